@@ -0,0 +1,207 @@
+#include "precomp.h"
+
+void AliasTable::Build( const float* weights, int count )
+{
+	slots.resize( count );
+	for ( int i = 0; i < count; i++ ) slots[i] = { 1.0f, i };
+
+	double sum = 0.0;
+	for ( int i = 0; i < count; i++ ) sum += weights[i];
+	total = (float)sum;
+	if ( sum <= 0.0 ) return; // nothing to prefer, uniform
+
+	// the slots that are short of their share are filled up by the ones with more than that; the indices without
+	// weight go last, so they are filled first and rounding never leaves one of them with a slot of its own
+	std::vector<double> scaled( count );
+	std::vector<int> small, large;
+	for ( int i = 0; i < count; i++ )
+	{
+		scaled[i] = weights[i] * count / sum;
+		if ( scaled[i] >= 1.0 ) large.push_back( i );
+		else if ( weights[i] > 0.0f ) small.push_back( i );
+	}
+	for ( int i = 0; i < count; i++ )
+		if ( weights[i] <= 0.0f ) small.push_back( i );
+
+	while ( !small.empty() && !large.empty() )
+	{
+		int less = small.back(), more = large.back();
+		small.pop_back();
+		slots[less] = { (float)scaled[less], more };
+		scaled[more] += scaled[less] - 1.0;
+		if ( scaled[more] < 1.0 )
+		{
+			large.pop_back();
+			small.push_back( more );
+		}
+	}
+	// what is left is about 1 up to rounding, and keeps its own slot
+}
+
+bool ApertureShape::LoadSprite( const char* fileName )
+{
+	std::vector<float> pixels;
+	int width, height;
+	if ( !ImageIO::read_exr_gray( fileName, &pixels, &width, &height ) ) return false;
+
+	// nearest pixel, sprites are usually made at this size
+	std::vector<float> transmission( APERTURE_SPRITE_SIZE * APERTURE_SPRITE_SIZE );
+	for ( int row = 0; row < APERTURE_SPRITE_SIZE; row++ )
+		for ( int column = 0; column < APERTURE_SPRITE_SIZE; column++ )
+			transmission[row * APERTURE_SPRITE_SIZE + column] = pixels[row * height / APERTURE_SPRITE_SIZE * width + column * width / APERTURE_SPRITE_SIZE];
+	SetSprite( transmission.data() );
+	return true;
+}
+
+void ApertureShape::SetSprite( const float* transmission )
+{
+	Timer timer;
+	const int N = APERTURE_SPRITE_SIZE;
+
+	// a pixel covers part of the ring between the radii of its row, the area grows with the radius
+	std::vector<float> weights( N * N );
+	double sum = 0.0;
+	for ( int i = 0; i < N * N; i++ )
+	{
+		weights[i] = transmission[i] * (float)( 2 * ( i / N ) + 1 );
+		sum += weights[i];
+	}
+	if ( sum <= 0.0 )
+	{
+		std::cout << "WARNING: the aperture sprite is black, keeping the round aperture" << std::endl;
+		SetRound();
+		return;
+	}
+	pixels.Build( weights.data(), N * N );
+
+	// the mean over the pupil, the rings weigh 2 * row + 1 out of N^2
+	float mean = (float)( sum / ( (double)N * N * N ) );
+	sprite.resize( N * N );
+	for ( int i = 0; i < N * N; i++ ) sprite[i] = transmission[i] / mean;
+
+	type = APERTURE_SPRITE;
+	time = timer.elapsed();
+}
+
+void ApertureShape::SetBlades( int blades, float rotation )
+{
+	if ( blades < 3 )
+	{
+		SetRound();
+		return;
+	}
+	type = APERTURE_BLADES;
+	this->blades = blades;
+	this->rotation = rotation;
+	apothem = cosf( PI / blades );
+	halfTangent = tanf( PI / blades );
+}
+
+//
+// Arc tangent of t >= 0, reduced to [-tan( pi / 8 ), tan( pi / 8 )] as in Cephes atanf, whose minimax polynomial it
+// uses: absolute error about 1E-7, for float and floatv alike.
+//
+template <class T> static T ArcTangentPolynomial( const T& x )
+{
+	T z = x * x;
+	return ( ( ( ( z * 8.05374449538E-2f - 1.38776856032E-1f ) * z + 1.99777106478E-1f ) * z - 3.33329491539E-1f ) * z ) * x + x;
+}
+
+static float ArcTangent( float t )
+{
+	if ( t > 2.414213562f ) return 0.5f * PI + ArcTangentPolynomial( -1.0f / t );
+	if ( t > 0.414213562f ) return 0.25f * PI + ArcTangentPolynomial( ( t - 1.0f ) / ( t + 1.0f ) );
+	return ArcTangentPolynomial( t );
+}
+
+static floatv ArcTangent( const floatv& t )
+{
+	maskv far = t > 2.414213562f, middle = t > 0.414213562f;
+	floatv x = floatv::select( far, -1.0f / t, floatv::select( middle, ( t - 1.0f ) / ( t + 1.0f ), t ) );
+	return floatv::select( far, 0.5f * PI, floatv::select( middle, 0.25f * PI, 0.0f ) ) + ArcTangentPolynomial( x );
+}
+
+//
+// Blades: a triangle between the center and one side of the polygon, all of the same area, then a point in it in polar
+// coordinates. Uniform over the triangle, the angle from the middle of the side has a tangent uniform in
+// [-halfTangent, halfTangent], and the squared radius is uniform up to the side, apothem^2 ( 1 + tangent^2 ), so the
+// only transcendental left is the arc tangent of the angle, over at most [-sqrt( 3 ), sqrt( 3 )] for three blades.
+// Sprite: a pixel, in one lookup of the alias table, and a point in it, uniform over its area.
+//
+void ApertureShape::Sample( float2 u, float* theta, float* rho ) const
+{
+	if ( type == APERTURE_BLADES )
+	{
+		float x = u.x * blades;
+		int side = std::min( (int)x, blades - 1 );
+		float tangent = ( 2.0f * ( x - side ) - 1.0f ) * halfTangent;
+		float angle = ArcTangent( fabsf( tangent ) );
+		*theta = rotation + ( side + 0.5f ) / blades + copysignf( angle, tangent ) * ( 0.5f / PI );
+		*theta -= floorf( *theta );
+		*rho = apothem * sqrtf( ( 1.0f + tangent * tangent ) * u.y );
+	}
+	else if ( type == APERTURE_SPRITE )
+	{
+		float w = u.x;
+		int pixel = pixels.Sample( &w );
+		int row = pixel / APERTURE_SPRITE_SIZE, column = pixel % APERTURE_SPRITE_SIZE;
+		*theta = ( column + w ) * ( 1.0f / APERTURE_SPRITE_SIZE );
+		*rho = sqrtf( ( row * row + u.y * ( 2 * row + 1 ) ) ) * ( 1.0f / APERTURE_SPRITE_SIZE );
+	}
+	else
+	{
+		*theta = u.x;
+		*rho = sqrtf( u.y );
+	}
+}
+
+//
+// The blades and the round aperture lane parallel; the alias tables of a sprite are lane by lane, they are lookups.
+//
+void ApertureShape::Sample( const floatv& ux, const floatv& uy, floatv* theta, floatv* rho ) const
+{
+	if ( type == APERTURE_BLADES )
+	{
+		floatv x = ux * (float)blades;
+		floatv side = floatv::min( floatv::floor( x ), (float)( blades - 1 ) );
+		floatv tangent = ( ( x - side ) * 2.0f - 1.0f ) * halfTangent;
+		maskv negative = tangent < 0.0f;
+		floatv angle = ArcTangent( floatv::select( negative, -tangent, tangent ) );
+		floatv turns = ( side + 0.5f ) * ( 1.0f / blades ) + rotation + floatv::select( negative, -angle, angle ) * ( 0.5f / PI );
+		*rho = floatv::sqrt( ( tangent * tangent + 1.0f ) * uy ) * apothem;
+		*theta = turns - floatv::floor( turns );
+	}
+	else if ( type == APERTURE_SPRITE )
+	{
+		for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+		{
+			float laneTheta, laneRho;
+			Sample( float2( ux[lane], uy[lane] ), &laneTheta, &laneRho );
+			( *theta )[lane] = laneTheta, ( *rho )[lane] = laneRho;
+		}
+	}
+	else
+	{
+		*rho = floatv::sqrt( uy );
+		*theta = ux;
+	}
+}
+
+float ApertureShape::Transmission( float theta, float rho ) const
+{
+	if ( rho >= 1.0f ) return 0.0f;
+	if ( type == APERTURE_BLADES )
+	{
+		// inside when within the apothem of the side the angle faces
+		float sides = ( theta - rotation ) * blades;
+		float offset = ( sides - floorf( sides ) - 0.5f ) * 2.0f * PI / blades; // from the middle of the side
+		float area = 0.5f * blades * sinf( 2.0f * PI / blades );
+		return rho * cosf( offset ) <= cosf( PI / blades ) ? PI / area : 0.0f;
+	}
+	if ( type == APERTURE_SPRITE )
+	{
+		int row = (int)( rho * APERTURE_SPRITE_SIZE ), column = std::min( (int)( theta * APERTURE_SPRITE_SIZE ), APERTURE_SPRITE_SIZE - 1 );
+		return sprite[row * APERTURE_SPRITE_SIZE + column];
+	}
+	return 1.0f;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+//
+// Draws indices in proportion to their weights in constant time (Walker's alias method, built with Vose's algorithm):
+// every index owns a slot, which it shares with at most one other index, its alias.
+//
+class AliasTable
+{
+  public:
+	void Build( const float* weights, int count );
+
+	// an index drawn from u in [0, 1), which returns the part of u left over, again uniform in [0, 1)
+	int Sample( float* u ) const
+	{
+		float x = *u * slots.size();
+		int index = std::min( (int)x, (int)slots.size() - 1 );
+		float t = x - index, p = slots[index].probability;
+		if ( t < p )
+		{
+			*u = t / p;
+			return index;
+		}
+		*u = std::min( ( t - p ) / ( 1.0f - p ), 0.99999994f );
+		return slots[index].alias;
+	}
+
+	float total = 0.0f; // of the weights
+
+  private:
+	struct Slot
+	{
+		float probability; // to keep its own index
+		int alias;
+	};
+	std::vector<Slot> slots;
+};
+
+enum ApertureType
+{
+	APERTURE_ROUND,	 // the whole pupil
+	APERTURE_BLADES, // a regular polygon inscribed in the pupil
+	APERTURE_SPRITE	 // a polar sprite of the transmission
+};
+
+//
+// The shape of the aperture stop, which DOF::Apply and DOF::ApplyBatch draw their pupil samples from with
+// USE_APERTURE_SPRITE. The samples are drawn in proportion to the transmission, so every sample weighs the same and dark
+// parts of a sprite take no samples; a shape spreads the light of the round aperture differently, it keeps its exposure.
+//
+// A sprite is APERTURE_SPRITE_SIZE x APERTURE_SPRITE_SIZE pixels in polar coordinates: a row per radius, from the center
+// to the edge of the pupil, and a column per angle, in turns. Its pixels are drawn from a single alias table.
+//
+class ApertureShape
+{
+  public:
+	// reads a sprite from an EXR file (see ImageIO::read_exr_gray), returns false when there is none
+	bool LoadSprite( const char* fileName );
+	void SetSprite( const float* transmission ); // APERTURE_SPRITE_SIZE^2, row by row
+	void SetBlades( int blades, float rotation = 0.0f ); // rotation in turns
+	void SetRound() { type = APERTURE_ROUND; }
+	bool Round() const { return type == APERTURE_ROUND; }
+
+	// a point drawn from the shape, from a sample in [0, 1)^2, as the _theta and _rho of DOF::Apply
+	void Sample( float2 u, float* theta, float* rho ) const;
+	// the same for a batch, as the _theta and _rho of DOF::ApplyBatch; theta and rho may be ux and uy
+	void Sample( const floatv& ux, const floatv& uy, floatv* theta, floatv* rho ) const;
+
+	// at a point of the pupil, relative to the mean over the pupil: what a uniform sample would weigh
+	float Transmission( float theta, float rho ) const;
+
+	ApertureType type = APERTURE_ROUND;
+	int blades = 0;
+	float rotation = 0.0f;
+	float time = 0.0f; // of building the alias tables of the last sprite, in s
+
+  private:
+	float apothem = 1.0f, halfTangent = 0.0f; // of the blades: the distance of a side from the center, and the tangent of half the angle it spans
+	std::vector<float> sprite; // relative to the mean over the pupil
+	AliasTable pixels; // of the sprite, row by row
+};
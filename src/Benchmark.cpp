@@ -0,0 +1,2002 @@
+#include "precomp.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+//
+// A hardware event counter for the calling process (all threads), through perf_event_open on Linux. Valid() is false
+// when the kernel or the sandbox doesn't allow it, or on other platforms.
+//
+class PerfCounter
+{
+  public:
+	PerfCounter( uint type, uint64 config )
+	{
+#ifdef __linux__
+		perf_event_attr attr = {};
+		attr.size = sizeof( attr );
+		attr.type = type;
+		attr.config = config;
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.inherit = 1; // count the OpenMP threads as well
+		fd = (int)syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 );
+#endif
+	}
+	~PerfCounter()
+	{
+#ifdef __linux__
+		if ( fd >= 0 ) close( fd );
+#endif
+	}
+
+	bool Valid() const { return fd >= 0; }
+
+	void Start()
+	{
+#ifdef __linux__
+		if ( fd < 0 ) return;
+		ioctl( fd, PERF_EVENT_IOC_RESET, 0 );
+		ioctl( fd, PERF_EVENT_IOC_ENABLE, 0 );
+#endif
+	}
+
+	uint64 Stop()
+	{
+		uint64 count = 0;
+#ifdef __linux__
+		if ( fd < 0 ) return 0;
+		ioctl( fd, PERF_EVENT_IOC_DISABLE, 0 );
+		if ( read( fd, &count, sizeof( count ) ) != sizeof( count ) ) count = 0;
+#endif
+		return count;
+	}
+
+  private:
+	int fd = -1;
+};
+
+int Benchmark::failures = 0;
+
+//
+// Runs one benchmark by name, or all of them when name is "all". The benchmarks also check what the code they measure
+// claims, see Check; returns how many of those checks failed, an unknown name counts as one.
+//
+int Benchmark::Run( const char* name )
+{
+	failures = 0;
+	bool all = strcmp( name, "all" ) == 0;
+	bool found = false;
+
+	if ( all || strcmp( name, "scaling" ) == 0 ) Scaling(), found = true;
+	if ( all || strcmp( name, "seidel" ) == 0 ) SeidelKernel(), found = true;
+	if ( all || strcmp( name, "ssrt" ) == 0 ) SSRTKernel(), found = true;
+	if ( all || strcmp( name, "import" ) == 0 ) Import(), found = true;
+	if ( all || strcmp( name, "agf" ) == 0 ) AGFCatalog(), found = true;
+	if ( all || strcmp( name, "precalc" ) == 0 ) Precalc(), found = true;
+	if ( all || strcmp( name, "lenscache" ) == 0 ) LensCache(), found = true;
+	if ( all || strcmp( name, "splat" ) == 0 ) Splat(), found = true;
+	if ( all || strcmp( name, "schedule" ) == 0 ) Schedule(), found = true;
+	if ( all || strcmp( name, "adaptive" ) == 0 ) Adaptive(), found = true;
+	if ( all || strcmp( name, "sampler" ) == 0 ) Sampling(), found = true;
+	if ( all || strcmp( name, "hero" ) == 0 ) HeroWavelengths(), found = true;
+	if ( all || strcmp( name, "setup" ) == 0 ) SampleCost(), found = true;
+	if ( all || strcmp( name, "lenstable" ) == 0 ) LensTable(), found = true;
+	if ( all || strcmp( name, "distances" ) == 0 ) Distances(), found = true;
+	if ( all || strcmp( name, "scrub" ) == 0 ) Scrub(), found = true;
+	if ( all || strcmp( name, "zoom" ) == 0 ) Zoom(), found = true;
+	if ( all || strcmp( name, "polynomial" ) == 0 ) Polynomial(), found = true;
+	if ( all || strcmp( name, "raytable" ) == 0 ) RayTransfer(), found = true;
+	if ( all || strcmp( name, "vignetting" ) == 0 ) Vignetting(), found = true;
+	if ( all || strcmp( name, "aperture" ) == 0 ) Aperture(), found = true;
+	if ( all || strcmp( name, "convolution" ) == 0 ) Convolution(), found = true;
+
+	if ( !found )
+	{
+		std::cout << "ERROR: unknown benchmark " << name << ", choose from: all, scaling, seidel, ssrt, import, agf, precalc, lenscache, splat, schedule, adaptive, sampler, hero, setup, lenstable, distances, scrub, zoom, polynomial, raytable, vignetting, aperture, convolution" << std::endl;
+		return 1;
+	}
+	if ( failures > 0 ) std::cout << std::endl << "FAILED: " << failures << " check" << ( failures > 1 ? "s" : "" ) << ", see FAIL above" << std::endl;
+	return failures;
+}
+
+//
+// A claim a benchmark checks, rather than only printing the numbers it rests on: prints FAIL and counts it when it
+// doesn't hold
+//
+bool Benchmark::Check( bool passed, const std::string& claim )
+{
+	if ( !passed )
+	{
+		std::cout << "FAIL: " << claim << std::endl;
+		failures++;
+	}
+	return passed;
+}
+
+//
+// Fills an SCRWIDTH x SCRHEIGHT RGBA image (depth in alpha) resembling a night time city plate: a dark background receding
+// into the distance with lots of small, very bright highlights at varying depths, which is the worst case for the splatting.
+// With a focus distance everything below the top quarter is put at that distance, a mostly in focus plate.
+//
+void Benchmark::GenerateScene( float* rgbaImage, float focusDistance )
+{
+	uint state = 0x2545F491;
+	auto rnd = [&state]() { state ^= state << 13, state ^= state >> 17, state ^= state << 5; return state * 2.3283064365387e-10f; };
+
+	for ( int y = 0; y < SCRHEIGHT; y++ )
+	{
+		float v = (float)y / SCRHEIGHT;
+		for ( int x = 0; x < SCRWIDTH; x++ )
+		{
+			float* pixel = &rgbaImage[( y * SCRWIDTH + x ) * 4];
+			pixel[0] = 0.02f + 0.03f * v;
+			pixel[1] = 0.02f + 0.02f * v;
+			pixel[2] = 0.04f;
+			pixel[3] = 0.3f + 14.0f * ( 1.0f - v ) * ( 1.0f - v ); // far away at the top, close by at the bottom
+			if ( focusDistance > 0 && v > 0.25f ) pixel[3] = focusDistance;
+		}
+	}
+
+	for ( int light = 0; light < 4000; light++ )
+	{
+		int x = (int)( rnd() * SCRWIDTH );
+		int y = (int)( rnd() * SCRHEIGHT );
+		float brightness = 10.0f + 200.0f * rnd() * rnd();
+		float3 color = float3( 1.0f, 0.6f + 0.4f * rnd(), 0.3f + 0.7f * rnd() ) * brightness;
+
+		float* pixel = &rgbaImage[( y * SCRWIDTH + x ) * 4];
+		pixel[0] = color.x;
+		pixel[1] = color.y;
+		pixel[2] = color.z;
+	}
+}
+
+//
+// FNV-1a hash of the accumulator, to check that renders are reproducible
+//
+uint Benchmark::Checksum( const float4* accumulator )
+{
+	const byte* data = (const byte*)accumulator;
+	uint hash = 2166136261u;
+	for ( size_t i = 0; i < SCRWIDTH * SCRHEIGHT * sizeof( float4 ); i++ )
+		hash = ( hash ^ data[i] ) * 16777619u;
+	return hash;
+}
+
+//
+// The application most benchmarks render with: the night plate (see GenerateScene) through a lens focused at 0.6m,
+// 250000 samples per frame, ready to render
+//
+std::unique_ptr<Application> Benchmark::NightPlate( const float* rgbaImage, const char* lensFile )
+{
+	std::unique_ptr<Application> app = std::make_unique<Application>();
+	app->focus = 0.6f;
+	app->samplesPerFrame = 250000;
+	app->LoadLens( lensFile );
+	app->LoadImage( rgbaImage );
+	app->PrepareSampling();
+	return app;
+}
+
+//
+// All lens designs in assets/lensdesigns, sorted by name
+//
+std::vector<std::string> Benchmark::LensFiles()
+{
+	std::vector<std::string> files;
+	for ( const auto& entry : std::filesystem::directory_iterator( "assets/lensdesigns" ) )
+		files.push_back( entry.path().string() );
+	std::sort( files.begin(), files.end() );
+	return files;
+}
+
+//
+// Renders the same workload with an increasing number of threads, with direct scatter and with binned splatting, and
+// reports the speedup relative to a single thread
+//
+void Benchmark::Scaling()
+{
+	std::cout << std::endl << "=== Benchmark: thread scaling ===" << std::endl;
+
+	std::vector<float> scene( SCRWIDTH * SCRHEIGHT * 4 );
+	GenerateScene( scene.data() );
+
+	std::unique_ptr<Application> app = NightPlate( scene.data() );
+
+	int maxThreads = omp_get_num_procs();
+	int frames = std::max( 8, 2 * maxThreads ); // enough frames to keep every thread busy
+
+	std::vector<int> threadCounts;
+	for ( int threads = 1; threads < maxThreads; threads *= 2 ) threadCounts.push_back( threads );
+	threadCounts.push_back( maxThreads );
+
+	for ( int binned = 0; binned < 2; binned++ )
+	{
+		app->binnedSplat = binned != 0;
+		float singleThreadTime = 0.0f;
+		uint singleThreadChecksum = 0;
+		for ( int threads : threadCounts )
+		{
+			omp_set_num_threads( threads );
+			app->ClearAccumulator();
+			float time = app->Render( frames );
+			uint checksum = Checksum( app->GetAccumulator() );
+			if ( threads == 1 ) singleThreadTime = time, singleThreadChecksum = checksum;
+
+			float speedup = singleThreadTime / time;
+			std::cout << ( binned ? "binned: " : "direct: " ) << threads << " threads: " << time << "s, " << ( app->totalSamplesTaken / time * 1E-6f ) << "M samples/s, speedup " << speedup << "x, efficiency " << ( 100.0f * speedup / threads ) << "%, checksum " << std::hex << checksum << std::dec << std::endl;
+			Check( checksum == singleThreadChecksum, std::string( binned ? "binned" : "direct" ) + " render on " + std::to_string( threads ) + " threads has the checksum of one thread" );
+		}
+	}
+
+	omp_set_num_threads( maxThreads );
+}
+
+//
+// Direct scatter into per-thread fixed point accumulators vs binned splatting through SplatBins: render time, samples per second,
+// cache misses (when perf events are available), and the checksum on one and on all threads
+//
+void Benchmark::Splat()
+{
+	std::cout << std::endl << "=== Benchmark: direct scatter vs tile binned splatting ===" << std::endl;
+
+	std::vector<float> scene( SCRWIDTH * SCRHEIGHT * 4 );
+	GenerateScene( scene.data() );
+
+	std::unique_ptr<Application> app = NightPlate( scene.data() );
+
+	int maxThreads = std::max( 4, omp_get_num_procs() ); // at least 4, so the thread count independence is visible on small machines
+	int frames = 8;
+
+#ifdef __linux__
+	PerfCounter l1Misses( PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ) );
+	PerfCounter llcMisses( PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES );
+#else
+	PerfCounter l1Misses( 0, 0 ), llcMisses( 0, 0 );
+#endif
+	if ( !l1Misses.Valid() && !llcMisses.Valid() ) std::cout << "(cache miss counters are not available here)" << std::endl;
+
+	for ( int binned = 0; binned < 2; binned++ )
+	{
+		app->binnedSplat = binned != 0;
+		uint singleThreadChecksum = 0;
+		for ( int threads : { 1, maxThreads } )
+		{
+			omp_set_num_threads( threads );
+			app->ClearAccumulator();
+
+			l1Misses.Start();
+			llcMisses.Start();
+			float time = app->Render( frames );
+			uint64 l1 = l1Misses.Stop(), llc = llcMisses.Stop();
+
+			std::cout << ( binned ? "binned: " : "direct: " ) << threads << " threads: " << time << "s, " << ( app->totalSamplesTaken / time * 1E-6f ) << "M samples/s";
+			if ( l1Misses.Valid() ) std::cout << ", " << ( (float)l1 / app->totalSamplesTaken ) << " L1D misses/sample";
+			if ( llcMisses.Valid() ) std::cout << ", " << ( (float)llc / app->totalSamplesTaken ) << " LLC misses/sample";
+			uint checksum = Checksum( app->GetAccumulator() );
+			std::cout << ", checksum " << std::hex << checksum << std::dec << std::endl;
+			if ( threads == 1 ) singleThreadChecksum = checksum;
+			Check( checksum == singleThreadChecksum, std::string( binned ? "binned" : "direct" ) + " render on " + std::to_string( threads ) + " threads has the checksum of one thread" );
+		}
+	}
+
+	omp_set_num_threads( omp_get_num_procs() );
+}
+
+//
+// Binned rendering with the work units handed out by omp dynamic vs the work stealing TaskScheduler, with the time
+// every thread spent rendering units, the imbalance (slowest thread over the mean) and the number of steals
+//
+void Benchmark::Schedule()
+{
+	std::cout << std::endl << "=== Benchmark: omp dynamic vs work stealing over cost balanced work units ===" << std::endl;
+
+	std::vector<float> scene( SCRWIDTH * SCRHEIGHT * 4 );
+	GenerateScene( scene.data() );
+
+	std::unique_ptr<Application> app = NightPlate( scene.data() );
+
+	int maxThreads = std::max( 4, omp_get_num_procs() );
+	int frames = 8;
+
+	uint firstChecksum = 0;
+	for ( int stealing = 0; stealing < 2; stealing++ )
+	{
+		app->workStealing = stealing != 0;
+		for ( int threads : { 1, maxThreads } )
+		{
+			omp_set_num_threads( threads );
+			app->ClearAccumulator();
+			float time = app->Render( frames );
+
+			const std::vector<ThreadStats>& stats = app->GetThreadStats();
+			float maxBusy = 0, totalBusy = 0;
+			int steals = 0;
+			for ( const ThreadStats& thread : stats )
+				maxBusy = std::max( maxBusy, thread.busy ), totalBusy += thread.busy, steals += thread.steals;
+
+			std::cout << ( stealing ? "work stealing: " : "omp dynamic:   " ) << threads << " threads: " << time << "s, " << ( app->totalSamplesTaken / time * 1E-6f ) << "M samples/s, ";
+			uint checksum = Checksum( app->GetAccumulator() );
+			std::cout << "imbalance " << ( maxBusy / ( totalBusy / stats.size() ) ) << ", " << steals << " steals, checksum " << std::hex << checksum << std::dec << std::endl;
+			if ( !stealing && threads == 1 ) firstChecksum = checksum;
+			Check( checksum == firstChecksum, std::string( stealing ? "work stealing" : "omp dynamic" ) + " on " + std::to_string( threads ) + " threads has the checksum of omp dynamic on one thread" );
+			std::cout << "    busy:";
+			for ( const ThreadStats& thread : stats ) std::cout << " " << thread.busy << "s/" << thread.tasks;
+			std::cout << std::endl;
+		}
+	}
+
+	omp_set_num_threads( omp_get_num_procs() );
+}
+
+//
+// Fixed vs adaptive sampling on a mostly in focus plate, both until every tile has converged (or 128 frames): render
+// time, frames, samples, and how far the mean luminance of the adaptive render is off the fixed one. The fixed render
+// takes a frame at a time, which doesn't change the result.
+//
+void Benchmark::Adaptive()
+{
+	std::cout << std::endl << "=== Benchmark: fixed vs adaptive sampling to the same noise threshold, mostly in focus plate ===" << std::endl;
+
+	std::vector<float> scene( SCRWIDTH * SCRHEIGHT * 4 );
+	GenerateScene( scene.data(), 0.6f );
+
+	std::unique_ptr<Application> app = NightPlate( scene.data() );
+
+	// the mean luminance of the image, the adaptive render should keep that of the fixed one
+	auto meanLuminance = [&]() {
+		double sum = 0;
+		for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ ) sum += HelperFunctions::Luminance( app->GetAccumulator()[n].rgb );
+		return sum / app->GetFrameCount();
+	};
+
+	int maxFrames = 128;
+	for ( float threshold : { 0.4f, 0.3f } )
+	{
+		app->noiseThreshold = threshold;
+		double fixedLuminance = 0;
+		for ( int adaptive = 0; adaptive < 2; adaptive++ )
+		{
+			app->adaptive = adaptive != 0;
+			app->ClearAccumulator();
+			float time = 0;
+			if ( adaptive )
+				time = app->Render( maxFrames );
+			else
+				while ( app->ConvergedTiles() < SPLAT_TILES && app->GetFrameCount() < maxFrames ) time += app->Render( 1 );
+
+			std::cout << "threshold " << threshold << ( adaptive ? ", adaptive: " : ", fixed:    " ) << app->GetFrameCount() << " frames, " << time << "s, ";
+			std::cout << app->totalSamplesTaken << " samples, " << app->ConvergedTiles() << "/" << SPLAT_TILES << " tiles converged";
+			if ( adaptive )
+				std::cout << ", mean luminance " << ( ( meanLuminance() / fixedLuminance - 1.0 ) * 100.0 ) << "% off the fixed render";
+			else
+				fixedLuminance = meanLuminance();
+			std::cout << std::endl;
+		}
+	}
+
+	app->adaptive = false;
+}
+
+//
+// Renders the current settings of app twice with a different seed, the difference between the two gives the error
+// without a reference image: the relative RMS error of the luminance per pixel, and of the mean luminance of 8x8 pixel
+// blocks, which is the noise that remains visible from a distance. The chroma error is the same for the opponent
+// colors r - g and g - b, relative to the mean luminance as well. The time is that of one render.
+//
+Benchmark::Noise Benchmark::MeasureNoise( Application* app, int frames )
+{
+	const int block = 8, blocksX = SCRWIDTH / block, blocksY = SCRHEIGHT / block;
+	const int pixels = blocksX * blocksY * block * block;
+	int seed = Random::seed;
+
+	Noise noise;
+	std::vector<float3> renders[2]; // luminance and the opponent colors of every pixel
+	for ( int render = 0; render < 2; render++ )
+	{
+		Random::seed = seed + render;
+		app->ClearAccumulator();
+		noise.time += app->Render( frames ) / 2;
+		renders[render].resize( SCRWIDTH * SCRHEIGHT );
+		for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
+		{
+			float3 color = app->GetAccumulator()[n].rgb;
+			renders[render][n] = float3( HelperFunctions::Luminance( color ), color.x - color.y, color.y - color.z );
+		}
+	}
+	Random::seed = seed;
+
+	double mean = 0, pixelDifference[2] = {}, blockDifference[2] = {};
+	std::vector<float3> blockSums( blocksX * blocksY, float3( 0, 0, 0 ) );
+	for ( int y = 0; y < blocksY * block; y++ )
+		for ( int x = 0; x < blocksX * block; x++ )
+		{
+			float3 a = renders[0][y * SCRWIDTH + x], b = renders[1][y * SCRWIDTH + x], d = a - b;
+			mean += ( a.x + b.x ) / 2;
+			pixelDifference[0] += d.x * d.x;
+			pixelDifference[1] += d.y * d.y + d.z * d.z;
+			blockSums[( y / block ) * blocksX + x / block] += d;
+		}
+	for ( const float3& d : blockSums )
+	{
+		blockDifference[0] += d.x * d.x / ( block * block * block * block );
+		blockDifference[1] += ( d.y * d.y + d.z * d.z ) / ( block * block * block * block );
+	}
+	mean /= pixels;
+
+	// the difference of two independent renders has twice the variance of one
+	noise.pixelError = (float)( sqrt( pixelDifference[0] / pixels / 2 ) / mean );
+	noise.blockError = (float)( sqrt( blockDifference[0] / ( blocksX * blocksY ) / 2 ) / mean );
+	noise.pixelChroma = (float)( sqrt( pixelDifference[1] / pixels / 2 ) / mean );
+	noise.blockChroma = (float)( sqrt( blockDifference[1] / ( blocksX * blocksY ) / 2 ) / mean );
+	return noise;
+}
+
+//
+// Random vs Owen scrambled Sobol sampling on every lens in assets/lensdesigns, with the error from MeasureNoise. From
+// the block error and the render time follows how much longer the random sampler has to render for the noise of the
+// Sobol sampler, with the error going down with the square root of the time.
+//
+void Benchmark::Sampling()
+{
+	std::cout << std::endl << "=== Benchmark: random vs Sobol sampling, error at equal time ===" << std::endl;
+
+	// the known answer vectors of Philox4x32-10 that come with Random123: counter, key, result
+	static const uint known[3][10] = {
+		{ 0, 0, 0, 0, 0, 0, 0x6627E8D5, 0xE169C58D, 0xBC57AC4C, 0x9B00DBD8 },
+		{ 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x408F276D, 0x41C83B0E, 0xA20BC7C6, 0x6D5451FD },
+		{ 0x243F6A88, 0x85A308D3, 0x13198A2E, 0x03707344, 0xA4093822, 0x299F31D0, 0xD16CFE09, 0x94FDCCEB, 0x5001E420, 0x24126EA1 } };
+	for ( const uint* vector : known )
+	{
+		uint counter[4] = { vector[0], vector[1], vector[2], vector[3] };
+		Random::Philox( counter, vector[4], vector[5] );
+		std::ostringstream claim;
+		claim << "Philox4x32-10 of counter " << std::hex << vector[0] << " " << vector[1] << " " << vector[2] << " " << vector[3] << ", key " << vector[4] << " "
+			  << vector[5] << " is " << vector[6] << " " << vector[7] << " " << vector[8] << " " << vector[9] << ", got " << counter[0] << " " << counter[1] << " "
+			  << counter[2] << " " << counter[3];
+		Check( memcmp( counter, vector + 6, sizeof( counter ) ) == 0, claim.str() );
+	}
+	std::cout << "Philox4x32-10 known answers checked" << std::endl;
+
+	std::vector<float> scene( SCRWIDTH * SCRHEIGHT * 4 );
+	GenerateScene( scene.data() );
+
+	double totalGain = 0;
+	int lenses = 0;
+	for ( const std::string& file : LensFiles() )
+	{
+		std::unique_ptr<Application> app = NightPlate( scene.data(), file.c_str() );
+
+		Noise noise[2];
+		for ( SamplerType sampler : { SAMPLER_RANDOM, SAMPLER_SOBOL } )
+		{
+			app->sampler = sampler;
+			noise[sampler] = MeasureNoise( app.get(), 4 );
+		}
+
+		const Noise &random = noise[SAMPLER_RANDOM], &sobol = noise[SAMPLER_SOBOL];
+		if ( !( random.blockError > 0 ) || !( sobol.blockError > 0 ) )
+		{
+			std::cout << std::filesystem::path( file ).filename().string() << ": nothing rendered" << std::endl;
+			continue;
+		}
+
+		float gain = ( random.blockError * random.blockError * random.time ) / ( sobol.blockError * sobol.blockError * sobol.time );
+		std::cout << std::filesystem::path( file ).filename().string() << ": random " << random.time << "s, error " << random.pixelError << " per pixel, " << random.blockError << " per block";
+		std::cout << "; sobol " << sobol.time << "s, error " << sobol.pixelError << " per pixel, " << sobol.blockError << " per block; random needs " << gain << "x the time" << std::endl;
+		totalGain += log( gain );
+		lenses++;
+	}
+	std::cout << "geometric mean: random needs " << exp( totalGain / lenses ) << "x the time" << std::endl;
+}
+
+//
+// One wavelength per pupil sample vs HERO_WAVELENGTHS on every lens in assets/lensdesigns, at the same number of
+// wavelength samples per frame (so about equal time), with the error from MeasureNoise. Hero wavelengths trade pupil
+// samples for wavelengths, the chroma noise should drop a lot more than the luminance noise rises.
+//
+void Benchmark::HeroWavelengths()
+{
+#ifndef ENABLE_CHROMATICS
+	std::cout << std::endl << "hero wavelengths: ENABLE_CHROMATICS is off, skipped" << std::endl;
+	return;
+#endif
+	std::cout << std::endl << "=== Benchmark: 1 vs " << HERO_WAVELENGTHS << " hero wavelengths per pupil sample, error at equal samples ===" << std::endl;
+
+	std::vector<float> scene( SCRWIDTH * SCRHEIGHT * 4 );
+	GenerateScene( scene.data() );
+
+	double totalChromaGain = 0, totalLuminanceGain = 0;
+	int lenses = 0;
+	for ( const std::string& file : LensFiles() )
+	{
+		std::unique_ptr<Application> app = NightPlate( scene.data(), file.c_str() );
+
+		Noise single, hero;
+		app->heroWavelengths = 1;
+		app->PrepareSampling();
+		single = MeasureNoise( app.get(), 4 );
+		app->heroWavelengths = HERO_WAVELENGTHS;
+		app->PrepareSampling();
+		hero = MeasureNoise( app.get(), 4 );
+
+		if ( !( single.blockError > 0 ) || !( hero.blockError > 0 ) )
+		{
+			std::cout << std::filesystem::path( file ).filename().string() << ": nothing rendered" << std::endl;
+			continue;
+		}
+
+		// how much longer one wavelength per sample has to render for the noise of hero wavelengths
+		float chromaGain = ( single.pixelChroma * single.pixelChroma * single.time ) / ( hero.pixelChroma * hero.pixelChroma * hero.time );
+		float luminanceGain = ( single.pixelError * single.pixelError * single.time ) / ( hero.pixelError * hero.pixelError * hero.time );
+		std::cout << std::filesystem::path( file ).filename().string() << ": single " << single.time << "s, chroma " << single.pixelChroma << " per pixel, " << single.blockChroma << " per block, luminance " << single.pixelError << " per pixel";
+		std::cout << "; hero " << hero.time << "s, chroma " << hero.pixelChroma << " per pixel, " << hero.blockChroma << " per block, luminance " << hero.pixelError << " per pixel";
+		std::cout << "; single needs " << chromaGain << "x the time for the chroma, " << luminanceGain << "x for the luminance" << std::endl;
+		totalChromaGain += log( chromaGain );
+		totalLuminanceGain += log( luminanceGain );
+		lenses++;
+	}
+	std::cout << "geometric mean: single needs " << exp( totalChromaGain / lenses ) << "x the time for the chroma, " << exp( totalLuminanceGain / lenses ) << "x for the luminance" << std::endl;
+}
+
+//
+// Cost per sample of DOF::Apply and DOF::ApplyBatch on the night plate, for every other pixel in both directions, with
+// the pixel setup done once per pixel (as Application::RenderPixel does) and done again for every sample, which is what
+// the sample loop paid before DOF::SetupPixel. Most pixels take one sample or none per frame, so both are measured with
+// one sample per pixel and with eight.
+//
+void Benchmark::SampleCost()
+{
+	std::cout << std::endl << "=== Benchmark: cost per sample, with the pixel setup hoisted out of the sample loop ===" << std::endl;
+
+	std::vector<float> scene( SCRWIDTH * SCRHEIGHT * 4 );
+	GenerateScene( scene.data() );
+	std::vector<float4> image( SCRWIDTH * SCRHEIGHT );
+	for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
+		image[n] = float4( scene[n * 4], scene[n * 4 + 1], scene[n * 4 + 2], scene[n * 4 + 3] );
+	std::vector<float4> accumulator( SCRWIDTH * SCRHEIGHT, float4( 0, 0, 0, 0 ) );
+	SplatTarget target( accumulator.data() );
+
+	LensSystem* ls = new LensSystem();
+	ls->FOCUS = 0.6f;
+	ls->ImportFile( "assets/lensdesigns/doublegauss.zmx" );
+
+	DOF* dof = new DOF();
+	dof->meanLensData = ls->GetLensData( 0.550f, ls->FOCUS );
+	dof->Prepare( ls );
+
+	for ( int samples : { 1, 8 } )
+	{
+		float total = (float)samples * ( SCRWIDTH / 2 ) * ( SCRHEIGHT / 2 );
+
+		Timer timer;
+		for ( int y = 0; y < SCRHEIGHT; y += 2 )
+			for ( int x = 0; x < SCRWIDTH; x += 2 )
+			{
+				PixelSetup setup = dof->SetupPixel( image.data(), x, y, ls );
+				for ( int sample = 0; sample < samples; sample++ )
+				{
+					Sampler sampler( dof->sampler, y * SCRWIDTH + x, 0, sample, samples );
+					dof->Apply( setup, &target, nullptr, x, y, ls, 1.0f / samples, false, &sampler );
+				}
+			}
+		float hoisted = timer.elapsed();
+
+		timer.reset();
+		for ( int y = 0; y < SCRHEIGHT; y += 2 )
+			for ( int x = 0; x < SCRWIDTH; x += 2 )
+				for ( int sample = 0; sample < samples; sample++ )
+				{
+					Sampler sampler( dof->sampler, y * SCRWIDTH + x, 0, sample, samples );
+					dof->Apply( dof->SetupPixel( image.data(), x, y, ls ), &target, nullptr, x, y, ls, 1.0f / samples, false, &sampler );
+				}
+		float perSample = timer.elapsed();
+
+		timer.reset();
+		for ( int y = 0; y < SCRHEIGHT; y += 2 )
+			for ( int x = 0; x < SCRWIDTH; x += 2 )
+				dof->ApplyBatch( dof->SetupPixel( image.data(), x, y, ls ), &target, x, y, ls, 1.0f / samples, 0, samples );
+		float batch = timer.elapsed();
+
+		std::cout << samples << " samples per pixel: Apply " << ( hoisted / total * 1E9f ) << "ns/sample, setup per sample " << ( perSample / total * 1E9f ) << "ns/sample";
+		std::cout << ", ApplyBatch " << ( batch / total * 1E9f ) << "ns/sample (" << dof->heroWavelengths << " wavelengths per sample)" << std::endl;
+	}
+
+	delete dof;
+	delete ls;
+}
+
+//
+// The lens data lookup of the SIMD batches: LensSystem::GetLensData per lane (bilinear over four LensData structs)
+// against the structure-of-arrays LensDataTable fetch, in float or, with LENS_TABLE_HALF, half precision. Reports the
+// speed, the largest difference per field relative to the range of that field, and what the difference does to the
+// sensor positions of ApplySeidelBatch.
+//
+void Benchmark::LensTable()
+{
+	std::cout << std::endl << "=== Benchmark: lens data lookup, per lane vs " <<
+#ifdef LENS_TABLE_HALF
+		"half"
+#else
+		"float"
+#endif
+		<< " structure-of-arrays table ===" << std::endl;
+
+	LensSystem* ls = new LensSystem();
+	ls->FOCUS = 0.6f;
+	ls->ImportFile( "assets/lensdesigns/doublegauss.zmx" );
+
+	DOF* dof = new DOF();
+	dof->meanLensData = ls->GetLensData( 0.550f, ls->FOCUS );
+	dof->Prepare( ls );
+
+	// like ApplyBatch, every batch holds the samples of one pixel: one depth, all wavelengths
+	const int count = 1 << 20;
+	std::vector<float> wavelength( count ), z( count ), Psx( count ), Psy( count ), _theta( count ), _rho( count );
+	for ( int i = 0; i < count; i++ )
+	{
+		RandomStream random( i, 0, 0 );
+		wavelength[i] = random.rnd() * 0.470f + 0.360f;
+		float depth = 0.3f + 15.0f * RandomStream( i / SIMD_WIDTH, 0, 1 ).rnd();
+		float FOVsize = SENSOR_SIZE * depth / ( ls->sensorPosition - dof->meanLensData.principalPlaneRear );
+		float2 Ps = float2( random.rnd() - 0.5f, ( random.rnd() - 0.5f ) * SCRHEIGHT / SCRWIDTH ) * FOVsize;
+		Psx[i] = Ps.x, Psy[i] = Ps.y;
+		z[i] = sqrtf( depth * depth - Ps.sqrLength() );
+		_theta[i] = random.rnd();
+		_rho[i] = sqrtf( random.rnd() );
+	}
+	auto load = [&]( SampleBatch* batch, int first ) {
+		for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+		{
+			batch->wavelength[lane] = wavelength[first + lane], batch->z[lane] = z[first + lane];
+			batch->Psx[lane] = Psx[first + lane], batch->Psy[lane] = Psy[first + lane];
+			batch->_theta[lane] = _theta[first + lane], batch->_rho[lane] = _rho[first + lane];
+		}
+	};
+
+	SampleBatch perLane, table;
+	floatv sum = 0.0f; // keeps the lookups alive
+	Timer timer;
+	for ( int first = 0; first < count; first += SIMD_WIDTH )
+	{
+		load( &perLane, first );
+		for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+			perLane.SetLensData( lane, ls->GetLensData( perLane.wavelength[lane], perLane.z[lane] ) );
+		sum += perLane.B + perLane.exitPupil;
+	}
+	float perLaneTime = timer.elapsed();
+
+	timer.reset();
+	for ( int first = 0; first < count; first += SIMD_WIDTH )
+	{
+		load( &table, first );
+		table.FetchLensData( ls->lensTable );
+		sum += table.B + table.exitPupil;
+	}
+	float tableTime = timer.elapsed();
+
+	struct
+	{
+		const char* name;
+		floatv SampleBatch::*member;
+		float low = 1E30f, high = -1E30f, difference = 0.0f;
+	} fields[] = { { "B", &SampleBatch::B }, { "C", &SampleBatch::C }, { "D", &SampleBatch::D }, { "E", &SampleBatch::E }, { "F", &SampleBatch::F },
+		{ "focalLength", &SampleBatch::focalLength }, { "entrancePupil", &SampleBatch::entrancePupil }, { "exitPupil", &SampleBatch::exitPupil },
+		{ "entrancePupilRadius", &SampleBatch::entrancePupilRadius }, { "exitPupilRadius", &SampleBatch::exitPupilRadius },
+		{ "principalPlaneFront", &SampleBatch::principalPlaneFront } };
+	float maxDifference = 0.0f;
+	for ( int first = 0; first < count; first += SIMD_WIDTH )
+	{
+		load( &perLane, first );
+		load( &table, first );
+		for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+			perLane.SetLensData( lane, ls->GetLensData( perLane.wavelength[lane], perLane.z[lane] ) );
+		table.FetchLensData( ls->lensTable );
+		for ( auto& field : fields )
+			for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+			{
+				float expected = ( perLane.*field.member )[lane], actual = ( table.*field.member )[lane];
+				field.low = std::min( field.low, expected ), field.high = std::max( field.high, expected );
+				field.difference = std::max( field.difference, fabsf( actual - expected ) );
+			}
+
+		dof->ApplySeidelBatch( &perLane );
+		dof->ApplySeidelBatch( &table );
+		for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+			if ( perLane.valid[lane] && table.valid[lane] )
+				maxDifference = std::max( maxDifference, ( float2( table.sensorx[lane], table.sensory[lane] ) - float2( perLane.sensorx[lane], perLane.sensory[lane] ) ).length() );
+	}
+	float fieldError = 0.0f;
+	const char* worstField = "";
+	for ( auto& field : fields )
+		if ( field.high > field.low && field.difference / ( field.high - field.low ) > fieldError ) fieldError = field.difference / ( field.high - field.low ), worstField = field.name;
+
+	if ( sum[0] == 12345.0f ) std::cout << " ";
+	std::cout << "per lane: " << ( perLaneTime / count * 1E9f ) << "ns/sample, table of " << ( sizeof( LensData ) * LOOKUP_SIZE * ls->distanceAxis.Count() / 1024 ) << "KB" << std::endl;
+	std::cout << "table:    " << ( tableTime / count * 1E9f ) << "ns/sample, speedup " << ( perLaneTime / tableTime ) << "x, table of " << ( ls->lensTable.Bytes() / 1024 ) << "KB" << std::endl;
+	std::cout << "max difference: " << fieldError << " of the range of " << worstField << ", " << ( maxDifference / SENSOR_SIZE * SCRWIDTH ) << " pixels on the sensor" << std::endl;
+
+	delete dof;
+	delete ls;
+}
+
+//
+// Builds the lensData table of every lens design at a few tolerances, and measures the interpolation error of the
+// Seidel coefficients over distance against the coefficients calculated directly at 400 distances from 0.2 m to 1 km.
+// The fixed grid of 64 distances from 0.2 to 15.2 m that the table had before is measured the same way. The error is
+// relative to the largest magnitude of the coefficient at the test distances, and taken at the wavelengths of the table
+// rows, so only the interpolation over distance counts.
+//
+void Benchmark::Distances()
+{
+	std::cout << std::endl << "=== Benchmark: lens data table over distance, fixed grid and error bounded ===" << std::endl;
+
+	static float LensData::*const terms[] = { &LensData::B, &LensData::C, &LensData::D, &LensData::E, &LensData::F, &LensData::s_prime };
+	const float tolerances[] = { 1E-2f, 1E-3f, 1E-4f };
+	const int testCount = 400, gridCount = 64;
+	std::vector<float> testDist( testCount ), gridDist( gridCount );
+	for ( int t = 0; t < testCount; t++ ) testDist[t] = 0.2f * powf( 5000.0f, t / ( testCount - 1.0f ) );
+	for ( int j = 0; j < gridCount; j++ ) gridDist[j] = 0.2f + j * 15.0f / gridCount;
+
+	struct Result
+	{
+		std::string name;
+		int distances, evaluations;
+		float time, nearError = 0.0f, farError = 0.0f; // up to and beyond 15.2 m
+	};
+	std::vector<std::vector<Result>> results;
+
+	for ( const std::string& file : LensFiles() )
+	{
+		std::vector<Result> lens;
+		for ( int config = 0; config <= 3; config++ )
+		{
+			LensSystem* ls = new LensSystem();
+			ls->FOCUS = 0.6f;
+			ls->tableTolerance = config > 0 ? tolerances[config - 1] : LENS_TABLE_TOLERANCE;
+			ls->ImportFile( file );
+			Timer timer;
+			ls->Precalculate( APERTURE );
+
+			Result r;
+			r.name = config == 0 ? "fixed 64" : "tolerance " + std::to_string( tolerances[config - 1] ).substr( 0, 6 );
+			r.time = timer.elapsed();
+			r.distances = config == 0 ? gridCount : ls->distanceAxis.Count();
+			r.evaluations = config == 0 ? LOOKUP_SIZE * gridCount : ls->seidelEvaluations;
+
+			for ( int i = 0; i < LOOKUP_SIZE; i += 9 )
+			{
+				float wavelength = ( i / ( LOOKUP_SIZE - 1.0f ) ) * 0.470f + 0.360f;
+				std::vector<LensData> exact( testCount, ls->GetLensData( wavelength, 1.0f ) ), grid( gridCount, exact[0] );
+				Seidel::GenerateCoefficientsRow( wavelength, ls->num_elements, ls->dispconstants.data(), ls->radii.data(), ls->centers.data(), ls->thicknesses.data(), exact.data(), testCount, testDist.data() );
+				Seidel::GenerateCoefficientsRow( wavelength, ls->num_elements, ls->dispconstants.data(), ls->radii.data(), ls->centers.data(), ls->thicknesses.data(), grid.data(), gridCount, gridDist.data() );
+
+				for ( float LensData::*term : terms )
+				{
+					float magnitude = 0.0f;
+					for ( const LensData& ld : exact ) magnitude = std::max( magnitude, fabsf( ld.*term ) );
+					for ( int t = 0; t < testCount; t++ )
+					{
+						float value;
+						if ( config == 0 ) // the interpolation of the old GetLensData
+						{
+							float v = std::min( gridCount - 1.0f, ( testDist[t] - 0.2f ) / 15.0f * gridCount );
+							int v1 = (int)v, v2 = std::min( v1 + 1, gridCount - 1 );
+							value = grid[v1].*term + ( grid[v2].*term - grid[v1].*term ) * ( v - v1 );
+						}
+						else
+							value = ls->GetLensData( wavelength, testDist[t] ).*term;
+						float error = fabsf( value - exact[t].*term ) / magnitude;
+						float& worst = testDist[t] <= 15.2f ? r.nearError : r.farError;
+						worst = std::max( worst, error );
+					}
+				}
+			}
+			lens.push_back( r );
+			delete ls;
+		}
+		results.push_back( lens );
+	}
+
+	std::vector<std::string> files = LensFiles();
+	std::cout << std::endl << "distances, table size, Seidel evaluations, Precalculate time, error up to / beyond 15.2 m:" << std::endl;
+	for ( int i = 0; i < (int)files.size(); i++ )
+	{
+		std::cout << files[i] << ":" << std::endl;
+		for ( const Result& r : results[i] )
+			std::cout << "  " << r.name << ": " << r.distances << ", " << ( r.distances * LOOKUP_SIZE * sizeof( LensData ) / 1024 ) << "KB, " << r.evaluations << ", "
+					  << ( r.time * 1E3f ) << "ms, " << r.nearError << " / " << r.farError << std::endl;
+	}
+}
+
+//
+// Scrubs the aperture and focus of a few lenses through random values, with SetAperture and SetFocus recalculating and
+// with them interpolating in a PrecalculateRange, and compares both: the time per change, and the difference in sensor
+// position (relative), Seidel focus (in diopters, and only up to 3 m, beyond which PrecalculateFocus itself is off by
+// a lot from one distance to the next) and lens data (relative to the range of every field over the test points).
+//
+void Benchmark::Scrub()
+{
+	std::cout << std::endl << "=== Benchmark: aperture and focus changes, recalculated vs interpolated from a range ===" << std::endl;
+
+	const char* files[] = { "assets/lensdesigns/doublegauss.zmx", "assets/lensdesigns/nikkor50mm18.zmx", "assets/lensdesigns/pikaichi35mmf28.zmx", "assets/lensdesigns/zoom2.zmx" };
+	const int changes = 40;
+	const float minAperture = 0.1f, maxAperture = 1.0f, nearFocus = 0.3f, farFocus = 20.0f;
+
+	struct Result
+	{
+		float rangeTime, exactTime, interpolatedTime, sensorError = 0.0f, focusError = 0.0f, dataError = 0.0f;
+		size_t bytes;
+		int exactCells;
+	};
+	std::vector<Result> results;
+
+	for ( const char* file : files )
+	{
+		Result r;
+		LensSystem* exact = new LensSystem();
+		LensSystem* interpolated = new LensSystem();
+		exact->FOCUS = interpolated->FOCUS = 0.6f;
+		exact->ImportFile( file );
+		interpolated->ImportFile( file );
+
+		Timer timer;
+		interpolated->PrecalculateRange( minAperture, maxAperture, LENS_RANGE_APERTURES, nearFocus, farFocus, LENS_RANGE_FOCUS );
+		r.rangeTime = timer.elapsed();
+		r.bytes = interpolated->range.Bytes();
+		r.exactCells = (int)std::count( interpolated->range.exact.begin(), interpolated->range.exact.end(), true );
+
+		std::vector<float> apertureValues( changes ), focusValues( changes );
+		for ( int i = 0; i < changes; i++ )
+		{
+			RandomStream random( i, 0, 0 );
+			apertureValues[i] = minAperture + ( maxAperture - minAperture ) * random.rnd();
+			focusValues[i] = nearFocus * powf( farFocus / nearFocus, random.rnd() );
+		}
+
+		std::vector<LensData> exactData, interpolatedData;
+		float exactTime = 0.0f, interpolatedTime = 0.0f;
+		for ( int i = 0; i < changes; i++ )
+		{
+			timer.reset();
+			exact->SetAperture( apertureValues[i] );
+			exact->SetFocus( focusValues[i] );
+			exactTime += timer.elapsed();
+
+			timer.reset();
+			interpolated->SetAperture( apertureValues[i] );
+			interpolated->SetFocus( focusValues[i] );
+			interpolatedTime += timer.elapsed();
+
+			r.sensorError = std::max( r.sensorError, fabsf( exact->sensorPosition - interpolated->sensorPosition ) / exact->sensorPosition );
+			if ( focusValues[i] < 3.0f ) r.focusError = std::max( r.focusError, fabsf( 1.0f / exact->seidelFocus - 1.0f / interpolated->seidelFocus ) );
+			for ( float wavelength = 0.360f; wavelength <= 0.830f; wavelength += 0.047f )
+				for ( float dist : { 0.3f, 1.0f, 3.0f, 10.0f, 100.0f } )
+				{
+					exactData.push_back( exact->GetLensData( wavelength, dist ) );
+					interpolatedData.push_back( interpolated->GetLensData( wavelength, dist ) );
+				}
+		}
+		r.exactTime = exactTime / changes;
+		r.interpolatedTime = interpolatedTime / changes;
+
+		for ( int field = 0; field < 13; field++ ) // all fields up to and including s_prime
+		{
+			float low = 1E30f, high = -1E30f, difference = 0.0f;
+			for ( int i = 0; i < (int)exactData.size(); i++ )
+			{
+				float a = ( (const float*)&exactData[i] )[field], b = ( (const float*)&interpolatedData[i] )[field];
+				low = std::min( low, a ), high = std::max( high, a );
+				difference = std::max( difference, fabsf( a - b ) );
+			}
+			float scale = std::max( high - low, 1E-3f * std::max( fabsf( low ), fabsf( high ) ) ); // not below float rounding
+			if ( scale > 0 ) r.dataError = std::max( r.dataError, difference / scale );
+		}
+
+		results.push_back( r );
+		delete interpolated;
+		delete exact;
+	}
+
+	std::cout << std::endl << "apertures " << minAperture << " to " << maxAperture << " in " << LENS_RANGE_APERTURES << " steps, focus " << nearFocus << " to " << farFocus << "m in "
+			  << LENS_RANGE_FOCUS << " steps:" << std::endl;
+	for ( int i = 0; i < (int)results.size(); i++ )
+	{
+		const Result& r = results[i];
+		std::cout << files[i] << ": range " << ( r.rangeTime * 1E3f ) << "ms, " << ( r.bytes / 1024 ) << "KB, " << r.exactCells << " of "
+				  << ( LENS_RANGE_APERTURES - 1 ) * ( LENS_RANGE_FOCUS - 1 ) << " cells recalculate the focus, change " << ( r.exactTime * 1E3f ) << "ms / "
+				  << ( r.interpolatedTime * 1E3f ) << "ms, speedup " << ( r.exactTime / r.interpolatedTime ) << "x, error: sensor " << r.sensorError << ", Seidel focus "
+				  << r.focusError << " dpt up to 3m, lens data " << r.dataError << std::endl;
+	}
+}
+
+//
+// Zooms a lens file with multiple configurations through random positions, with SetZoom recalculating the lens and
+// with it interpolating between the positions of PrecalculateZoom, and compares both as Scrub does
+//
+void Benchmark::Zoom()
+{
+	std::cout << std::endl << "=== Benchmark: zoom changes, recalculated vs interpolated between zoom positions ===" << std::endl;
+
+	const char* file = "assets/lensdesigns/zoom2.zmx";
+	const int changes = 40;
+
+	LensSystem* exact = new LensSystem();
+	LensSystem* interpolated = new LensSystem();
+	exact->FOCUS = interpolated->FOCUS = 2.0f;
+	exact->ImportFile( file );
+	interpolated->ImportFile( file );
+
+	std::cout << std::endl << "mean focal length per configuration:";
+	for ( int c = 0; c < exact->zoomConfigurations; c++ )
+	{
+		exact->SetZoom( c / (float)std::max( 1, exact->zoomConfigurations - 1 ) );
+		std::cout << " " << ( exact->meanFocalLength * 1E3f ) << "mm f/" << exact->meanFstop;
+	}
+	std::cout << std::endl;
+
+	Timer timer;
+	interpolated->PrecalculateZoom( LENS_ZOOM_POSITIONS );
+	float zoomTime = timer.elapsed();
+
+	float exactTime = 0.0f, interpolatedTime = 0.0f, sensorError = 0.0f, focusError = 0.0f;
+	std::vector<LensData> exactData, interpolatedData;
+	for ( int i = 0; i < changes; i++ )
+	{
+		RandomStream random( i, 0, 0 );
+		float position = random.rnd();
+
+		timer.reset();
+		exact->SetZoom( position );
+		exactTime += timer.elapsed();
+
+		timer.reset();
+		interpolated->SetZoom( position );
+		interpolatedTime += timer.elapsed();
+
+		sensorError = std::max( sensorError, fabsf( exact->sensorPosition - interpolated->sensorPosition ) / exact->sensorPosition );
+		focusError = std::max( focusError, fabsf( 1.0f / exact->seidelFocus - 1.0f / interpolated->seidelFocus ) );
+		for ( float wavelength = 0.360f; wavelength <= 0.830f; wavelength += 0.047f )
+			for ( float dist : { 0.3f, 1.0f, 3.0f, 10.0f, 100.0f } )
+			{
+				exactData.push_back( exact->GetLensData( wavelength, dist ) );
+				interpolatedData.push_back( interpolated->GetLensData( wavelength, dist ) );
+			}
+	}
+
+	// the fields the renderer reads, s_prime only places the distance axis and has a pole where an object distance is
+	// imaged to infinity, which moves with the zoom
+	float dataError = 0.0f;
+	for ( int field = 0; field < 12; field++ )
+	{
+		float low = 1E30f, high = -1E30f, difference = 0.0f;
+		for ( int i = 0; i < (int)exactData.size(); i++ )
+		{
+			float a = ( (const float*)&exactData[i] )[field], b = ( (const float*)&interpolatedData[i] )[field];
+			low = std::min( low, a ), high = std::max( high, a );
+			difference = std::max( difference, fabsf( a - b ) );
+		}
+		float scale = std::max( high - low, 1E-3f * std::max( fabsf( low ), fabsf( high ) ) );
+		if ( scale > 0 ) dataError = std::max( dataError, difference / scale );
+	}
+
+	std::cout << file << ": " << LENS_ZOOM_POSITIONS << " positions in " << ( zoomTime * 1E3f ) << "ms on " << omp_get_max_threads() << " threads, "
+			  << ( interpolated->zoomTables.Bytes() / 1024 ) << "KB, change " << ( exactTime / changes * 1E3f ) << "ms / " << ( interpolatedTime / changes * 1E3f )
+			  << "ms, speedup " << ( exactTime / interpolatedTime ) << "x, error: sensor " << sensorError << ", Seidel focus " << focusError << " dpt, lens data "
+			  << dataError << std::endl;
+
+	delete interpolated;
+	delete exact;
+}
+
+//
+// Fits PolynomialOptics to a few lenses and compares DOF::ApplyPolynomialBatch against DOF::ApplySSRTBatch on the same
+// random samples: the fit, the difference in sensor position and vignetting, and the time per sample of both and of
+// DOF::ApplySeidelBatch
+//
+void Benchmark::Polynomial()
+{
+	std::cout << std::endl << "=== Benchmark: polynomial optics vs SSRT ray packets ===" << std::endl;
+
+	const char* files[] = { "assets/lensdesigns/doublegauss.zmx", "assets/lensdesigns/nikkor50mm18.zmx", "assets/lensdesigns/pikaichi35mmf28.zmx",
+		"assets/lensdesigns/nikkor135mmf4.zmx", "assets/lensdesigns/zoom2.zmx", "assets/lensdesigns/fisheye.ZMX" };
+	const int count = 1 << 16;
+
+	struct Result
+	{
+		int terms;
+		PolynomialFitError fit;
+		float ssrtTime, polynomialTime, seidelTime, rms = 0.0f, max = 0.0f;
+		int mismatches = 0, valid = 0;
+	};
+	std::vector<Result> results;
+
+	for ( const char* file : files )
+	{
+		LensSystem* ls = new LensSystem();
+		ls->FOCUS = 2.0f;
+		ls->ImportFile( file );
+
+		DOF* dof = new DOF();
+		dof->meanLensData = ls->GetLensData( 0.550f, ls->FOCUS );
+		dof->Prepare( ls );
+		if ( !dof->polynomials.Fits( ls ) ) dof->polynomials.Fit( ls );
+
+		Result r;
+		r.terms = dof->polynomials.Terms();
+		r.fit = dof->polynomials.error;
+
+		std::vector<SampleBatch> batches( count / SIMD_WIDTH );
+		for ( int i = 0; i < count; i++ )
+		{
+			RandomStream random( i, 1, 0 );
+			float wavelength = random.rnd() * 0.470f + 0.360f;
+			float depth = 0.3f + 15.0f * random.rnd();
+			float FOVsize = SENSOR_SIZE * depth / ( ls->sensorPosition - dof->meanLensData.principalPlaneRear );
+			float2 Ps = float2( random.rnd() - 0.5f, ( random.rnd() - 0.5f ) * SCRHEIGHT / SCRWIDTH ) * FOVsize;
+			float z = sqrtf( depth * depth - Ps.sqrLength() );
+
+			SampleBatch& batch = batches[i / SIMD_WIDTH];
+			int lane = i % SIMD_WIDTH;
+			batch.SetLensData( lane, ls->GetLensData( wavelength, z ) );
+			batch.wavelength[lane] = wavelength;
+			batch.Psx[lane] = Ps.x;
+			batch.Psy[lane] = Ps.y;
+			batch.z[lane] = z;
+			batch._theta[lane] = random.rnd();
+			batch._rho[lane] = sqrtf( random.rnd() );
+		}
+
+		std::vector<SampleBatch> ssrt = batches, polynomial = batches, seidel = batches;
+		Timer timer;
+		for ( SampleBatch& batch : ssrt ) dof->ApplySSRTBatch( &batch, ls );
+		r.ssrtTime = timer.elapsed() / count;
+		timer.reset();
+		for ( SampleBatch& batch : polynomial ) dof->ApplyPolynomialBatch( &batch, ls );
+		r.polynomialTime = timer.elapsed() / count;
+		timer.reset();
+		for ( SampleBatch& batch : seidel ) dof->ApplySeidelBatch( &batch );
+		r.seidelTime = timer.elapsed() / count;
+
+		double squares = 0.0;
+		int compared = 0;
+		for ( int b = 0; b < (int)batches.size(); b++ )
+			for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+			{
+				bool a = ssrt[b].valid[lane], p = polynomial[b].valid[lane];
+				if ( a ) r.valid++;
+				if ( a != p ) r.mismatches++;
+				if ( !a || !p ) continue;
+				float dx = ssrt[b].sensorx[lane] - polynomial[b].sensorx[lane], dy = ssrt[b].sensory[lane] - polynomial[b].sensory[lane];
+				float pixels = sqrtf( dx * dx + dy * dy ) / SENSOR_SIZE * SCRWIDTH;
+				squares += pixels * pixels;
+				r.max = std::max( r.max, pixels );
+				compared++;
+			}
+		r.rms = compared > 0 ? (float)sqrt( squares / compared ) : 0.0f;
+
+		results.push_back( r );
+		delete dof;
+		delete ls;
+	}
+
+	std::cout << std::endl << "degree " << POLYNOMIAL_DEGREE << ", up to " << POLYNOMIAL_TERMS << " terms per output, " << POLYNOMIAL_RAYS << " rays, " << count
+			  << " samples at focus 2m:" << std::endl;
+	for ( int i = 0; i < (int)results.size(); i++ )
+	{
+		const Result& r = results[i];
+		std::cout << files[i] << ": " << r.terms << " terms, fit " << ( r.fit.time * 1E3f ) << "ms (" << r.fit.rms << " / " << r.fit.max << " px), ssrt "
+				  << ( r.ssrtTime * 1E9f ) << "ns, polynomial " << ( r.polynomialTime * 1E9f ) << "ns, seidel " << ( r.seidelTime * 1E9f ) << "ns per sample, speedup "
+				  << ( r.ssrtTime / r.polynomialTime ) << "x, error " << r.rms << " px rms, " << r.max << " px max, " << r.mismatches << " of " << count
+				  << " differ in vignetting (" << r.valid << " pass)" << std::endl;
+	}
+}
+
+//
+// Bakes the RayTable of a few lenses, without and with the cache, and compares DOF::ApplyRayTableBatch against
+// DOF::ApplySSRTBatch on the same random samples, at the focus the table was baked at and after refocusing, where the
+// slopes carry the rays to the new sensor position
+//
+void Benchmark::RayTransfer()
+{
+	std::cout << std::endl << "=== Benchmark: baked ray table vs SSRT ray packets ===" << std::endl;
+
+	const char* files[] = { "assets/lensdesigns/doublegauss.zmx", "assets/lensdesigns/nikkor50mm18.zmx", "assets/lensdesigns/pikaichi35mmf28.zmx",
+		"assets/lensdesigns/nikkor135mmf4.zmx", "assets/lensdesigns/zoom2.zmx", "assets/lensdesigns/fisheye.ZMX" };
+	const float focusDistances[] = { 2.0f, 0.8f };
+	const int count = 1 << 16;
+
+	struct Result
+	{
+		float bakeTime, mapTime;
+		float ssrtTime[2], tableTime[2], rms[2] = {}, p99[2] = {}, max[2] = {};
+		int mismatches[2] = {}, valid[2] = {};
+	};
+	std::vector<Result> results;
+
+	// the table lookup vs the SSRT ray packets on the same random samples, for the lens in its current state
+	struct Measurement
+	{
+		float ssrtTime, tableTime, rms = 0.0f, p99 = 0.0f, max = 0.0f;
+		int mismatches = 0, valid = 0;
+	};
+	auto measure = [&]( LensSystem* ls, DOF* dof ) {
+		Measurement m;
+		std::vector<SampleBatch> batches( count / SIMD_WIDTH );
+		for ( int i = 0; i < count; i++ )
+		{
+			RandomStream random( i, 1, 0 );
+			float wavelength = random.rnd() * 0.470f + 0.360f;
+			float depth = 0.3f + 15.0f * random.rnd();
+			float FOVsize = SENSOR_SIZE * depth / ( ls->sensorPosition - dof->meanLensData.principalPlaneRear );
+			float2 Ps = float2( random.rnd() - 0.5f, ( random.rnd() - 0.5f ) * SCRHEIGHT / SCRWIDTH ) * FOVsize;
+			float z = sqrtf( depth * depth - Ps.sqrLength() );
+
+			SampleBatch& batch = batches[i / SIMD_WIDTH];
+			int lane = i % SIMD_WIDTH;
+			batch.SetLensData( lane, ls->GetLensData( wavelength, z ) );
+			batch.wavelength[lane] = wavelength;
+			batch.Psx[lane] = Ps.x;
+			batch.Psy[lane] = Ps.y;
+			batch.z[lane] = z;
+			batch._theta[lane] = random.rnd();
+			batch._rho[lane] = sqrtf( random.rnd() );
+		}
+
+		std::vector<SampleBatch> ssrt = batches, table = batches;
+		Timer timer;
+		for ( SampleBatch& batch : ssrt ) dof->ApplySSRTBatch( &batch, ls );
+		m.ssrtTime = timer.elapsed() / count;
+		for ( SampleBatch& batch : table ) dof->ApplyRayTableBatch( &batch, ls ); // once to fault the pages of the table in
+		timer.reset();
+		for ( SampleBatch& batch : table ) dof->ApplyRayTableBatch( &batch, ls );
+		m.tableTime = timer.elapsed() / count;
+
+		double squares = 0.0;
+		int compared = 0;
+		std::vector<float> errors;
+		for ( int b = 0; b < (int)batches.size(); b++ )
+			for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+			{
+				bool a = ssrt[b].valid[lane], t = table[b].valid[lane];
+				if ( a ) m.valid++;
+				if ( a != t ) m.mismatches++;
+				if ( !a || !t ) continue;
+				float dx = ssrt[b].sensorx[lane] - table[b].sensorx[lane], dy = ssrt[b].sensory[lane] - table[b].sensory[lane];
+				float pixels = sqrtf( dx * dx + dy * dy ) / SENSOR_SIZE * SCRWIDTH;
+				squares += pixels * pixels;
+				m.max = std::max( m.max, pixels );
+				errors.push_back( pixels );
+				compared++;
+			}
+		m.rms = compared > 0 ? (float)sqrt( squares / compared ) : 0.0f;
+		if ( compared > 0 )
+		{
+			std::nth_element( errors.begin(), errors.begin() + compared * 99 / 100, errors.end() );
+			m.p99 = errors[compared * 99 / 100];
+		}
+		return m;
+	};
+
+	for ( const char* file : files )
+	{
+		LensSystem* ls = new LensSystem();
+		ls->FOCUS = focusDistances[0];
+		ls->ImportFile( file );
+
+		DOF* dof = new DOF();
+		dof->meanLensData = ls->GetLensData( 0.550f, ls->FOCUS );
+		dof->rayTable.Load( ls ); // once to find out where the cache is
+		std::filesystem::remove( dof->rayTable.cachePath );
+
+		Result r;
+		dof->rayTable.Load( ls );
+		r.bakeTime = dof->rayTable.time;
+		{
+			RayTable mapped;
+			mapped.Load( ls );
+			r.mapTime = mapped.time;
+		}
+
+		for ( int f = 0; f < 2; f++ )
+		{
+			ls->SetFocus( focusDistances[f] );
+			dof->Prepare( ls );
+			Measurement m = measure( ls, dof );
+			r.ssrtTime[f] = m.ssrtTime, r.tableTime[f] = m.tableTime, r.rms[f] = m.rms, r.p99[f] = m.p99, r.max[f] = m.max;
+			r.mismatches[f] = m.mismatches, r.valid[f] = m.valid;
+		}
+
+		results.push_back( r );
+		delete dof;
+		delete ls;
+	}
+
+	//
+	// Random aperture changes of the first lens within its precalculated range: the tables of the nearest precalculated
+	// apertures stand in for the ones in between, each baked once and mapped from the cache after that
+	//
+	LensSystem* ls = new LensSystem();
+	ls->FOCUS = focusDistances[0];
+	ls->ImportFile( files[0] );
+	ls->PrecalculateRange( 0.5f, 1.0f, LENS_RANGE_APERTURES, 0.5f, 10.0f, LENS_RANGE_FOCUS );
+	DOF* dof = new DOF();
+	const int scrubSteps = 64;
+	std::set<std::string> scrubTables;
+	float scrubTime = 0.0f, scrubRms = 0.0f, scrubMax = 0.0f;
+	for ( int step = 0; step < scrubSteps; step++ )
+	{
+		RandomStream random( step, 2, 0 );
+		ls->SetAperture( 0.5f + 0.5f * random.rnd() );
+		dof->meanLensData = ls->GetLensData( 0.550f, ls->FOCUS );
+		Timer timer;
+		if ( !dof->rayTable.Fits( ls ) ) dof->rayTable.Load( ls );
+		scrubTime += timer.elapsed();
+		scrubTables.insert( dof->rayTable.cachePath );
+		if ( step % 16 == 15 )
+		{
+			dof->Prepare( ls );
+			Measurement m = measure( ls, dof );
+			scrubRms = std::max( scrubRms, m.rms ), scrubMax = std::max( scrubMax, m.max );
+		}
+	}
+	delete dof;
+	delete ls;
+
+	std::cout << std::endl << RAY_TABLE_FIELDS << " fields x " << RAY_TABLE_PUPIL << " pupil intervals x " << RAY_TABLE_WAVELENGTHS << " wavelengths x "
+			  << RAY_TABLE_DEPTHS << " depths, " << ( RayTable::Cells() * sizeof( RayCell ) >> 20 ) << "MB per lens, " << count << " samples:" << std::endl;
+	for ( int i = 0; i < (int)results.size(); i++ )
+	{
+		const Result& r = results[i];
+		std::cout << files[i] << ": baked in " << ( r.bakeTime * 1E3f ) << "ms, mapped in " << ( r.mapTime * 1E3f ) << "ms" << std::endl;
+		for ( int f = 0; f < 2; f++ )
+			std::cout << "  focus " << focusDistances[f] << "m: ssrt " << ( r.ssrtTime[f] * 1E9f ) << "ns, table " << ( r.tableTime[f] * 1E9f ) << "ns per sample, speedup "
+					  << ( r.ssrtTime[f] / r.tableTime[f] ) << "x, error " << r.rms[f] << " px rms, " << r.p99[f] << " px 99th percentile, " << r.max[f] << " px max, " << r.mismatches[f] << " of "
+					  << count << " differ in vignetting (" << r.valid[f] << " pass)" << std::endl;
+	}	std::cout << files[0] << ", " << scrubSteps << " aperture changes within a range of " << LENS_RANGE_APERTURES << " apertures: " << scrubTables.size() << " tables, "
+			  << ( scrubTime / scrubSteps * 1E3f ) << "ms per change, error up to " << scrubRms << " px rms, " << scrubMax << " px max" << std::endl;
+}
+
+//
+// Draws pupil samples for random pixels of the night plate, uniformly over the pupil and from DOF::pupilRegions, and
+// counts how many of them the Seidel kernel (which only checks the first lens element) and the SSRT ray packets throw
+// away, over the whole frame and its outer part, with the lenses wide open. The share of the uniform samples that pass
+// outside of their region is the light the regions miss, which PupilRegion::Sample still draws from the whole pupil;
+// the light that is kept, every sample weighted as Sample returns, is the same as uniformly up to noise.
+//
+void Benchmark::Vignetting()
+{
+	std::cout << std::endl << "=== Benchmark: rejected pupil samples, uniform vs drawn from the pupil regions ===" << std::endl;
+
+	std::vector<float> scene( SCRWIDTH * SCRHEIGHT * 4 );
+	GenerateScene( scene.data() );
+	std::vector<float4> image( SCRWIDTH * SCRHEIGHT );
+	for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
+		image[n] = float4( scene[n * 4], scene[n * 4 + 1], scene[n * 4 + 2], scene[n * 4 + 3] );
+
+	const char* files[] = { "assets/lensdesigns/doublegauss.zmx", "assets/lensdesigns/nikkor50mm18.zmx", "assets/lensdesigns/pikaichi35mmf28.zmx",
+		"assets/lensdesigns/nikkor135mmf4.zmx", "assets/lensdesigns/zoom2.zmx" };
+	const char* kernels[] = { "seidel", "ssrt" };
+	const int count = 1 << 16;
+	const float edge = 0.75f * sqrtf( SCRWIDTH * SCRWIDTH + SCRHEIGHT * SCRHEIGHT ) * 0.5f; // from the center, in pixels
+
+	struct Result
+	{
+		float buildTime;
+		int tests;
+		int drawn[2] = {}, rejected[2] = {}, edgeDrawn[2] = {}, edgeRejected[2] = {}; // uniform, regions
+		int missed = 0; // uniform samples that pass outside of their region
+		int withRegion = 0; // samples of a bin that uses its region
+		double light[2] = {};
+		float time[2]; // of the kernel per kept sample
+	};
+	std::vector<Result> results;
+
+	for ( const char* file : files )
+	{
+		LensSystem* ls = new LensSystem();
+		ls->FOCUS = 2.0f;
+		ls->ImportFile( file );
+		ls->SetAperture( 1.0f );
+
+		DOF* dof = new DOF();
+		dof->meanLensData = ls->GetLensData( 0.550f, ls->FOCUS );
+		dof->unvignettedSampling = true;
+		dof->Prepare( ls );
+
+		for ( int traced = 0; traced < 2; traced++ )
+		{
+			Result r;
+			dof->pupilRegions.Build( ls, dof->lensSetup, traced );
+			r.buildTime = dof->pupilRegions.time;
+			r.tests = dof->pupilRegions.tests;
+
+			for ( int regions = 0; regions < 2; regions++ )
+			{
+				std::vector<SampleBatch> batches( count / SIMD_WIDTH );
+				std::vector<float> weights( count );
+				std::vector<char> outer( count ), outside( count );
+				for ( int i = 0; i < count; i++ )
+				{
+					RandomStream random( i, 7, 0 );
+					int x = std::min( (int)( random.rnd() * SCRWIDTH ), SCRWIDTH - 1 ), y = std::min( (int)( random.rnd() * SCRHEIGHT ), SCRHEIGHT - 1 );
+					PixelSetup setup = dof->SetupPixel( image.data(), x, y, ls );
+					float2 Ps = setup.center + ( float2( random.rnd(), random.rnd() ) - float2( 0.5f, 0.5f ) ) * setup.pixelSize;
+					float z = sqrtf( setup.depth2 - Ps.sqrLength() );
+					float wavelength = random.rnd() * 0.470f + 0.360f;
+					float2 pupilSample = float2( random.rnd(), random.rnd() );
+
+					float _theta = pupilSample.x, _rho = sqrtf( pupilSample.y );
+					weights[i] = 1.0f;
+					if ( setup.pupilRegion && regions ) weights[i] = setup.pupilRegion->Sample( pupilSample, setup.pupilAngle, &_theta, &_rho );
+					outside[i] = setup.pupilRegion && !setup.pupilRegion->Contains( _theta, _rho * _rho, setup.pupilAngle );
+					r.withRegion += regions && setup.pupilRegion;
+					outer[i] = ( float2( x, y ) - float2( SCRWIDTH, SCRHEIGHT ) * 0.5f ).length() > edge;
+
+					SampleBatch& batch = batches[i / SIMD_WIDTH];
+					int lane = i % SIMD_WIDTH;
+					batch.SetLensData( lane, ls->GetLensData( wavelength, z ) );
+					batch.wavelength[lane] = wavelength;
+					batch.Psx[lane] = Ps.x;
+					batch.Psy[lane] = Ps.y;
+					batch.z[lane] = z;
+					batch._theta[lane] = _theta;
+					batch._rho[lane] = _rho;
+				}
+
+				Timer timer;
+				for ( SampleBatch& batch : batches )
+					if ( traced ) dof->ApplySSRTBatch( &batch, ls );
+					else dof->ApplySeidelBatch( &batch );
+				float time = timer.elapsed();
+
+				int kept = 0;
+				for ( int i = 0; i < count; i++ )
+				{
+					// a sample drawn from a region the lens hides is not traced
+					if ( weights[i] == 0.0f ) continue;
+					bool valid = batches[i / SIMD_WIDTH].valid[i % SIMD_WIDTH];
+					r.drawn[regions]++, r.edgeDrawn[regions] += outer[i];
+					if ( !valid ) r.rejected[regions]++, r.edgeRejected[regions] += outer[i];
+					else r.light[regions] += weights[i], kept++, r.missed += !regions && outside[i];
+				}
+				r.time[regions] = time / std::max( kept, 1 );
+			}
+			results.push_back( r );
+		}
+
+		delete dof;
+		delete ls;
+	}
+
+	std::cout << std::endl << PUPIL_REGION_FIELDS << " fields x " << PUPIL_REGION_DEPTHS << " depths x " << PUPIL_REGION_BANDS << " bands, " << count
+			  << " samples over the frame, the outer part beyond " << (int)edge << " pixels from the center:" << std::endl;
+	for ( int i = 0; i < (int)results.size(); i++ )
+	{
+		const Result& r = results[i];
+		std::cout << files[i / 2] << ", " << kernels[i % 2] << ": regions built in " << ( r.buildTime * 1E3f ) << "ms (" << r.tests << " tests), " << ( 100.0f * r.withRegion / count ) << "% of the samples in a bin that uses its region, rejected "
+				  << ( 100.0f * r.rejected[0] / std::max( r.drawn[0], 1 ) ) << "% -> " << ( 100.0f * r.rejected[1] / std::max( r.drawn[1], 1 ) ) << "%, outer part "
+				  << ( 100.0f * r.edgeRejected[0] / std::max( r.edgeDrawn[0], 1 ) ) << "% -> " << ( 100.0f * r.edgeRejected[1] / std::max( r.edgeDrawn[1], 1 ) )
+				  << "%, regions miss " << ( 100.0f * r.missed / std::max( r.drawn[0] - r.rejected[0], 1 ) ) << "% of the light, light " << ( r.light[1] / r.light[0] ) << "x, kernel per kept sample " << ( r.time[0] * 1E9f ) << " -> " << ( r.time[1] * 1E9f ) << "ns"
+				  << std::endl;
+	}
+}
+
+//
+// Pupil samples of a few aperture shapes: drawn uniformly and weighted by the transmission of the shape, as the sprite
+// used to be applied, vs drawn from the shape by ApertureShape::Sample. Counts the samples that carry no light, the
+// share of the samples the weights leave effective ( sum w )^2 / ( n sum w^2 ), and the time per sample, and compares
+// the mean of a test function over the shape, which both should agree on. The sprite goes through an EXR file first.
+// With USE_APERTURE_SPRITE, also the time per sample of DOF::ApplyBatch with each shape, from the pupil to the splat.
+//
+void Benchmark::Aperture()
+{
+	std::cout << std::endl << "=== Benchmark: aperture shapes, uniform pupil samples vs drawn from the shape ===" << std::endl;
+
+	// a catadioptric ring with five spokes, brighter to the outside
+	const int N = APERTURE_SPRITE_SIZE;
+	std::vector<float> sprite( N * N ), rgba( N * N * 4 );
+	for ( int row = 0; row < N; row++ )
+		for ( int column = 0; column < N; column++ )
+		{
+			float rho = ( row + 0.5f ) / N, theta = ( column + 0.5f ) / N;
+			bool spoke = theta * 5.0f - floorf( theta * 5.0f ) < 0.08f;
+			float t = rho > 0.55f && rho < 0.95f && !spoke ? 0.5f + 0.5f * rho : 0.0f;
+			sprite[row * N + column] = t;
+			for ( int channel = 0; channel < 3; channel++ ) rgba[( row * N + column ) * 4 + channel] = t;
+			rgba[( row * N + column ) * 4 + 3] = 1.0f;
+		}
+	std::string path = ( std::filesystem::temp_directory_path() / "seidel_benchmark_sprite.exr" ).string();
+	ImageIO::save_to_exr( rgba, path, N, N );
+
+	ApertureShape shapes[4];
+	shapes[0].SetBlades( 6 );
+	shapes[1].SetBlades( 9, 0.05f );
+	ApertureShape reference;
+	reference.SetSprite( sprite.data() );
+	bool loaded = shapes[2].LoadSprite( path.c_str() );
+	std::remove( path.c_str() );
+	const char* names[] = { "6 blades", "9 blades", "ring sprite", "round" };
+
+	// the EXR holds half floats, the sprite should come back as it went in up to that
+	float worst = 0.0f;
+	for ( int row = 0; loaded && row < N; row++ )
+		for ( int column = 0; column < N; column++ )
+		{
+			float rho = ( row + 0.5f ) / N, theta = ( column + 0.5f ) / N;
+			worst = std::max( worst, fabsf( shapes[2].Transmission( theta, rho ) - reference.Transmission( theta, rho ) ) );
+		}
+	std::cout << "sprite read back from " << path << ": " << ( loaded ? "yes" : "NO" ) << ", largest difference " << worst
+			  << ", alias tables built in " << ( shapes[2].time * 1E3f ) << "ms" << std::endl;
+
+	const int count = 1 << 20;
+	auto test = []( float theta, float rho ) { // a point of the pupil in cartesian coordinates, shifted off the center
+		float x = rho * sinf( theta * 2.0f * PI ), y = rho * cosf( theta * 2.0f * PI );
+		return ( x + 0.3f ) * ( x + 0.3f ) + 0.5f * y;
+	};
+	for ( int s = 0; s < 4; s++ )
+	{
+		const ApertureShape& shape = shapes[s];
+		std::vector<float2> u( count );
+		for ( int i = 0; i < count; i++ )
+		{
+			RandomStream random( i, 11, 0 );
+			u[i].x = random.rnd();
+			u[i].y = random.rnd();
+		}
+
+		// uniform, weighted
+		double sum = 0.0, sum2 = 0.0, estimate = 0.0;
+		int dark = 0;
+		for ( int i = 0; i < count; i++ )
+		{
+			float theta = u[i].x, rho = sqrtf( u[i].y );
+			float w = shape.Transmission( theta, rho );
+			dark += w == 0.0f;
+			sum += w, sum2 += w * w;
+			estimate += w * test( theta, rho );
+		}
+
+		// from the shape, every sample weighs 1
+		double drawnEstimate = 0.0;
+		int drawnDark = 0;
+		for ( int i = 0; i < count; i++ )
+		{
+			float theta, rho;
+			shape.Sample( u[i], &theta, &rho );
+			drawnDark += shape.Transmission( theta, rho ) == 0.0f;
+			drawnEstimate += test( theta, rho );
+		}
+
+		// what either costs per sample: the uniform point and its transmission, or drawing the point
+		float checksum = 0.0f;
+		Timer timer;
+		for ( int i = 0; i < count; i++ ) checksum += shape.Transmission( u[i].x, sqrtf( u[i].y ) );
+		float uniformTime = timer.elapsed();
+		timer.reset();
+		for ( int i = 0; i < count; i++ )
+		{
+			float theta, rho;
+			shape.Sample( u[i], &theta, &rho );
+			checksum += rho;
+		}
+		float drawnTime = timer.elapsed();
+		timer.reset();
+		for ( int i = 0; i + SIMD_WIDTH <= count; i += SIMD_WIDTH )
+		{
+			floatv ux, uy;
+			for ( int lane = 0; lane < SIMD_WIDTH; lane++ ) ux[lane] = u[i + lane].x, uy[lane] = u[i + lane].y;
+			shape.Sample( ux, uy, &ux, &uy );
+			checksum += uy[0];
+		}
+		float batchTime = timer.elapsed();
+
+		// the batch sampler draws the same points
+		float batchDifference = 0.0f;
+		for ( int i = 0; i + SIMD_WIDTH <= count; i += SIMD_WIDTH * 64 )
+		{
+			floatv ux, uy;
+			for ( int lane = 0; lane < SIMD_WIDTH; lane++ ) ux[lane] = u[i + lane].x, uy[lane] = u[i + lane].y;
+			shape.Sample( ux, uy, &ux, &uy );
+			for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+			{
+				float theta, rho;
+				shape.Sample( u[i + lane], &theta, &rho );
+				float turn = fabsf( ux[lane] - theta );
+				batchDifference = std::max( batchDifference, std::max( std::min( turn, 1.0f - turn ), fabsf( uy[lane] - rho ) ) );
+			}
+		}
+
+		std::cout << names[s] << ": dark samples " << ( 100.0f * dark / count ) << "% -> " << ( 100.0f * drawnDark / count ) << "%, effective "
+				  << ( 100.0 * sum * sum / ( (double)count * sum2 ) ) << "% -> 100%, mean weight " << ( sum / count ) << ", test mean " << ( estimate / count )
+				  << " vs " << ( drawnEstimate / count ) << ", " << ( uniformTime * 1E9f / count ) << " -> " << ( drawnTime * 1E9f / count ) << "ns per sample, "
+				  << ( batchTime * 1E9f / count ) << "ns batched (differs by " << batchDifference << ")" << ( checksum == 0.0f ? " " : "" ) << std::endl;
+	}
+
+	// end to end: every 8th pixel of the night plate through DOF::ApplyBatch, with the Seidel kernel and splatting, round
+	// vs each shape; the shapes only take effect with USE_APERTURE_SPRITE
+#ifdef USE_APERTURE_SPRITE
+	std::vector<float> scene( SCRWIDTH * SCRHEIGHT * 4 );
+	GenerateScene( scene.data() );
+	std::vector<float4> image( SCRWIDTH * SCRHEIGHT ), accumulator( SCRWIDTH * SCRHEIGHT );
+	for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
+		image[n] = float4( scene[n * 4], scene[n * 4 + 1], scene[n * 4 + 2], scene[n * 4 + 3] );
+
+	LensSystem* ls = new LensSystem();
+	ls->FOCUS = 0.6f;
+	ls->ImportFile( "assets/lensdesigns/doublegauss.zmx" );
+	DOF* dof = new DOF();
+	dof->meanLensData = ls->GetLensData( 0.550f, ls->FOCUS );
+	dof->Prepare( ls );
+	SplatTarget target( accumulator.data() );
+
+	const int samples = 8 * SIMD_WIDTH;
+	float renderTime[4];
+	for ( int s = 0; s < 4; s++ )
+	{
+		ls->apertureShape = shapes[s];
+		Timer timer;
+		for ( int y = 0; y < SCRHEIGHT; y += 8 )
+			for ( int x = 0; x < SCRWIDTH; x += 8 )
+				dof->ApplyBatch( dof->SetupPixel( image.data(), x, y, ls ), &target, x, y, ls, 1.0f, 0, samples );
+		renderTime[s] = timer.elapsed() / ( ( SCRHEIGHT + 7 ) / 8 * ( ( SCRWIDTH + 7 ) / 8 ) * samples );
+	}
+	std::cout << "DOF::ApplyBatch on doublegauss, seidel, " << samples << " samples per pixel, per sample:";
+	for ( int s = 0; s < 4; s++ ) std::cout << ( s ? ", " : " " ) << names[s] << " " << ( renderTime[s] * 1E9f ) << "ns";
+	std::cout << std::endl;
+
+	delete dof;
+	delete ls;
+#else
+	std::cout << "define USE_APERTURE_SPRITE for the render time of the shapes through DOF::ApplyBatch" << std::endl;
+#endif
+}
+
+//
+// The PSF convolution against the scatter renderer on the night plate: a long binned render is the reference, and the
+// first convolution, sampling its PSFs included, and a binned render that takes about as long are compared to it, by
+// the RMS of the difference relative to the RMS of the reference, also without the noise of the reference, which the
+// two binned renders tell; and the time the binned render would take to get as close as the convolution. Also per knot
+// of the PSFs, their radius, the eigen PSFs it took and the error of the low rank approximation.
+//
+void Benchmark::Convolution()
+{
+	std::cout << std::endl << "=== Benchmark: PSF convolution vs scatter ===" << std::endl;
+
+	std::vector<float> scene( SCRWIDTH * SCRHEIGHT * 4 );
+	GenerateScene( scene.data() );
+
+	std::unique_ptr<Application> app = NightPlate( scene.data() );
+
+	auto image = [&]() {
+		std::vector<float4> result( app->GetAccumulator(), app->GetAccumulator() + SCRWIDTH * SCRHEIGHT );
+		for ( float4& pixel : result ) pixel *= 1.0f / app->GetFrameCount();
+		return result;
+	};
+	auto difference = [&]( const std::vector<float4>& a, const std::vector<float4>& reference ) {
+		double squares = 0.0, referenceSquares = 0.0;
+		for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
+		{
+			float3 d = a[n].rgb - reference[n].rgb;
+			squares += dot( d, d );
+			referenceSquares += dot( reference[n].rgb, reference[n].rgb );
+		}
+		return sqrt( squares / referenceSquares );
+	};
+
+	app->psfConvolution = true;
+	app->ClearAccumulator();
+	float firstTime = app->Render( 1 );
+	int prepareSamples = app->totalSamplesTaken;
+	app->ClearAccumulator();
+	float time = app->Render( 1 );
+	std::vector<float4> convolved = image();
+	const PSFConvolution* convolution = app->GetConvolution();
+	for ( int k = 0; k < (int)convolution->knots.size(); k++ )
+	{
+		const PSFKnot& knot = convolution->knots[k];
+		std::cout << "knot " << k << " at " << ( 1.0f / knot.inverseDistance ) << "m: radius " << knot.radius << ", " << knot.subpixels << " subpixels, " << knot.rank << " eigen PSFs, error "
+				  << ( knot.error * 100.0f ) << "% (noise " << ( knot.noise * 100.0f ) << "%), lost " << ( knot.lost * 100.0f ) << "%" << std::endl;
+	}
+	std::cout << "PSFs sampled in " << convolution->prepareTime << "s (" << prepareSamples << " samples, first render " << firstTime << "s), render " << time << "s, "
+			  << convolution->transforms << " FFTs" << std::endl;
+
+	const int referenceFrames = 1024;
+	app->psfConvolution = false;
+	app->ClearAccumulator();
+	float referenceTime = app->Render( referenceFrames );
+	std::vector<float4> reference = image();
+	std::cout << "reference: " << referenceFrames << " frames of " << app->samplesPerFrame << " samples in " << referenceTime << "s" << std::endl;
+
+	// the frames after the reference, so their noise is independent of it, as many as the first convolution took, with
+	// sampling the PSFs
+	float frameTime = referenceTime / referenceFrames;
+	int frames = std::max( 1, (int)( firstTime / frameTime + 0.5f ) );
+	float scatterTime = app->Render( frames );
+	std::vector<float4> scattered = image();
+	for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
+		scattered[n] = ( scattered[n] * (float)( referenceFrames + frames ) - reference[n] * (float)referenceFrames ) * ( 1.0f / frames );
+
+	// the noise of the scatter render is that of the reference times sqrt( referenceFrames / frames ), which tells the
+	// noise of the reference, and what is left of either difference without it
+	double convolvedDifference = difference( convolved, reference ), scatteredDifference = difference( scattered, reference );
+	double noise = scatteredDifference * scatteredDifference / ( 1.0 + (double)referenceFrames / frames ); // squared
+	auto withoutNoise = [&]( double d ) { return sqrt( std::max( d * d - noise, 0.0 ) ) * 100.0; };
+	std::cout << "difference from the reference: convolution " << ( convolvedDifference * 100.0 ) << "%, scatter of " << frames << " frames ("
+			  << scatterTime << "s) " << ( scatteredDifference * 100.0 ) << "%; without the noise of the reference (" << ( sqrt( noise ) * 100.0 )
+			  << "%): convolution " << withoutNoise( convolvedDifference ) << "%, scatter " << withoutNoise( scatteredDifference ) << "%" << std::endl;
+
+	// the scatter render has no bias, what it misses falls with the square root of its frames: the time it takes to get
+	// as close to the reference as the convolution
+	double ratio = withoutNoise( scatteredDifference ) / std::max( withoutNoise( convolvedDifference ), 1E-6 );
+	float usableTime = (float)( frames * ratio * ratio ) * frameTime;
+	std::cout << "time to an image as close as the convolution: convolution " << firstTime << "s (" << time << "s once its PSFs are sampled), scatter "
+			  << usableTime << "s (" << (int)ceilf( usableTime / frameTime ) << " frames)" << std::endl;
+	Check( firstTime < usableTime, "the convolution, sampling its PSFs included, beats the scatter render to its image" );
+}
+
+//
+// Compares DOF::ApplySeidelBatch against the scalar DOF::ApplySeidel on the same random samples, both for speed and for
+// the largest difference in sensor position
+//
+void Benchmark::SeidelKernel()
+{
+	std::cout << std::endl << "=== Benchmark: Seidel kernel, scalar vs " << SIMD_WIDTH << " wide batches ===" << std::endl;
+	CompareKernels( false, 1 << 20 );
+}
+
+//
+// Compares DOF::ApplySSRTBatch (ray packets) against the scalar DOF::ApplySSRT
+//
+void Benchmark::SSRTKernel()
+{
+	std::cout << std::endl << "=== Benchmark: SSRT, scalar TraceRay3D vs " << SIMD_WIDTH << " wide ray packets ===" << std::endl;
+	CompareKernels( true, 1 << 18 );
+}
+
+//
+// Imports every lens design in assets/lensdesigns, then compares resolving all their glasses through the sorted catalog
+// index against the linear scan over the catalog it replaced
+//
+void Benchmark::Import()
+{
+	std::cout << std::endl << "=== Benchmark: lens import ===" << std::endl;
+
+	std::vector<std::string> files = LensFiles();
+
+	std::vector<std::string> materials;
+	std::vector<float> importTimes;
+	for ( const std::string& file : files )
+	{
+		LensSystem* ls = new LensSystem();
+		Timer timer;
+		ls->ImportFile( file );
+		importTimes.push_back( timer.elapsed() );
+		materials.insert( materials.end(), ls->materials.begin(), ls->materials.end() );
+		delete ls;
+	}
+
+	float totalTime = 0.0f;
+	for ( int i = 0; i < (int)files.size(); i++ )
+	{
+		std::cout << files[i] << ": " << ( importTimes[i] * 1000.0f ) << "ms" << std::endl;
+		totalTime += importTimes[i];
+	}
+	std::cout << files.size() << " files imported in " << totalTime << "s" << std::endl;
+
+	const int repeats = 10000;
+	size_t found = 0;
+
+	Timer timer;
+	for ( int repeat = 0; repeat < repeats; repeat++ )
+		for ( const std::string& material : materials )
+			found += Glass::FindLinear( material.c_str() ) != nullptr;
+	float linearTime = timer.elapsed();
+
+	timer.reset();
+	for ( int repeat = 0; repeat < repeats; repeat++ )
+		for ( const std::string& material : materials )
+			found += Glass::Find( material.c_str() ) != nullptr;
+	float indexTime = timer.elapsed();
+
+	float lookups = (float)repeats * materials.size();
+	std::cout << "glass lookup over " << materials.size() << " materials, " << glassCatalogSize << " glasses in the catalog (" << ( found / 2 / repeats ) << " known):" << std::endl;
+	std::cout << "linear scan:  " << ( linearTime / lookups * 1E9f ) << "ns/lookup" << std::endl;
+	std::cout << "sorted index: " << ( indexTime / lookups * 1E9f ) << "ns/lookup, speedup " << ( linearTime / indexTime ) << "x" << std::endl;
+}
+
+//
+// Writes the built-in glasses as an AGF catalog to the temp directory, then measures parsing it into the binary cache
+// against loading it from the mapped cache, and checks that the loaded glasses give the same refractive indices
+//
+void Benchmark::AGFCatalog()
+{
+	std::cout << std::endl << "=== Benchmark: AGF glass catalog, parsing vs memory mapped cache ===" << std::endl;
+
+	std::string path = ( std::filesystem::temp_directory_path() / "seidel_benchmark.agf" ).string();
+	{
+		std::ofstream agf( path );
+		agf.precision( 9 );
+		agf << "CC Built-in glasses of Glass.h" << std::endl;
+		for ( const GlassEntry& glass : glassCatalog )
+		{
+			bool sellmeier = glass.dc[5] > 1;
+			agf << "NM " << glass.name << " " << ( sellmeier ? 2 : 1 ) << " 0 1.5 50 0 0 0" << std::endl << "CD";
+			for ( int i = 0; i < 6; i++ )
+				agf << " " << glass.dc[sellmeier ? ( i / 2 + ( i % 2 ) * 3 ) : i]; // Sellmeier coefficients are interleaved K1 L1 K2 ...
+			agf << " 0 0 0 0" << std::endl;
+		}
+	}
+	std::filesystem::remove( path + ".cache" );
+
+	GlassCatalog* catalog = new GlassCatalog();
+	Timer timer;
+	catalog->Load( path );
+	float parseTime = timer.elapsed();
+
+	const int loads = 1000;
+	timer.reset();
+	for ( int i = 0; i < loads; i++ ) catalog->Load( path );
+	float cacheTime = timer.elapsed() / loads;
+
+	float maxDifference = 0.0f;
+	int missing = 0;
+	for ( const GlassEntry& glass : glassCatalog )
+	{
+		const CachedGlass* cached = catalog->Find( glass.name );
+		if ( !cached )
+		{
+			missing++;
+			continue;
+		}
+		const GlassEntry* builtin = Glass::Find( glass.name ); // the first of duplicate names, like the cache
+		for ( float wavelength = 0.360f; wavelength <= 0.830f; wavelength += 0.01f )
+		{
+			float n1 = HelperFunctions::CalculateRefractiveIndex( wavelength, (float*)builtin->dc.data() );
+			float n2 = HelperFunctions::CalculateRefractiveIndex( wavelength, (float*)cached->dc.data() );
+			if ( std::isfinite( n1 ) ) maxDifference = std::max( maxDifference, fabsf( n1 - n2 ) );
+		}
+	}
+
+	std::cout << catalog->count << " glasses, " << missing << " not found after loading, cache used: " << ( catalog->fromCache ? "yes" : "no" ) << std::endl;
+	std::cout << "parse + build cache: " << ( parseTime * 1E3f ) << "ms" << std::endl;
+	std::cout << "load from cache:     " << ( cacheTime * 1E6f ) << "us, speedup " << ( parseTime / cacheTime ) << "x" << std::endl;
+	std::cout << "max refractive index difference to the built-in glasses: " << maxDifference << std::endl;
+
+	delete catalog;
+	std::filesystem::remove( path );
+	std::filesystem::remove( path + ".cache" );
+}
+
+//
+// Times LensSystem::Precalculate for every lens design on one thread and on all of them, and the incremental updates
+// after an aperture or focus change. Also checks that the incremental updates end up with the same lens data as a full
+// Precalculate with the new values.
+//
+void Benchmark::Precalc()
+{
+	std::cout << std::endl << "=== Benchmark: lens precalculation, full and incremental ===" << std::endl;
+
+	struct Result
+	{
+		float single, parallel, aperture, focus, difference;
+	};
+	std::vector<std::string> files = LensFiles();
+	std::vector<Result> results;
+	int maxThreads = omp_get_max_threads();
+
+	for ( const std::string& file : files )
+	{
+		Result result;
+		LensSystem* ls = new LensSystem();
+		ls->FOCUS = 0.6f;
+		ls->ImportFile( file );
+
+		omp_set_num_threads( 1 );
+		Timer timer;
+		ls->Precalculate( APERTURE );
+		result.single = timer.elapsed();
+
+		omp_set_num_threads( maxThreads );
+		timer.reset();
+		ls->Precalculate( APERTURE );
+		result.parallel = timer.elapsed();
+
+		timer.reset();
+		ls->SetAperture( APERTURE * 0.5f );
+		result.aperture = timer.elapsed();
+
+		timer.reset();
+		ls->SetFocus( 2.0f );
+		result.focus = timer.elapsed();
+
+		// the same state, calculated from scratch
+		LensSystem* reference = new LensSystem();
+		reference->FOCUS = 2.0f;
+		reference->ImportFile( file );
+		reference->Precalculate( APERTURE * 0.5f );
+
+		auto difference = []( float a, float b ) { return a == b || ( std::isnan( a ) && std::isnan( b ) ) ? 0.0f : fabsf( a - b ); };
+		result.difference = difference( ls->seidelFocus, reference->seidelFocus ) + difference( ls->sensorPosition, reference->sensorPosition );
+		for ( float wavelength = 0.360f; wavelength <= 0.830f; wavelength += 0.01f )
+			for ( float dist = 0.2f; dist < 15.2f; dist += 0.1f )
+			{
+				LensData a = ls->GetLensData( wavelength, dist ), b = reference->GetLensData( wavelength, dist );
+				const float* fa = (const float*)&a;
+				const float* fb = (const float*)&b;
+				for ( int i = 0; i < 13; i++ ) // all fields up to and including s_prime
+					result.difference += difference( fa[i], fb[i] );
+			}
+
+		results.push_back( result );
+		delete reference;
+		delete ls;
+	}
+
+	std::cout << std::endl << "Precalculate on 1 / " << maxThreads << " threads, then SetAperture and SetFocus:" << std::endl;
+	for ( int i = 0; i < (int)files.size(); i++ )
+	{
+		const Result& r = results[i];
+		std::cout << files[i] << ": " << ( r.single * 1E3f ) << "ms / " << ( r.parallel * 1E3f ) << "ms, aperture " << ( r.aperture * 1E3f ) << "ms, focus "
+				  << ( r.focus * 1E3f ) << "ms, " << ( r.difference == 0 ? "same as full" : "DIFFERS from full: " + std::to_string( r.difference ) ) << std::endl;
+	}
+}
+
+//
+// Imports every lens design twice, first without its lens data cache, then from the cache, and checks that both give
+// the same lens data
+//
+void Benchmark::LensCache()
+{
+	std::cout << std::endl << "=== Benchmark: lens import with and without the lens data cache ===" << std::endl;
+
+#ifndef ENABLE_LENS_CACHE
+	std::cout << "ENABLE_LENS_CACHE is not defined" << std::endl;
+#else
+	std::vector<std::string> files = LensFiles();
+	std::vector<float> coldTimes, warmTimes;
+	std::vector<bool> same;
+
+	for ( const std::string& file : files )
+	{
+		LensSystem* cold = new LensSystem();
+		cold->FOCUS = 0.6f;
+		cold->ImportFile( file ); // once to find out where the cache is
+		std::filesystem::remove( cold->cachePath );
+		delete cold;
+
+		cold = new LensSystem();
+		cold->FOCUS = 0.6f;
+		Timer timer;
+		cold->ImportFile( file );
+		coldTimes.push_back( timer.elapsed() );
+
+		LensSystem* warm = new LensSystem();
+		warm->FOCUS = 0.6f;
+		timer.reset();
+		warm->ImportFile( file );
+		warmTimes.push_back( timer.elapsed() );
+
+		bool equal = memcmp( &cold->seidelFocus, &warm->seidelFocus, sizeof( float ) ) == 0 && memcmp( &cold->sensorPosition, &warm->sensorPosition, sizeof( float ) ) == 0;
+		for ( float wavelength = 0.360f; wavelength <= 0.830f; wavelength += 0.01f )
+			for ( float dist = 0.2f; dist < 15.2f; dist += 0.1f )
+			{
+				LensData a = cold->GetLensData( wavelength, dist ), b = warm->GetLensData( wavelength, dist );
+				equal &= memcmp( &a, &b, 13 * sizeof( float ) ) == 0; // all fields up to and including s_prime
+			}
+		same.push_back( equal );
+
+		delete warm;
+		delete cold;
+	}
+
+	std::cout << std::endl << "import without / with cache:" << std::endl;
+	for ( int i = 0; i < (int)files.size(); i++ )
+		std::cout << files[i] << ": " << ( coldTimes[i] * 1E3f ) << "ms / " << ( warmTimes[i] * 1E3f ) << "ms, speedup " << ( coldTimes[i] / warmTimes[i] ) << "x, "
+				  << ( same[i] ? "same lens data" : "lens data DIFFERS" ) << std::endl;
+#endif
+}
+
+void Benchmark::CompareKernels( bool useSSRT, int count )
+{
+	LensSystem* ls = new LensSystem();
+	ls->FOCUS = 0.6f;
+	ls->ImportFile( "assets/lensdesigns/doublegauss.zmx" );
+
+	DOF* dof = new DOF();
+	dof->meanLensData = ls->GetLensData( 0.550f, ls->FOCUS );
+	dof->Prepare( ls );
+
+	std::vector<LensData> lensData( count );
+	std::vector<float2> Ps( count ), sensorScalar( count ), sensorBatch( count );
+	std::vector<float> wavelength( count ), z( count ), _theta( count ), _rho( count );
+	std::vector<bool> validScalar( count ), validBatch( count );
+
+	for ( int i = 0; i < count; i++ )
+	{
+		RandomStream random( i, 0, 0 );
+		wavelength[i] = random.rnd() * 0.470f + 0.360f;
+		float depth = 0.3f + 15.0f * random.rnd();
+		float FOVsize = SENSOR_SIZE * depth / ( ls->sensorPosition - dof->meanLensData.principalPlaneRear );
+		Ps[i] = float2( random.rnd() - 0.5f, ( random.rnd() - 0.5f ) * SCRHEIGHT / SCRWIDTH ) * FOVsize;
+		z[i] = sqrtf( depth * depth - Ps[i].sqrLength() );
+		lensData[i] = ls->GetLensData( wavelength[i], z[i] );
+		_theta[i] = random.rnd();
+		_rho[i] = sqrtf( random.rnd() );
+	}
+
+	Timer timer;
+	for ( int i = 0; i < count; i++ )
+	{
+		LensData& ld = lensData[i];
+		float theta = _theta[i] * 2.0f * PI;
+		float M_prime = ld.exitPupilRadius / ld.entrancePupilRadius;
+		float rho = _rho[i] * ld.exitPupilRadius / M_prime;
+		float2 direction = float2( sinf( theta ), cosf( theta ) );
+		float2 Pprime1 = direction * _rho[i] * ld.exitPupilRadius;
+		float2 Pprime0 = Pprime1 / M_prime;
+
+		bool valid;
+		if ( useSSRT )
+			sensorScalar[i] = dof->ApplySSRT( &valid, ls, ls->FOCUS, wavelength[i], ld, Ps[i], z[i], Pprime0 );
+		else
+			sensorScalar[i] = dof->ApplySeidel( &valid, ld, Ps[i], z[i], Pprime0, Pprime1, direction, rho );
+		validScalar[i] = valid;
+	}
+	float scalarTime = timer.elapsed();
+
+	timer.reset();
+	SampleBatch batch;
+	for ( int first = 0; first < count; first += SIMD_WIDTH )
+	{
+		for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+		{
+			int i = first + lane;
+			batch.SetLensData( lane, lensData[i] );
+			batch.wavelength[lane] = wavelength[i];
+			batch.Psx[lane] = Ps[i].x;
+			batch.Psy[lane] = Ps[i].y;
+			batch.z[lane] = z[i];
+			batch._theta[lane] = _theta[i];
+			batch._rho[lane] = _rho[i];
+		}
+
+		if ( useSSRT )
+			dof->ApplySSRTBatch( &batch, ls );
+		else
+			dof->ApplySeidelBatch( &batch );
+
+		for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+		{
+			sensorBatch[first + lane] = float2( batch.sensorx[lane], batch.sensory[lane] );
+			validBatch[first + lane] = batch.valid[lane];
+		}
+	}
+	float batchTime = timer.elapsed();
+
+	float maxDifference = 0.0f;
+	int mismatches = 0, valid = 0;
+	for ( int i = 0; i < count; i++ )
+	{
+		if ( validScalar[i] ) valid++;
+		if ( validScalar[i] != validBatch[i] ) mismatches++;
+		if ( validScalar[i] && validBatch[i] ) maxDifference = std::max( maxDifference, ( sensorScalar[i] - sensorBatch[i] ).length() );
+	}
+
+	std::cout << "scalar: " << ( scalarTime / count * 1E9f ) << "ns/sample" << std::endl;
+	std::cout << "batch:  " << ( batchTime / count * 1E9f ) << "ns/sample, speedup " << ( scalarTime / batchTime ) << "x" << std::endl;
+	std::cout << "max difference: " << ( maxDifference / SENSOR_SIZE ) << " sensor widths (" << ( maxDifference / SENSOR_SIZE * SCRWIDTH ) << " pixels), "
+			  << mismatches << " of " << count << " samples differ in vignetting (" << valid << " pass)" << std::endl;
+
+	// the batches only reorder the float operations, and the vignetting can only flip for rays that graze an element
+	Check( maxDifference / SENSOR_SIZE * SCRWIDTH < 0.01f && mismatches <= count / 10000, "the batch kernel agrees with the scalar one within 0.01 pixels, and on the vignetting of all but 1 in 10000 samples" );
+
+	delete dof;
+	delete ls;
+}
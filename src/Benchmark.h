@@ -0,0 +1,48 @@
+#pragma once
+
+class Benchmark
+{
+  public:
+	static int Run( const char* name ); // returns the number of checks that failed
+
+	static void Scaling();
+	static void SeidelKernel();
+	static void SSRTKernel();
+	static void Import();
+	static void AGFCatalog();
+	static void Precalc();
+	static void LensCache();
+	static void Splat();
+	static void Schedule();
+	static void Adaptive();
+	static void Sampling();
+	static void HeroWavelengths();
+	static void SampleCost();
+	static void LensTable();
+	static void Distances();
+	static void Scrub();
+	static void Zoom();
+	static void Polynomial();
+	static void RayTransfer();
+	static void Vignetting();
+	static void Aperture();
+	static void Convolution();
+
+  private:
+	static int failures; // of Check, during the current Run
+
+	struct Noise
+	{
+		float time = 0.0f; // of one render
+		float pixelError, blockError;	// luminance
+		float pixelChroma, blockChroma; // opponent colors
+	};
+
+	static bool Check( bool passed, const std::string& claim );
+	static void GenerateScene( float* rgbaImage, float focusDistance = 0.0f );
+	static std::unique_ptr<Application> NightPlate( const float* rgbaImage, const char* lensFile = "assets/lensdesigns/doublegauss.zmx" );
+	static uint Checksum( const float4* accumulator );
+	static std::vector<std::string> LensFiles();
+	static Noise MeasureNoise( Application* app, int frames );
+	static void CompareKernels( bool useSSRT, int count );
+};
@@ -1,9 +1,10 @@
 #include "precomp.h"
 
 //
-// Applies DOF using a Seidel aberrations, calculates the sensor coordinates
+// Applies DOF using a Seidel aberrations, calculates the sensor coordinates. direction is ( sin( theta ), cos( theta ) ) of
+// the pupil sample, the sensor plane and the first lens element come from lensSetup (see Prepare).
 //
-float2 DOF::ApplySeidel( bool* valid, LensSystem* lensSystem, float focus_distance, float wavelength, LensData lensData, float2 Ps, float z, float2 Pprime0, float2 Pprime1, float theta, float rho )
+float2 DOF::ApplySeidel( bool* valid, LensData lensData, float2 Ps, float z, float2 Pprime0, float2 Pprime1, float2 direction, float rho )
 {
 	float D0 = z + lensData.entrancePupil;
 	float M = -lensData.focalLength / ( z + lensData.principalPlaneFront - lensData.focalLength );
@@ -16,22 +17,13 @@ float2 DOF::ApplySeidel( bool* valid, LensSystem* lensSystem, float focus_distan
 	//
 	// Calculate optical vignetting by checking if the ray passes through the first lens element
 	//
-#if 0
-	float3 O = float3( Ps.x, Ps.y, -z );
-	float3 D = ( float3( Pprime0.x, Pprime0.y, lensData.entrancePupil ) - O ).normalized();
-
-	*valid = lensSystem->TraceRay3D( &O, &D, wavelength, 0, lensSystem->num_elements - 1, true, false );
-	if ( !*valid ) return float2();
-#else
-	float element0 = lensSystem->centers[0] + lensSystem->radii[0];
 	float2 dir = ( Pprime0 - Ps ) / D0; // direction vector if we move a distance of 1 on the z axis
-	float2 Popening = Ps + dir * ( z + element0 );
-	if ( Popening.sqrLength() > lensSystem->apertures[0] * lensSystem->apertures[0] ) // check if the ray can pass through the lens element
+	float2 Popening = Ps + dir * ( z + lensSetup.element0 );
+	if ( Popening.sqrLength() > lensSetup.aperture0Sqr ) // check if the ray can pass through the lens element
 	{
 		*valid = false;
 		return float2();
 	}
-#endif
 #endif
 
 	//
@@ -52,13 +44,10 @@ float2 DOF::ApplySeidel( bool* valid, LensSystem* lensSystem, float focus_distan
 	float2 p0_axial = p0_size != 0 ? p0 / p0_size : float2( 0, 1 );
 	float2 p0_radial = float2( p0_axial.y, -p0_axial.x );
 
-	// calculate the angle between the positive y-axis and p0_axial
-	float angle = acosf( float2( 0, 1 ).dot( p0_axial ) );
-	if ( p0.x < 0 ) angle = 2 * PI - angle;
-
-	// do expensive calculations only once up front
-	float sinTheta = sinf( theta - angle );
-	float cosTheta = cosf( theta - angle );
+	// sin( theta - angle ) and cos( theta - angle ), with angle the angle between the positive y-axis and p0_axial, so
+	// sin( angle ) = p0_axial.x and cos( angle ) = p0_axial.y
+	float sinTheta = direction.x * p0_axial.y - direction.y * p0_axial.x;
+	float cosTheta = direction.y * p0_axial.y + direction.x * p0_axial.x;
 
 	float rho2 = rho * rho;
 	float rho3 = rho2 * rho;
@@ -106,16 +95,11 @@ float2 DOF::ApplySeidel( bool* valid, LensSystem* lensSystem, float focus_distan
 	float2 P1 = p1 * D0 * M;
 
 	//
-	// Calculate the sensor distance based on the average focal length of the lens and the focus distance, such that this is
-	// fixed no matter the wavelength. Also calculate the focal distance, or the distance at which the lens forms an image of
-	// light of the current wavelength.
+	// The focal distance, or the distance at which the lens forms an image of light of the current wavelength. The sensor
+	// distance is fixed no matter the wavelength, see Prepare.
 	//
-
-	float M_sensor = -meanLensData.focalLength / ( focus_distance + meanLensData.principalPlaneFront - meanLensData.focalLength );
-	float Mprime_sensor = meanLensData.exitPupilRadius / meanLensData.entrancePupilRadius;
-	float D1_sensor = ( focus_distance + meanLensData.entrancePupil ) * M_sensor * Mprime_sensor;
 	float z_image = lensData.exitPupil - D1;
-	float z_sensor = meanLensData.exitPupil - D1_sensor;
+	float z_sensor = lensSetup.zSensor;
 
 	//
 	// Calculate Qstripe, the point on the Gaussian reference sphere we are going to interpolate between
@@ -138,6 +122,145 @@ float2 DOF::ApplySeidel( bool* valid, LensSystem* lensSystem, float focus_distan
 	return float2( Psensor_3.x, Psensor_3.y );
 }
 
+//
+// Batched version of ApplySeidel, evaluates SIMD_WIDTH samples at once, with one vectorized sincos of theta for the
+// pupil direction. The sensor coordinates match the scalar path to within 1E-6 of the sensor size, i.e. well below a
+// thousandth of a pixel (see: seidel --benchmark seidel).
+//
+void DOF::ApplySeidelBatch( SampleBatch* batch )
+{
+	SampleBatch& b = *batch;
+
+	//
+	// Entrance (P'_0) and exit (P'_1) pupil coordinates
+	//
+	floatv theta = b._theta * ( 2.0f * PI );
+	floatv sinTheta0, cosTheta0;
+	floatv::sincos( theta, &sinTheta0, &cosTheta0 );
+
+	floatv M_prime = b.exitPupilRadius / b.entrancePupilRadius;
+	floatv rho = b._rho * b.exitPupilRadius / M_prime;
+
+	floatv Pprime1x = b._rho * sinTheta0 * b.exitPupilRadius;
+	floatv Pprime1y = b._rho * cosTheta0 * b.exitPupilRadius;
+	floatv Pprime0x = Pprime1x / M_prime;
+	floatv Pprime0y = Pprime1y / M_prime;
+
+	floatv D0 = b.z + b.entrancePupil;
+	floatv M = -b.focalLength / ( b.z + b.principalPlaneFront - b.focalLength );
+	floatv Mprime = M_prime;
+
+	b.valid = maskv::First( SIMD_WIDTH );
+
+#ifdef ENABLE_OPTICAL_VIGNETTING
+	//
+	// Calculate optical vignetting by checking if the ray passes through the first lens element
+	//
+	floatv dirx = ( Pprime0x - b.Psx ) / D0;
+	floatv diry = ( Pprime0y - b.Psy ) / D0;
+	floatv Popeningx = b.Psx + dirx * ( b.z + lensSetup.element0 );
+	floatv Popeningy = b.Psy + diry * ( b.z + lensSetup.element0 );
+	b.valid = ( Popeningx * Popeningx + Popeningy * Popeningy ) <= floatv( lensSetup.aperture0Sqr );
+#endif
+
+	//
+	// p0 and its axial and radial normalized vectors
+	//
+	floatv p0x = b.Psx / D0;
+	floatv p0y = b.Psy / D0;
+	floatv p0_size = floatv::sqrt( p0x * p0x + p0y * p0y );
+	maskv nonzero = p0_size != 0.0f;
+	floatv p0_axialx = floatv::select( nonzero, p0x / p0_size, 0.0f );
+	floatv p0_axialy = floatv::select( nonzero, p0y / p0_size, 1.0f );
+	floatv p0_radialx = p0_axialy;
+	floatv p0_radialy = -p0_axialx;
+
+	// sin( theta - angle ) and cos( theta - angle )
+	floatv sinTheta = sinTheta0 * p0_axialy - cosTheta0 * p0_axialx;
+	floatv cosTheta = cosTheta0 * p0_axialy + sinTheta0 * p0_axialx;
+
+	floatv rho2 = rho * rho;
+	floatv rho3 = rho2 * rho;
+	floatv rho4 = rho2 * rho2;
+
+	floatv y0 = p0_size;
+	floatv y0_2 = y0 * y0;
+	floatv y0_3 = y0_2 * y0;
+
+	//
+	// SEIDEL ABERRATIONS
+	//
+
+	floatv delta_p0x = 0.0f;
+	floatv delta_p0y = 0.0f;
+	floatv phi = 0.0f;
+
+#ifdef ENABLE_ABERRATIONS
+	// spherical aberration ( B != 0 )
+	delta_p0x += b.B * rho3 * sinTheta;
+	delta_p0y += b.B * rho3 * cosTheta;
+	phi += -0.25f * b.B * rho4;
+
+	// coma ( F != 0 )
+	delta_p0x += -2.0f * b.F * y0 * rho2 * sinTheta * cosTheta;
+	delta_p0y += -b.F * y0 * rho2 * ( 1.0f + 2.0f * cosTheta * cosTheta );
+	phi += b.F * y0 * rho3 * cosTheta;
+
+	// astigmatism ( C != 0) and curvature of field ( D != 0 )
+	delta_p0x += b.D * rho * y0_2 * sinTheta;
+	delta_p0y += ( 2.0f * b.C + b.D ) * rho * y0_2 * cosTheta;
+	phi += -b.C * y0_2 * rho2 * cosTheta * cosTheta - 0.5f * b.D * y0_2 * rho2;
+
+	// distortion ( E != 0 )
+	delta_p0y += -b.E * y0_3;
+	phi += b.E * y0_3 * rho * cosTheta;
+#endif
+
+	//
+	// Calculate P1 (image plane coordinates)
+	//
+	floatv p1x = p0x + p0_axialx * delta_p0y + p0_radialx * delta_p0x;
+	floatv p1y = p0y + p0_axialy * delta_p0y + p0_radialy * delta_p0x;
+
+	floatv D1 = D0 * M * Mprime;
+	floatv P1x = p1x * D0 * M;
+	floatv P1y = p1y * D0 * M;
+
+	//
+	// Sensor and image distances, see ApplySeidel
+	//
+	floatv z_image = b.exitPupil - D1;
+	float z_sensor = lensSetup.zSensor;
+
+	//
+	// Calculate Qstripe, the point on the Gaussian reference sphere we are going to interpolate between
+	//
+	floatv P1starx = b.Psx * M;
+	floatv P1stary = b.Psy * M;
+	floatv P1starz = z_image - b.exitPupil;
+	floatv gaussianReferenceSphereRadius = floatv::sqrt( P1starx * P1starx + P1stary * P1stary + P1starz * P1starz );
+
+	floatv dx = Pprime1x - P1starx;
+	floatv dy = Pprime1y - P1stary;
+	floatv dz = b.exitPupil - z_image;
+	floatv scale = ( gaussianReferenceSphereRadius - phi ) / floatv::sqrt( dx * dx + dy * dy + dz * dz );
+	floatv Qstripex = P1starx + dx * scale;
+	floatv Qstripey = P1stary + dy * scale;
+	floatv Qstripez = z_image + dz * scale;
+
+	//
+	// Interpolate between Q and the focal distance coordinates to obtain the image sensor coordinates
+	//
+	floatv image_to_sensor_dist = z_sensor - z_image;
+	floatv rayx = P1x - Qstripex;
+	floatv rayy = P1y - Qstripey;
+	floatv rayz = z_image - Qstripez;
+	floatv t = image_to_sensor_dist / rayz;
+
+	b.sensorx = P1x + rayx * t;
+	b.sensory = P1y + rayy * t;
+}
+
 //
 // Applies DOF using a Screen Space Ray Tracing, calculates the sensor coordinates
 //
@@ -166,112 +289,482 @@ float2 DOF::ApplySSRT( bool* valid, LensSystem* lensSystem, float focus_distance
 	return float2( Psensor.x, Psensor.y );
 }
 
-void DOF::Apply( float4* inputImage, float4* accumulator, float* cocMap, int x, int y, LensSystem* lensSystem, float brightness, bool fillCocMap )
+//
+// Batched version of ApplySSRT, traces SIMD_WIDTH samples at once as a ray packet
+//
+void DOF::ApplySSRTBatch( SampleBatch* batch, LensSystem* lensSystem )
 {
-#ifdef ZOOM
-	if ( x > 0.625f * SCRWIDTH || x < 0.375f * SCRWIDTH || y > 0.625f * SCRHEIGHT || y < 0.375f * SCRHEIGHT ) return;
-#endif
+	SampleBatch& b = *batch;
 
 	//
-	// preliminaries
+	// Entrance pupil coordinates (P'_0)
 	//
-	float wavelength = Random::rnd() * 0.470f + 0.360f;
-	float3 color_rgb = CIE1931::WavelengthXYZ( wavelength );
+	floatv sinTheta, cosTheta;
+	floatv::sincos( b._theta * ( 2.0f * PI ), &sinTheta, &cosTheta );
 
-	if ( fillCocMap ) wavelength = 0.550f;
+	floatv M_prime = b.exitPupilRadius / b.entrancePupilRadius;
+	floatv Pprime0x = b._rho * sinTheta * b.exitPupilRadius / M_prime;
+	floatv Pprime0y = b._rho * cosTheta * b.exitPupilRadius / M_prime;
 
-#if !defined ENABLE_CHROMATICS || defined UseSprite || defined UsePencilMap 
-	color_rgb = float3( 1.0f, 1.0f, 1.0f );
-	wavelength = 0.550f;
-#endif
+	//
+	// Use 3D (!) ray tracing to trace the rays from the light source to the imaging sensor
+	//
+	RayPacket packet;
+	packet.Ox = b.Psx;
+	packet.Oy = b.Psy;
+	packet.Oz = -b.z;
+	packet.Dx = Pprime0x - b.Psx;
+	packet.Dy = Pprime0y - b.Psy;
+	packet.Dz = b.entrancePupil + b.z;
+	floatv Dscale = 1.0f / floatv::sqrt( packet.Dx * packet.Dx + packet.Dy * packet.Dy + packet.Dz * packet.Dz );
+	packet.Dx *= Dscale;
+	packet.Dy *= Dscale;
+	packet.Dz *= Dscale;
 
-	float4 pixel = inputImage[y * SCRWIDTH + x];
+	// move the ray origin forward to reduce banding artifacts. assumes the lens starts at x = 0.
+	floatv advance = floatv::select( b.z > 0.1f, b.z - 0.05f, 0.0f );
+	packet.Ox += packet.Dx * advance;
+	packet.Oy += packet.Dy * advance;
+	packet.Oz += packet.Dz * advance;
+
+	packet.wavelength = b.wavelength;
+	packet.valid = maskv::First( SIMD_WIDTH );
+
+	b.valid = lensSystem->TraceRay3DPacket( &packet, 0, lensSystem->num_elements - 1, true );
 
 	//
-	// Camera space coordinates of the light source (P_s)
+	// Intersect the rays and the imaging sensor
 	//
-#ifdef TESTING
-	float2 pixelOffset = float2( 0.0f, 0.0f );
+	floatv t = ( lensSystem->sensorPosition - packet.Oz ) / packet.Dz;
+	b.sensorx = packet.Ox + t * packet.Dx;
+	b.sensory = packet.Oy + t * packet.Dy;
+}
+
+//
+// The inputs of PolynomialOptics (and RayTable) for a sample, rotated so the light source lies on the positive y axis,
+// and the axis it was rotated from. pupil is the entrance pupil sample in the unit disk.
+//
+static void RotatedInputs( float wavelength, float2 Ps, float z, float2 pupil, float maxField, float* in, float2* axis )
+{
+	float field = Ps.length();
+	*axis = field != 0 ? Ps / field : float2( 0, 1 );
+
+	in[POLY_FIELD] = field / z / maxField;
+	in[POLY_PUPIL_X] = pupil.x * axis->y - pupil.y * axis->x;
+	in[POLY_PUPIL_Y] = pupil.x * axis->x + pupil.y * axis->y;
+	in[POLY_WAVELENGTH] = ( wavelength - 0.595f ) / 0.235f;
+	in[POLY_INVERSE_DISTANCE] = std::min( LENS_TABLE_NEAR / z, 1.0f );
+}
+
+//
+// Intersects the rotated ray and the imaging sensor, toSensor away from the plane of the outputs, and rotates it back
+//
+static float2 RotatedSensorPosition( const float* out, float2 axis, float toSensor )
+{
+	float x = out[POLY_X] + out[POLY_U] * toSensor;
+	float y = out[POLY_Y] + out[POLY_V] * toSensor;
+	return float2( x * axis.y + y * axis.x, y * axis.y - x * axis.x );
+}
+
+//
+// Batched versions of RotatedInputs and RotatedSensorPosition
+//
+static void RotatedInputs( const SampleBatch& b, float maxField, floatv* in, floatv* axisx, floatv* axisy )
+{
+	floatv sinTheta, cosTheta;
+	floatv::sincos( b._theta * ( 2.0f * PI ), &sinTheta, &cosTheta );
+	floatv pupilx = b._rho * sinTheta;
+	floatv pupily = b._rho * cosTheta;
+
+	floatv field = floatv::sqrt( b.Psx * b.Psx + b.Psy * b.Psy );
+	maskv nonzero = field != 0.0f;
+	*axisx = floatv::select( nonzero, b.Psx / field, 0.0f );
+	*axisy = floatv::select( nonzero, b.Psy / field, 1.0f );
+
+	in[POLY_FIELD] = field / ( b.z * maxField );
+	in[POLY_PUPIL_X] = pupilx * *axisy - pupily * *axisx;
+	in[POLY_PUPIL_Y] = pupilx * *axisx + pupily * *axisy;
+	in[POLY_WAVELENGTH] = ( b.wavelength - 0.595f ) * ( 1.0f / 0.235f );
+	in[POLY_INVERSE_DISTANCE] = floatv::min( LENS_TABLE_NEAR / b.z, 1.0f );
+}
+
+static void RotatedSensorPosition( SampleBatch* b, const floatv* out, const floatv& axisx, const floatv& axisy, float toSensor )
+{
+	floatv x = out[POLY_X] + out[POLY_U] * toSensor;
+	floatv y = out[POLY_Y] + out[POLY_V] * toSensor;
+	b->sensorx = x * axisy + y * axisx;
+	b->sensory = y * axisy - x * axisx;
+}
+
+//
+// Applies DOF with the polynomials fitted to the Screen Space Ray Tracing (see PolynomialOptics), calculates the sensor
+// coordinates. pupil is the entrance pupil sample in the unit disk.
+//
+float2 DOF::ApplyPolynomial( bool* valid, LensSystem* lensSystem, float wavelength, float2 Ps, float z, float2 pupil )
+{
+	float in[POLY_INPUTS], out[POLY_OUTPUTS];
+	float2 axis;
+	RotatedInputs( wavelength, Ps, z, pupil, polynomials.maxField, in, &axis );
+	polynomials.Evaluate( in, out );
+
+	*valid = out[POLY_TRANSMITTANCE] > 0.5f;
+	if ( !*valid ) return float2();
+	return RotatedSensorPosition( out, axis, lensSystem->sensorPosition - polynomials.zPlane );
+}
+
+//
+// Batched version of ApplyPolynomial, evaluates SIMD_WIDTH samples at once. Uses no lens data.
+//
+void DOF::ApplyPolynomialBatch( SampleBatch* batch, LensSystem* lensSystem )
+{
+	floatv in[POLY_INPUTS], out[POLY_OUTPUTS], axisx, axisy;
+	RotatedInputs( *batch, polynomials.maxField, in, &axisx, &axisy );
+	polynomials.Evaluate( in, out );
+
+	batch->valid = out[POLY_TRANSMITTANCE] > 0.5f;
+	RotatedSensorPosition( batch, out, axisx, axisy, lensSystem->sensorPosition - polynomials.zPlane );
+}
+
+//
+// Applies DOF with the rays of the Screen Space Ray Tracing interpolated from a baked table (see RayTable), calculates
+// the sensor coordinates. pupil is the entrance pupil sample in the unit disk.
+//
+float2 DOF::ApplyRayTable( bool* valid, LensSystem* lensSystem, float wavelength, float2 Ps, float z, float2 pupil )
+{
+	float in[POLY_INPUTS], out[POLY_OUTPUTS];
+	float2 axis;
+	RotatedInputs( wavelength, Ps, z, pupil, rayTable.maxField, in, &axis );
+	rayTable.Lookup( in, out );
+
+	*valid = out[POLY_TRANSMITTANCE] > 0.5f;
+	if ( !*valid ) return float2();
+	return RotatedSensorPosition( out, axis, lensSystem->sensorPosition - rayTable.zPlane );
+}
+
+//
+// Batched version of ApplyRayTable, looks SIMD_WIDTH samples up at once. Uses no lens data.
+//
+void DOF::ApplyRayTableBatch( SampleBatch* batch, LensSystem* lensSystem )
+{
+	floatv in[POLY_INPUTS], out[POLY_OUTPUTS], axisx, axisy;
+	RotatedInputs( *batch, rayTable.maxField, in, &axisx, &axisy );
+	rayTable.Lookup( in, out );
+
+	batch->valid = out[POLY_TRANSMITTANCE] > 0.5f;
+	RotatedSensorPosition( batch, out, axisx, axisy, lensSystem->sensorPosition - rayTable.zPlane );
+}
+
+//
+// Everything the samples share until the lens, focus or aperture change. Call after changing any of them.
+//
+void DOF::Prepare( LensSystem* lensSystem )
+{
+	//
+	// Calculate the sensor distance based on the average focal length of the lens and the focus distance, such that this
+	// is fixed no matter the wavelength
+	//
+	float focus_distance = lensSystem->seidelFocus;
+	float M_sensor = -meanLensData.focalLength / ( focus_distance + meanLensData.principalPlaneFront - meanLensData.focalLength );
+	float Mprime_sensor = meanLensData.exitPupilRadius / meanLensData.entrancePupilRadius;
+	float D1_sensor = ( focus_distance + meanLensData.entrancePupil ) * M_sensor * Mprime_sensor;
+	lensSetup.zSensor = meanLensData.exitPupil - D1_sensor;
+
+	lensSetup.element0 = lensSystem->centers[0] + lensSystem->radii[0];
+	lensSetup.aperture0Sqr = lensSystem->apertures[0] * lensSystem->apertures[0];
+
+#ifdef UsePolynomial
+	if ( !polynomials.Fits( lensSystem ) ) polynomials.Fit( lensSystem );
+#endif
+#ifdef UseRayTable
+	if ( !rayTable.Fits( lensSystem ) ) rayTable.Load( lensSystem );
+#endif
+
+	// the Seidel kernel only vignettes with ENABLE_OPTICAL_VIGNETTING, the others always do
+#ifdef UseSeidel
+	const bool traced = false;
 #else
-	float2 pixelOffset = float2( Random::rnd() - 0.5f, Random::rnd() - 0.5f );
+	const bool traced = true;
+#endif
+#if defined ENABLE_OPTICAL_VIGNETTING || !defined UseSeidel
+	if ( unvignettedSampling && !pupilRegions.Fits( lensSystem, traced ) ) pupilRegions.Build( lensSystem, lensSetup, traced );
 #endif
+}
 
+//
+// Everything the samples of one source pixel share, so the sample loops only do what depends on the sample
+//
+PixelSetup DOF::SetupPixel( const float4* inputImage, int x, int y, LensSystem* lensSystem ) const
+{
+	return SetupPixel( inputImage[y * SCRWIDTH + x], x, y, lensSystem );
+}
+
+PixelSetup DOF::SetupPixel( float4 pixel, int x, int y, LensSystem* lensSystem ) const
+{
 	float FOVsize = SENSOR_SIZE * pixel.a / ( lensSystem->sensorPosition - meanLensData.principalPlaneRear );
-	float2 Ps = ( ( float2( x, y ) + pixelOffset - float2( SCRWIDTH, SCRHEIGHT ) * 0.5f ) / SCRWIDTH ) * FOVsize; // met "Basics of lens optics in all of these equations (similar triangles on both sides of the lens):" https://www.scantips.com/lights/fieldofviewmath.html
 
-	float z = sqrtf( pixel.a * pixel.a - Ps.sqrLength() ); // distance of the light source plane
+	// met "Basics of lens optics in all of these equations (similar triangles on both sides of the lens):" https://www.scantips.com/lights/fieldofviewmath.html
+	PixelSetup setup;
+	setup.color = pixel.rgb;
+	setup.pixelSize = FOVsize / SCRWIDTH;
+	setup.center = ( float2( x, y ) - float2( SCRWIDTH, SCRHEIGHT ) * 0.5f ) * setup.pixelSize;
+	setup.depth2 = pixel.a * pixel.a;
 
-#if defined UseSimpleDOF || defined UseSprite || defined UsePencilMap || defined UseSeidelDistortion
-	LensData lensData = meanLensData;
+	setup.pupilRegion = nullptr;
+	bool regions = unvignettedSampling && pupilRegions.Built();
+#ifdef USE_APERTURE_SPRITE
+	regions &= lensSystem->apertureShape.Round(); // the regions are parts of the round pupil
+#endif
+	if ( regions )
+	{
+		float z = sqrtf( setup.depth2 - setup.center.sqrLength() );
+		setup.pupilRegion = pupilRegions.Find( setup.center.length() / z, z );
+		setup.pupilAngle = atan2f( setup.center.x, setup.center.y ) * ( 0.5f / PI );
+	}
+	return setup;
+}
+
+//
+// The wavelength of one of the hero wavelengths of a sample: the first is drawn, the others are spaced evenly over the
+// visible range from there, wrapping around, so every pupil sample covers the whole spectrum
+//
+float DOF::HeroWavelength( float first, int wavelength, int wavelengths )
+{
+	float u = first + (float)wavelength / wavelengths;
+	if ( u >= 1.0f ) u -= 1.0f;
+	return u * 0.470f + 0.360f;
+}
+
+void DOF::Apply( const PixelSetup& setup, SplatTarget* target, float* cocMap, int x, int y, LensSystem* lensSystem, float brightness, bool fillCocMap, Sampler* sampler )
+{
+#ifdef ZOOM
+	if ( x > 0.625f * SCRWIDTH || x < 0.375f * SCRWIDTH || y > 0.625f * SCRHEIGHT || y < 0.375f * SCRHEIGHT ) return;
+#endif
+
+	//
+	// preliminaries
+	//
+	float firstWavelength = sampler->Get1D();
+	int wavelengths = fillCocMap ? 1 : heroWavelengths;
+#if !defined ENABLE_CHROMATICS || defined UseSprite || defined UsePencilMap
+	wavelengths = 1;
+#endif
+
+	//
+	// Camera space coordinates of the light source (P_s)
+	//
+#ifdef TESTING
+	float2 pixelOffset = float2( 0.0f, 0.0f );
 #else
-	LensData lensData = lensSystem->GetLensData( wavelength, z );
+	float2 pixelOffset = sampler->Get2D() - float2( 0.5f, 0.5f );
 #endif
 
+	float2 Ps = setup.center + pixelOffset * setup.pixelSize;
+	float z = sqrtf( setup.depth2 - Ps.sqrLength() ); // distance of the light source plane
 
 	//
-	// Entrance (P'_0) and exit (P'_1) pupil coordinates
+	// Entrance (P'_0) and exit (P'_1) pupil sample, shared by all wavelengths
 	//
-	float _theta = fillCocMap ? 0.0f : Random::rnd();
+	float2 pupilSample = sampler->Get2D();
+	float _theta = fillCocMap ? 0.0f : pupilSample.x;
 #if defined UseSprite || defined UsePencilMap
-	float _rho = ( Random::rnd() );
-	color_rgb *= 2;
+	float _rho = ( pupilSample.y );
 #else
-	float _rho = fillCocMap ? 0.5f : sqrtf( Random::rnd() );
+	float _rho = fillCocMap ? 0.5f : sqrtf( pupilSample.y );
+#endif
+#ifdef USE_APERTURE_SPRITE
+	// drawn in proportion to the transmission of the aperture, so every sample weighs the same
+	if ( !fillCocMap ) lensSystem->apertureShape.Sample( pupilSample, &_theta, &_rho );
 #endif
+	if ( setup.pupilRegion && !fillCocMap )
+	{
+		brightness *= setup.pupilRegion->Sample( pupilSample, setup.pupilAngle, &_theta, &_rho );
+		if ( brightness == 0.0f ) return; // drawn from a region the lens hides
+	}
 	float theta = _theta * 2.0f * PI;
-	float M_prime = lensData.exitPupilRadius / lensData.entrancePupilRadius;
-	float rho = _rho * lensData.exitPupilRadius / M_prime;
+	float2 direction = float2( sinf( theta ), cosf( theta ) );
 
-	float2 Pprime1 = float2( _rho * sinf( theta ), _rho * cosf( theta ) ) * lensData.exitPupilRadius;
-	float2 Pprime0 = Pprime1 / M_prime;
+	for ( int hero = 0; hero < wavelengths; hero++ )
+	{
+		float wavelength = HeroWavelength( firstWavelength, hero, wavelengths );
+		float3 color_rgb = CIE1931::WavelengthXYZ( wavelength );
 
-	//
-	// Calculate the sensor plane coordinates, either by using screen space ray tracing or applying Seidel aberrations.
-	//
-	bool valid = true;
+		if ( fillCocMap ) wavelength = 0.550f;
 
-	float2 Psensor;
+#if !defined ENABLE_CHROMATICS || defined UseSprite || defined UsePencilMap
+		color_rgb = float3( 1.0f, 1.0f, 1.0f );
+		wavelength = 0.550f;
+#endif
+#if defined UseSprite || defined UsePencilMap
+		color_rgb *= 2;
+#endif
+
+#if defined UseSimpleDOF || defined UseSprite || defined UsePencilMap || defined UseSeidelDistortion
+		LensData lensData = meanLensData;
+#else
+		LensData lensData = lensSystem->GetLensData( wavelength, z );
+#endif
+
+		float M_prime = lensData.exitPupilRadius / lensData.entrancePupilRadius;
+		float rho = _rho * lensData.exitPupilRadius / M_prime;
+
+		float2 Pprime1 = direction * _rho * lensData.exitPupilRadius;
+		float2 Pprime0 = Pprime1 / M_prime;
+
+		//
+		// Calculate the sensor plane coordinates, either by using screen space ray tracing or applying Seidel aberrations.
+		//
+		bool valid = true;
+
+		float2 Psensor;
 
 #ifdef UseSeidel
-	Psensor = ApplySeidel( &valid, lensSystem, lensSystem->seidelFocus, wavelength, lensData, Ps, z, Pprime0, Pprime1, theta, rho );
+		Psensor = ApplySeidel( &valid, lensData, Ps, z, Pprime0, Pprime1, direction, rho );
 #elif defined UseSSRT
-	Psensor = ApplySSRT( &valid, lensSystem, lensSystem->FOCUS, wavelength, lensData, Ps, z, Pprime0 );
+		Psensor = ApplySSRT( &valid, lensSystem, lensSystem->FOCUS, wavelength, lensData, Ps, z, Pprime0 );
+#elif defined UsePolynomial
+		Psensor = ApplyPolynomial( &valid, lensSystem, wavelength, Ps, z, direction * _rho );
+#elif defined UseRayTable
+		Psensor = ApplyRayTable( &valid, lensSystem, wavelength, Ps, z, direction * _rho );
 #endif
 
-	Psensor /= SENSOR_SIZE; // normalize
-	Psensor *= -1;			// flip the image
+		Psensor /= SENSOR_SIZE; // normalize
+		Psensor *= -1;			// flip the image
 
-	if ( !valid )
-		return;
+		if ( !valid )
+			continue;
 
 #ifdef ZOOM
-	Psensor *= 4;
-	color_rgb *= 16;
+		Psensor *= 4;
+		color_rgb *= 16;
 #endif
 
-	//
-	// Pixel coordinates
-	//
-	int x_render = (int)( Psensor.x * SCRWIDTH + SCRWIDTH / 2 + 1.0f ) - 1;
-	int y_render = (int)( Psensor.y * SCRWIDTH + SCRHEIGHT / 2 + 1.0f ) - 1;
+		//
+		// Pixel coordinates
+		//
+		int x_render = (int)( Psensor.x * SCRWIDTH + SCRWIDTH / 2 + 1.0f ) - 1;
+		int y_render = (int)( Psensor.y * SCRWIDTH + SCRHEIGHT / 2 + 1.0f ) - 1;
+
+		if ( fillCocMap )
+		{
+			cocMap[y * SCRWIDTH + x] = ( ( x - x_render ) * ( x - x_render ) + ( y - y_render ) * ( y - y_render ) );
+			return;
+		}
+
+		// every wavelength carries its share of the sample
+		float weight = brightness / wavelengths;
+		target->Add( Psensor.x * SCRWIDTH + SCRWIDTH / 2, Psensor.y * SCRWIDTH + SCRHEIGHT / 2, setup.color * color_rgb * weight, weight );
+	}
+}
+
+//
+// Applies DOF to a number of samples of the same pixel, evaluating them SIMD_WIDTH at a time with ApplySeidelBatch or
+// ApplySSRTBatch. With hero wavelengths every sample takes heroWavelengths neighbouring lanes, which share the pupil
+// sample and the light source position. Draws the same sample points as Apply, so both paths render the same samples.
+// It has no counterpart of the mean lens data and sprite pupil of the legacy modes, those have to undefine ENABLE_SIMD.
+//
+#if defined ENABLE_SIMD && ( defined UseSimpleDOF || defined UseSprite || defined UsePencilMap || defined UseSeidelDistortion )
+#error "DOF::ApplyBatch doesn't support UseSimpleDOF, UseSprite, UsePencilMap or UseSeidelDistortion, undefine ENABLE_SIMD"
+#endif
+void DOF::ApplyBatch( const PixelSetup& setup, SplatTarget* target, int x, int y, LensSystem* lensSystem, float brightness, int frame, int samples )
+{
+#ifdef ZOOM
+	if ( x > 0.625f * SCRWIDTH || x < 0.375f * SCRWIDTH || y > 0.625f * SCRHEIGHT || y < 0.375f * SCRHEIGHT ) return;
+#endif
+
+	int pixelIndex = y * SCRWIDTH + x;
+
+	int wavelengths = heroWavelengths;
+#if !defined ENABLE_CHROMATICS || defined UseSprite || defined UsePencilMap
+	wavelengths = 1;
+#endif
+	int samplesPerBatch = SIMD_WIDTH / wavelengths;
+
+	SampleBatch batch;
+	float3 color_rgb[SIMD_WIDTH];
+	float sampleWeight[SIMD_WIDTH]; // relative to a sample drawn uniformly from the pupil, see PupilRegion::Sample
 
-	if ( fillCocMap )
+	for ( int first = 0; first < samples; first += samplesPerBatch )
 	{
-		cocMap[y * SCRWIDTH + x] = ( ( x - x_render ) * ( x - x_render ) + ( y - y_render ) * ( y - y_render ) );
-		return;
-	}
+		int count = std::min( samplesPerBatch, samples - first );
+
+		for ( int lane = 0; lane < count * wavelengths; lane += wavelengths )
+		{
+			Sampler sampler( this->sampler, pixelIndex, frame, first + lane / wavelengths, samples );
+
+			float firstWavelength = sampler.Get1D();
+
+#ifdef TESTING
+			float2 pixelOffset = float2( 0.0f, 0.0f );
+#else
+			float2 pixelOffset = sampler.Get2D() - float2( 0.5f, 0.5f );
+#endif
 
+			float2 Ps = setup.center + pixelOffset * setup.pixelSize;
+			float z = sqrtf( setup.depth2 - Ps.sqrLength() );
+			float2 pupilSample = sampler.Get2D();
+			float _theta = pupilSample.x, _rho = sqrtf( pupilSample.y );
 #ifdef USE_APERTURE_SPRITE
-	color_rgb *= lensSystem->spriteMultiplier * lensSystem->apertureSprite[256 * (int)( 256 * _rho ) + (int)( 256 * _theta )] / 256.0f;
+			if ( !lensSystem->apertureShape.Round() ) _rho = pupilSample.y; // drawn from the shape for the whole batch below
+#endif
+			float pupilWeight = setup.pupilRegion ? setup.pupilRegion->Sample( pupilSample, setup.pupilAngle, &_theta, &_rho ) : 1.0f;
+
+			for ( int hero = 0; hero < wavelengths; hero++ )
+			{
+				float wavelength = HeroWavelength( firstWavelength, hero, wavelengths );
+				color_rgb[lane + hero] = CIE1931::WavelengthXYZ( wavelength );
+#if !defined ENABLE_CHROMATICS || defined UseSprite || defined UsePencilMap
+				color_rgb[lane + hero] = float3( 1.0f, 1.0f, 1.0f );
+				wavelength = 0.550f;
 #endif
 
-	pixel.r *= color_rgb.x;
-	pixel.g *= color_rgb.y;
-	pixel.b *= color_rgb.z;
+				sampleWeight[lane + hero] = pupilWeight;
+				batch.wavelength[lane + hero] = wavelength;
+				batch.Psx[lane + hero] = Ps.x;
+				batch.Psy[lane + hero] = Ps.y;
+				batch.z[lane + hero] = z;
+				batch._theta[lane + hero] = _theta;
+				batch._rho[lane + hero] = _rho;
+			}
+		}
+
+		// unused lanes repeat the last sample
+		for ( int lane = count * wavelengths; lane < SIMD_WIDTH; lane++ )
+			batch.CopyLane( lane, lane - wavelengths );
+#ifdef USE_APERTURE_SPRITE
+		if ( !lensSystem->apertureShape.Round() ) lensSystem->apertureShape.Sample( batch._theta, batch._rho, &batch._theta, &batch._rho );
+#endif
+		batch.FetchLensData( lensSystem->lensTable );
 
-	if ( x_render >= 0 && y_render >= 0 && x_render < SCRWIDTH && y_render < SCRHEIGHT )
-	{
-		accumulator[y_render * SCRWIDTH + x_render].rgb += pixel.rgb * brightness;
-		accumulator[y_render * SCRWIDTH + x_render].a += brightness;
+#ifdef UseSeidel
+		ApplySeidelBatch( &batch );
+#elif defined UseSSRT
+		ApplySSRTBatch( &batch, lensSystem );
+#elif defined UsePolynomial
+		ApplyPolynomialBatch( &batch, lensSystem );
+#elif defined UseRayTable
+		ApplyRayTableBatch( &batch, lensSystem );
+#endif
+
+		maskv valid = batch.valid & maskv::First( count * wavelengths );
+		if ( !valid.any() ) continue;
+
+		// every wavelength carries its share of the sample
+		for ( int lane = 0; lane < count * wavelengths; lane++ )
+		{
+			float weight = brightness / wavelengths * sampleWeight[lane];
+			if ( !valid[lane] || weight == 0.0f ) continue;
+
+			float2 Psensor = float2( batch.sensorx[lane], batch.sensory[lane] );
+			Psensor /= SENSOR_SIZE; // normalize
+			Psensor *= -1;			// flip the image
+
+			float3 color = color_rgb[lane];
+#ifdef ZOOM
+			Psensor *= 4;
+			color *= 16;
+#endif
+
+			target->Add( Psensor.x * SCRWIDTH + SCRWIDTH / 2, Psensor.y * SCRWIDTH + SCRHEIGHT / 2, setup.color * color * weight, weight );
+		}
 	}
 }
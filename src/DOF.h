@@ -1,12 +1,117 @@
 #pragma once
 
+//
+// SIMD_WIDTH samples in structure-of-arrays form, the input and output of DOF::ApplySeidelBatch and DOF::ApplySSRTBatch
+//
+struct SampleBatch
+{
+	// lens data of every sample, only the fields used by ApplySeidel
+	floatv B, C, D, E, F;
+	floatv focalLength, entrancePupil, exitPupil, entrancePupilRadius, exitPupilRadius, principalPlaneFront;
+
+	// light source position (P_s), its distance and the pupil sample, with _theta in [0, 1) and _rho in [0, 1]
+	floatv wavelength;
+	floatv Psx, Psy, z;
+	floatv _theta, _rho;
+
+	// sensor plane coordinates and whether the sample passed through the lens
+	floatv sensorx, sensory;
+	maskv valid;
+
+	void SetLensData( int lane, const LensData& lensData )
+	{
+		B[lane] = lensData.B;
+		C[lane] = lensData.C;
+		D[lane] = lensData.D;
+		E[lane] = lensData.E;
+		F[lane] = lensData.F;
+		focalLength[lane] = lensData.focalLength;
+		entrancePupil[lane] = lensData.entrancePupil;
+		exitPupil[lane] = lensData.exitPupil;
+		entrancePupilRadius[lane] = lensData.entrancePupilRadius;
+		exitPupilRadius[lane] = lensData.exitPupilRadius;
+		principalPlaneFront[lane] = lensData.principalPlaneFront;
+	}
+
+	// the lens data of every lane from its wavelength and z, only the fields the active kernel reads
+	void FetchLensData( const LensDataTable& table )
+	{
+#if defined UsePolynomial || defined UseRayTable
+		// the polynomials and the ray table take the samples as they are
+#else
+#ifdef UseSSRT
+		static const LensField fields[] = { LENS_ENTRANCE_PUPIL, LENS_ENTRANCE_PUPIL_RADIUS, LENS_EXIT_PUPIL_RADIUS };
+		floatv* const out[] = { &entrancePupil, &entrancePupilRadius, &exitPupilRadius };
+#else
+		static const LensField fields[] = { LENS_B, LENS_C, LENS_D, LENS_E, LENS_F, LENS_FOCAL_LENGTH, LENS_ENTRANCE_PUPIL, LENS_EXIT_PUPIL,
+			LENS_ENTRANCE_PUPIL_RADIUS, LENS_EXIT_PUPIL_RADIUS, LENS_PRINCIPAL_PLANE_FRONT };
+		floatv* const out[] = { &B, &C, &D, &E, &F, &focalLength, &entrancePupil, &exitPupil, &entrancePupilRadius, &exitPupilRadius, &principalPlaneFront };
+#endif
+		table.Fetch( wavelength, z, fields, sizeof( fields ) / sizeof( fields[0] ), out );
+#endif
+	}
+
+	// fills an unused lane with the input of another one, so it stays finite
+	void CopyLane( int lane, int from )
+	{
+		for ( floatv* field : { &wavelength, &Psx, &Psy, &z, &_theta, &_rho } )
+			( *field )[lane] = ( *field )[from];
+	}
+};
+
+//
+// What all samples of one source pixel share, made once per pixel by DOF::SetupPixel
+//
+struct PixelSetup
+{
+	float3 color;	 // of the source pixel
+	float2 center;	 // light source position (P_s) of the pixel center, a sample adds its offset times pixelSize
+	float pixelSize; // on the light source plane
+	float depth2;	 // squared distance of the light source, z follows from this and P_s
+
+	const PupilRegion* pupilRegion; // where the pupil samples are drawn from, nullptr for the whole pupil
+	float pupilAngle;				 // of the light source, in turns, the angle pupilRegion is relative to
+};
+
+//
+// What all samples share as long as the lens, focus and aperture don't change, made by DOF::Prepare
+//
+struct LensSetup
+{
+	float zSensor;		// sensor plane for meanLensData at the Seidel focus distance, see ApplySeidel
+	float element0;		// axial position of the first lens element and its aperture squared, for the optical vignetting
+	float aperture0Sqr;
+};
+
+static_assert( SIMD_WIDTH % HERO_WAVELENGTHS == 0, "a batch holds whole pupil samples" );
+
 class DOF
 {
   public:
 	float3 sprite[65536];
 	LensData meanLensData;
+	SamplerType sampler = SAMPLER_SOBOL; // the sampler ApplyBatch uses, Apply gets one passed in
+	int heroWavelengths = HERO_WAVELENGTHS; // wavelengths per sample with ENABLE_CHROMATICS, a divisor of SIMD_WIDTH, Application::WavelengthsPerSample makes sure of that
+
+	LensSetup lensSetup; // of the last Prepare
+	PolynomialOptics polynomials; // fitted to the lens by Prepare with UsePolynomial
+	RayTable rayTable;			  // loaded for the lens by Prepare with UseRayTable
+	PupilRegions pupilRegions;	  // built by Prepare when the kernel vignettes
+	bool unvignettedSampling = false; // draw most pupil samples from pupilRegions, so fewer are thrown away; pays off on lenses that vignette strongly
+
+	static float HeroWavelength( float first, int wavelength, int wavelengths );
 
-	void Apply( float4 *inputImage, float4 *accumulator, float* cocMap, int x, int y, LensSystem *lensSystem, float brightness, bool fillCocMap );
-	float2 ApplySeidel( bool *valid, LensSystem *lensSystem, float focus_distance, float wavelength, LensData lensData, float2 Ps, float z, float2 Pprime0, float2 Pprime1, float theta, float rho );
+	void Prepare( LensSystem *lensSystem );
+	PixelSetup SetupPixel( const float4 *inputImage, int x, int y, LensSystem *lensSystem ) const;
+	PixelSetup SetupPixel( float4 pixel, int x, int y, LensSystem *lensSystem ) const; // color and depth of the pixel
+	void Apply( const PixelSetup &setup, SplatTarget *target, float* cocMap, int x, int y, LensSystem *lensSystem, float brightness, bool fillCocMap, Sampler *sampler );
+	void ApplyBatch( const PixelSetup &setup, SplatTarget *target, int x, int y, LensSystem *lensSystem, float brightness, int frame, int samples );
+	float2 ApplySeidel( bool *valid, LensData lensData, float2 Ps, float z, float2 Pprime0, float2 Pprime1, float2 direction, float rho );
+	void ApplySeidelBatch( SampleBatch *batch );
 	float2 ApplySSRT( bool *valid, LensSystem *lensSystem, float focus_distance, float wavelength, LensData lensData, float2 Ps, float z, float2 Pprime0 );
+	void ApplySSRTBatch( SampleBatch *batch, LensSystem *lensSystem );
+	float2 ApplyPolynomial( bool *valid, LensSystem *lensSystem, float wavelength, float2 Ps, float z, float2 pupil );
+	void ApplyPolynomialBatch( SampleBatch *batch, LensSystem *lensSystem );
+	float2 ApplyRayTable( bool *valid, LensSystem *lensSystem, float wavelength, float2 Ps, float z, float2 pupil );
+	void ApplyRayTableBatch( SampleBatch *batch, LensSystem *lensSystem );
 };
@@ -0,0 +1,92 @@
+#include "precomp.h"
+
+static const int STRIP = 32; // columns a pass transforms together, 128 bytes of every row of either plane
+static const int BLOCK = 32; // of the transpose
+
+FFT2D::FFT2D( int width, int height ) : width( width ), height( height )
+{
+	longest = std::max( width, height );
+	cosines.resize( longest / 2 );
+	sines.resize( longest / 2 );
+	for ( int k = 0; k < longest / 2; k++ )
+	{
+		double angle = -2.0 * 3.14159265358979323846 * k / longest;
+		cosines[k] = (float)cos( angle );
+		sines[k] = (float)sin( angle );
+	}
+}
+
+//
+// Transforms along the rows of re and im (rows x stride) for the columns from first to first + columns, in place: the
+// rows in bit reversed order, then the butterflies of every stage, each over the whole strip
+//
+void FFT2D::Pass( float* re, float* im, int rows, int stride, int first, int columns, bool inverse ) const
+{
+	int bits = 0;
+	while ( ( 1 << bits ) < rows ) bits++;
+	int end = first + columns;
+
+#pragma omp parallel for schedule( dynamic, 1 )
+	for ( int strip = first; strip < end; strip += STRIP )
+	{
+		int width = std::min( STRIP, end - strip );
+		float* R = re + strip;
+		float* I = im + strip;
+
+		for ( int r = 0; r < rows; r++ )
+		{
+			int reversed = 0;
+			for ( int b = 0; b < bits; b++ ) reversed |= ( ( r >> b ) & 1 ) << ( bits - 1 - b );
+			if ( r >= reversed ) continue;
+			std::swap_ranges( R + (size_t)r * stride, R + (size_t)r * stride + width, R + (size_t)reversed * stride );
+			std::swap_ranges( I + (size_t)r * stride, I + (size_t)r * stride + width, I + (size_t)reversed * stride );
+		}
+
+		for ( int length = 2; length <= rows; length *= 2 )
+		{
+			int half = length / 2, step = longest / length;
+			for ( int start = 0; start < rows; start += length )
+				for ( int k = 0; k < half; k++ )
+				{
+					float wr = cosines[k * step], wi = inverse ? -sines[k * step] : sines[k * step];
+					float* ar = R + (size_t)( start + k ) * stride;
+					float* ai = I + (size_t)( start + k ) * stride;
+					float* br = R + (size_t)( start + k + half ) * stride;
+					float* bi = I + (size_t)( start + k + half ) * stride;
+					for ( int c = 0; c < width; c++ )
+					{
+						float tr = br[c] * wr - bi[c] * wi, ti = br[c] * wi + bi[c] * wr;
+						br[c] = ar[c] - tr, bi[c] = ai[c] - ti;
+						ar[c] += tr, ai[c] += ti;
+					}
+				}
+		}
+	}
+}
+
+void FFT2D::Transpose( const float* in, float* out, int rows, int columns )
+{
+#pragma omp parallel for schedule( static )
+	for ( int r0 = 0; r0 < rows; r0 += BLOCK )
+		for ( int c0 = 0; c0 < columns; c0 += BLOCK )
+			for ( int c = c0; c < std::min( c0 + BLOCK, columns ); c++ )
+				for ( int r = r0; r < std::min( r0 + BLOCK, rows ); r++ )
+					out[(size_t)c * rows + r] = in[(size_t)r * columns + c];
+}
+
+void FFT2D::Forward( float* re, float* im, float* outRe, float* outIm, int columns ) const
+{
+	// the columns that are zero stay zero down the rows
+	Pass( re, im, height, width, 0, columns, false );
+	Transpose( re, outRe, height, width );
+	Transpose( im, outIm, height, width );
+	Pass( outRe, outIm, width, height, 0, height, false );
+}
+
+void FFT2D::Inverse( float* re, float* im, float* outRe, float* outIm, int first, int columns ) const
+{
+	Pass( re, im, width, height, 0, height, true );
+	Transpose( re, outRe, width, height );
+	Transpose( im, outIm, width, height );
+	Pass( outRe, outIm, height, width, first, columns, true );
+}
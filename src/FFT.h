@@ -0,0 +1,40 @@
+#pragma once
+
+//
+// Two dimensional FFTs of complex images, width x height, both powers of two, for PSFConvolution. The real and the
+// imaginary parts are separate planes, so two real images go through one transform as its two parts. Both dimensions
+// go through the same pass, which runs the radix 2 butterflies of the transforms down the rows for a strip of columns
+// at once, so every butterfly is a SIMD loop over contiguous memory that stays in L2; a blocked transpose in between
+// turns the other dimension into rows. The spectrum is kept transposed (width rows of height values), which pointwise
+// products don't mind, and that saves transposing it back.
+//
+class FFT2D
+{
+  public:
+	FFT2D( int width, int height );
+
+	// re and im (height x width) to their transposed spectrum in outRe and outIm (width x height), re and im are
+	// overwritten; only the first columns of re and im may be nonzero
+	void Forward( float* re, float* im, float* outRe, float* outIm, int columns ) const;
+
+	// a transposed spectrum (overwritten) back to an image in outRe and outIm (height x width), unnormalized, so
+	// multiplied by width * height; only the columns from first to first + columns of the image are transformed
+	void Inverse( float* re, float* im, float* outRe, float* outIm, int first, int columns ) const;
+
+	// the index of the negative frequency of index i of a transposed spectrum, for separating the spectra of two real
+	// images packed into one
+	int Negative( int i ) const
+	{
+		int x = i / height, y = i % height;
+		return ( ( width - x ) & ( width - 1 ) ) * height + ( ( height - y ) & ( height - 1 ) );
+	}
+
+	int width, height;
+
+  private:
+	void Pass( float* re, float* im, int rows, int stride, int first, int columns, bool inverse ) const;
+	static void Transpose( const float* in, float* out, int rows, int columns );
+
+	std::vector<float> cosines, sines; // of -2 pi k / longest for k < longest / 2, a shorter transform takes every other one
+	int longest;
+};
@@ -1,1430 +1,1513 @@
 #pragma once
-#include <map>
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <string>
-#include <vector>
 
-class Glass
+typedef std::array<float, 6> DispersionConstants;
+
+//
+// One glass of the catalog, the name as used in lens files and its dispersion constants
+//
+struct GlassEntry
 {
-public:
-	// returns the dispersion constants of a certain glass type
-	static std::vector<float> GetDispersionConstants( std::string material )
-	{
-		if ( material == "AIR" ) return { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
-		if ( material == "H-LAF50B" ) return { 3.07031881f, -0.0135921167f, 0.0258190179f, -1.6644976E-5f, 6.94966225E-5, -2.88382024E-6 };
-		if ( material == "F4" ) return { 2.5544667f, -0.00847847799f, 0.0232832892f, 0.000583809482f, 2.1963001E-5f, 1.96537708E-6f };
-		if ( material == "K5" ) return { 2.259379f, 0.009090504f, 0.02633942f, -0.003777418f, 0.0005228702f, -2.629182E-5f };
-		if ( material == "J-LASF015" ) return { 3.17452404f, -0.0132156517f, 0.0276472367f, 0.000483338934f, 1.20380702E-5f, 6.02649728E-7f };
+	const char* name;
+	DispersionConstants dc;
+};
 
-		// special materials
-		if ( material == "SUPRASIL" ) return { 1.10294f, 0.00114003f, 0.916395f, 0.00791467f, 0.082308f, 100.0f };  // best fit, calculated using Mathematica from data from https://www.heraeus.com/media/media/hca/doc_hca/products_and_solutions_8/optics/Data_and_Properties_Optics_fused_silica_EN.pdf
-		if ( material == "COC" ) return { 1.10635f, 0.254876f, 0.202124f, -0.0157115f, -0.00912351f, 0.00153054f }; // best fit, calculated using Mathematica from data from https://diverseoptics.com/wp-content/uploads/2012/02/Specifications_of_Optical_Grade_Polymers_and_Glass.pdf
-		if ( material == "AL-6263-(OKP4HT)" ) return { 1.601f, 0.0f, 7.622E-3, 1.127E9, -2.516E13, 0.0f };		  // from http://focenter.com/wp-content/uploads/2015/05/AngstromLink-AL-6261-6263-6264-6265.pdf
+//
+// The glass catalog, in the order the glasses were collected. When a name occurs more than once, the first entry wins.
+//
+inline constexpr GlassEntry glassCatalog[] = {
+	{ "AIR", { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f } },
+	{ "H-LAF50B", { 3.07031881f, -0.0135921167f, 0.0258190179f, -1.6644976E-5f, 6.94966225E-5, -2.88382024E-6 } },
+	{ "F4", { 2.5544667f, -0.00847847799f, 0.0232832892f, 0.000583809482f, 2.1963001E-5f, 1.96537708E-6f } },
+	{ "K5", { 2.259379f, 0.009090504f, 0.02633942f, -0.003777418f, 0.0005228702f, -2.629182E-5f } },
+	{ "J-LASF015", { 3.17452404f, -0.0132156517f, 0.0276472367f, 0.000483338934f, 1.20380702E-5f, 6.02649728E-7f } },
 
-		// data from https://refractiveindex.info/, using sellmeier equation (eq. 2)
-		if ( material == "BAH32" ) return { 1.498643f, 0.2175678f, 1.559728f, 0.009643255f, 0.04511666f, 171.1121f };
-		if ( material == "BAL15Y" ) return { 1.28348331f, 0.102800765f, 0.404609885f, 0.00790900515f, 0.0305971274f, 46.5268356f };
-		if ( material == "BAL35Y" ) return { 1.26231429f, 0.22515421f, 0.639119345f, 0.00695586355f, 0.0221310699f, 63.1662736f };
-		if ( material == "BAM3" ) return { 1.264742f, 0.189784f, 1.105094f, 0.007911881f, 0.03806705f, 133.8316f };
-		if ( material == "BPH5" ) return { 1.44845677f, 0.22044806f, 0.99476362f, 0.0092817361f, 0.0433001987f, 77.6475264f };
-		if ( material == "BPH8" ) return { 1.59323023f, 0.277775516f, 1.04070526f, 0.0103458172f, 0.0474089271f, 81.2863792f };
-		if ( material == "BPM51" ) return { 1.37436455f, 0.174025602f, 0.905485504f, 0.00877165624f, 0.0405249716f, 72.7685343f };
-		if ( material == "BSL7Y" ) return { 1.13329383f, 0.136897201f, 0.703456004f, 0.00669407868f, 0.023739176f, 70.7030316f };
-		if ( material == "BSM22" ) return { 1.35097f, 0.2324447f, 1.179f, 0.007454835f, 0.02949403f, 131.6202f };
-		if ( material == "BSM51Y" ) return { 1.22393171f, 0.306482383f, 0.823950901f, 0.00649521083f, 0.0208194161f, 79.5168951f };
-		if ( material == "BSM9" ) return { 1.095086f, 0.4642304f, 1.203056f, 0.005354893f, 0.02206781f, 133.3129f };
-		if ( material == "LAH78" ) return { 2.08122726f, 0.398632407f, 2.21679491f, 0.011190641f, 0.0521753272f, 141.893166f };
-		if ( material == "LAH80" ) return { 2.06636247f, 0.349315832f, 1.91746463f, 0.0122133846f, 0.0555959908f, 125.47362f };
-		if ( material == "LAL58" ) return { 1.53415f, 0.2744946f, 1.210527f, 0.008014497f, 0.03023701f, 118.7442f };
-		if ( material == "LAM58" ) return { 1.704423f, 0.1778568f, 1.425726f, 0.01024939f, 0.04576819f, 153.5267f };
-		if ( material == "LAM59" ) return { 1.626945f, 0.1906681f, 1.281079f, 0.008757497f, 0.03779724f, 123.7784f };
-		if ( material == "LAM61" ) return { 1.706024f, 0.182716f, 1.204833f, 0.009579771f, 0.04044097f, 127.571f };
-		if ( material == "LAM7" ) return { 1.734192f, 0.2314896f, 1.517096f, 0.01110755f, 0.05153277f, 163.4134f };
-		if ( material == "L-BAL35P" ) return { 0.806742194f, 0.690488648f, 1.26477947f, 0.0148836231f, 0.00251943058f, 111.31457f };
-		if ( material == "L-BAL35" ) return { 1.1626263f, 0.325661051f, 1.35132486f, 0.0125957437f, -0.0032691105f, 119.214596f };
-		if ( material == "L-BAL42P" ) return { 0.881090017f, 0.595038859f, 1.22582098f, 0.0148496655f, 0.00163577371f, 125.11372f };
-		if ( material == "L-BAL42" ) return { 1.39528097f, 0.072551952f, 1.66335848f, 0.011186203f, -0.0246748575f, 167.717958f };
-		if ( material == "L-BAL43" ) return { 1.04745291f, 0.428452873f, 1.14111303f, 0.00563209756f, 0.0188321416f, 114.197069f };
-		if ( material == "L-BBH1" ) return { 2.56597628f, 0.526892298f, 1.27957402f, 0.0205164012f, 0.0831737967f, 109.78774f };
-		if ( material == "L-BBH2" ) return { 2.53279005f, 0.583375125f, 1.5299288f, 0.0186909889f, 0.0765409078f, 112.197368f };
-		if ( material == "L-BSL7" ) return { 0.917473918f, 0.352687665f, 1.05579788f, 0.00527701411f, 0.0170809497f, 104.302583f };
-		if ( material == "L-LAH53" ) return { 1.87409991f, 0.297921402f, 1.35064285f, 0.00993318344f, 0.0405501825f, 100.5022f };
-		if ( material == "L-LAH81" ) return { 1.89927344f, 0.270978866f, 1.33163819f, 0.0102901828f, 0.0424227173f, 100.967566f };
-		if ( material == "L-LAH83" ) return { 1.82331579f, 0.548625885f, 1.63182855f, 0.00911468875f, 0.032841967f, 123.611174f };
-		if ( material == "L-LAH84P" ) return { 1.83485816f, 0.355717498f, 1.37757002f, 0.009788482f, 0.03837087f, 109.71692f };
-		if ( material == "L-LAH84" ) return { 1.83606127f, 0.341720032f, 1.35280173f, 0.00981969903f, 0.0385636264f, 107.04553f };
-		if ( material == "L-LAH85V" ) return { 1.97460503f, 0.361903592f, 1.38433241f, 0.0101854258f, 0.0384829118f, 103.713627f };
-		if ( material == "L-LAH85" ) return { 1.93889988f, 0.39787919f, 1.49937713f, 0.00996381644f, 0.036975114f, 107.951467f };
-		if ( material == "L-LAH86" ) return { 2.11102709f, 0.370368094f, 1.62687484f, 0.0120714135f, 0.0532464416f, 109.166396f };
-		if ( material == "L-LAH87" ) return { 1.44196269f, 0.617507311f, 1.21890079f, 0.00731826717f, 0.0245370775f, 105.976009f };
-		if ( material == "L-LAH90" ) return { 1.97595301f, 0.283924985f, 1.35176368f, 0.0104276395f, 0.0427708222f, 101.45371f };
-		if ( material == "L-LAH91" ) return { 1.26144128f, 0.782115273f, 1.15823645f, 0.00572512582f, 0.0219829752f, 88.04822f };
-		if ( material == "L-LAH94" ) return { 2.0062142f, 0.347029888f, 1.41688382f, 0.0105499238f, 0.0445845013f, 105.99525f };
-		if ( material == "L-LAL12" ) return { 1.28516283f, 0.478333797f, 1.21605301f, 0.00641062082f, 0.0214815099f, 100.243378f };
-		if ( material == "L-LAL13" ) return { 1.17776146f, 0.634591345f, 1.20435649f, 0.00557618243f, 0.0206821469f, 99.6322776f };
-		if ( material == "L-LAL15" ) return { 1.07959634f, 0.731872134f, 1.17111107f, 0.00470047543f, 0.0198615758f, 87.03599f };
-		if ( material == "L-LAM60" ) return { 1.47574184f, 0.496132743f, 1.23796236f, 0.0073695f, 0.0251891746f, 98.0306651f };
-		if ( material == "L-LAM69" ) return { 1.7403896f, 0.176996917f, 1.76775413f, 0.010339887f, 0.0484822765f, 136.671996f };
-		if ( material == "L-LAM72" ) return { 1.50483297f, 0.433346414f, 1.2714921f, 0.0075034233f, 0.026900952f, 95.7631272f };
-		if ( material == "L-NBH54" ) return { 2.00722652f, 0.442086773f, 3.37287426f, 0.0135705124f, 0.0591808873f, 219.832665f };
-		if ( material == "L-PHL1" ) return { 1.07570798f, 0.335020347f, 0.810997558f, 0.00591654042f, 0.0203432769f, 106.182158f };
-		if ( material == "L-PHL2" ) return { 1.08137176f, 0.31325766f, 0.879192863f, 0.00594210177f, 0.0198011567f, 109.893817f };
-		if ( material == "L-TIH53" ) return { 1.83464643f, 0.415079602f, 2.82563492f, 0.0134992001f, 0.0618608854f, 201.62917f };
-		if ( material == "L-TIM28P" ) return { 1.53013396f, 0.24536228f, 1.78233031f, 0.0114236857f, 0.0555101852f, 179.0743f };
-		if ( material == "L-TIM28" ) return { 1.52780829f, 0.232776367f, 1.71638781f, 0.0114135883f, 0.0559068566f, 171.5118f };
-		if ( material == "PBH1" ) return { 1.55408138f, 0.289397861f, 1.06727944f, 0.0120146818f, 0.0532883208f, 122.863029f };
-		if ( material == "PBH3" ) return { 1.59470208f, 0.317791814f, 1.29219485f, 0.0122277091f, 0.0544975824f, 147.63368f };
-		if ( material == "PBH55" ) return { 1.81022611f, 0.447772917f, 1.12017569f, 0.013972897f, 0.0582195245f, 120.984115f };
-		if ( material == "PBH56" ) return { 1.78552677f, 0.446684871f, 1.21749317f, 0.0136046011f, 0.0570875152f, 129.967536f };
-		if ( material == "PBH71" ) return { 1.97039844f, 0.520330498f, 1.30696186f, 0.0155780448f, 0.0632642123f, 142.045097f };
-		if ( material == "PBL1Y" ) return { 1.24772961f, 0.101954909f, 0.350479619f, 0.00926606623f, 0.0451754311f, 45.0186705f };
-		if ( material == "PBL25Y" ) return { 1.31960626f, 0.123752633f, 0.210055351f, 0.0101863415f, 0.0483593508f, 27.3272029f };
-		if ( material == "PBL26" ) return { 1.23494993f, 0.169136142f, 1.09067013f, 0.00862847509f, 0.0422686058f, 132.796906f };
-		if ( material == "PBL26Y" ) return { 1.29471773f, 0.108880981f, 0.220322964f, 0.00986579479f, 0.0477568828f, 28.8509863f };
-		if ( material == "PBL35Y" ) return { 1.31884698f, 0.125014653f, 0.215794324f, 0.0101474939f, 0.0481636043f, 28.5517448f };
-		if ( material == "PBL6Y" ) return { 1.22310794f, 0.0811217929f, 0.321400939f, 0.00897805333f, 0.0445756957f, 40.5962247f };
-		if ( material == "PBM18Y" ) return { 1.34660215f, 0.136322343f, 0.183371587f, 0.0106313733f, 0.0491403013f, 23.9154655f };
-		if ( material == "PBM2Y" ) return { 1.39446503f, 0.159230985f, 0.245470216f, 0.0110571872f, 0.0507194882f, 31.4440142f };
-		if ( material == "PBM3" ) return { 1.32567543f, 0.208112474f, 1.15985207f, 0.00973013804f, 0.046285933f, 137.559854f };
-		if ( material == "PBM8Y" ) return { 1.35351322f, 0.130212912f, 0.158337266f, 0.0105624626f, 0.0496606652f, 20.7965806f };
-		if ( material == "S-BAH10" ) return { 1.59034337f, 0.138464579f, 1.21988043f, 0.0093273434f, 0.0427498654f, 119.251777f };
-		if ( material == "S-BAH11" ) return { 1.5713886f, 0.147869313f, 1.28092846f, 0.00910807936f, 0.0402401684f, 130.399367f };
-		if ( material == "S-BAH27" ) return { 1.68939052f, 0.133081013f, 1.41165515f, 0.0103598193f, 0.0533982239f, 126.515503f };
-		if ( material == "S-BAH28" ) return { 1.69493484f, 0.192890298f, 1.56385948f, 0.010272319f, 0.052118764f, 137.818035f };
-		if ( material == "S-BAH32" ) return { 1.5802363f, 0.137504632f, 1.60603298f, 0.0103578062f, 0.0548393088f, 147.982885f };
-		if ( material == "S-BAL11" ) return { 0.821314256f, 0.612586478f, 1.24859637f, 0.00351436131f, 0.0179762375f, 133.45667f };
-		if ( material == "S-BAL12" ) return { 0.714605258f, 0.621993289f, 1.22537681f, 0.00301763913f, 0.016650545f, 143.506314f };
-		if ( material == "S-BAL14" ) return { 1.27553696f, 0.146083393f, 1.16754699f, 0.00749692359f, 0.031042153f, 128.947092f };
-		if ( material == "S-BAL22" ) return { 1.16333541f, 0.26332321f, 1.12551059f, 0.0118079103f, -0.00438112893f, 106.905682f };
-		if ( material == "S-BAL2" ) return { 1.30923813f, 0.114137353f, 1.17882259f, 0.00838873953f, 0.0399436485f, 140.257892f };
-		if ( material == "S-BAL35" ) return { 0.941357273f, 0.546174895f, 1.16168917f, 0.0140333996f, 0.000906635683f, 114.163758f };
-		if ( material == "S-BAL3" ) return { 1.2936689f, 0.132440252f, 1.10197293f, 0.00800367962f, 0.0354711196f, 134.517431f };
-		if ( material == "S-BAL41" ) return { 1.243442f, 0.166301104f, 1.10586114f, 0.0116396708f, -0.00890464938f, 114.11122f };
-		if ( material == "S-BAL42" ) return { 1.39570615f, 0.071850507f, 1.27129267f, 0.0112218843f, -0.0252117422f, 134.49786f };
-		if ( material == "S-BAM12" ) return { 1.50161605f, 0.126987445f, 1.43544052f, 0.00940761826f, 0.0472602195f, 141.666499f };
-		if ( material == "S-BAM3" ) return { 1.36955358f, 0.0853825867f, 1.16159771f, 0.00941331434f, 0.0504359027f, 130.548899f };
-		if ( material == "S-BAM4" ) return { 1.41059317f, 0.111201306f, 1.34148939f, 0.00963312192f, 0.049877821f, 152.237696f };
-		if ( material == "S-BSL7" ) return { 1.1515019f, 0.118583612f, 1.26301359f, 0.010598413f, -0.011822519f, 129.617662f };
-		if ( material == "S-BSM10" ) return { 0.945443081f, 0.643237376f, 1.17752968f, 0.0157263798f, 0.00161924066f, 121.361748f };
-		if ( material == "S-BSM14" ) return { 1.2828627f, 0.247647429f, 1.10383999f, 0.0122902399f, -0.00613142361f, 106.883378f };
-		if ( material == "S-BSM15" ) return { 0.953128328f, 0.637613977f, 1.65245647f, 0.00387638985f, 0.0185094632f, 159.442367f };
-		if ( material == "S-BSM16" ) return { 1.14490383f, 0.439563911f, 1.27688079f, 0.0137034916f, -0.00186514205f, 119.535585f };
-		if ( material == "S-BSM18" ) return { 0.927886025f, 0.708858526f, 1.18610897f, 0.00417549199f, 0.0184691838f, 122.210416f };
-		if ( material == "S-BSM21" ) return { 1.47867898f, 0.0899501399f, 1.03056525f, 0.00869705653f, 0.0399353993f, 108.550949f };
-		if ( material == "S-BSM22" ) return { 1.44305741f, 0.140786358f, 1.26093951f, 0.0081920891f, 0.0356911455f, 131.959337f };
-		if ( material == "S-BSM25" ) return { 1.34814257f, 0.347530319f, 1.38798368f, 0.00695364366f, 0.0277863478f, 142.138122f };
-		if ( material == "S-BSM28" ) return { 1.43822841f, 0.128100017f, 1.3435553f, 0.0085977975f, 0.0408617854f, 143.70989f };
-		if ( material == "S-BSM2" ) return { 0.867168676f, 0.672848343f, 1.18456107f, 0.00369311003f, 0.0181652804f, 132.376147f };
-		if ( material == "S-BSM4" ) return { 0.96244308f, 0.595939234f, 1.10558352f, 0.00468062141f, 0.0178772082f, 115.896432f };
-		if ( material == "S-BSM71" ) return { 1.50847885f, 0.158099826f, 1.36815368f, 0.00812769076f, 0.0354200898f, 136.110038f };
-		if ( material == "S-BSM81" ) return { 0.996356844f, 0.651392837f, 1.22432622f, 0.0144821587f, 0.00154826389f, 89.9818604f };
-		if ( material == "S-BSM9" ) return { 1.37020077f, 0.189397267f, 1.24202324f, 0.00757631457f, 0.0300787515f, 131.350111f };
-		if ( material == "S-FPL51" ) return { 1.17010505f, 0.0475710783f, 0.763832445f, 0.00616203924f, 0.0263372876f, 141.882642f };
-		if ( material == "S-FPL51Y" ) return { 1.14031443f, 0.0771496272f, 1.43721957f, 0.00595466872f, 0.0223953953f, 274.290057f };
-		if ( material == "S-FPL52" ) return { 1.06785857f, 0.0335857718f, 1.10219763f, 0.00699227302f, -0.0207608925f, 226.496541f };
-		if ( material == "S-FPL53" ) return { 0.983532327f, 0.069568814f, 1.11409238f, 0.00492234955f, 0.0193581091f, 264.275294f };
-		if ( material == "S-FPL55" ) return { 0.839067682f, 0.214083503f, 1.47914677f, 0.00795286639f, -0.00232581717f, 340.0437f };
-		if ( material == "S-FPM2" ) return { 0.761242785f, 0.747033375f, 0.938928947f, 0.00321174095f, 0.0140234423f, 139.52353f };
-		if ( material == "S-FPM3" ) return { 0.809407286f, 0.527007033f, 0.909127704f, 0.00376072389f, 0.0135654895f, 142.503612f };
-		if ( material == "S-FSL5" ) return { 1.17447043f, 0.0140056154f, 1.19272435f, 0.00841855181f, -0.0581790767f, 129.599726f };
-		if ( material == "S-FSL5Y" ) return { 0.977409944f, 0.210950834f, 1.37142848f, 0.00557649364f, 0.0177000313f, 149.211443f };
-		if ( material == "S-FTL10" ) return { 1.10542993f, 0.116184325f, 1.15396111f, 0.00669004168f, 0.0360840691f, 137.546485f };
-		if ( material == "S-FTM16" ) return { 1.32940907f, 0.141512125f, 1.44299068f, 0.0102377287f, 0.0578081956f, 150.597139f };
-		if ( material == "TIFN5" ) return { 1.32940907f, 0.141512125f, 1.44299068f, 0.0102377287f, 0.0578081956f, 150.597139f };
-		if ( material == "S-LAH51" ) return { 1.82586991f, 0.283023349f, 1.35964319f, 0.00935297152f, 0.0373803057f, 100.655798f };
-		if ( material == "S-LAH52Q" ) return { 1.91082318f, 0.239854589f, 1.16159733f, 0.0103565352f, 0.0413805081f, 96.60373f };
-		if ( material == "S-LAH52" ) return { 1.85390925f, 0.297925555f, 1.39382086f, 0.00955320687f, 0.039381685f, 102.706848f };
-		if ( material == "S-LAH53V" ) return { 1.96600955f, 0.205143305f, 1.23200934f, 0.0107817785f, 0.0463727869f, 97.69406f };
-		if ( material == "S-LAH53" ) return { 1.91811619f, 0.253724399f, 1.39473885f, 0.0102147684f, 0.0433176011f, 101.938021f };
-		if ( material == "S-LAH55VS" ) return { 1.92591095f, 0.34895346f, 1.42230744f, 0.0096115249f, 0.036513298f, 103.36409f };
-		if ( material == "S-LAH55V" ) return { 1.97025325f, 0.30489414f, 1.39214665f, 0.00991088134f, 0.0383202295f, 97.7785249f };
-		if ( material == "S-LAH55" ) return { 1.95615766f, 0.319216215f, 1.39173189f, 0.00979338965f, 0.0376836296f, 94.8775271f };
-		if ( material == "S-LAH58" ) return { 1.78764964f, 0.6526356f, 1.79914564f, 0.00847378536f, 0.0313126408f, 132.788001f };
-		if ( material == "S-LAH59" ) return { 1.51372967f, 0.702462343f, 1.33600982f, 0.00705246901f, 0.0249488689f, 100.085908f };
-		if ( material == "S-LAH60V" ) return { 2.05081962f, 0.208475257f, 1.31486394f, 0.0116035991f, 0.0526489359f, 99.38065f };
-		if ( material == "S-LAH60" ) return { 1.95243469f, 0.30710021f, 1.56578094f, 0.0106442437f, 0.0456735302f, 110.28141f };
-		if ( material == "S-LAH63Q" ) return { 1.96723017f, 0.194953915f, 1.25386282f, 0.0110456086f, 0.0497137061f, 104.84352f };
-		if ( material == "S-LAH63" ) return { 1.89458276f, 0.268702978f, 1.45705526f, 0.0102277048f, 0.0442801243f, 104.874927f };
-		if ( material == "S-LAH64" ) return { 1.83021453f, 0.29156359f, 1.28544024f, 0.0090482329f, 0.0330756689f, 89.3675501f };
-		if ( material == "S-LAH65VS" ) return { 1.76068422f, 0.414128906f, 1.33415439f, 0.00853607198f, 0.0301826383f, 98.09421f };
-		if ( material == "S-LAH65V" ) return { 1.81419034f, 0.361376301f, 1.32729484f, 0.00874935029f, 0.0318352836f, 91.3406898f };
-		if ( material == "S-LAH65" ) return { 1.68191258f, 0.493779818f, 1.45682822f, 0.0077668425f, 0.0288916181f, 99.2574356f };
-		if ( material == "S-LAH66" ) return { 1.39280586f, 0.679577094f, 1.38702069f, 0.00608475118f, 0.0233925351f, 95.8354094f };
-		if ( material == "S-LAH71" ) return { 1.98280031f, 0.31675845f, 2.44472646f, 0.0118987456f, 0.0527156001f, 213.220697f };
-		if ( material == "S-LAH79" ) return { 2.32557148f, 0.507967133f, 2.43087198f, 0.0132895208f, 0.0528335449f, 161.122408f };
-		if ( material == "S-LAH88" ) return { 2.1284434f, 0.405082139f, 1.67918461f, 0.0117309815f, 0.0508706599f, 107.091456f };
-		if ( material == "S-LAH89" ) return { 1.95118827f, 0.377607223f, 1.47757262f, 0.00976560799f, 0.0382232043f, 112.23672f };
-		if ( material == "S-LAH92" ) return { 2.10440311f, 0.358346161f, 1.63010064f, 0.0108531811f, 0.044340592f, 123.2498f };
-		if ( material == "S-LAH93" ) return { 2.17884378f, 0.325508683f, 1.70608646f, 0.0115760879f, 0.0495982503f, 128.91358f };
-		if ( material == "S-LAH95" ) return { 2.15636617f, 0.329558178f, 1.72178935f, 0.012288051f, 0.0555507835f, 124.43934f };
-		if ( material == "S-LAH96" ) return { 1.85078519f, 0.189204854f, 1.19763137f, 0.00940657541f, 0.0380345187f, 101.426835f };
-		if ( material == "S-LAH97" ) return { 1.0273018f, 0.989293564f, 1.25781057f, 0.0183406129f, 0.00371264195f, 87.85105f };
-		if ( material == "S-LAL10" ) return { 1.52812575f, 0.367965267f, 1.11751784f, 0.00776817644f, 0.0272026548f, 88.86974f };
-		if ( material == "S-LAL12" ) return { 0.992053895f, 0.771377731f, 1.18296264f, 0.0167095063f, 0.00236750156f, 105.90108f };
-		if ( material == "S-LAL13" ) return { 0.980071267f, 0.832904776f, 1.28111995f, 0.00389123698f, 0.0189164592f, 98.9052676f };
-		if ( material == "S-LAL14" ) return { 1.2372097f, 0.589722623f, 1.3192188f, 0.015355132f, -0.00030789625f, 93.7202947f };
-		if ( material == "S-LAL18" ) return { 1.50276318f, 0.430224497f, 1.3472606f, 0.0145462356f, -0.00332784153f, 93.3508342f };
-		if ( material == "S-LAL19" ) return { 0.973997577f, 0.958186322f, 1.20163359f, 0.00379332678f, 0.0177574581f, 83.79896f };
-		if ( material == "S-LAL20" ) return { 1.06788467f, 0.75873535f, 1.02804682f, 0.00518896058f, 0.0204004357f, 120.82632f };
-		if ( material == "S-LAL54Q" ) return { 0.920085087f, 0.758646115f, 1.07073096f, 0.0160829667f, 0.00292059306f, 85.12112f };
-		if ( material == "S-LAL54" ) return { 1.41910189f, 0.258416881f, 1.07385537f, 0.00726647428f, 0.0263842499f, 102.555463f };
-		if ( material == "S-LAL56" ) return { 1.54052f, 0.217748704f, 1.30456122f, 0.00826765101f, 0.0328533726f, 124.527479f };
-		if ( material == "S-LAL58" ) return { 1.06368789f, 0.744939067f, 1.59178942f, 0.018519964f, 0.00116295862f, 156.636025f };
-		if ( material == "S-LAL59" ) return { 1.13962742f, 0.805227838f, 1.29488061f, 0.00493294862f, 0.020247996f, 93.4746507f };
-		if ( material == "S-LAL61" ) return { 1.11073292f, 0.859347773f, 1.26707433f, 0.00464181248f, 0.0192989261f, 87.3917698f };
-		if ( material == "S-LAL7" ) return { 0.916121247f, 0.765948319f, 1.27745023f, 0.00395889743f, 0.0167547425f, 110.762706f };
-		if ( material == "S-LAL8" ) return { 1.30663291f, 0.571377253f, 1.24303605f, 0.00611862448f, 0.021272147f, 90.6285686f };
-		if ( material == "S-LAL9" ) return { 1.16195687f, 0.644860099f, 1.25062221f, 0.0159659509f, 0.000505502467f, 93.8284169f };
-		if ( material == "S-LAM2" ) return { 1.7713f, 0.19581423f, 1.19487834f, 0.00976652444f, 0.0412718628f, 110.458122f };
-		if ( material == "S-LAM3" ) return { 1.64258713f, 0.23963461f, 1.22483026f, 0.0086824602f, 0.0351226242f, 116.604369f };
-		if ( material == "S-LAM51" ) return { 1.638472f, 0.188330533f, 1.47502357f, 0.00904853452f, 0.0372740173f, 137.77005f };
-		if ( material == "S-LAM52" ) return { 1.73442942f, 0.15155391f, 1.46225433f, 0.0100690928f, 0.0470634701f, 140.084396f };
-		if ( material == "S-LAM54" ) return { 1.84213306f, 0.175468631f, 1.25750878f, 0.0094399322f, 0.0395281122f, 86.5463013f };
-		if ( material == "S-LAM55" ) return { 1.85412979f, 0.165450323f, 1.27255422f, 0.0108438152f, 0.051405098f, 109.986837f };
-		if ( material == "S-LAM58" ) return { 1.70984856f, 0.173342897f, 1.64833565f, 0.0100852127f, 0.0470890831f, 157.46852f };
-		if ( material == "S-LAM59" ) return { 1.63056133f, 0.186994897f, 1.30014289f, 0.00899690705f, 0.0368011993f, 122.239544f };
-		if ( material == "S-LAM60" ) return { 1.60673056f, 0.36641564f, 1.31761804f, 0.0077504614f, 0.0289967611f, 93.0720709f };
-		if ( material == "S-LAM61" ) return { 1.7388333f, 0.15093743f, 1.12118445f, 0.00980244105f, 0.0433179685f, 101.214625f };
-		if ( material == "S-LAM66" ) return { 1.92094221f, 0.219901208f, 1.72705231f, 0.0115075241f, 0.0547993543f, 120.133674f };
-		if ( material == "S-LAM73" ) return { 1.86353123f, 0.255215617f, 1.23399133f, 0.0107620673f, 0.0487248679f, 117.12511f };
-		if ( material == "S-LAM7" ) return { 1.71014712f, 0.256943292f, 1.63986271f, 0.010516108f, 0.0502809636f, 146.181217f };
-		if ( material == "S-NBH51" ) return { 1.71203689f, 0.255989588f, 1.81456998f, 0.0107724134f, 0.0488593504f, 136.359013f };
-		if ( material == "S-NBH52V" ) return { 1.51336868f, 0.212341478f, 1.54149143f, 0.00987077827f, 0.0462843662f, 126.97851f };
-		if ( material == "S-NBH52" ) return { 1.50305799f, 0.221715926f, 1.84496391f, 0.00999021738f, 0.0450327698f, 163.722302f };
-		if ( material == "S-NBH53V" ) return { 1.65444141f, 0.267453927f, 2.14530347f, 0.0112485533f, 0.052027274f, 167.3661f };
-		if ( material == "S-NBH53" ) return { 1.6582834f, 0.263275666f, 2.10142759f, 0.0113872516f, 0.0522108137f, 165.523649f };
-		if ( material == "S-NBH55" ) return { 1.83145156f, 0.287818024f, 2.152083f, 0.0122443139f, 0.057387731f, 186.099124f };
-		if ( material == "S-NBH56" ) return { 1.85191438f, 0.431102852f, 3.45278284f, 0.013273262f, 0.0585944644f, 239.357089f };
-		if ( material == "S-NBH57" ) return { 1.92026488f, 0.37153524f, 2.55205704f, 0.0118468028f, 0.0532105472f, 204.5493f };
-		if ( material == "S-NBH5" ) return { 1.47544521f, 0.193060095f, 1.5093901f, 0.0095583674f, 0.0460430483f, 126.422746f };
-		if ( material == "S-NBH8" ) return { 1.61344136f, 0.257295888f, 1.98364455f, 0.0106386752f, 0.0487071624f, 159.784404f };
-		if ( material == "S-NBM51" ) return { 1.37023101f, 0.177665568f, 1.30515471f, 0.00871920342f, 0.0405725552f, 112.703058f };
-		if ( material == "S-NPH1W" ) return { 1.75156623f, 0.364006304f, 2.47874141f, 0.0135004681f, 0.0668245147f, 170.756006f };
-		if ( material == "S-NPH1" ) return { 1.75156623f, 0.364006304f, 2.47874141f, 0.0135004681f, 0.0668245147f, 170.756006f };
-		if ( material == "S-NPH2" ) return { 2.0386951f, 0.437269641f, 2.96711461f, 0.0170796224f, 0.0749254813f, 174.155354f };
-		if ( material == "S-NPH3" ) return { 2.09834903f, 0.489088388f, 2.94009268f, 0.0179123869f, 0.0776653353f, 160.930428f };
-		if ( material == "S-NPH4" ) return { 1.93563931f, 0.449596478f, 2.71828573f, 0.0152585289f, 0.0696815778f, 170.327149f };
-		if ( material == "S-NPH53" ) return { 1.85484904f, 0.396194484f, 2.43512461f, 0.0134621486f, 0.0631945361f, 170.864886f };
-		if ( material == "S-NPH5" ) return { 1.89108996f, 0.395220126f, 2.20492127f, 0.0141164499f, 0.0662834445f, 148.6807f };
-		if ( material == "S-NSL2" ) return { 0.951239368f, 0.313094652f, 1.70928507f, 0.00513091895f, 0.0231960516f, 201.539573f };
-		if ( material == "S-NSL36" ) return { 1.09666153f, 0.168990073f, 1.20580827f, 0.00667491123f, 0.033609545f, 141.668738f };
-		if ( material == "S-NSL3" ) return { 0.882514764f, 0.389271907f, 1.10693448f, 0.00464504582f, 0.0200551397f, 136.234339f };
-		if ( material == "S-NSL5" ) return { 1.04574577f, 0.239613026f, 1.1590685f, 0.0058523228f, 0.0236858752f, 131.329061f };
-		if ( material == "S-PHM52" ) return { 1.0996655f, 0.478125422f, 1.13214074f, 0.0132718559f, -0.000601649685f, 130.595472f };
-		if ( material == "S-PHM53" ) return { 1.09775423f, 0.434816432f, 1.13894976f, 0.01233694f, -0.000372522903f, 124.276984f };
-		if ( material == "S-TIH10" ) return { 1.61549392f, 0.262433239f, 2.09426189f, 0.0119830897f, 0.059651024f, 181.657554f };
-		if ( material == "S-TIH11" ) return { 1.72677471f, 0.324568628f, 2.65816809f, 0.0129369958f, 0.0618255245f, 221.904637f };
-		if ( material == "S-TIH13" ) return { 1.62224674f, 0.293844589f, 1.99225164f, 0.0118368386f, 0.0590208025f, 171.959976f };
-		if ( material == "S-TIH14" ) return { 1.68915108f, 0.290462024f, 2.37971516f, 0.0128202514f, 0.0618090841f, 201.094352f };
-		if ( material == "S-TIH18" ) return { 1.59921608f, 0.259532164f, 2.12454543f, 0.0116469304f, 0.0584824883f, 186.927779f };
-		if ( material == "S-TIH1" ) return { 1.60326759f, 0.242980935f, 1.81313592f, 0.0118019139f, 0.0591363658f, 161.218747f };
-		if ( material == "S-TIH20" ) return { 1.59255052f, 0.218805922f, 1.60254262f, 0.0119420495f, 0.0592770292f, 143.961778f };
-		if ( material == "S-TIH23" ) return { 1.73986485f, 0.313894918f, 2.31093206f, 0.01294413f, 0.0612116868f, 197.420482f };
-		if ( material == "S-TIH3" ) return { 1.64797648f, 0.267261917f, 2.19772845f, 0.0121917693f, 0.0597893039f, 192.15834f };
-		if ( material == "S-TIH4" ) return { 1.66755531f, 0.294411865f, 2.49422119f, 0.0122052137f, 0.0597775329f, 214.869618f };
-		if ( material == "SFL4" ) return { 1.66755531f, 0.294411865f, 2.49422119f, 0.0122052137f, 0.0597775329f, 214.869618f }; // waarschijnlijk fout
-		if ( material == "S-TIH53W" ) return { 1.87904886f, 0.369719775f, 2.33730863f, 0.014412177f, 0.063881799f, 182.66818f };
-		if ( material == "S-TIH53" ) return { 1.87904886f, 0.369719775f, 2.33730863f, 0.014412177f, 0.063881799f, 182.66818f };
-		if ( material == "S-TIH57" ) return { 2.21103256f, 0.450346986f, 2.47746663f, 0.0142330268f, 0.0638573392f, 161.9376f };
-		if ( material == "S-TIH6" ) return { 1.77227611f, 0.34569125f, 2.40788501f, 0.0131182633f, 0.0614479619f, 200.753254f };
-		if ( material == "S-TIL1" ) return { 1.25088944f, 0.0997973327f, 1.20583504f, 0.00883921279f, 0.0482685052f, 137.414953f };
-		if ( material == "S-TIL25" ) return { 1.32122534f, 0.123824976f, 1.43685254f, 0.00952091436f, 0.0516062665f, 149.064883f };
-		if ( material == "S-TIL26" ) return { 1.31066488f, 0.0941903094f, 1.23292644f, 0.00968897812f, 0.0527763106f, 133.296422f };
-		if ( material == "S-TIL27" ) return { 1.31433154f, 0.112300168f, 1.413901f, 0.00950404477f, 0.0524112772f, 148.429972f };
-		if ( material == "S-TIL2" ) return { 1.23401499f, 0.0959796833f, 1.20503991f, 0.00869507801f, 0.0465611429f, 137.953301f };
-		if ( material == "S-TIL6" ) return { 1.17701777f, 0.12795803f, 1.34740124f, 0.00771087686f, 0.0411325328f, 154.531692f };
-		if ( material == "S-TIM1" ) return { 1.4496383f, 0.122986408f, 1.38066723f, 0.0112094282f, 0.059626577f, 138.178326f };
-		if ( material == "S-TIM22" ) return { 1.44222294f, 0.194432265f, 1.74092482f, 0.0104249404f, 0.0550235257f, 169.710769f };
-		if ( material == "S-TIM25" ) return { 1.50659233f, 0.204786135f, 1.92036668f, 0.0109501562f, 0.0574980285f, 178.128535f };
-		if ( material == "S-TIM27" ) return { 1.4168047f, 0.196785057f, 1.68001322f, 0.0100732158f, 0.0537616908f, 164.672436f };
-		if ( material == "S-TIM28" ) return { 1.5427081f, 0.217113891f, 1.81904459f, 0.0113925005f, 0.0579224572f, 167.697189f };
-		if ( material == "S-TIM2" ) return { 1.42193846f, 0.133827968f, 1.45060574f, 0.0107291511f, 0.0572587546f, 145.381805f };
-		if ( material == "S-TIM35" ) return { 1.55849775f, 0.230767007f, 1.84436099f, 0.0115367235f, 0.0586095947f, 162.981888f };
-		if ( material == "S-TIM39" ) return { 1.47008105f, 0.224752746f, 2.44968592f, 0.0102900432f, 0.0541276904f, 237.43494f };
-		if ( material == "S-TIM3" ) return { 1.40691144f, 0.128369745f, 1.51826191f, 0.0105633641f, 0.0568483105f, 152.107924f };
-		if ( material == "S-TIM5" ) return { 1.38531342f, 0.122372945f, 1.40508326f, 0.0104074567f, 0.0557440088f, 144.878733f };
-		if ( material == "S-TIM6" ) return { 1.41315067f, 0.1914654f, 1.68833255f, 0.00995172814f, 0.0527932739f, 168.804627f };
-		if ( material == "S-TIM8" ) return { 1.37262713f, 0.112636276f, 1.39786421f, 0.0103220068f, 0.0550195044f, 147.735609f };
-		if ( material == "S-YGH51" ) return { 1.0828017f, 0.933988681f, 1.32367286f, 0.018115636f, 0.00304157575f, 91.0353195f };
-		if ( material == "N-LAK33" ) return { 1.0828017f, 0.933988681f, 1.32367286f, 0.018115636f, 0.00304157575f, 91.0353195f }; // wschl
-		if ( material == "BAFN6" ) return { 1.36719201f, 0.10907994f, 1.02108011f, 0.00882820704f, 0.0438731646f, 113.58602f };
-		if ( material == "BK7G18" ) return { 1.26538542f, 0.0144191073f, 1.00323028f, 0.00813104078f, 0.0543303226f, 102.821166f };
-		if ( material == "F2G12" ) return { 1.34702224f, 0.210037763f, 19.5350768f, 0.00980850553f, 0.0471788018f, 2279.1547f };
-		if ( material == "F2HT" ) return { 1.34533359f, 0.209073176f, 0.937357162f, 0.00997743871f, 0.0470450767f, 111.886764f };
-		if ( material == "F2" ) return { 1.34533359f, 0.209073176f, 0.937357162f, 0.00997743871f, 0.0470450767f, 111.886764f };
-		if ( material == "FN11" ) return { 1.34533359f, 0.209073176f, 0.937357162f, 0.00997743871f, 0.0470450767f, 111.886764f }; // ??
-		if ( material == "F5" ) return { 1.3104463f, 0.19603426f, 0.96612977f, 0.00958633048f, 0.0457627627f, 115.011883f };
-		if ( material == "FK3" ) return { 0.973346627f, 0.146642231f, 0.679304225f, 0.00640795469f, 0.020565293f, 80.4965389f };
-		if ( material == "FK5HTi" ) return { 0.90936218f, 0.279077054f, 0.891813298f, 0.0052014247f, 0.0158938446f, 95.9109448f };
-		if ( material == "K10" ) return { 1.15687082f, 0.0642625444f, 0.872376139f, 0.00809424251f, 0.0386051284f, 104.74773f };
-		if ( material == "K5G20" ) return { 1.14094396f, 0.14500119f, 37.4705786f, 0.00694945478f, 0.0310574444f, 4536.25624f };
-		if ( material == "K7" ) return { 1.1273555f, 0.124412303f, 0.827100531f, 0.00720341707f, 0.0269835916f, 100.384588f };
-		if ( material == "KZFS12" ) return { 1.55624873f, 0.239769276f, 0.947887658f, 0.0102012744f, 0.0469277969f, 69.8370722f };
-		if ( material == "KZFSN4" ) return { 1.37994218f, 0.168496708f, 0.874885726f, 0.00891159699f, 0.040533407f, 69.6628237f };
-		if ( material == "LAFN7" ) return { 1.66842615f, 0.298512803f, 1.0774376f, 0.0103159999f, 0.0469216348f, 82.5078509f };
-		if ( material == "LAK9G15" ) return { 1.28773667f, 0.518244853f, 26.1756109f, 0.0055754192f, 0.0223679524f, 1892.2533f };
-		if ( material == "LAKL12" ) return { 1.28115389f, 0.482607607f, 1.16553538f, 0.00636439821f, 0.0213764262f, 93.2771532f };
-		if ( material == "LASF35" ) return { 2.45505861f, 0.453006077f, 2.3851308f, 0.0135670404f, 0.054580302f, 167.904715f };
-		if ( material == "LASFN9" ) return { 1.97888194f, 0.320435298f, 1.92900751f, 0.0118537266f, 0.052738177f, 166.25654f };
-		if ( material == "LF5G15" ) return { 1.28887331f, 0.162818811f, 10.5579792f, 0.0092001566f, 0.0456954308f, 1275.44015f };
-		if ( material == "LF5G19" ) return { 1.34611327f, 0.142428018f, 0.900477176f, 0.0097174385f, 0.0501911619f, 111.959703f };
-		if ( material == "LF5HTi" ) return { 1.28552924f, 0.158357622f, 0.892175122f, 0.0093988626f, 0.0452566659f, 110.544829f };
-		if ( material == "LF5" ) return { 1.28035628f, 0.163505973f, 0.893930112f, 0.00929854416f, 0.0449135769f, 110.493685f };
-		if ( material == "LITHOSIL-Q" ) return { 0.67071081f, 0.433322857f, 0.877379057f, 0.00449192312f, 0.0132812976f, 95.8899878f };
-		if ( material == "LITHOTEC-CAF2" ) return { 0.617617011f, 0.421117656f, 3.79711183f, 0.00275381936f, 0.0105900875f, 1182.67444f };
-		if ( material == "LLF1HTi" ) return { 1.22510445f, 0.125155671f, 0.892236751f, 0.00870432098f, 0.0427325235f, 108.049968f };
-		if ( material == "LLF1" ) return { 1.21640125f, 0.13366454f, 0.883399468f, 0.00857807248f, 0.0420143003f, 107.59306f };
-		if ( material == "N-BAF10" ) return { 1.5851495f, 0.143559385f, 1.08521269f, 0.00926681282f, 0.0424489805f, 105.613573f };
-		if ( material == "N-BAF3" ) return { 1.34859634f, 0.10764424f, 1.13207084f, 0.00871492932f, 0.0478406436f, 112.936116f };
-		if ( material == "N-BAF4" ) return { 1.42056328f, 0.102721269f, 1.14380976f, 0.00942015382f, 0.0531087291f, 110.278856f };
-		if ( material == "N-BAF51" ) return { 1.51503623f, 0.153621958f, 1.15427909f, 0.00942734715f, 0.04308265f, 124.889868f };
-		if ( material == "N-BAF52" ) return { 1.43903433f, 0.0967046052f, 1.09875818f, 0.00907800128f, 0.050821208f, 105.691856f };
-		if ( material == "N-BAK1" ) return { 1.12365662f, 0.309276848f, 0.881511957f, 0.00644742752f, 0.0222284402f, 107.297751f };
-		if ( material == "N-BAK2" ) return { 1.01662154f, 0.319903051f, 0.937232995f, 0.00592383763f, 0.0203828415f, 113.118417f };
-		if ( material == "N-BAK4HT" ) return { 1.28834642f, 0.132817724f, 0.945395373f, 0.00779980626f, 0.0315631177f, 105.965875f };
-		if ( material == "N-BAK4" ) return { 1.28834642f, 0.132817724f, 0.945395373f, 0.00779980626f, 0.0315631177f, 105.965875f };
-		if ( material == "N-BALF4" ) return { 1.31004128f, 0.142038259f, 0.964929351f, 0.0079659645f, 0.0330672072f, 109.19732f };
-		if ( material == "N-BALF5" ) return { 1.28385965f, 0.0719300942f, 1.05048927f, 0.00825815975f, 0.0441920027f, 107.097324f };
-		if ( material == "N-BASF2" ) return { 1.53652081f, 0.156971102f, 1.30196815f, 0.0108435729f, 0.0562278762f, 131.3397f };
-		if ( material == "N-BASF64" ) return { 1.65554268f, 0.17131977f, 1.33664448f, 0.0104485644f, 0.0499394756f, 118.961472f };
-		if ( material == "N-BK10" ) return { 0.888308131f, 0.328964475f, 0.984610769f, 0.00516900822f, 0.0161190045f, 99.7575331f };
-		if ( material == "N-BK7HTi" ) return { 1.03961212f, 0.231792344f, 1.01046945f, 0.00600069867f, 0.0200179144f, 103.560653f };
-		if ( material == "N-BK7HT" ) return { 1.03961212f, 0.231792344f, 1.01046945f, 0.00600069867f, 0.0200179144f, 103.560653f };
-		if ( material == "N-BK7" ) return { 1.03961212f, 0.231792344f, 1.01046945f, 0.00600069867f, 0.0200179144f, 103.560653f };
-		if ( material == "BK7" ) return { 1.03961212f, 0.231792344f, 1.01046945f, 0.00600069867f, 0.0200179144f, 103.560653f };
-		if ( material == "N-F2" ) return { 1.39757037f, 0.159201403f, 1.2686543f, 0.00995906143f, 0.0546931752f, 119.248346f };
-		if ( material == "N-FK51A" ) return { 0.971247817f, 0.216901417f, 0.904651666f, 0.00472301995f, 0.0153575612f, 168.68133f };
-		if ( material == "N-FK51" ) return { 0.971247817f, 0.216901417f, 0.904651666f, 0.00472301995f, 0.0153575612f, 168.68133f };
-		if ( material == "FK51" ) return { 0.971247817f, 0.216901417f, 0.904651666f, 0.00472301995f, 0.0153575612f, 168.68133f };
-		if ( material == "N-FK58" ) return { 0.738042712f, 0.363371967f, 0.989296264f, 0.00339065607f, 0.0117551189f, 212.842145f };
-		if ( material == "N-FK5" ) return { 0.844309338f, 0.344147824f, 0.910790213f, 0.00475111955f, 0.0149814849f, 97.8600293f };
-		if ( material == "FK5" ) return { 0.844309338f, 0.344147824f, 0.910790213f, 0.00475111955f, 0.0149814849f, 97.8600293f }; // ?
-		if ( material == "N-K5" ) return { 1.08511833f, 0.199562005f, 0.930511663f, 0.00661099503f, 0.024110866f, 111.982777f };
-		if ( material == "N-KF9" ) return { 1.19286778f, 0.0893346571f, 0.920819805f, 0.00839154696f, 0.0404010786f, 112.572446f };
-		if ( material == "N-KZFS11" ) return { 1.3322245f, 0.28924161f, 1.15161734f, 0.0084029848f, 0.034423972f, 88.4310532f };
-		if ( material == "N-KZFS2" ) return { 1.23697554f, 0.153569376f, 0.903976272f, 0.00747170505f, 0.0308053556f, 70.1731084f };
-		if ( material == "N-KZFS4HT" ) return { 1.35055424f, 0.197575506f, 1.09962992f, 0.0087628207f, 0.0371767201f, 90.3866994f };
-		if ( material == "N-KZFS4" ) return { 1.35055424f, 0.197575506f, 1.09962992f, 0.0087628207f, 0.0371767201f, 90.3866994f };
-		if ( material == "N-KZFS5" ) return { 1.47460789f, 0.193584488f, 1.26589974f, 0.00986143816f, 0.0445477583f, 106.436258f };
-		if ( material == "N-KZFS8" ) return { 1.62693651f, 0.24369876f, 1.62007141f, 0.010880863f, 0.0494207753f, 131.009163f };
-		if ( material == "N-LAF21" ) return { 1.87134529f, 0.25078301f, 1.22048639f, 0.0093332228f, 0.0345637762f, 83.2404866f };
-		if ( material == "N-LAF2" ) return { 1.80984227f, 0.15729555f, 1.0930037f, 0.0101711622f, 0.0442431765f, 100.687748f };
-		if ( material == "N-LAF33" ) return { 1.79653417f, 0.311577903f, 1.15981863f, 0.00927313493f, 0.0358201181f, 87.3448712f };
-		if ( material == "N-LAF34" ) return { 1.75836958f, 0.313537785f, 1.18925231f, 0.00872810026f, 0.0293020832f, 85.1780644f };
-		if ( material == "N-LAF35" ) return { 1.51697436f, 0.455875464f, 1.07469242f, 0.00750943203f, 0.0260046715f, 80.5945159f };
-		if ( material == "N-LAF36" ) return { 1.85744228f, 0.294098729f, 1.16615417f, 0.00982397191f, 0.0384309138f, 89.3984634f };
-		if ( material == "N-LAF3" ) return { 1.73155854f, 0.150874455f, 1.06586596f, 0.00953833914f, 0.0407887211f, 98.0758545f };
-		if ( material == "N-LAF7" ) return { 1.74028764f, 0.226710554f, 1.32525548f, 0.010792558f, 0.0538626639f, 106.268665f };
-		if ( material == "N-LAK10" ) return { 1.72878017f, 0.169257825f, 1.19386956f, 0.00886014635f, 0.0363416509f, 82.9009069f };
-		if ( material == "LAK16A" ) return { 1.72878017f, 0.169257825f, 1.19386956f, 0.00886014635f, 0.0363416509f, 82.9009069f }; // ???
-		if ( material == "N-LAK12" ) return { 1.17365704f, 0.588992398f, 0.978014394f, 0.00577031797f, 0.0200401678f, 95.4873482f };
-		if ( material == "N-LAK14" ) return { 1.50781212f, 0.318866829f, 1.14287213f, 0.00746098727f, 0.0242024834f, 80.9565165f };
-		if ( material == "N-LAK21" ) return { 1.22718116f, 0.420783743f, 1.01284843f, 0.00602075682f, 0.0196862889f, 88.4370099f };
-		if ( material == "N-LAK22" ) return { 1.14229781f, 0.535138441f, 1.04088385f, 0.00585778594f, 0.0198546147f, 100.834017f };
-		if ( material == "N-LAK33A" ) return { 1.44116999f, 0.571749501f, 1.16605226f, 0.00680933877f, 0.0222291824f, 80.9379555f };
-		if ( material == "N-LAK33" ) return { 1.44116999f, 0.571749501f, 1.16605226f, 0.00680933877f, 0.0222291824f, 80.9379555f }; // ???
-		if ( material == "N-LAK33B" ) return { 1.42288601f, 0.593661336f, 1.1613526f, 0.00670283452f, 0.021941621f, 80.7407701f };
-		if ( material == "N-LAK34" ) return { 1.26661442f, 0.665919318f, 1.1249612f, 0.00589278062f, 0.0197509041f, 78.8894174f };
-		if ( material == "N-LAK7" ) return { 1.23679889f, 0.445051837f, 1.01745888f, 0.00610105538f, 0.0201388334f, 90.638038f };
-		if ( material == "N-LAK8" ) return { 1.33183167f, 0.546623206f, 1.19084015f, 0.00620023871f, 0.0216465439f, 82.5827736f };
-		if ( material == "N-LAK9" ) return { 1.46231905f, 0.344399589f, 1.15508372f, 0.00724270156f, 0.0243353131f, 85.4686868f };
-		if ( material == "N-LASF31A" ) return { 1.96485075f, 0.475231259f, 1.48360109f, 0.00982060155f, 0.0344713438f, 110.739863f };
-		if ( material == "N-LASF31" ) return { 1.71317198f, 0.718575109f, 1.7233247f, 0.00819172228f, 0.0297801704f, 138.461313f };
-		if ( material == "N-LASF40" ) return { 1.98550331f, 0.274057042f, 1.28945661f, 0.010958331f, 0.0474551603f, 96.9085286f };
-		if ( material == "N-LASF41" ) return { 1.86348331f, 0.413307255f, 1.35784815f, 0.00910368219f, 0.0339247268f, 93.3580595f };
-		if ( material == "N-LASF43" ) return { 1.93502827f, 0.23662935f, 1.26291344f, 0.0104001413f, 0.0447505292f, 87.437569f };
-		if ( material == "N-LASF44" ) return { 1.78897105f, 0.38675867f, 1.30506243f, 0.00872506277f, 0.0308085023f, 92.7743824f };
-		if ( material == "N-LASF45HT" ) return { 1.87140198f, 0.267777879f, 1.73030008f, 0.011217192f, 0.0505134972f, 147.106505f };
-		if ( material == "N-LASF45" ) return { 1.87140198f, 0.267777879f, 1.73030008f, 0.011217192f, 0.0505134972f, 147.106505f };
-		if ( material == "N-LASF46A" ) return { 2.16701566f, 0.319812761f, 1.66004486f, 0.0123595524f, 0.0560610282f, 107.047718f };
-		if ( material == "N-LASF46B" ) return { 2.17988922f, 0.306495184f, 1.56882437f, 0.0125805384f, 0.0567191367f, 105.316538f };
-		if ( material == "N-LASF46" ) return { 2.18073678f, 0.298978656f, 1.62190046f, 0.0125642118f, 0.056469999f, 105.662819f };
-		if ( material == "N-LASF9HT" ) return { 2.00029547f, 0.298926886f, 1.80691843f, 0.0121426017f, 0.0538736236f, 156.530829f };
-		if ( material == "N-LASF9" ) return { 2.00029547f, 0.298926886f, 1.80691843f, 0.0121426017f, 0.0538736236f, 156.530829f };
-		if ( material == "N-PK51" ) return { 1.15610775f, 0.153229344f, 0.785618966f, 0.00585597402f, 0.0194072416f, 140.537046f };
-		if ( material == "N-PK52A" ) return { 1.029607f, 0.1880506f, 0.736488165f, 0.00516800155f, 0.0166658798f, 138.964129f };
-		if ( material == "N-PSK3" ) return { 0.88727211f, 0.489592425f, 1.04865296f, 0.00469824067f, 0.0161818463f, 104.374975f };
-		if ( material == "N-PSK53A" ) return { 1.38121836f, 0.196745645f, 0.886089205f, 0.00706416337f, 0.0233251345f, 97.4847345f };
-		if ( material == "N-PSK53" ) return { 1.3434087f, 0.241417935f, 0.952896897f, 0.00675074317f, 0.0219910513f, 103.551457f };
-		if ( material == "N-SF10" ) return { 1.62153902f, 0.256287842f, 1.64447552f, 0.0122241457f, 0.0595736775f, 147.468793f };
-		if ( material == "N-SF11" ) return { 1.73759695f, 0.313747346f, 1.89878101f, 0.013188707f, 0.0623068142f, 155.23629f };
-		if ( material == "N-SF14" ) return { 1.69022361f, 0.288870052f, 1.7045187f, 0.0130512113f, 0.061369188f, 149.517689f };
-		if ( material == "N-SF15" ) return { 1.57055634f, 0.218987094f, 1.50824017f, 0.0116507014f, 0.0597856897f, 132.709339f };
-		if ( material == "N-SF19" ) return { 1.52005444f, 0.17573947f, 1.43623424f, 0.01096144f, 0.0593248486f, 126.795151f };
-		if ( material == "N-SF1" ) return { 1.60865158f, 0.237725916f, 1.51530653f, 0.0119654879f, 0.0590589722f, 135.521676f };
-		if ( material == "N-SF2" ) return { 1.47343127f, 0.163681849f, 1.36920899f, 0.0109019098f, 0.0585683687f, 127.404933f };
-		if ( material == "N-SF4" ) return { 1.67780282f, 0.282849893f, 1.63539276f, 0.012679345f, 0.0602038419f, 145.760496f };
-		if ( material == "N-SF56" ) return { 1.73562085f, 0.317487012f, 1.95398203f, 0.0129624742f, 0.0612884288f, 161.559441f };
-		if ( material == "N-SF57HTultra" ) return { 1.87543831f, 0.37375749f, 2.30001797f, 0.0141749518f, 0.0640509927f, 177.389795f };
-		if ( material == "N-SF57HT" ) return { 1.87543831f, 0.37375749f, 2.30001797f, 0.0141749518f, 0.0640509927f, 177.389795f };
-		if ( material == "N-SF57" ) return { 1.87543831f, 0.37375749f, 2.30001797f, 0.0141749518f, 0.0640509927f, 177.389795f };
-		if ( material == "N-SF5" ) return { 1.52481889f, 0.187085527f, 1.42729015f, 0.011254756f, 0.0588995392f, 129.141675f };
-		if ( material == "N-SF64" ) return { 1.59163762f, 0.219908428f, 1.46929315f, 0.0118623434f, 0.0594585499f, 133.310762f };
-		if ( material == "N-SF66" ) return { 2.0245976f, 0.470187196f, 2.59970433f, 0.0147053225f, 0.0692998276f, 161.817601f };
-		if ( material == "N-SF6HTultra" ) return { 1.77931763f, 0.338149866f, 2.08734474f, 0.0133714182f, 0.0617533621f, 174.01759f };
-		if ( material == "N-SF6HT" ) return { 1.77931763f, 0.338149866f, 2.08734474f, 0.0133714182f, 0.0617533621f, 174.01759f };
-		if ( material == "N-SF6" ) return { 1.77931763f, 0.338149866f, 2.08734474f, 0.0133714182f, 0.0617533621f, 174.01759f };
-		if ( material == "N-SF8" ) return { 1.55075812f, 0.209816918f, 1.46205491f, 0.0114338344f, 0.0582725652f, 133.24165f };
-		if ( material == "N-SK10" ) return { 1.34972093f, 0.238587973f, 0.9667336f, 0.00736272269f, 0.0253765327f, 103.502909f };
-		if ( material == "N-SK11" ) return { 1.17963631f, 0.229817295f, 0.935789652f, 0.00680282081f, 0.0219737205f, 101.513232f };
-		if ( material == "N-SK14" ) return { 0.936155374f, 0.594052018f, 1.04374583f, 0.00461716525f, 0.016885927f, 103.736265f };
-		if ( material == "SK14" ) return { 0.936155374f, 0.594052018f, 1.04374583f, 0.00461716525f, 0.016885927f, 103.736265f }; // ???
-		if ( material == "N-SK15" ) return { 1.30417786f, 0.28584116f, 0.974781572f, 0.00695051276f, 0.0232023703f, 99.016884f };
-		if ( material == "N-SK16" ) return { 1.34317774f, 0.241144399f, 0.994317969f, 0.00704687339f, 0.0229005f, 92.7508526f };
-		if ( material == "N-SK2HT" ) return { 1.28189012f, 0.257738258f, 0.96818604f, 0.0072719164f, 0.0242823527f, 110.377773f };
-		if ( material == "N-SK2" ) return { 1.28189012f, 0.257738258f, 0.96818604f, 0.0072719164f, 0.0242823527f, 110.377773f };
-		if ( material == "N-SK4" ) return { 1.32993741f, 0.228542996f, 0.988465211f, 0.00716874107f, 0.0246455892f, 100.886364f };
-		if ( material == "N-SK5" ) return { 0.991463823f, 0.495982121f, 0.987393925f, 0.00522730467f, 0.0172733646f, 98.3594579f };
-		if ( material == "SK5" ) return { 0.991463823f, 0.495982121f, 0.987393925f, 0.00522730467f, 0.0172733646f, 98.3594579f }; // ???
-		if ( material == "N-SSK2" ) return { 1.4306027f, 0.153150554f, 1.01390904f, 0.00823982975f, 0.0333736841f, 106.870822f };
-		if ( material == "N-SSK5" ) return { 1.59222659f, 0.103520774f, 1.05174016f, 0.00920284626f, 0.0423530072f, 106.927374f };
-		if ( material == "N-SSK8" ) return { 1.44857867f, 0.117965926f, 1.06937528f, 0.00869310149f, 0.0421566593f, 111.300666f };
-		if ( material == "N-ZK7A" ) return { 1.07509891f, 0.168895044f, 0.860503983f, 0.00676601657f, 0.0230642817f, 89.0498778f };
-		if ( material == "N-ZK7" ) return { 1.07715032f, 0.168079109f, 0.851889892f, 0.00676601657f, 0.0230642817f, 89.0498778f };
-		if ( material == "P-BK7" ) return { 1.18318503f, 0.0871756426f, 1.03133701f, 0.00722141956f, 0.0268216805f, 101.702362f };
-		if ( material == "P-LAF37" ) return { 1.76003244f, 0.248286745f, 1.15935122f, 0.00938006396f, 0.0360537464f, 86.4324693f };
-		if ( material == "P-LAK35" ) return { 1.3932426f, 0.418882766f, 1.043807f, 0.00715959695f, 0.0233637446f, 88.3284426f };
-		if ( material == "P-LASF47" ) return { 1.85543101f, 0.315854649f, 1.28561839f, 0.0100328203f, 0.0387095168f, 94.5421507f };
-		if ( material == "P-LASF50" ) return { 1.84910553f, 0.329828674f, 1.30400901f, 0.00999234757f, 0.0387437988f, 95.8967681f };
-		if ( material == "P-LASF51" ) return { 1.84568806f, 0.3390016f, 1.32418921f, 0.00988495571f, 0.0378097402f, 97.841543f };
-		if ( material == "P-PK53" ) return { 0.960316767f, 0.340437227f, 0.777865595f, 0.00531032986f, 0.0175073434f, 106.87533f };
-		if ( material == "P-SF67" ) return { 1.97464225f, 0.467095921f, 2.43154209f, 0.0145772324f, 0.0669790359f, 157.444895f };
-		if ( material == "P-SF68" ) return { 2.3330067f, 0.452961396f, 1.25172339f, 0.0168838419f, 0.0716086325f, 118.707479f };
-		if ( material == "P-SF69" ) return { 1.62594647f, 0.235927609f, 1.67434623f, 0.0121696677f, 0.0600710405f, 145.651908f };
-		if ( material == "P-SF8" ) return { 1.55370411f, 0.206332561f, 1.39708831f, 0.011658267f, 0.0582087757f, 130.748028f };
-		if ( material == "P-SK57Q1" ) return { 1.30536483f, 0.171434328f, 1.10117219f, 0.00736408831f, 0.0255786047f, 106.72606f };
-		if ( material == "P-SK57" ) return { 1.31053414f, 0.169376189f, 1.10987714f, 0.00740877235f, 0.0254563489f, 107.751087f };
-		if ( material == "P-SK58A" ) return { 1.3167841f, 0.171154756f, 1.12501473f, 0.00720717498f, 0.0245659595f, 102.739728f };
-		if ( material == "P-SK60" ) return { 1.40790442f, 0.143381417f, 1.16513947f, 0.00784382378f, 0.0287769365f, 105.373397f };
-		if ( material == "SF10" ) return { 1.61625977f, 0.259229334f, 1.07762317f, 0.0127534559f, 0.0581983954f, 116.60768f };
-		if ( material == "SF11" ) return { 1.73848403f, 0.311168974f, 1.17490871f, 0.0136068604f, 0.0615960463f, 121.922711f };
-		if ( material == "SF14" ) return { 1.69182538f, 0.285919934f, 1.12595145f, 0.0133151542f, 0.0612647445f, 118.405242f };
-		if ( material == "SF15" ) return { 1.53925927f, 0.247620926f, 1.03816409f, 0.0119307961f, 0.0556077536f, 116.416747f };
-		if ( material == "SF1" ) return { 1.55912923f, 0.284246288f, 0.968842926f, 0.0121481001f, 0.0534549042f, 112.174809f };
-		if ( material == "SF2" ) return { 1.40301821f, 0.231767504f, 0.939056586f, 0.0105795466f, 0.0493226978f, 112.405955f };
-		if ( material == "SF4" ) return { 1.61957826f, 0.339493189f, 1.02566931f, 0.0125502104f, 0.0544559822f, 117.652222f };
-		if ( material == "SF56A" ) return { 1.70579259f, 0.344223052f, 1.09601828f, 0.0133874699f, 0.0579561608f, 121.616024f };
-		if ( material == "SF57HTultra" ) return { 1.81651371f, 0.428893641f, 1.07186278f, 0.0143704198f, 0.0592801172f, 121.419942f };
-		if ( material == "SF57" ) return { 1.81651371f, 0.428893641f, 1.07186278f, 0.0143704198f, 0.0592801172f, 121.419942f };
-		if ( material == "SF5" ) return { 1.46141885f, 0.247713019f, 0.949995832f, 0.0111826126f, 0.0508594669f, 112.041888f };
-		if ( material == "SF66" ) return { 2.07842233f, 0.407120032f, 1.76711292f, 0.0180875134f, 0.0679493572f, 215.266127f };
-		if ( material == "SF6G05" ) return { 1.62113942f, 0.506586092f, 10.4032298f, 0.0113478992f, 0.0535840223f, 1118.83658f };
-		if ( material == "SF6" ) return { 1.72448482f, 0.390104889f, 1.04572858f, 0.0134871947f, 0.0569318095f, 118.557185f };
-		if ( material == "SFL57" ) return { 1.88742326f, 0.360534025f, 2.26189313f, 0.0145939341f, 0.0648198946f, 176.062211f };
-		if ( material == "SFL6" ) return { 1.78922056f, 0.328427448f, 2.01639441f, 0.0135163537f, 0.0622729599f, 168.014713f };
-		if ( material == "4786" ) return { 0.795944286f, 0.356650937f, 0.98008113f, 0.00371401467f, 0.0125884185f, 190.314843f };
-		if ( material == "5165" ) return { 1.12790724f, 0.129745283f, 0.994872985f, 0.00673602593f, 0.0228274219f, 94.2587142f };
-		if ( material == "5742" ) return { 1.30326513f, 0.127313632f, 0.895143157f, 0.00977713845f, 0.0463756328f, 107.962139f };
-		if ( material == "5859" ) return { 1.06973916f, 0.422042806f, 0.897510953f, 0.00562417858f, 0.0188055076f, 71.2142596f };
-		if ( material == "7054" ) return { 1.18710503f, 0.669241576f, 1.10329256f, 0.00549101471f, 0.0196008925f, 83.1244339f };
-		if ( material == "AF32ECO" ) return { 1.11332955f, 0.141527282f, 0.860743147f, 0.00707493977f, 0.0225358637f, 90.1552652f };
-		if ( material == "D263TECO" ) return { 1.23795755f, 0.0466468888f, 2.46700556f, 0.00863080926f, 0.0469074501f, 264.146296f };
-		if ( material == "LF7" ) return { 1.26879731f, 0.156697051f, 0.887676301f, 0.00919553925f, 0.0447256764f, 106.8203610f };
-		if ( material == "4786" ) return { 0.795944286f, 0.356650937f, 0.98008113f, 0.00371401467f, 0.0125884185f, 190.314843f };
-		if ( material == "5165" ) return { 1.12790724f, 0.129745283f, 0.994872985f, 0.00673602593f, 0.0228274219f, 94.2587142f };
-		if ( material == "5742" ) return { 1.30326513f, 0.127313632f, 0.895143157f, 0.00977713845f, 0.0463756328f, 107.962139f };
-		if ( material == "5859" ) return { 1.06973916f, 0.422042806f, 0.897510953f, 0.00562417858f, 0.0188055076f, 71.2142596f };
-		if ( material == "7054" ) return { 1.18710503f, 0.669241576f, 1.10329256f, 0.00549101471f, 0.0196008925f, 83.1244339f };
-		if ( material == "AF32ECO" ) return { 1.11332955f, 0.141527282f, 0.860743147f, 0.00707493977f, 0.0225358637f, 90.1552652f };
-		if ( material == "D263TECO" ) return { 1.23795755f, 0.0466468888f, 2.46700556f, 0.00863080926f, 0.0469074501f, 264.146296f };
-		if ( material == "LF7" ) return { 1.26879731f, 0.156697051f, 0.887676301f, 0.00919553925f, 0.0447256764f, 106.8203610f };
-		if ( material == "4786" ) return { 0.795944286f, 0.356650937f, 0.98008113f, 0.00371401467f, 0.0125884185f, 190.314843f };
-		if ( material == "5165" ) return { 1.12790724f, 0.129745283f, 0.994872985f, 0.00673602593f, 0.0228274219f, 94.2587142f };
-		if ( material == "5742" ) return { 1.30326513f, 0.127313632f, 0.895143157f, 0.00977713845f, 0.0463756328f, 107.962139f };
-		if ( material == "5859" ) return { 1.06973916f, 0.422042806f, 0.897510953f, 0.00562417858f, 0.0188055076f, 71.2142596f };
-		if ( material == "7054" ) return { 1.18710503f, 0.669241576f, 1.10329256f, 0.00549101471f, 0.0196008925f, 83.1244339f };
-		if ( material == "AF32ECO" ) return { 1.11332955f, 0.141527282f, 0.860743147f, 0.00707493977f, 0.0225358637f, 90.1552652f };
-		if ( material == "D263TECO" ) return { 1.23795755f, 0.0466468888f, 2.46700556f, 0.00863080926f, 0.0469074501f, 264.146296f };
-		if ( material == "LF7" ) return { 1.26879731f, 0.156697051f, 0.887676301f, 0.00919553925f, 0.0447256764f, 106.8203610f };
-		if ( material == "4786" ) return { 0.795944286f, 0.356650937f, 0.98008113f, 0.00371401467f, 0.0125884185f, 190.314843f };
-		if ( material == "5165" ) return { 1.12790724f, 0.129745283f, 0.994872985f, 0.00673602593f, 0.0228274219f, 94.2587142f };
-		if ( material == "5742" ) return { 1.30326513f, 0.127313632f, 0.895143157f, 0.00977713845f, 0.0463756328f, 107.962139f };
-		if ( material == "5859" ) return { 1.06973916f, 0.422042806f, 0.897510953f, 0.00562417858f, 0.0188055076f, 71.2142596f };
-		if ( material == "7054" ) return { 1.18710503f, 0.669241576f, 1.10329256f, 0.00549101471f, 0.0196008925f, 83.1244339f };
-		if ( material == "AF32ECO" ) return { 1.11332955f, 0.141527282f, 0.860743147f, 0.00707493977f, 0.0225358637f, 90.1552652f };
-		if ( material == "D263TECO" ) return { 1.23795755f, 0.0466468888f, 2.46700556f, 0.00863080926f, 0.0469074501f, 264.146296f };
-		if ( material == "LF7" ) return { 1.26879731f, 0.156697051f, 0.887676301f, 0.00919553925f, 0.0447256764f, 106.8203610f };
+	// special materials
+	{ "SUPRASIL", { 1.10294f, 0.00114003f, 0.916395f, 0.00791467f, 0.082308f, 100.0f } }, // best fit, calculated using Mathematica from data from https://www.heraeus.com/media/media/hca/doc_hca/products_and_solutions_8/optics/Data_and_Properties_Optics_fused_silica_EN.pdf
+	{ "COC", { 1.10635f, 0.254876f, 0.202124f, -0.0157115f, -0.00912351f, 0.00153054f } }, // best fit, calculated using Mathematica from data from https://diverseoptics.com/wp-content/uploads/2012/02/Specifications_of_Optical_Grade_Polymers_and_Glass.pdf
+	{ "AL-6263-(OKP4HT)", { 1.601f, 0.0f, 7.622E-3, 1.127E9, -2.516E13, 0.0f } }, // from http://focenter.com/wp-content/uploads/2015/05/AngstromLink-AL-6261-6263-6264-6265.pdf
 
+	// data from https://refractiveindex.info/, using sellmeier equation (eq. 2)
+	{ "BAH32", { 1.498643f, 0.2175678f, 1.559728f, 0.009643255f, 0.04511666f, 171.1121f } },
+	{ "BAL15Y", { 1.28348331f, 0.102800765f, 0.404609885f, 0.00790900515f, 0.0305971274f, 46.5268356f } },
+	{ "BAL35Y", { 1.26231429f, 0.22515421f, 0.639119345f, 0.00695586355f, 0.0221310699f, 63.1662736f } },
+	{ "BAM3", { 1.264742f, 0.189784f, 1.105094f, 0.007911881f, 0.03806705f, 133.8316f } },
+	{ "BPH5", { 1.44845677f, 0.22044806f, 0.99476362f, 0.0092817361f, 0.0433001987f, 77.6475264f } },
+	{ "BPH8", { 1.59323023f, 0.277775516f, 1.04070526f, 0.0103458172f, 0.0474089271f, 81.2863792f } },
+	{ "BPM51", { 1.37436455f, 0.174025602f, 0.905485504f, 0.00877165624f, 0.0405249716f, 72.7685343f } },
+	{ "BSL7Y", { 1.13329383f, 0.136897201f, 0.703456004f, 0.00669407868f, 0.023739176f, 70.7030316f } },
+	{ "BSM22", { 1.35097f, 0.2324447f, 1.179f, 0.007454835f, 0.02949403f, 131.6202f } },
+	{ "BSM51Y", { 1.22393171f, 0.306482383f, 0.823950901f, 0.00649521083f, 0.0208194161f, 79.5168951f } },
+	{ "BSM9", { 1.095086f, 0.4642304f, 1.203056f, 0.005354893f, 0.02206781f, 133.3129f } },
+	{ "LAH78", { 2.08122726f, 0.398632407f, 2.21679491f, 0.011190641f, 0.0521753272f, 141.893166f } },
+	{ "LAH80", { 2.06636247f, 0.349315832f, 1.91746463f, 0.0122133846f, 0.0555959908f, 125.47362f } },
+	{ "LAL58", { 1.53415f, 0.2744946f, 1.210527f, 0.008014497f, 0.03023701f, 118.7442f } },
+	{ "LAM58", { 1.704423f, 0.1778568f, 1.425726f, 0.01024939f, 0.04576819f, 153.5267f } },
+	{ "LAM59", { 1.626945f, 0.1906681f, 1.281079f, 0.008757497f, 0.03779724f, 123.7784f } },
+	{ "LAM61", { 1.706024f, 0.182716f, 1.204833f, 0.009579771f, 0.04044097f, 127.571f } },
+	{ "LAM7", { 1.734192f, 0.2314896f, 1.517096f, 0.01110755f, 0.05153277f, 163.4134f } },
+	{ "L-BAL35P", { 0.806742194f, 0.690488648f, 1.26477947f, 0.0148836231f, 0.00251943058f, 111.31457f } },
+	{ "L-BAL35", { 1.1626263f, 0.325661051f, 1.35132486f, 0.0125957437f, -0.0032691105f, 119.214596f } },
+	{ "L-BAL42P", { 0.881090017f, 0.595038859f, 1.22582098f, 0.0148496655f, 0.00163577371f, 125.11372f } },
+	{ "L-BAL42", { 1.39528097f, 0.072551952f, 1.66335848f, 0.011186203f, -0.0246748575f, 167.717958f } },
+	{ "L-BAL43", { 1.04745291f, 0.428452873f, 1.14111303f, 0.00563209756f, 0.0188321416f, 114.197069f } },
+	{ "L-BBH1", { 2.56597628f, 0.526892298f, 1.27957402f, 0.0205164012f, 0.0831737967f, 109.78774f } },
+	{ "L-BBH2", { 2.53279005f, 0.583375125f, 1.5299288f, 0.0186909889f, 0.0765409078f, 112.197368f } },
+	{ "L-BSL7", { 0.917473918f, 0.352687665f, 1.05579788f, 0.00527701411f, 0.0170809497f, 104.302583f } },
+	{ "L-LAH53", { 1.87409991f, 0.297921402f, 1.35064285f, 0.00993318344f, 0.0405501825f, 100.5022f } },
+	{ "L-LAH81", { 1.89927344f, 0.270978866f, 1.33163819f, 0.0102901828f, 0.0424227173f, 100.967566f } },
+	{ "L-LAH83", { 1.82331579f, 0.548625885f, 1.63182855f, 0.00911468875f, 0.032841967f, 123.611174f } },
+	{ "L-LAH84P", { 1.83485816f, 0.355717498f, 1.37757002f, 0.009788482f, 0.03837087f, 109.71692f } },
+	{ "L-LAH84", { 1.83606127f, 0.341720032f, 1.35280173f, 0.00981969903f, 0.0385636264f, 107.04553f } },
+	{ "L-LAH85V", { 1.97460503f, 0.361903592f, 1.38433241f, 0.0101854258f, 0.0384829118f, 103.713627f } },
+	{ "L-LAH85", { 1.93889988f, 0.39787919f, 1.49937713f, 0.00996381644f, 0.036975114f, 107.951467f } },
+	{ "L-LAH86", { 2.11102709f, 0.370368094f, 1.62687484f, 0.0120714135f, 0.0532464416f, 109.166396f } },
+	{ "L-LAH87", { 1.44196269f, 0.617507311f, 1.21890079f, 0.00731826717f, 0.0245370775f, 105.976009f } },
+	{ "L-LAH90", { 1.97595301f, 0.283924985f, 1.35176368f, 0.0104276395f, 0.0427708222f, 101.45371f } },
+	{ "L-LAH91", { 1.26144128f, 0.782115273f, 1.15823645f, 0.00572512582f, 0.0219829752f, 88.04822f } },
+	{ "L-LAH94", { 2.0062142f, 0.347029888f, 1.41688382f, 0.0105499238f, 0.0445845013f, 105.99525f } },
+	{ "L-LAL12", { 1.28516283f, 0.478333797f, 1.21605301f, 0.00641062082f, 0.0214815099f, 100.243378f } },
+	{ "L-LAL13", { 1.17776146f, 0.634591345f, 1.20435649f, 0.00557618243f, 0.0206821469f, 99.6322776f } },
+	{ "L-LAL15", { 1.07959634f, 0.731872134f, 1.17111107f, 0.00470047543f, 0.0198615758f, 87.03599f } },
+	{ "L-LAM60", { 1.47574184f, 0.496132743f, 1.23796236f, 0.0073695f, 0.0251891746f, 98.0306651f } },
+	{ "L-LAM69", { 1.7403896f, 0.176996917f, 1.76775413f, 0.010339887f, 0.0484822765f, 136.671996f } },
+	{ "L-LAM72", { 1.50483297f, 0.433346414f, 1.2714921f, 0.0075034233f, 0.026900952f, 95.7631272f } },
+	{ "L-NBH54", { 2.00722652f, 0.442086773f, 3.37287426f, 0.0135705124f, 0.0591808873f, 219.832665f } },
+	{ "L-PHL1", { 1.07570798f, 0.335020347f, 0.810997558f, 0.00591654042f, 0.0203432769f, 106.182158f } },
+	{ "L-PHL2", { 1.08137176f, 0.31325766f, 0.879192863f, 0.00594210177f, 0.0198011567f, 109.893817f } },
+	{ "L-TIH53", { 1.83464643f, 0.415079602f, 2.82563492f, 0.0134992001f, 0.0618608854f, 201.62917f } },
+	{ "L-TIM28P", { 1.53013396f, 0.24536228f, 1.78233031f, 0.0114236857f, 0.0555101852f, 179.0743f } },
+	{ "L-TIM28", { 1.52780829f, 0.232776367f, 1.71638781f, 0.0114135883f, 0.0559068566f, 171.5118f } },
+	{ "PBH1", { 1.55408138f, 0.289397861f, 1.06727944f, 0.0120146818f, 0.0532883208f, 122.863029f } },
+	{ "PBH3", { 1.59470208f, 0.317791814f, 1.29219485f, 0.0122277091f, 0.0544975824f, 147.63368f } },
+	{ "PBH55", { 1.81022611f, 0.447772917f, 1.12017569f, 0.013972897f, 0.0582195245f, 120.984115f } },
+	{ "PBH56", { 1.78552677f, 0.446684871f, 1.21749317f, 0.0136046011f, 0.0570875152f, 129.967536f } },
+	{ "PBH71", { 1.97039844f, 0.520330498f, 1.30696186f, 0.0155780448f, 0.0632642123f, 142.045097f } },
+	{ "PBL1Y", { 1.24772961f, 0.101954909f, 0.350479619f, 0.00926606623f, 0.0451754311f, 45.0186705f } },
+	{ "PBL25Y", { 1.31960626f, 0.123752633f, 0.210055351f, 0.0101863415f, 0.0483593508f, 27.3272029f } },
+	{ "PBL26", { 1.23494993f, 0.169136142f, 1.09067013f, 0.00862847509f, 0.0422686058f, 132.796906f } },
+	{ "PBL26Y", { 1.29471773f, 0.108880981f, 0.220322964f, 0.00986579479f, 0.0477568828f, 28.8509863f } },
+	{ "PBL35Y", { 1.31884698f, 0.125014653f, 0.215794324f, 0.0101474939f, 0.0481636043f, 28.5517448f } },
+	{ "PBL6Y", { 1.22310794f, 0.0811217929f, 0.321400939f, 0.00897805333f, 0.0445756957f, 40.5962247f } },
+	{ "PBM18Y", { 1.34660215f, 0.136322343f, 0.183371587f, 0.0106313733f, 0.0491403013f, 23.9154655f } },
+	{ "PBM2Y", { 1.39446503f, 0.159230985f, 0.245470216f, 0.0110571872f, 0.0507194882f, 31.4440142f } },
+	{ "PBM3", { 1.32567543f, 0.208112474f, 1.15985207f, 0.00973013804f, 0.046285933f, 137.559854f } },
+	{ "PBM8Y", { 1.35351322f, 0.130212912f, 0.158337266f, 0.0105624626f, 0.0496606652f, 20.7965806f } },
+	{ "S-BAH10", { 1.59034337f, 0.138464579f, 1.21988043f, 0.0093273434f, 0.0427498654f, 119.251777f } },
+	{ "S-BAH11", { 1.5713886f, 0.147869313f, 1.28092846f, 0.00910807936f, 0.0402401684f, 130.399367f } },
+	{ "S-BAH27", { 1.68939052f, 0.133081013f, 1.41165515f, 0.0103598193f, 0.0533982239f, 126.515503f } },
+	{ "S-BAH28", { 1.69493484f, 0.192890298f, 1.56385948f, 0.010272319f, 0.052118764f, 137.818035f } },
+	{ "S-BAH32", { 1.5802363f, 0.137504632f, 1.60603298f, 0.0103578062f, 0.0548393088f, 147.982885f } },
+	{ "S-BAL11", { 0.821314256f, 0.612586478f, 1.24859637f, 0.00351436131f, 0.0179762375f, 133.45667f } },
+	{ "S-BAL12", { 0.714605258f, 0.621993289f, 1.22537681f, 0.00301763913f, 0.016650545f, 143.506314f } },
+	{ "S-BAL14", { 1.27553696f, 0.146083393f, 1.16754699f, 0.00749692359f, 0.031042153f, 128.947092f } },
+	{ "S-BAL22", { 1.16333541f, 0.26332321f, 1.12551059f, 0.0118079103f, -0.00438112893f, 106.905682f } },
+	{ "S-BAL2", { 1.30923813f, 0.114137353f, 1.17882259f, 0.00838873953f, 0.0399436485f, 140.257892f } },
+	{ "S-BAL35", { 0.941357273f, 0.546174895f, 1.16168917f, 0.0140333996f, 0.000906635683f, 114.163758f } },
+	{ "S-BAL3", { 1.2936689f, 0.132440252f, 1.10197293f, 0.00800367962f, 0.0354711196f, 134.517431f } },
+	{ "S-BAL41", { 1.243442f, 0.166301104f, 1.10586114f, 0.0116396708f, -0.00890464938f, 114.11122f } },
+	{ "S-BAL42", { 1.39570615f, 0.071850507f, 1.27129267f, 0.0112218843f, -0.0252117422f, 134.49786f } },
+	{ "S-BAM12", { 1.50161605f, 0.126987445f, 1.43544052f, 0.00940761826f, 0.0472602195f, 141.666499f } },
+	{ "S-BAM3", { 1.36955358f, 0.0853825867f, 1.16159771f, 0.00941331434f, 0.0504359027f, 130.548899f } },
+	{ "S-BAM4", { 1.41059317f, 0.111201306f, 1.34148939f, 0.00963312192f, 0.049877821f, 152.237696f } },
+	{ "S-BSL7", { 1.1515019f, 0.118583612f, 1.26301359f, 0.010598413f, -0.011822519f, 129.617662f } },
+	{ "S-BSM10", { 0.945443081f, 0.643237376f, 1.17752968f, 0.0157263798f, 0.00161924066f, 121.361748f } },
+	{ "S-BSM14", { 1.2828627f, 0.247647429f, 1.10383999f, 0.0122902399f, -0.00613142361f, 106.883378f } },
+	{ "S-BSM15", { 0.953128328f, 0.637613977f, 1.65245647f, 0.00387638985f, 0.0185094632f, 159.442367f } },
+	{ "S-BSM16", { 1.14490383f, 0.439563911f, 1.27688079f, 0.0137034916f, -0.00186514205f, 119.535585f } },
+	{ "S-BSM18", { 0.927886025f, 0.708858526f, 1.18610897f, 0.00417549199f, 0.0184691838f, 122.210416f } },
+	{ "S-BSM21", { 1.47867898f, 0.0899501399f, 1.03056525f, 0.00869705653f, 0.0399353993f, 108.550949f } },
+	{ "S-BSM22", { 1.44305741f, 0.140786358f, 1.26093951f, 0.0081920891f, 0.0356911455f, 131.959337f } },
+	{ "S-BSM25", { 1.34814257f, 0.347530319f, 1.38798368f, 0.00695364366f, 0.0277863478f, 142.138122f } },
+	{ "S-BSM28", { 1.43822841f, 0.128100017f, 1.3435553f, 0.0085977975f, 0.0408617854f, 143.70989f } },
+	{ "S-BSM2", { 0.867168676f, 0.672848343f, 1.18456107f, 0.00369311003f, 0.0181652804f, 132.376147f } },
+	{ "S-BSM4", { 0.96244308f, 0.595939234f, 1.10558352f, 0.00468062141f, 0.0178772082f, 115.896432f } },
+	{ "S-BSM71", { 1.50847885f, 0.158099826f, 1.36815368f, 0.00812769076f, 0.0354200898f, 136.110038f } },
+	{ "S-BSM81", { 0.996356844f, 0.651392837f, 1.22432622f, 0.0144821587f, 0.00154826389f, 89.9818604f } },
+	{ "S-BSM9", { 1.37020077f, 0.189397267f, 1.24202324f, 0.00757631457f, 0.0300787515f, 131.350111f } },
+	{ "S-FPL51", { 1.17010505f, 0.0475710783f, 0.763832445f, 0.00616203924f, 0.0263372876f, 141.882642f } },
+	{ "S-FPL51Y", { 1.14031443f, 0.0771496272f, 1.43721957f, 0.00595466872f, 0.0223953953f, 274.290057f } },
+	{ "S-FPL52", { 1.06785857f, 0.0335857718f, 1.10219763f, 0.00699227302f, -0.0207608925f, 226.496541f } },
+	{ "S-FPL53", { 0.983532327f, 0.069568814f, 1.11409238f, 0.00492234955f, 0.0193581091f, 264.275294f } },
+	{ "S-FPL55", { 0.839067682f, 0.214083503f, 1.47914677f, 0.00795286639f, -0.00232581717f, 340.0437f } },
+	{ "S-FPM2", { 0.761242785f, 0.747033375f, 0.938928947f, 0.00321174095f, 0.0140234423f, 139.52353f } },
+	{ "S-FPM3", { 0.809407286f, 0.527007033f, 0.909127704f, 0.00376072389f, 0.0135654895f, 142.503612f } },
+	{ "S-FSL5", { 1.17447043f, 0.0140056154f, 1.19272435f, 0.00841855181f, -0.0581790767f, 129.599726f } },
+	{ "S-FSL5Y", { 0.977409944f, 0.210950834f, 1.37142848f, 0.00557649364f, 0.0177000313f, 149.211443f } },
+	{ "S-FTL10", { 1.10542993f, 0.116184325f, 1.15396111f, 0.00669004168f, 0.0360840691f, 137.546485f } },
+	{ "S-FTM16", { 1.32940907f, 0.141512125f, 1.44299068f, 0.0102377287f, 0.0578081956f, 150.597139f } },
+	{ "TIFN5", { 1.32940907f, 0.141512125f, 1.44299068f, 0.0102377287f, 0.0578081956f, 150.597139f } },
+	{ "S-LAH51", { 1.82586991f, 0.283023349f, 1.35964319f, 0.00935297152f, 0.0373803057f, 100.655798f } },
+	{ "S-LAH52Q", { 1.91082318f, 0.239854589f, 1.16159733f, 0.0103565352f, 0.0413805081f, 96.60373f } },
+	{ "S-LAH52", { 1.85390925f, 0.297925555f, 1.39382086f, 0.00955320687f, 0.039381685f, 102.706848f } },
+	{ "S-LAH53V", { 1.96600955f, 0.205143305f, 1.23200934f, 0.0107817785f, 0.0463727869f, 97.69406f } },
+	{ "S-LAH53", { 1.91811619f, 0.253724399f, 1.39473885f, 0.0102147684f, 0.0433176011f, 101.938021f } },
+	{ "S-LAH55VS", { 1.92591095f, 0.34895346f, 1.42230744f, 0.0096115249f, 0.036513298f, 103.36409f } },
+	{ "S-LAH55V", { 1.97025325f, 0.30489414f, 1.39214665f, 0.00991088134f, 0.0383202295f, 97.7785249f } },
+	{ "S-LAH55", { 1.95615766f, 0.319216215f, 1.39173189f, 0.00979338965f, 0.0376836296f, 94.8775271f } },
+	{ "S-LAH58", { 1.78764964f, 0.6526356f, 1.79914564f, 0.00847378536f, 0.0313126408f, 132.788001f } },
+	{ "S-LAH59", { 1.51372967f, 0.702462343f, 1.33600982f, 0.00705246901f, 0.0249488689f, 100.085908f } },
+	{ "S-LAH60V", { 2.05081962f, 0.208475257f, 1.31486394f, 0.0116035991f, 0.0526489359f, 99.38065f } },
+	{ "S-LAH60", { 1.95243469f, 0.30710021f, 1.56578094f, 0.0106442437f, 0.0456735302f, 110.28141f } },
+	{ "S-LAH63Q", { 1.96723017f, 0.194953915f, 1.25386282f, 0.0110456086f, 0.0497137061f, 104.84352f } },
+	{ "S-LAH63", { 1.89458276f, 0.268702978f, 1.45705526f, 0.0102277048f, 0.0442801243f, 104.874927f } },
+	{ "S-LAH64", { 1.83021453f, 0.29156359f, 1.28544024f, 0.0090482329f, 0.0330756689f, 89.3675501f } },
+	{ "S-LAH65VS", { 1.76068422f, 0.414128906f, 1.33415439f, 0.00853607198f, 0.0301826383f, 98.09421f } },
+	{ "S-LAH65V", { 1.81419034f, 0.361376301f, 1.32729484f, 0.00874935029f, 0.0318352836f, 91.3406898f } },
+	{ "S-LAH65", { 1.68191258f, 0.493779818f, 1.45682822f, 0.0077668425f, 0.0288916181f, 99.2574356f } },
+	{ "S-LAH66", { 1.39280586f, 0.679577094f, 1.38702069f, 0.00608475118f, 0.0233925351f, 95.8354094f } },
+	{ "S-LAH71", { 1.98280031f, 0.31675845f, 2.44472646f, 0.0118987456f, 0.0527156001f, 213.220697f } },
+	{ "S-LAH79", { 2.32557148f, 0.507967133f, 2.43087198f, 0.0132895208f, 0.0528335449f, 161.122408f } },
+	{ "S-LAH88", { 2.1284434f, 0.405082139f, 1.67918461f, 0.0117309815f, 0.0508706599f, 107.091456f } },
+	{ "S-LAH89", { 1.95118827f, 0.377607223f, 1.47757262f, 0.00976560799f, 0.0382232043f, 112.23672f } },
+	{ "S-LAH92", { 2.10440311f, 0.358346161f, 1.63010064f, 0.0108531811f, 0.044340592f, 123.2498f } },
+	{ "S-LAH93", { 2.17884378f, 0.325508683f, 1.70608646f, 0.0115760879f, 0.0495982503f, 128.91358f } },
+	{ "S-LAH95", { 2.15636617f, 0.329558178f, 1.72178935f, 0.012288051f, 0.0555507835f, 124.43934f } },
+	{ "S-LAH96", { 1.85078519f, 0.189204854f, 1.19763137f, 0.00940657541f, 0.0380345187f, 101.426835f } },
+	{ "S-LAH97", { 1.0273018f, 0.989293564f, 1.25781057f, 0.0183406129f, 0.00371264195f, 87.85105f } },
+	{ "S-LAL10", { 1.52812575f, 0.367965267f, 1.11751784f, 0.00776817644f, 0.0272026548f, 88.86974f } },
+	{ "S-LAL12", { 0.992053895f, 0.771377731f, 1.18296264f, 0.0167095063f, 0.00236750156f, 105.90108f } },
+	{ "S-LAL13", { 0.980071267f, 0.832904776f, 1.28111995f, 0.00389123698f, 0.0189164592f, 98.9052676f } },
+	{ "S-LAL14", { 1.2372097f, 0.589722623f, 1.3192188f, 0.015355132f, -0.00030789625f, 93.7202947f } },
+	{ "S-LAL18", { 1.50276318f, 0.430224497f, 1.3472606f, 0.0145462356f, -0.00332784153f, 93.3508342f } },
+	{ "S-LAL19", { 0.973997577f, 0.958186322f, 1.20163359f, 0.00379332678f, 0.0177574581f, 83.79896f } },
+	{ "S-LAL20", { 1.06788467f, 0.75873535f, 1.02804682f, 0.00518896058f, 0.0204004357f, 120.82632f } },
+	{ "S-LAL54Q", { 0.920085087f, 0.758646115f, 1.07073096f, 0.0160829667f, 0.00292059306f, 85.12112f } },
+	{ "S-LAL54", { 1.41910189f, 0.258416881f, 1.07385537f, 0.00726647428f, 0.0263842499f, 102.555463f } },
+	{ "S-LAL56", { 1.54052f, 0.217748704f, 1.30456122f, 0.00826765101f, 0.0328533726f, 124.527479f } },
+	{ "S-LAL58", { 1.06368789f, 0.744939067f, 1.59178942f, 0.018519964f, 0.00116295862f, 156.636025f } },
+	{ "S-LAL59", { 1.13962742f, 0.805227838f, 1.29488061f, 0.00493294862f, 0.020247996f, 93.4746507f } },
+	{ "S-LAL61", { 1.11073292f, 0.859347773f, 1.26707433f, 0.00464181248f, 0.0192989261f, 87.3917698f } },
+	{ "S-LAL7", { 0.916121247f, 0.765948319f, 1.27745023f, 0.00395889743f, 0.0167547425f, 110.762706f } },
+	{ "S-LAL8", { 1.30663291f, 0.571377253f, 1.24303605f, 0.00611862448f, 0.021272147f, 90.6285686f } },
+	{ "S-LAL9", { 1.16195687f, 0.644860099f, 1.25062221f, 0.0159659509f, 0.000505502467f, 93.8284169f } },
+	{ "S-LAM2", { 1.7713f, 0.19581423f, 1.19487834f, 0.00976652444f, 0.0412718628f, 110.458122f } },
+	{ "S-LAM3", { 1.64258713f, 0.23963461f, 1.22483026f, 0.0086824602f, 0.0351226242f, 116.604369f } },
+	{ "S-LAM51", { 1.638472f, 0.188330533f, 1.47502357f, 0.00904853452f, 0.0372740173f, 137.77005f } },
+	{ "S-LAM52", { 1.73442942f, 0.15155391f, 1.46225433f, 0.0100690928f, 0.0470634701f, 140.084396f } },
+	{ "S-LAM54", { 1.84213306f, 0.175468631f, 1.25750878f, 0.0094399322f, 0.0395281122f, 86.5463013f } },
+	{ "S-LAM55", { 1.85412979f, 0.165450323f, 1.27255422f, 0.0108438152f, 0.051405098f, 109.986837f } },
+	{ "S-LAM58", { 1.70984856f, 0.173342897f, 1.64833565f, 0.0100852127f, 0.0470890831f, 157.46852f } },
+	{ "S-LAM59", { 1.63056133f, 0.186994897f, 1.30014289f, 0.00899690705f, 0.0368011993f, 122.239544f } },
+	{ "S-LAM60", { 1.60673056f, 0.36641564f, 1.31761804f, 0.0077504614f, 0.0289967611f, 93.0720709f } },
+	{ "S-LAM61", { 1.7388333f, 0.15093743f, 1.12118445f, 0.00980244105f, 0.0433179685f, 101.214625f } },
+	{ "S-LAM66", { 1.92094221f, 0.219901208f, 1.72705231f, 0.0115075241f, 0.0547993543f, 120.133674f } },
+	{ "S-LAM73", { 1.86353123f, 0.255215617f, 1.23399133f, 0.0107620673f, 0.0487248679f, 117.12511f } },
+	{ "S-LAM7", { 1.71014712f, 0.256943292f, 1.63986271f, 0.010516108f, 0.0502809636f, 146.181217f } },
+	{ "S-NBH51", { 1.71203689f, 0.255989588f, 1.81456998f, 0.0107724134f, 0.0488593504f, 136.359013f } },
+	{ "S-NBH52V", { 1.51336868f, 0.212341478f, 1.54149143f, 0.00987077827f, 0.0462843662f, 126.97851f } },
+	{ "S-NBH52", { 1.50305799f, 0.221715926f, 1.84496391f, 0.00999021738f, 0.0450327698f, 163.722302f } },
+	{ "S-NBH53V", { 1.65444141f, 0.267453927f, 2.14530347f, 0.0112485533f, 0.052027274f, 167.3661f } },
+	{ "S-NBH53", { 1.6582834f, 0.263275666f, 2.10142759f, 0.0113872516f, 0.0522108137f, 165.523649f } },
+	{ "S-NBH55", { 1.83145156f, 0.287818024f, 2.152083f, 0.0122443139f, 0.057387731f, 186.099124f } },
+	{ "S-NBH56", { 1.85191438f, 0.431102852f, 3.45278284f, 0.013273262f, 0.0585944644f, 239.357089f } },
+	{ "S-NBH57", { 1.92026488f, 0.37153524f, 2.55205704f, 0.0118468028f, 0.0532105472f, 204.5493f } },
+	{ "S-NBH5", { 1.47544521f, 0.193060095f, 1.5093901f, 0.0095583674f, 0.0460430483f, 126.422746f } },
+	{ "S-NBH8", { 1.61344136f, 0.257295888f, 1.98364455f, 0.0106386752f, 0.0487071624f, 159.784404f } },
+	{ "S-NBM51", { 1.37023101f, 0.177665568f, 1.30515471f, 0.00871920342f, 0.0405725552f, 112.703058f } },
+	{ "S-NPH1W", { 1.75156623f, 0.364006304f, 2.47874141f, 0.0135004681f, 0.0668245147f, 170.756006f } },
+	{ "S-NPH1", { 1.75156623f, 0.364006304f, 2.47874141f, 0.0135004681f, 0.0668245147f, 170.756006f } },
+	{ "S-NPH2", { 2.0386951f, 0.437269641f, 2.96711461f, 0.0170796224f, 0.0749254813f, 174.155354f } },
+	{ "S-NPH3", { 2.09834903f, 0.489088388f, 2.94009268f, 0.0179123869f, 0.0776653353f, 160.930428f } },
+	{ "S-NPH4", { 1.93563931f, 0.449596478f, 2.71828573f, 0.0152585289f, 0.0696815778f, 170.327149f } },
+	{ "S-NPH53", { 1.85484904f, 0.396194484f, 2.43512461f, 0.0134621486f, 0.0631945361f, 170.864886f } },
+	{ "S-NPH5", { 1.89108996f, 0.395220126f, 2.20492127f, 0.0141164499f, 0.0662834445f, 148.6807f } },
+	{ "S-NSL2", { 0.951239368f, 0.313094652f, 1.70928507f, 0.00513091895f, 0.0231960516f, 201.539573f } },
+	{ "S-NSL36", { 1.09666153f, 0.168990073f, 1.20580827f, 0.00667491123f, 0.033609545f, 141.668738f } },
+	{ "S-NSL3", { 0.882514764f, 0.389271907f, 1.10693448f, 0.00464504582f, 0.0200551397f, 136.234339f } },
+	{ "S-NSL5", { 1.04574577f, 0.239613026f, 1.1590685f, 0.0058523228f, 0.0236858752f, 131.329061f } },
+	{ "S-PHM52", { 1.0996655f, 0.478125422f, 1.13214074f, 0.0132718559f, -0.000601649685f, 130.595472f } },
+	{ "S-PHM53", { 1.09775423f, 0.434816432f, 1.13894976f, 0.01233694f, -0.000372522903f, 124.276984f } },
+	{ "S-TIH10", { 1.61549392f, 0.262433239f, 2.09426189f, 0.0119830897f, 0.059651024f, 181.657554f } },
+	{ "S-TIH11", { 1.72677471f, 0.324568628f, 2.65816809f, 0.0129369958f, 0.0618255245f, 221.904637f } },
+	{ "S-TIH13", { 1.62224674f, 0.293844589f, 1.99225164f, 0.0118368386f, 0.0590208025f, 171.959976f } },
+	{ "S-TIH14", { 1.68915108f, 0.290462024f, 2.37971516f, 0.0128202514f, 0.0618090841f, 201.094352f } },
+	{ "S-TIH18", { 1.59921608f, 0.259532164f, 2.12454543f, 0.0116469304f, 0.0584824883f, 186.927779f } },
+	{ "S-TIH1", { 1.60326759f, 0.242980935f, 1.81313592f, 0.0118019139f, 0.0591363658f, 161.218747f } },
+	{ "S-TIH20", { 1.59255052f, 0.218805922f, 1.60254262f, 0.0119420495f, 0.0592770292f, 143.961778f } },
+	{ "S-TIH23", { 1.73986485f, 0.313894918f, 2.31093206f, 0.01294413f, 0.0612116868f, 197.420482f } },
+	{ "S-TIH3", { 1.64797648f, 0.267261917f, 2.19772845f, 0.0121917693f, 0.0597893039f, 192.15834f } },
+	{ "S-TIH4", { 1.66755531f, 0.294411865f, 2.49422119f, 0.0122052137f, 0.0597775329f, 214.869618f } },
+	{ "SFL4", { 1.66755531f, 0.294411865f, 2.49422119f, 0.0122052137f, 0.0597775329f, 214.869618f } }, // waarschijnlijk fout
+	{ "S-TIH53W", { 1.87904886f, 0.369719775f, 2.33730863f, 0.014412177f, 0.063881799f, 182.66818f } },
+	{ "S-TIH53", { 1.87904886f, 0.369719775f, 2.33730863f, 0.014412177f, 0.063881799f, 182.66818f } },
+	{ "S-TIH57", { 2.21103256f, 0.450346986f, 2.47746663f, 0.0142330268f, 0.0638573392f, 161.9376f } },
+	{ "S-TIH6", { 1.77227611f, 0.34569125f, 2.40788501f, 0.0131182633f, 0.0614479619f, 200.753254f } },
+	{ "S-TIL1", { 1.25088944f, 0.0997973327f, 1.20583504f, 0.00883921279f, 0.0482685052f, 137.414953f } },
+	{ "S-TIL25", { 1.32122534f, 0.123824976f, 1.43685254f, 0.00952091436f, 0.0516062665f, 149.064883f } },
+	{ "S-TIL26", { 1.31066488f, 0.0941903094f, 1.23292644f, 0.00968897812f, 0.0527763106f, 133.296422f } },
+	{ "S-TIL27", { 1.31433154f, 0.112300168f, 1.413901f, 0.00950404477f, 0.0524112772f, 148.429972f } },
+	{ "S-TIL2", { 1.23401499f, 0.0959796833f, 1.20503991f, 0.00869507801f, 0.0465611429f, 137.953301f } },
+	{ "S-TIL6", { 1.17701777f, 0.12795803f, 1.34740124f, 0.00771087686f, 0.0411325328f, 154.531692f } },
+	{ "S-TIM1", { 1.4496383f, 0.122986408f, 1.38066723f, 0.0112094282f, 0.059626577f, 138.178326f } },
+	{ "S-TIM22", { 1.44222294f, 0.194432265f, 1.74092482f, 0.0104249404f, 0.0550235257f, 169.710769f } },
+	{ "S-TIM25", { 1.50659233f, 0.204786135f, 1.92036668f, 0.0109501562f, 0.0574980285f, 178.128535f } },
+	{ "S-TIM27", { 1.4168047f, 0.196785057f, 1.68001322f, 0.0100732158f, 0.0537616908f, 164.672436f } },
+	{ "S-TIM28", { 1.5427081f, 0.217113891f, 1.81904459f, 0.0113925005f, 0.0579224572f, 167.697189f } },
+	{ "S-TIM2", { 1.42193846f, 0.133827968f, 1.45060574f, 0.0107291511f, 0.0572587546f, 145.381805f } },
+	{ "S-TIM35", { 1.55849775f, 0.230767007f, 1.84436099f, 0.0115367235f, 0.0586095947f, 162.981888f } },
+	{ "S-TIM39", { 1.47008105f, 0.224752746f, 2.44968592f, 0.0102900432f, 0.0541276904f, 237.43494f } },
+	{ "S-TIM3", { 1.40691144f, 0.128369745f, 1.51826191f, 0.0105633641f, 0.0568483105f, 152.107924f } },
+	{ "S-TIM5", { 1.38531342f, 0.122372945f, 1.40508326f, 0.0104074567f, 0.0557440088f, 144.878733f } },
+	{ "S-TIM6", { 1.41315067f, 0.1914654f, 1.68833255f, 0.00995172814f, 0.0527932739f, 168.804627f } },
+	{ "S-TIM8", { 1.37262713f, 0.112636276f, 1.39786421f, 0.0103220068f, 0.0550195044f, 147.735609f } },
+	{ "S-YGH51", { 1.0828017f, 0.933988681f, 1.32367286f, 0.018115636f, 0.00304157575f, 91.0353195f } },
+	{ "N-LAK33", { 1.0828017f, 0.933988681f, 1.32367286f, 0.018115636f, 0.00304157575f, 91.0353195f } }, // wschl
+	{ "BAFN6", { 1.36719201f, 0.10907994f, 1.02108011f, 0.00882820704f, 0.0438731646f, 113.58602f } },
+	{ "BK7G18", { 1.26538542f, 0.0144191073f, 1.00323028f, 0.00813104078f, 0.0543303226f, 102.821166f } },
+	{ "F2G12", { 1.34702224f, 0.210037763f, 19.5350768f, 0.00980850553f, 0.0471788018f, 2279.1547f } },
+	{ "F2HT", { 1.34533359f, 0.209073176f, 0.937357162f, 0.00997743871f, 0.0470450767f, 111.886764f } },
+	{ "F2", { 1.34533359f, 0.209073176f, 0.937357162f, 0.00997743871f, 0.0470450767f, 111.886764f } },
+	{ "FN11", { 1.34533359f, 0.209073176f, 0.937357162f, 0.00997743871f, 0.0470450767f, 111.886764f } }, // ??
+	{ "F5", { 1.3104463f, 0.19603426f, 0.96612977f, 0.00958633048f, 0.0457627627f, 115.011883f } },
+	{ "FK3", { 0.973346627f, 0.146642231f, 0.679304225f, 0.00640795469f, 0.020565293f, 80.4965389f } },
+	{ "FK5HTi", { 0.90936218f, 0.279077054f, 0.891813298f, 0.0052014247f, 0.0158938446f, 95.9109448f } },
+	{ "K10", { 1.15687082f, 0.0642625444f, 0.872376139f, 0.00809424251f, 0.0386051284f, 104.74773f } },
+	{ "K5G20", { 1.14094396f, 0.14500119f, 37.4705786f, 0.00694945478f, 0.0310574444f, 4536.25624f } },
+	{ "K7", { 1.1273555f, 0.124412303f, 0.827100531f, 0.00720341707f, 0.0269835916f, 100.384588f } },
+	{ "KZFS12", { 1.55624873f, 0.239769276f, 0.947887658f, 0.0102012744f, 0.0469277969f, 69.8370722f } },
+	{ "KZFSN4", { 1.37994218f, 0.168496708f, 0.874885726f, 0.00891159699f, 0.040533407f, 69.6628237f } },
+	{ "LAFN7", { 1.66842615f, 0.298512803f, 1.0774376f, 0.0103159999f, 0.0469216348f, 82.5078509f } },
+	{ "LAK9G15", { 1.28773667f, 0.518244853f, 26.1756109f, 0.0055754192f, 0.0223679524f, 1892.2533f } },
+	{ "LAKL12", { 1.28115389f, 0.482607607f, 1.16553538f, 0.00636439821f, 0.0213764262f, 93.2771532f } },
+	{ "LASF35", { 2.45505861f, 0.453006077f, 2.3851308f, 0.0135670404f, 0.054580302f, 167.904715f } },
+	{ "LASFN9", { 1.97888194f, 0.320435298f, 1.92900751f, 0.0118537266f, 0.052738177f, 166.25654f } },
+	{ "LF5G15", { 1.28887331f, 0.162818811f, 10.5579792f, 0.0092001566f, 0.0456954308f, 1275.44015f } },
+	{ "LF5G19", { 1.34611327f, 0.142428018f, 0.900477176f, 0.0097174385f, 0.0501911619f, 111.959703f } },
+	{ "LF5HTi", { 1.28552924f, 0.158357622f, 0.892175122f, 0.0093988626f, 0.0452566659f, 110.544829f } },
+	{ "LF5", { 1.28035628f, 0.163505973f, 0.893930112f, 0.00929854416f, 0.0449135769f, 110.493685f } },
+	{ "LITHOSIL-Q", { 0.67071081f, 0.433322857f, 0.877379057f, 0.00449192312f, 0.0132812976f, 95.8899878f } },
+	{ "LITHOTEC-CAF2", { 0.617617011f, 0.421117656f, 3.79711183f, 0.00275381936f, 0.0105900875f, 1182.67444f } },
+	{ "LLF1HTi", { 1.22510445f, 0.125155671f, 0.892236751f, 0.00870432098f, 0.0427325235f, 108.049968f } },
+	{ "LLF1", { 1.21640125f, 0.13366454f, 0.883399468f, 0.00857807248f, 0.0420143003f, 107.59306f } },
+	{ "N-BAF10", { 1.5851495f, 0.143559385f, 1.08521269f, 0.00926681282f, 0.0424489805f, 105.613573f } },
+	{ "N-BAF3", { 1.34859634f, 0.10764424f, 1.13207084f, 0.00871492932f, 0.0478406436f, 112.936116f } },
+	{ "N-BAF4", { 1.42056328f, 0.102721269f, 1.14380976f, 0.00942015382f, 0.0531087291f, 110.278856f } },
+	{ "N-BAF51", { 1.51503623f, 0.153621958f, 1.15427909f, 0.00942734715f, 0.04308265f, 124.889868f } },
+	{ "N-BAF52", { 1.43903433f, 0.0967046052f, 1.09875818f, 0.00907800128f, 0.050821208f, 105.691856f } },
+	{ "N-BAK1", { 1.12365662f, 0.309276848f, 0.881511957f, 0.00644742752f, 0.0222284402f, 107.297751f } },
+	{ "N-BAK2", { 1.01662154f, 0.319903051f, 0.937232995f, 0.00592383763f, 0.0203828415f, 113.118417f } },
+	{ "N-BAK4HT", { 1.28834642f, 0.132817724f, 0.945395373f, 0.00779980626f, 0.0315631177f, 105.965875f } },
+	{ "N-BAK4", { 1.28834642f, 0.132817724f, 0.945395373f, 0.00779980626f, 0.0315631177f, 105.965875f } },
+	{ "N-BALF4", { 1.31004128f, 0.142038259f, 0.964929351f, 0.0079659645f, 0.0330672072f, 109.19732f } },
+	{ "N-BALF5", { 1.28385965f, 0.0719300942f, 1.05048927f, 0.00825815975f, 0.0441920027f, 107.097324f } },
+	{ "N-BASF2", { 1.53652081f, 0.156971102f, 1.30196815f, 0.0108435729f, 0.0562278762f, 131.3397f } },
+	{ "N-BASF64", { 1.65554268f, 0.17131977f, 1.33664448f, 0.0104485644f, 0.0499394756f, 118.961472f } },
+	{ "N-BK10", { 0.888308131f, 0.328964475f, 0.984610769f, 0.00516900822f, 0.0161190045f, 99.7575331f } },
+	{ "N-BK7HTi", { 1.03961212f, 0.231792344f, 1.01046945f, 0.00600069867f, 0.0200179144f, 103.560653f } },
+	{ "N-BK7HT", { 1.03961212f, 0.231792344f, 1.01046945f, 0.00600069867f, 0.0200179144f, 103.560653f } },
+	{ "N-BK7", { 1.03961212f, 0.231792344f, 1.01046945f, 0.00600069867f, 0.0200179144f, 103.560653f } },
+	{ "BK7", { 1.03961212f, 0.231792344f, 1.01046945f, 0.00600069867f, 0.0200179144f, 103.560653f } },
+	{ "N-F2", { 1.39757037f, 0.159201403f, 1.2686543f, 0.00995906143f, 0.0546931752f, 119.248346f } },
+	{ "N-FK51A", { 0.971247817f, 0.216901417f, 0.904651666f, 0.00472301995f, 0.0153575612f, 168.68133f } },
+	{ "N-FK51", { 0.971247817f, 0.216901417f, 0.904651666f, 0.00472301995f, 0.0153575612f, 168.68133f } },
+	{ "FK51", { 0.971247817f, 0.216901417f, 0.904651666f, 0.00472301995f, 0.0153575612f, 168.68133f } },
+	{ "N-FK58", { 0.738042712f, 0.363371967f, 0.989296264f, 0.00339065607f, 0.0117551189f, 212.842145f } },
+	{ "N-FK5", { 0.844309338f, 0.344147824f, 0.910790213f, 0.00475111955f, 0.0149814849f, 97.8600293f } },
+	{ "FK5", { 0.844309338f, 0.344147824f, 0.910790213f, 0.00475111955f, 0.0149814849f, 97.8600293f } }, // ?
+	{ "N-K5", { 1.08511833f, 0.199562005f, 0.930511663f, 0.00661099503f, 0.024110866f, 111.982777f } },
+	{ "N-KF9", { 1.19286778f, 0.0893346571f, 0.920819805f, 0.00839154696f, 0.0404010786f, 112.572446f } },
+	{ "N-KZFS11", { 1.3322245f, 0.28924161f, 1.15161734f, 0.0084029848f, 0.034423972f, 88.4310532f } },
+	{ "N-KZFS2", { 1.23697554f, 0.153569376f, 0.903976272f, 0.00747170505f, 0.0308053556f, 70.1731084f } },
+	{ "N-KZFS4HT", { 1.35055424f, 0.197575506f, 1.09962992f, 0.0087628207f, 0.0371767201f, 90.3866994f } },
+	{ "N-KZFS4", { 1.35055424f, 0.197575506f, 1.09962992f, 0.0087628207f, 0.0371767201f, 90.3866994f } },
+	{ "N-KZFS5", { 1.47460789f, 0.193584488f, 1.26589974f, 0.00986143816f, 0.0445477583f, 106.436258f } },
+	{ "N-KZFS8", { 1.62693651f, 0.24369876f, 1.62007141f, 0.010880863f, 0.0494207753f, 131.009163f } },
+	{ "N-LAF21", { 1.87134529f, 0.25078301f, 1.22048639f, 0.0093332228f, 0.0345637762f, 83.2404866f } },
+	{ "N-LAF2", { 1.80984227f, 0.15729555f, 1.0930037f, 0.0101711622f, 0.0442431765f, 100.687748f } },
+	{ "N-LAF33", { 1.79653417f, 0.311577903f, 1.15981863f, 0.00927313493f, 0.0358201181f, 87.3448712f } },
+	{ "N-LAF34", { 1.75836958f, 0.313537785f, 1.18925231f, 0.00872810026f, 0.0293020832f, 85.1780644f } },
+	{ "N-LAF35", { 1.51697436f, 0.455875464f, 1.07469242f, 0.00750943203f, 0.0260046715f, 80.5945159f } },
+	{ "N-LAF36", { 1.85744228f, 0.294098729f, 1.16615417f, 0.00982397191f, 0.0384309138f, 89.3984634f } },
+	{ "N-LAF3", { 1.73155854f, 0.150874455f, 1.06586596f, 0.00953833914f, 0.0407887211f, 98.0758545f } },
+	{ "N-LAF7", { 1.74028764f, 0.226710554f, 1.32525548f, 0.010792558f, 0.0538626639f, 106.268665f } },
+	{ "N-LAK10", { 1.72878017f, 0.169257825f, 1.19386956f, 0.00886014635f, 0.0363416509f, 82.9009069f } },
+	{ "LAK16A", { 1.72878017f, 0.169257825f, 1.19386956f, 0.00886014635f, 0.0363416509f, 82.9009069f } }, // ???
+	{ "N-LAK12", { 1.17365704f, 0.588992398f, 0.978014394f, 0.00577031797f, 0.0200401678f, 95.4873482f } },
+	{ "N-LAK14", { 1.50781212f, 0.318866829f, 1.14287213f, 0.00746098727f, 0.0242024834f, 80.9565165f } },
+	{ "N-LAK21", { 1.22718116f, 0.420783743f, 1.01284843f, 0.00602075682f, 0.0196862889f, 88.4370099f } },
+	{ "N-LAK22", { 1.14229781f, 0.535138441f, 1.04088385f, 0.00585778594f, 0.0198546147f, 100.834017f } },
+	{ "N-LAK33A", { 1.44116999f, 0.571749501f, 1.16605226f, 0.00680933877f, 0.0222291824f, 80.9379555f } },
+	{ "N-LAK33", { 1.44116999f, 0.571749501f, 1.16605226f, 0.00680933877f, 0.0222291824f, 80.9379555f } }, // ???
+	{ "N-LAK33B", { 1.42288601f, 0.593661336f, 1.1613526f, 0.00670283452f, 0.021941621f, 80.7407701f } },
+	{ "N-LAK34", { 1.26661442f, 0.665919318f, 1.1249612f, 0.00589278062f, 0.0197509041f, 78.8894174f } },
+	{ "N-LAK7", { 1.23679889f, 0.445051837f, 1.01745888f, 0.00610105538f, 0.0201388334f, 90.638038f } },
+	{ "N-LAK8", { 1.33183167f, 0.546623206f, 1.19084015f, 0.00620023871f, 0.0216465439f, 82.5827736f } },
+	{ "N-LAK9", { 1.46231905f, 0.344399589f, 1.15508372f, 0.00724270156f, 0.0243353131f, 85.4686868f } },
+	{ "N-LASF31A", { 1.96485075f, 0.475231259f, 1.48360109f, 0.00982060155f, 0.0344713438f, 110.739863f } },
+	{ "N-LASF31", { 1.71317198f, 0.718575109f, 1.7233247f, 0.00819172228f, 0.0297801704f, 138.461313f } },
+	{ "N-LASF40", { 1.98550331f, 0.274057042f, 1.28945661f, 0.010958331f, 0.0474551603f, 96.9085286f } },
+	{ "N-LASF41", { 1.86348331f, 0.413307255f, 1.35784815f, 0.00910368219f, 0.0339247268f, 93.3580595f } },
+	{ "N-LASF43", { 1.93502827f, 0.23662935f, 1.26291344f, 0.0104001413f, 0.0447505292f, 87.437569f } },
+	{ "N-LASF44", { 1.78897105f, 0.38675867f, 1.30506243f, 0.00872506277f, 0.0308085023f, 92.7743824f } },
+	{ "N-LASF45HT", { 1.87140198f, 0.267777879f, 1.73030008f, 0.011217192f, 0.0505134972f, 147.106505f } },
+	{ "N-LASF45", { 1.87140198f, 0.267777879f, 1.73030008f, 0.011217192f, 0.0505134972f, 147.106505f } },
+	{ "N-LASF46A", { 2.16701566f, 0.319812761f, 1.66004486f, 0.0123595524f, 0.0560610282f, 107.047718f } },
+	{ "N-LASF46B", { 2.17988922f, 0.306495184f, 1.56882437f, 0.0125805384f, 0.0567191367f, 105.316538f } },
+	{ "N-LASF46", { 2.18073678f, 0.298978656f, 1.62190046f, 0.0125642118f, 0.056469999f, 105.662819f } },
+	{ "N-LASF9HT", { 2.00029547f, 0.298926886f, 1.80691843f, 0.0121426017f, 0.0538736236f, 156.530829f } },
+	{ "N-LASF9", { 2.00029547f, 0.298926886f, 1.80691843f, 0.0121426017f, 0.0538736236f, 156.530829f } },
+	{ "N-PK51", { 1.15610775f, 0.153229344f, 0.785618966f, 0.00585597402f, 0.0194072416f, 140.537046f } },
+	{ "N-PK52A", { 1.029607f, 0.1880506f, 0.736488165f, 0.00516800155f, 0.0166658798f, 138.964129f } },
+	{ "N-PSK3", { 0.88727211f, 0.489592425f, 1.04865296f, 0.00469824067f, 0.0161818463f, 104.374975f } },
+	{ "N-PSK53A", { 1.38121836f, 0.196745645f, 0.886089205f, 0.00706416337f, 0.0233251345f, 97.4847345f } },
+	{ "N-PSK53", { 1.3434087f, 0.241417935f, 0.952896897f, 0.00675074317f, 0.0219910513f, 103.551457f } },
+	{ "N-SF10", { 1.62153902f, 0.256287842f, 1.64447552f, 0.0122241457f, 0.0595736775f, 147.468793f } },
+	{ "N-SF11", { 1.73759695f, 0.313747346f, 1.89878101f, 0.013188707f, 0.0623068142f, 155.23629f } },
+	{ "N-SF14", { 1.69022361f, 0.288870052f, 1.7045187f, 0.0130512113f, 0.061369188f, 149.517689f } },
+	{ "N-SF15", { 1.57055634f, 0.218987094f, 1.50824017f, 0.0116507014f, 0.0597856897f, 132.709339f } },
+	{ "N-SF19", { 1.52005444f, 0.17573947f, 1.43623424f, 0.01096144f, 0.0593248486f, 126.795151f } },
+	{ "N-SF1", { 1.60865158f, 0.237725916f, 1.51530653f, 0.0119654879f, 0.0590589722f, 135.521676f } },
+	{ "N-SF2", { 1.47343127f, 0.163681849f, 1.36920899f, 0.0109019098f, 0.0585683687f, 127.404933f } },
+	{ "N-SF4", { 1.67780282f, 0.282849893f, 1.63539276f, 0.012679345f, 0.0602038419f, 145.760496f } },
+	{ "N-SF56", { 1.73562085f, 0.317487012f, 1.95398203f, 0.0129624742f, 0.0612884288f, 161.559441f } },
+	{ "N-SF57HTultra", { 1.87543831f, 0.37375749f, 2.30001797f, 0.0141749518f, 0.0640509927f, 177.389795f } },
+	{ "N-SF57HT", { 1.87543831f, 0.37375749f, 2.30001797f, 0.0141749518f, 0.0640509927f, 177.389795f } },
+	{ "N-SF57", { 1.87543831f, 0.37375749f, 2.30001797f, 0.0141749518f, 0.0640509927f, 177.389795f } },
+	{ "N-SF5", { 1.52481889f, 0.187085527f, 1.42729015f, 0.011254756f, 0.0588995392f, 129.141675f } },
+	{ "N-SF64", { 1.59163762f, 0.219908428f, 1.46929315f, 0.0118623434f, 0.0594585499f, 133.310762f } },
+	{ "N-SF66", { 2.0245976f, 0.470187196f, 2.59970433f, 0.0147053225f, 0.0692998276f, 161.817601f } },
+	{ "N-SF6HTultra", { 1.77931763f, 0.338149866f, 2.08734474f, 0.0133714182f, 0.0617533621f, 174.01759f } },
+	{ "N-SF6HT", { 1.77931763f, 0.338149866f, 2.08734474f, 0.0133714182f, 0.0617533621f, 174.01759f } },
+	{ "N-SF6", { 1.77931763f, 0.338149866f, 2.08734474f, 0.0133714182f, 0.0617533621f, 174.01759f } },
+	{ "N-SF8", { 1.55075812f, 0.209816918f, 1.46205491f, 0.0114338344f, 0.0582725652f, 133.24165f } },
+	{ "N-SK10", { 1.34972093f, 0.238587973f, 0.9667336f, 0.00736272269f, 0.0253765327f, 103.502909f } },
+	{ "N-SK11", { 1.17963631f, 0.229817295f, 0.935789652f, 0.00680282081f, 0.0219737205f, 101.513232f } },
+	{ "N-SK14", { 0.936155374f, 0.594052018f, 1.04374583f, 0.00461716525f, 0.016885927f, 103.736265f } },
+	{ "SK14", { 0.936155374f, 0.594052018f, 1.04374583f, 0.00461716525f, 0.016885927f, 103.736265f } }, // ???
+	{ "N-SK15", { 1.30417786f, 0.28584116f, 0.974781572f, 0.00695051276f, 0.0232023703f, 99.016884f } },
+	{ "N-SK16", { 1.34317774f, 0.241144399f, 0.994317969f, 0.00704687339f, 0.0229005f, 92.7508526f } },
+	{ "N-SK2HT", { 1.28189012f, 0.257738258f, 0.96818604f, 0.0072719164f, 0.0242823527f, 110.377773f } },
+	{ "N-SK2", { 1.28189012f, 0.257738258f, 0.96818604f, 0.0072719164f, 0.0242823527f, 110.377773f } },
+	{ "N-SK4", { 1.32993741f, 0.228542996f, 0.988465211f, 0.00716874107f, 0.0246455892f, 100.886364f } },
+	{ "N-SK5", { 0.991463823f, 0.495982121f, 0.987393925f, 0.00522730467f, 0.0172733646f, 98.3594579f } },
+	{ "SK5", { 0.991463823f, 0.495982121f, 0.987393925f, 0.00522730467f, 0.0172733646f, 98.3594579f } }, // ???
+	{ "N-SSK2", { 1.4306027f, 0.153150554f, 1.01390904f, 0.00823982975f, 0.0333736841f, 106.870822f } },
+	{ "N-SSK5", { 1.59222659f, 0.103520774f, 1.05174016f, 0.00920284626f, 0.0423530072f, 106.927374f } },
+	{ "N-SSK8", { 1.44857867f, 0.117965926f, 1.06937528f, 0.00869310149f, 0.0421566593f, 111.300666f } },
+	{ "N-ZK7A", { 1.07509891f, 0.168895044f, 0.860503983f, 0.00676601657f, 0.0230642817f, 89.0498778f } },
+	{ "N-ZK7", { 1.07715032f, 0.168079109f, 0.851889892f, 0.00676601657f, 0.0230642817f, 89.0498778f } },
+	{ "P-BK7", { 1.18318503f, 0.0871756426f, 1.03133701f, 0.00722141956f, 0.0268216805f, 101.702362f } },
+	{ "P-LAF37", { 1.76003244f, 0.248286745f, 1.15935122f, 0.00938006396f, 0.0360537464f, 86.4324693f } },
+	{ "P-LAK35", { 1.3932426f, 0.418882766f, 1.043807f, 0.00715959695f, 0.0233637446f, 88.3284426f } },
+	{ "P-LASF47", { 1.85543101f, 0.315854649f, 1.28561839f, 0.0100328203f, 0.0387095168f, 94.5421507f } },
+	{ "P-LASF50", { 1.84910553f, 0.329828674f, 1.30400901f, 0.00999234757f, 0.0387437988f, 95.8967681f } },
+	{ "P-LASF51", { 1.84568806f, 0.3390016f, 1.32418921f, 0.00988495571f, 0.0378097402f, 97.841543f } },
+	{ "P-PK53", { 0.960316767f, 0.340437227f, 0.777865595f, 0.00531032986f, 0.0175073434f, 106.87533f } },
+	{ "P-SF67", { 1.97464225f, 0.467095921f, 2.43154209f, 0.0145772324f, 0.0669790359f, 157.444895f } },
+	{ "P-SF68", { 2.3330067f, 0.452961396f, 1.25172339f, 0.0168838419f, 0.0716086325f, 118.707479f } },
+	{ "P-SF69", { 1.62594647f, 0.235927609f, 1.67434623f, 0.0121696677f, 0.0600710405f, 145.651908f } },
+	{ "P-SF8", { 1.55370411f, 0.206332561f, 1.39708831f, 0.011658267f, 0.0582087757f, 130.748028f } },
+	{ "P-SK57Q1", { 1.30536483f, 0.171434328f, 1.10117219f, 0.00736408831f, 0.0255786047f, 106.72606f } },
+	{ "P-SK57", { 1.31053414f, 0.169376189f, 1.10987714f, 0.00740877235f, 0.0254563489f, 107.751087f } },
+	{ "P-SK58A", { 1.3167841f, 0.171154756f, 1.12501473f, 0.00720717498f, 0.0245659595f, 102.739728f } },
+	{ "P-SK60", { 1.40790442f, 0.143381417f, 1.16513947f, 0.00784382378f, 0.0287769365f, 105.373397f } },
+	{ "SF10", { 1.61625977f, 0.259229334f, 1.07762317f, 0.0127534559f, 0.0581983954f, 116.60768f } },
+	{ "SF11", { 1.73848403f, 0.311168974f, 1.17490871f, 0.0136068604f, 0.0615960463f, 121.922711f } },
+	{ "SF14", { 1.69182538f, 0.285919934f, 1.12595145f, 0.0133151542f, 0.0612647445f, 118.405242f } },
+	{ "SF15", { 1.53925927f, 0.247620926f, 1.03816409f, 0.0119307961f, 0.0556077536f, 116.416747f } },
+	{ "SF1", { 1.55912923f, 0.284246288f, 0.968842926f, 0.0121481001f, 0.0534549042f, 112.174809f } },
+	{ "SF2", { 1.40301821f, 0.231767504f, 0.939056586f, 0.0105795466f, 0.0493226978f, 112.405955f } },
+	{ "SF4", { 1.61957826f, 0.339493189f, 1.02566931f, 0.0125502104f, 0.0544559822f, 117.652222f } },
+	{ "SF56A", { 1.70579259f, 0.344223052f, 1.09601828f, 0.0133874699f, 0.0579561608f, 121.616024f } },
+	{ "SF57HTultra", { 1.81651371f, 0.428893641f, 1.07186278f, 0.0143704198f, 0.0592801172f, 121.419942f } },
+	{ "SF57", { 1.81651371f, 0.428893641f, 1.07186278f, 0.0143704198f, 0.0592801172f, 121.419942f } },
+	{ "SF5", { 1.46141885f, 0.247713019f, 0.949995832f, 0.0111826126f, 0.0508594669f, 112.041888f } },
+	{ "SF66", { 2.07842233f, 0.407120032f, 1.76711292f, 0.0180875134f, 0.0679493572f, 215.266127f } },
+	{ "SF6G05", { 1.62113942f, 0.506586092f, 10.4032298f, 0.0113478992f, 0.0535840223f, 1118.83658f } },
+	{ "SF6", { 1.72448482f, 0.390104889f, 1.04572858f, 0.0134871947f, 0.0569318095f, 118.557185f } },
+	{ "SFL57", { 1.88742326f, 0.360534025f, 2.26189313f, 0.0145939341f, 0.0648198946f, 176.062211f } },
+	{ "SFL6", { 1.78922056f, 0.328427448f, 2.01639441f, 0.0135163537f, 0.0622729599f, 168.014713f } },
+	{ "4786", { 0.795944286f, 0.356650937f, 0.98008113f, 0.00371401467f, 0.0125884185f, 190.314843f } },
+	{ "5165", { 1.12790724f, 0.129745283f, 0.994872985f, 0.00673602593f, 0.0228274219f, 94.2587142f } },
+	{ "5742", { 1.30326513f, 0.127313632f, 0.895143157f, 0.00977713845f, 0.0463756328f, 107.962139f } },
+	{ "5859", { 1.06973916f, 0.422042806f, 0.897510953f, 0.00562417858f, 0.0188055076f, 71.2142596f } },
+	{ "7054", { 1.18710503f, 0.669241576f, 1.10329256f, 0.00549101471f, 0.0196008925f, 83.1244339f } },
+	{ "AF32ECO", { 1.11332955f, 0.141527282f, 0.860743147f, 0.00707493977f, 0.0225358637f, 90.1552652f } },
+	{ "D263TECO", { 1.23795755f, 0.0466468888f, 2.46700556f, 0.00863080926f, 0.0469074501f, 264.146296f } },
+	{ "LF7", { 1.26879731f, 0.156697051f, 0.887676301f, 0.00919553925f, 0.0447256764f, 106.8203610f } },
+	{ "4786", { 0.795944286f, 0.356650937f, 0.98008113f, 0.00371401467f, 0.0125884185f, 190.314843f } },
+	{ "5165", { 1.12790724f, 0.129745283f, 0.994872985f, 0.00673602593f, 0.0228274219f, 94.2587142f } },
+	{ "5742", { 1.30326513f, 0.127313632f, 0.895143157f, 0.00977713845f, 0.0463756328f, 107.962139f } },
+	{ "5859", { 1.06973916f, 0.422042806f, 0.897510953f, 0.00562417858f, 0.0188055076f, 71.2142596f } },
+	{ "7054", { 1.18710503f, 0.669241576f, 1.10329256f, 0.00549101471f, 0.0196008925f, 83.1244339f } },
+	{ "AF32ECO", { 1.11332955f, 0.141527282f, 0.860743147f, 0.00707493977f, 0.0225358637f, 90.1552652f } },
+	{ "D263TECO", { 1.23795755f, 0.0466468888f, 2.46700556f, 0.00863080926f, 0.0469074501f, 264.146296f } },
+	{ "LF7", { 1.26879731f, 0.156697051f, 0.887676301f, 0.00919553925f, 0.0447256764f, 106.8203610f } },
+	{ "4786", { 0.795944286f, 0.356650937f, 0.98008113f, 0.00371401467f, 0.0125884185f, 190.314843f } },
+	{ "5165", { 1.12790724f, 0.129745283f, 0.994872985f, 0.00673602593f, 0.0228274219f, 94.2587142f } },
+	{ "5742", { 1.30326513f, 0.127313632f, 0.895143157f, 0.00977713845f, 0.0463756328f, 107.962139f } },
+	{ "5859", { 1.06973916f, 0.422042806f, 0.897510953f, 0.00562417858f, 0.0188055076f, 71.2142596f } },
+	{ "7054", { 1.18710503f, 0.669241576f, 1.10329256f, 0.00549101471f, 0.0196008925f, 83.1244339f } },
+	{ "AF32ECO", { 1.11332955f, 0.141527282f, 0.860743147f, 0.00707493977f, 0.0225358637f, 90.1552652f } },
+	{ "D263TECO", { 1.23795755f, 0.0466468888f, 2.46700556f, 0.00863080926f, 0.0469074501f, 264.146296f } },
+	{ "LF7", { 1.26879731f, 0.156697051f, 0.887676301f, 0.00919553925f, 0.0447256764f, 106.8203610f } },
+	{ "4786", { 0.795944286f, 0.356650937f, 0.98008113f, 0.00371401467f, 0.0125884185f, 190.314843f } },
+	{ "5165", { 1.12790724f, 0.129745283f, 0.994872985f, 0.00673602593f, 0.0228274219f, 94.2587142f } },
+	{ "5742", { 1.30326513f, 0.127313632f, 0.895143157f, 0.00977713845f, 0.0463756328f, 107.962139f } },
+	{ "5859", { 1.06973916f, 0.422042806f, 0.897510953f, 0.00562417858f, 0.0188055076f, 71.2142596f } },
+	{ "7054", { 1.18710503f, 0.669241576f, 1.10329256f, 0.00549101471f, 0.0196008925f, 83.1244339f } },
+	{ "AF32ECO", { 1.11332955f, 0.141527282f, 0.860743147f, 0.00707493977f, 0.0225358637f, 90.1552652f } },
+	{ "D263TECO", { 1.23795755f, 0.0466468888f, 2.46700556f, 0.00863080926f, 0.0469074501f, 264.146296f } },
+	{ "LF7", { 1.26879731f, 0.156697051f, 0.887676301f, 0.00919553925f, 0.0447256764f, 106.8203610f } },
 
-		// data from https://refractiveindex.info/ (eq. 3)
-		if ( material == "BAF10" ) return { 2.708194f, 0.004899893f, 0.03147874f, -0.002304342f, 0.0003414449f, -1.465281e-05f };
-		if ( material == "BAF11" ) return { 2.718364f, -0.009306715f, 0.02090148f, 0.0001588714f, 4.065932e-05f, -8.563966e-07f };
-		if ( material == "BAF3" ) return { 2.438682f, 0.001609961f, 0.02688829f, -0.002446579f, 0.0003965661f, -1.973046e-05f };
-		if ( material == "BAF4" ) return { 2.504959f, 0.003324741f, 0.02831428f, -0.002044138f, 0.0003343099f, -1.534858e-05f };
-		if ( material == "BAF8" ) return { 2.576356f, -0.004964319f, 0.02151531f, -0.0002533858f, 7.507447e-05f, -1.820369e-06f };
-		if ( material == "BAK2" ) return { 2.319725f, 0.002602493f, 0.02249807f, -0.002672041f, 0.0003926686f, -2.043303e-05f };
-		if ( material == "BAK4" ) return { 2.414299f, -0.002829974f, 0.01680892f, -8.945119e-05f, -1.350522e-05f, 4.145336e-06f };
-		if ( material == "BASF12" ) return { 2.729422f, -0.01897808f, 0.01735778f, 0.002340995f, -0.000198277f, 1.222741e-05f };
-		if ( material == "BASF2" ) return { 2.677014f, 0.003011704f, 0.03312038f, -0.0009256636f, 0.0001805364f, -2.622153e-06f };
-		if ( material == "BASF4" ) return { 2.653252f, -0.006578821f, 0.02439776f, 0.0005194976f, 2.48777e-05f, 1.560994e-06f };
-		if ( material == "BASF6" ) return { 2.718163f, -0.01334622f, 0.02057831f, 0.0009283221f, -1.411159e-05f, 1.659476e-06f };
-		if ( material == "BASF7" ) return { 2.83515f, -0.01785081f, 0.01539786f, 0.003719055f, -0.0004884822f, 3.290179e-05f };
-		if ( material == "BASF8" ) return { 2.881495f, -0.006454381f, 0.03074684f, -0.0001396031f, 0.0001314241f, -2.44494e-06f };
-		if ( material == "E-BAF10" ) return { 2.72932262f, -0.0106085219f, 0.0204478583f, 0.000484576944f, -3.06411426e-06f, 1.63981487e-06f };
-		if ( material == "E-BAF11" ) return { 2.71954649f, -0.0100472501f, 0.0200301385f, 0.000465868302f, -7.51633336e-06f, 1.77544989e-06f };
-		if ( material == "E-BAF12" ) return { 2.62833748f, -0.0100974072f, 0.0203176439f, 0.000375302287f, 1.45983254e-05f, 1.37126433e-06f };
-		if ( material == "E-BAF3" ) return { 2.43868193f, 0.00160996098f, 0.0268882943f, -0.00244657917f, 0.000396566086f, -1.9730459e-05f };
-		if ( material == "E-BAF4" ) return { 2.50495857f, 0.00332474118f, 0.0283142796f, -0.00204413784f, 0.000334309924f, -1.53485779e-05f };
-		if ( material == "E-BAF8" ) return { 2.58072694f, -0.00826682499f, 0.0192773695f, 0.000287391647f, 1.54399962e-05f, 4.63747358e-07f };
-		if ( material == "E-BAK1" ) return { 2.44353274f, -0.0161455184f, 0.00881927898f, 0.00144687542f, -0.000136331798f, 6.03309808e-06f };
-		if ( material == "E-BAK2" ) return { 2.33664322f, -0.00862588382f, 0.0125079902f, 0.000175550187f, 4.02268677e-06f, -3.58785019e-08f };
-		if ( material == "E-BAK4" ) return { 2.4220474f, -0.00935286439f, 0.0138282404f, 0.000292097262f, -5.77819731e-06f, 7.05644888e-07f };
-		if ( material == "E-BALF4" ) return { 2.45999845f, -0.0140695372f, 0.0104962988f, 0.00154266669f, -0.000169174126f, 9.43510859e-06f };
-		if ( material == "E-BASF2" ) return { 2.67701358f, 0.00301170374f, 0.033120376f, -0.000925663558f, 0.000180536382f, -2.62215298e-06f };
-		if ( material == "E-BASF6" ) return { 2.71377616f, -0.00941072521f, 0.0221914885f, 0.000735180213f, -2.11522864e-05f, 3.73099495e-06f };
-		if ( material == "E-BASF7" ) return { 2.83515039f, -0.0178508143f, 0.0153978598f, 0.00371905515f, -0.000488482182f, 3.29017911e-05f };
-		if ( material == "E-BASF8" ) return { 2.88848579f, -0.0117260382f, 0.0269121453f, 0.000931846805f, -1.77180132e-05f, 5.63107499e-06f };
-		if ( material == "E-BK7" ) return { 2.271192f, -0.00966126763f, 0.0110306969f, 7.00379964e-05f, 1.39658544e-05f, -7.62560454e-07f };
-		if ( material == "E-F16" ) return { 2.47196413f, -0.0100810083f, 0.0208698749f, 0.000995620952f, -4.77932855e-05f, 8.07129922e-06f };
-		if ( material == "E-F1" ) return { 2.56251919f, -0.00314623487f, 0.0291600242f, -0.000870730012f, 0.000226533195f, -8.61239946e-06f };
-		if ( material == "E-F2" ) return { 2.55739282f, -0.0107951229f, 0.0216807328f, 0.00105165979f, -5.36309816e-05f, 7.7466326e-06f };
-		if ( material == "E-F3" ) return { 2.52228312f, -0.00104823034f, 0.029395765f, -0.00139163033f, 0.000289680505f, -1.26508887e-05f };
-		if ( material == "E-F5" ) return { 2.50863619f, -0.0101869365f, 0.0204516474f, 0.000841069518f, -3.63565381e-05f, 5.99712664e-06f };
-		if ( material == "E-F8" ) return { 2.47286461f, -0.00151192688f, 0.0276004612f, -0.00152550371f, 0.000290711488f, -1.28484326e-05f };
-		if ( material == "E-FK01" ) return { 2.22250469f, -0.00850804282f, 0.005666787f, 0.00084184905f, -9.804141e-05f, 4.91868528e-06f };
-		if ( material == "E-FK5" ) return { 2.1887621f, -0.0095572007f, 0.0089915232f, 0.00014560516f, -5.2843067e-06f, 3.458801e-07f };
-		if ( material == "E-FKH1" ) return { 2.22025427f, -0.00513496818f, 0.00841587708f, 5.4263553e-05f, 7.61288219e-06f, -4.89857441e-07f };
-		if ( material == "E-FKH2" ) return { 2.10176037f, -0.00475364874f, 0.00656506916f, 0.000110380259f, -6.14897591e-06f, 3.33432784e-07f };
-		if ( material == "E-K3" ) return { 2.2707833f, -0.00772009861f, 0.0126286148f, -4.60005382e-05f, 3.30622876e-05f, -1.37462973e-06f };
-		if ( material == "E-K5" ) return { 2.25937934f, 0.00909050374f, 0.0263394215f, -0.00377741843f, 0.000522870195f, -2.62918185e-05f };
-		if ( material == "E-KF6" ) return { 2.24955402f, 0.00226224485f, 0.0221746519f, -0.00228248782f, 0.000344437297f, -1.73774146e-05f };
-		if ( material == "E-LAF010" ) return { 2.96201742f, -0.00690787335f, 0.0295340678f, -0.00139338248f, 0.000252317172f, -1.245434e-05f };
-		if ( material == "E-LAF016" ) return { 3.14158865f, -0.0147653343f, 0.0334231042f, 0.00125430167f, -3.49277287e-05f, 8.7589435e-06f };
-		if ( material == "E-LAF01" ) return { 2.82762091f, -0.0112227553f, 0.0213169098f, 0.000559325355f, -1.3357138e-05f, 1.86385587e-06f };
-		if ( material == "E-LAF02" ) return { 2.88761613f, -0.0113224055f, 0.0234620658f, 0.000879155778f, -3.93727241e-05f, 4.43531743e-06f };
-		if ( material == "E-LAF04" ) return { 3.01654365f, -0.0142462083f, 0.0251223164f, 0.000195992997f, 4.35063641e-05f, -7.85606637e-07f };
-		if ( material == "E-LAF05" ) return { 3.02046444f, -0.0121632364f, 0.028023846f, 0.000861441681f, -1.40486471e-05f, 4.5613035e-06f };
-		if ( material == "E-LAF09" ) return { 2.82115249f, -0.0128420041f, 0.0195742767f, 0.000851971209f, -3.82046776e-05f, 2.42425127e-06f };
-		if ( material == "E-LAF11" ) return { 2.98504551f, -0.012861773f, 0.0312839577f, 0.00217089493f, -0.000162580251f, 1.82003929e-05f };
-		if ( material == "E-LAF2" ) return { 2.9684827f, -0.0116032701f, 0.0244833672f, 0.000775976856f, -2.44342622e-05f, 3.01832049e-06f };
-		if ( material == "E-LAF3" ) return { 2.88218387f, -0.0106317724f, 0.0227527853f, 0.000397667212f, 1.25478223e-05f, 5.87511175e-07f };
-		if ( material == "E-LAF7" ) return { 2.96631279f, -0.0109274208f, 0.0314277188f, 0.000703288732f, 4.43317688e-05f, 2.65190331e-06f };
-		if ( material == "E-LAF9" ) return { 3.100922f, -0.01374983f, 0.03780926f, 0.002077998f, -9.162097e-05f, 1.798297e-05f };
-		if ( material == "E-LAFH2" ) return { 3.1493362f, -0.0148382096f, 0.0335324542f, 0.00159644183f, -7.06244061e-05f, 1.15814159e-05f };
-		if ( material == "E-LAK011" ) return { 2.97199342f, -0.0152435249f, 0.0202061158f, 0.000875252167f, -7.67180744e-05f, 4.84807195e-06f };
-		if ( material == "E-LAK01" ) return { 2.64816555f, -0.0139955727f, 0.0152775593f, 0.000227366594f, 4.86219531e-06f, -2.33276501e-07f };
-		if ( material == "E-LAK02" ) return { 2.74241958f, -0.0130203862f, 0.0159689321f, 0.000709178831f, -6.08192466e-05f, 3.51166538e-06f };
-		if ( material == "E-LAK04" ) return { 2.6768086f, -0.0102173269f, 0.0177389501f, 2.82247162e-05f, 4.32740016e-05f, -2.15847266e-06f };
-		if ( material == "E-LAK06" ) return { 2.77078533f, -0.0176502071f, 0.011803041f, 0.0027975002f, -0.000346617455f, 2.01612172e-05f };
-		if ( material == "E-LAK09" ) return { 2.95310231f, -0.0196724731f, 0.0174257922f, 0.00152866545f, -0.000137028672f, 6.72353302e-06f };
-		if ( material == "E-LAK10" ) return { 2.89528358f, -0.0117686807f, 0.0222295765f, 0.000269351264f, 2.23005932e-05f, -4.3546434e-07f };
-		if ( material == "E-LAK12" ) return { 2.78094755f, -0.0236624998f, 0.00867653717f, 0.00294181002f, -0.000351554137f, 1.84406503e-05f };
-		if ( material == "E-LAK13" ) return { 2.81365515f, -0.0134879998f, 0.0191920754f, 0.000414986834f, -7.45390097e-06f, 7.65453719e-07f };
-		if ( material == "E-LAK14" ) return { 2.8276674f, -0.0146359226f, 0.0183760559f, 0.000420548979f, -1.31827801e-05f, 9.74806017e-07f };
-		if ( material == "E-LAK18" ) return { 2.93385862f, -0.0150347642f, 0.0198579837f, 0.000500310675f, -2.05752531e-05f, 1.37499776e-06f };
-		if ( material == "LAK18" ) return { 2.93385862f, -0.0150347642f, 0.0198579837f, 0.000500310675f, -2.05752531e-05f, 1.37499776e-06f }; // ??
-		if ( material == "E-LAK7" ) return { 2.68241693f, -0.0118445415f, 0.016242269f, 0.000303298585f, -8.32486246e-06f, 7.74390846e-07f };
-		if ( material == "E-LAK8" ) return { 2.87864541f, -0.0142314931f, 0.0198025768f, 0.00040117957f, -6.68878586e-06f, 7.86869747e-07f };
-		if ( material == "E-LAK9" ) return { 2.78211953f, 0.00386988792f, 0.0322993842f, -0.00317915886f, 0.000435836848f, -2.06224134e-05f };
-		if ( material == "E-LASF010" ) return { 3.26060903f, -0.0148581563f, 0.0340319193f, 0.00114204288f, -1.89155362e-05f, 5.34279856e-06f };
-		if ( material == "E-LASF013" ) return { 3.16454973f, -0.0146684282f, 0.030386787f, 0.00102933823f, -2.54435589e-05f, 4.67271608e-06f };
-		if ( material == "E-LASF014" ) return { 3.12215038f, -0.0147958367f, 0.0260452483f, 0.000507811768f, 5.71446833e-06f, 8.82357872e-07f };
-		if ( material == "E-LASF015" ) return { 3.17656194f, -0.0153426611f, 0.0268472584f, 0.00064503193f, -5.1739717e-06f, 1.3910812e-06f };
-		if ( material == "E-LASF016" ) return { 3.07241378f, -0.0146849804f, 0.0244285857f, 0.000398183255f, 1.22802438e-05f, 1.23709929e-07f };
-		if ( material == "E-LASF017" ) return { 3.14429212f, -0.0156560059f, 0.026364495f, 0.000879416097f, -3.51678468e-05f, 3.33709709e-06f };
-		if ( material == "E-LASF01" ) return { 3.10625626f, -0.0130242032f, 0.0300056853f, -0.000279459588f, 0.000147953845f, -6.92451309e-06f };
-		if ( material == "E-LASF02" ) return { 3.15611691f, -0.0172799726f, 0.0273336859f, 0.00119991815f, -6.25674387e-05f, 5.65571879e-06f };
-		if ( material == "E-LASF03" ) return { 3.19737166f, -0.032023626f, 0.0167812195f, 0.00429709196f, -0.000439299261f, 2.40669567e-05f };
-		if ( material == "E-LASF04" ) return { 3.20360786f, -0.00877554777f, 0.0332446054f, -0.000432887979f, 0.000134715955f, -4.716471e-06f };
-		if ( material == "E-LASF05" ) return { 3.27555498f, -0.0149587295f, 0.0310927229f, 0.000682586922f, 9.41310743e-06f, 1.5045853e-06f };
-		if ( material == "E-LASF08" ) return { 3.44097798f, -0.0140195736f, 0.0351597803f, 0.000893152796f, 2.96132309e-06f, 1.83226713e-06f };
-		if ( material == "E-LASF09" ) return { 3.21588388f, -0.0133880786f, 0.0285023144f, 0.000406364414f, 2.70180277e-05f, -4.64955706e-07f };
-		if ( material == "E-LASFH2" ) return { 3.04964021f, -0.0143753567f, 0.0247919447f, 0.000638849518f, -1.05068423e-05f, 1.83387657e-06f };
-		if ( material == "E-LASFH9" ) return { 3.49989132f, -0.014925507f, 0.0384731987f, 0.00184372906f, -9.49882953e-05f, 1.04373643e-05f };
-		if ( material == "E-LASKH2" ) return { 3.01740929f, -0.0150192115f, 0.0220799937f, 0.000476675587f, -9.36464002e-06f, 9.63541852e-07f };
-		if ( material == "E-LF5" ) return { 2.44577168f, -0.0100665627f, 0.0184371468f, 0.000644165105f, -1.74180822e-05f, 3.77641526e-06f };
-		if ( material == "E-LF6" ) return { 2.4026161f, -0.00531026402f, 0.0170623068f, 0.000992586995f, -0.000110715814f, 9.21295404e-06f };
-		if ( material == "E-LF7" ) return { 2.42793483f, -0.0101841542f, 0.01737719f, 0.000782340309f, -4.23035005e-05f, 5.02350788e-06f };
-		if ( material == "E-LLF1" ) return { 2.35111949f, -0.00904795254f, 0.0155546832f, 0.000449505996f, -1.02073128e-05f, 2.3449403e-06f };
-		if ( material == "E-LLF2" ) return { 2.31105643f, 0.00359211226f, 0.0263534925f, -0.0028618174f, 0.000442961085f, -2.22792621e-05f };
-		if ( material == "E-LLF6" ) return { 2.30466f, -0.00864131348f, 0.0145944618f, 0.000206597874f, 1.88931616e-05f, 1.82626789e-07f };
-		if ( material == "E-PKH1" ) return { 2.27969929f, -0.00967939699f, 0.00983301659f, 0.000165890669f, -3.86343967e-06f, 1.39369901e-07f };
-		if ( material == "E-PSK02" ) return { 2.57651436f, -0.00817396399f, 0.0152706397f, -0.000117385023f, 4.69952008e-05f, -2.25968944e-06f };
-		if ( material == "E-PSK03" ) return { 2.53132391f, -0.00865579054f, 0.0142829487f, -0.000115110582f, 4.15511576e-05f, -1.9869836e-06f };
-		if ( material == "E-SF03" ) return { 3.25492893f, -0.0156026034f, 0.0458228209f, 0.0037273634f, -0.000238976694f, 3.42745142e-05f };
-		if ( material == "E-SF10" ) return { 2.87968193f, -0.0123038115f, 0.033443025f, 0.00183471163f, -8.12508073e-05f, 1.59440837e-05f };
-		if ( material == "E-SF11" ) return { 3.05654935f, -0.0143159709f, 0.0381593027f, 0.00315675913f, -0.000223523385f, 2.90021069e-05f };
-		if ( material == "E-SF13" ) return { 2.92006212f, -0.0134436038f, 0.0333556844f, 0.00246092959f, -0.000160492168f, 2.11511846e-05f };
-		if ( material == "E-SF14" ) return { 2.98384614f, -0.0128995609f, 0.035639664f, 0.00296907641f, -0.00022269905f, 2.67423649e-05f };
-		if ( material == "E-SF15" ) return { 2.7903158f, -0.0118464509f, 0.0305751341f, 0.00141030608f, -4.15895631e-05f, 1.14740935e-05f };
-		if ( material == "E-SF1" ) return { 2.84827856f, -0.0122548479f, 0.0316736954f, 0.00170745362f, -7.33008941e-05f, 1.41012815e-05f };
-		if ( material == "E-SF2" ) return { 2.63429594f, -0.00920840209f, 0.0274266023f, 0.000225441472f, 9.97644221e-05f, 1.76259116e-08f };
-		if ( material == "E-SF4" ) return { 2.96469762f, -0.0128650713f, 0.0357299793f, 0.00216572877f, -0.000102243404f, 1.82439835e-05f };
-		if ( material == "E-SF5" ) return { 2.71201742f, -0.0111228641f, 0.0276913413f, 0.00113193687f, -2.4225064e-05f, 8.91515336e-06f };
-		if ( material == "E-SF6" ) return { 3.117837f, -0.0119410737f, 0.0443602265f, 0.00181348056f, 4.69669929e-06f, 1.61754136e-05f };
-		if ( material == "E-SF7" ) return { 2.60224509f, -0.00228272809f, 0.0313239043f, -0.00110981516f, 0.00028447243f, -1.2054467e-05f };
-		if ( material == "E-SF8" ) return { 2.76155381f, -0.0116348386f, 0.0286355735f, 0.00155293137f, -7.94510589e-05f, 1.28609539e-05f };
-		if ( material == "E-SFS3" ) return { 3.05701152f, -0.0132251945f, 0.0390853018f, 0.0025148016f, -0.000131876542f, 2.24898958e-05f };
-		if ( material == "E-SK10" ) return { 2.58912326f, -0.0100115186f, 0.0156165805f, 0.000328758605f, -9.84858579e-06f, 7.82877169e-07f };
-		if ( material == "E-SK11" ) return { 2.41034365f, -0.0101286559f, 0.0126748412f, 0.000257347078f, -6.24279133e-06f, 3.35932224e-07f };
-		if ( material == "E-SK12" ) return { 2.46638796f, -0.00865760981f, 0.0144628215f, 7.9427451e-05f, 1.55773822e-05f, -5.24586883e-07f };
-		if ( material == "E-SK14" ) return { 2.53104523f, -0.0107742896f, 0.0140100006f, 0.000247886041f, -1.0881644e-06f, 1.03415548e-07f };
-		if ( material == "E-SK15" ) return { 2.59512882f, -0.0133017463f, 0.0129505299f, 0.000946976976f, -9.28161846e-05f, 5.07474225e-06f };
-		if ( material == "E-SK16" ) return { 2.58572188f, -0.0114561541f, 0.0140913669f, 0.000439966701f, -2.67679001e-05f, 1.51331053e-06f };
-		if ( material == "E-SK18" ) return { 2.65253732f, -0.0207076891f, 0.00823565189f, 0.00259890034f, -0.00030272324f, 1.591967e-05f };
-		if ( material == "E-SK2" ) return { 2.5423297f, -0.0100137205f, 0.0136627069f, 0.000828586571f, -8.59026849e-05f, 5.07949629e-06f };
-		if ( material == "E-SK4" ) return { 2.55935739f, -0.0101666557f, 0.01458787f, 0.00036544107f, -1.59151229e-05f, 9.9861439e-07f };
-		if ( material == "E-SK5" ) return { 2.48616859f, -0.00962090414f, 0.0146866348f, -0.000117877135f, 4.43876615e-05f, -2.05228288e-06f };
-		if ( material == "E-SSK1" ) return { 2.56935287f, -0.0103280973f, 0.0161803173f, 0.000314456596f, -8.91235286e-08f, 6.08967029e-07f };
-		if ( material == "E-SSK5" ) return { 2.69603796f, -0.0100729839f, 0.0188657945f, 0.00036803849f, 4.06084448e-06f, 4.57460676e-07f };
-		if ( material == "E-SSK8" ) return { 2.57047824f, -0.0119686463f, 0.0149712411f, 0.00112845548f, -0.000110413826f, 7.39815032e-06f };
-		if ( material == "F1" ) return { 2.562519f, -0.003146235f, 0.02916002f, -0.00087073f, 0.0002265332f, -8.612399e-06f };
-		if ( material == "F2" ) return { 2.545002f, -0.001337396f, 0.02801151f, -0.0005417021f, 0.0001501754f, -3.617071e-06f };
-		if ( material == "F3" ) return { 2.522283f, -0.00104823f, 0.02939577f, -0.00139163f, 0.0002896805f, -1.265089e-05f };
-		if ( material == "F5" ) return { 2.527725f, -0.02381908f, 0.01020504f, 0.003480576f, -0.0003603615f, 2.057311e-05f };
-		if ( material == "F8" ) return { 2.472865f, -0.001511927f, 0.02760046f, -0.001525504f, 0.0002907115f, -1.284843e-05f };
-		if ( material == "K3" ) return { 2.27187f, -0.008333884f, 0.0119425f, 0.0001494434f, 8.303797e-06f, -2.694974e-07f };
-		if ( material == "K5" ) return { 2.259379f, 0.009090504f, 0.02633942f, -0.003777418f, 0.0005228702f, -2.629182e-05f };
-		if ( material == "KF6" ) return { 2.249554f, 0.002262245f, 0.02217465f, -0.002282488f, 0.0003444373f, -1.737741e-05f };
-		if ( material == "KZFH1" ) return { 2.547175f, -0.01287115f, 0.01838384f, 0.0005862006f, -1.624561e-05f, 2.266107e-06f };
-		if ( material == "KZFH2" ) return { 2.723491f, -0.01309285f, 0.02374514f, 0.0007951295f, -1.290725e-05f, 3.339887e-06f };
-		if ( material == "KZFS4" ) return { 2.554362f, -0.0165228f, 0.01560256f, 0.001407955f, -0.0001318867f, 8.507447e-06f };
-		if ( material == "LAF09" ) return { 2.821152f, -0.012842f, 0.01957428f, 0.0008519712f, -3.820468e-05f, 2.424251e-06f };
-		if ( material == "LAF11" ) return { 2.809631f, 0.1142767f, 0.1251064f, -0.0221709f, 0.002916176f, -0.0001356855f };
-		if ( material == "LAF2" ) return { 2.966463f, -0.01184749f, 0.02659597f, 7.166823e-05f, 6.759269e-05f, -1.704166e-06f };
-		if ( material == "LAF3" ) return { 2.830874f, 0.02556412f, 0.05044859f, -0.00670398f, 0.0008789224f, -4.052452e-05f };
-		if ( material == "LAF7" ) return { 2.871638f, 0.05586319f, 0.08260113f, -0.01257133f, 0.00171414f, -7.977217e-05f };
-		if ( material == "LAF9" ) return { 3.097921f, -0.01112466f, 0.0388245f, 0.001949184f, -6.840198e-05f, 1.330305e-05f };
-		if ( material == "LAK011" ) return { 2.971993f, -0.01524352f, 0.02020612f, 0.0008752522f, -7.671807e-05f, 4.848072e-06f };
-		if ( material == "LAK04" ) return { 2.676809f, -0.01021733f, 0.01773895f, 2.822472e-05f, 4.3274e-05f, -2.158473e-06f };
-		if ( material == "LAK09" ) return { 2.953102f, -0.01967247f, 0.01742579f, 0.001528665f, -0.0001370287f, 6.723533e-06f };
-		if ( material == "LAK12" ) return { 2.780948f, -0.0236625f, 0.008676537f, 0.00294181f, -0.0003515541f, 1.844065e-05f };
-		if ( material == "LAK7" ) return { 2.684146f, -0.01282175f, 0.01520999f, 0.0005791021f, -4.197895e-05f, 2.32621e-06f };
-		if ( material == "LAK9" ) return { 2.78212f, 0.003869888f, 0.03229938f, -0.003179159f, 0.0004358368f, -2.062241e-05f };
-		if ( material == "LASF010" ) return { 3.162451f, 0.04629811f, 0.09621568f, -0.01807107f, 0.002856517f, -0.0001616506f };
-		if ( material == "LASF01" ) return { 3.106256f, -0.0130242f, 0.03000569f, -0.0002794596f, 0.0001479538f, -6.924513e-06f };
-		if ( material == "LASF02" ) return { 3.156117f, -0.01727997f, 0.02733369f, 0.001199918f, -6.256744e-05f, 5.655719e-06f };
-		if ( material == "LASFH6" ) return { 3.167451f, -0.02220547f, 0.02630248f, 0.004028856f, -0.0004018775f, 2.821967e-05f };
-		if ( material == "LF5" ) return { 2.439252f, -0.005116676f, 0.02191912f, -0.000308089f, 0.0001181173f, -4.409047e-06f };
-		if ( material == "LF6" ) return { 2.402616f, -0.005310264f, 0.01706231f, 0.000992587f, -0.0001107158f, 9.212954e-06f };
-		if ( material == "LF7" ) return { 2.440824f, -0.02002119f, 0.01089699f, 0.002343396f, -0.0002198222f, 1.221823e-05f };
-		if ( material == "LLF1" ) return { 2.362448f, -0.01634943f, 0.008894781f, 0.002311903f, -0.000257494f, 1.457859e-05f };
-		if ( material == "LLF2" ) return { 2.311056f, 0.003592112f, 0.02635349f, -0.002861817f, 0.0004429611f, -2.227926e-05f };
-		if ( material == "LLF6" ) return { 2.326858f, -0.02496168f, 0.002979231f, 0.003164392f, -0.0003498773f, 1.777229e-05f };
-		if ( material == "P-FK01S" ) return { 2.2209843f, -0.00850617932f, 0.00565991749f, 0.000843578948f, -9.83647071e-05f, 4.93916644e-06f };
-		if ( material == "P-FKH2S" ) return { 2.10062741f, -0.0047428655f, 0.00658636025f, 0.00010373696f, -5.35155073e-06f, 2.98151037e-07f };
-		if ( material == "PK1" ) return { 2.23377f, -0.009387074f, 0.01057538f, -3.481847e-05f, 2.380097e-05f, -1.340308e-06f };
-		if ( material == "PK2" ) return { 2.268721f, -0.005772466f, 0.01533408f, -0.001159258f, 0.0001697392f, -8.270431e-06f };
-		if ( material == "SF03" ) return { 3.261335f, -0.01832792f, 0.0415517f, 0.00494909f, -0.0003884548f, 3.837014e-05f };
-		if ( material == "SF10" ) return { 2.842085f, 0.01641576f, 0.05206046f, -0.002610463f, 0.000446977f, -9.429829e-06f };
-		if ( material == "SF11" ) return { 3.127487f, -0.0637466f, -0.0009890957f, 0.01363913f, -0.001588824f, 9.646333e-05f };
-		if ( material == "SF12" ) return { 2.620359f, 0.002381459f, 0.03560544f, -0.001773085f, 0.0003452771f, -1.282207e-05f };
-		if ( material == "SF13" ) return { 2.92263f, -0.01150018f, 0.02875835f, 0.004472855f, -0.0004973006f, 4.089372e-05f };
-		if ( material == "SF14" ) return { 2.983846f, -0.01289956f, 0.03563966f, 0.002969076f, -0.000222699f, 2.674236e-05f };
-		if ( material == "SF15" ) return { 2.787118f, -0.006950628f, 0.03016016f, 0.00207609f, -0.0001855962f, 2.047325e-05f };
-		if ( material == "SF1" ) return { 2.839803f, -0.004469128f, 0.03464028f, 0.001334322f, -5.451762e-05f, 1.214724e-05f };
-		if ( material == "SF2" ) return { 2.612482f, 0.007294838f, 0.03844929f, -0.002459877f, 0.0004247475f, -1.668865e-05f };
-		if ( material == "SF4" ) return { 2.988119f, -0.03043514f, 0.0237723f, 0.005097428f, -0.0004379463f, 3.025835e-05f };
-		if ( material == "SF5" ) return { 2.735991f, -0.0272415f, 0.01394696f, 0.004883728f, -0.0004997414f, 2.996089e-05f };
-		if ( material == "SF6" ) return { 3.080799f, 0.01530035f, 0.06350134f, -0.002963535f, 0.0006026374f, -1.590891e-05f };
-		if ( material == "SF7" ) return { 2.602245f, -0.002282728f, 0.0313239f, -0.001109815f, 0.0002844724f, -1.205447e-05f };
-		if ( material == "SF8" ) return { 2.798858f, -0.03718093f, 0.007630191f, 0.007231691f, -0.0008073847f, 4.696667e-05f };
-		if ( material == "SF9" ) return { 2.661342f, -0.01187903f, 0.02328061f, 0.001777729f, -0.0001298549f, 1.138748e-05f };
-		if ( material == "SFS3" ) return { 3.071402f, -0.02168875f, 0.02943887f, 0.005498532f, -0.0005380916f, 4.131754e-05f };
-		if ( material == "SK15" ) return { 2.595129f, -0.01330175f, 0.01295053f, 0.000946977f, -9.281618e-05f, 5.074742e-06f };
-		if ( material == "SK16" ) return { 2.592001f, -0.01540969f, 0.0102268f, 0.001581559f, -0.0001877149f, 1.012515e-05f };
-		if ( material == "SK18" ) return { 2.652537f, -0.02070769f, 0.008235652f, 0.0025989f, -0.0003027232f, 1.591967e-05f };
-		if ( material == "SK2" ) return { 2.54233f, -0.01001372f, 0.01366271f, 0.0008285866f, -8.590268e-05f, 5.079496e-06f };
-		if ( material == "SK4" ) return { 2.542124f, 0.002965422f, 0.02316274f, -0.001681083f, 0.0002235719f, -1.000551e-05f };
-		if ( material == "SK9" ) return { 2.564248f, -0.01337038f, 0.01398205f, 0.0007030773f, -4.206054e-05f, 2.098576e-06f };
-		if ( material == "SSK1" ) return { 2.577488f, -0.01546625f, 0.01135863f, 0.001651928f, -0.0001733264f, 9.058966e-06f };
-		if ( material == "SSK2" ) return { 2.591243f, -0.01427206f, 0.01239656f, 0.00153774f, -0.0001592745f, 8.552111e-06f };
-		if ( material == "SSK8" ) return { 2.570478f, -0.01196865f, 0.01497124f, 0.001128455f, -0.0001104138f, 7.39815e-06f };
-		if ( material == "BAC4" ) return { 2.4196645f, -0.0083329314f, 0.01539739f, -0.00017391654f, 6.218322e-05f, -3.062131e-06f };
-		if ( material == "BACD11" ) return { 2.4095163f, -0.0091904415f, 0.012939968f, 0.0002346143f, -1.1130589e-05f, 1.0131863e-06f };
-		if ( material == "BACD14" ) return { 2.5335256f, -0.011903338f, 0.012257249f, 0.00079172149f, -7.7381829e-05f, 3.9935441e-06f };
-		if ( material == "BACD15" ) return { 2.5864832f, -0.0080357829f, 0.018080573f, -0.00045974172f, 8.8484321e-05f, -3.7544765e-06f };
-		if ( material == "BACD16" ) return { 2.5859898f, -0.011940432f, 0.013995502f, 0.00048974502f, -3.9120717e-05f, 2.2611915e-06f };
-		if ( material == "BACD18" ) return { 2.6365277f, -0.0097558464f, 0.017143665f, 0.00022592497f, 3.0855342e-06f, 4.5831917e-07f };
-		if ( material == "BACD2" ) return { 2.5393255f, -0.0087207883f, 0.015909566f, 8.8163036e-05f, 2.5876593e-05f, -1.1733523e-06f };
-		if ( material == "BACD4" ) return { 2.5584621f, -0.0097457283f, 0.015110495f, 0.00023273333f, 1.1137249e-06f, 1.6424767e-07f };
-		if ( material == "BACD5" ) return { 2.4861499f, -0.0095684845f, 0.014685059f, -0.00011216487f, 4.1978777e-05f, -1.885619e-06f };
-		if ( material == "BACED5" ) return { 2.6934245f, -0.008637014f, 0.02049645f, -9.3205453e-05f, 6.2709747e-05f, -2.0834652e-06f };
-		if ( material == "BAF10" ) return { 2.7324621f, -0.01249046f, 0.018562334f, 0.00099990536f, -6.8388552e-05f, 4.9257931e-06f };
-		if ( material == "BAF11" ) return { 2.7272955f, -0.013470236f, 0.014809271f, 0.0019615335f, -0.00019787663f, 1.0851117e-05f };
-		if ( material == "BAFD7" ) return { 2.8217211f, -0.0097265483f, 0.024345979f, 0.00078406305f, -2.2431497e-05f, 4.6726029e-06f };
-		if ( material == "BAFD8" ) return { 2.8863236f, -0.009802724f, 0.027654256f, 0.00089006367f, -3.6309109e-05f, 7.6181062e-06f };
-		if ( material == "BSC7" ) return { 2.2702566f, -0.0091988101f, 0.011609706f, -7.6123911e-05f, 2.8558727e-05f, -1.2566486e-06f };
-		if ( material == "E-ADF10" ) return { 2.5528983f, -0.015709364f, 0.015647688f, 0.0014461641f, -0.00014458879f, 9.5275733e-06f };
-		if ( material == "E-ADF50" ) return { 2.6680422f, -0.013184258f, 0.023930479f, 0.00023928655f, 5.0697941e-05f, 9.1240958e-07f };
-		if ( material == "E-BACD10" ) return { 2.5906326f, -0.010608994f, 0.014490916f, 0.00067542247f, -5.5303116e-05f, 3.0061364e-06f };
-		if ( material == "E-BACED20" ) return { 2.6667537f, -0.0097319259f, 0.017436284f, 0.00047558015f, -1.7144989e-05f, 1.1049589e-06f };
-		if ( material == "E-BAF8" ) return { 2.5801121f, -0.0079717945f, 0.019728054f, 0.00013876076f, 3.7632071e-05f, -7.4634717e-07f };
-		if ( material == "E-C3" ) return { 2.2725452f, -0.008410491f, 0.011306843f, 0.00037782297f, -2.6903423e-05f, 1.5976489e-06f };
-		if ( material == "E-CF6" ) return { 2.2668912f, -0.0093866212f, 0.012174195f, 0.0005076903f, -3.3573414e-05f, 2.9059013e-06f };
-		if ( material == "E-F1" ) return { 2.5730565f, -0.010203605f, 0.023095784f, 0.00087114252f, -3.0730079e-05f, 6.9457986e-06f };
-		if ( material == "E-F2" ) return { 2.5561822f, -0.010237038f, 0.022470348f, 0.00084580679f, -3.3087089e-05f, 7.1054919e-06f };
-		if ( material == "E-F3" ) return { 2.5362697f, -0.010610424f, 0.021233821f, 0.00099012105f, -5.9984348e-05f, 8.2354366e-06f };
-		if ( material == "E-F5" ) return { 2.5095673f, -0.010862661f, 0.019894774f, 0.0010137134f, -6.2697117e-05f, 7.5080045e-06f };
-		if ( material == "E-F8" ) return { 2.4866561f, -0.010188484f, 0.019287417f, 0.00088553737f, -5.0937106e-05f, 6.4256956e-06f };
-		if ( material == "E-FD10" ) return { 2.881518f, -0.013228312f, 0.03145559f, 0.0026851666f, -0.00022577544f, 2.4693268e-05f };
-		if ( material == "E-FD13" ) return { 2.9205906f, -0.013681618f, 0.03256776f, 0.0028725519f, -0.00024277107f, 2.6614514e-05f };
-		if ( material == "E-FD15" ) return { 2.7919943f, -0.012311206f, 0.028802741f, 0.0021430059f, -0.00016932119f, 1.9741766e-05f };
-		if ( material == "E-FD1" ) return { 2.8508499f, -0.01323461f, 0.029415325f, 0.0025542666f, -0.00021232133f, 2.2261936e-05f };
-		if ( material == "E-FD2" ) return { 2.6399644f, -0.011645718f, 0.023061733f, 0.0017348219f, -0.00013986059f, 1.391667e-05f };
-		if ( material == "E-FD4" ) return { 2.9673173f, -0.013989565f, 0.03345668f, 0.0030717804f, -0.00026682435f, 2.8950241e-05f };
-		if ( material == "E-FD5" ) return { 2.7135839f, -0.011419719f, 0.026133708f, 0.0017576479f, -0.00013307737f, 1.5203351e-05f };
-		if ( material == "E-FD7" ) return { 2.6165865f, -0.011427854f, 0.022534361f, 0.001551289f, -0.00011769852f, 1.2401891e-05f };
-		if ( material == "E-FD8" ) return { 2.7617586f, -0.011254039f, 0.028221737f, 0.0017540315f, -0.00012127053f, 1.5522384e-05f };
-		if ( material == "E-FDS1-W" ) return { 3.5044639f, -0.020333833f, 0.0538027f, 0.0062874192f, -0.00056922176f, 7.3559387e-05f };
-		if ( material == "E-FDS1" ) return { 3.5044639f, -0.020333833f, 0.0538027f, 0.0062874192f, -0.00056922176f, 7.3559387e-05f };
-		if ( material == "E-FDS2" ) return { 3.7672603f, -0.017001227f, 0.069849634f, 0.0063862892f, -0.00050812539f, 8.4455529e-05f };
-		if ( material == "E-FDS3" ) return { 4.1120387f, -0.01822767f, 0.089852105f, 0.00787144f, -0.00052228008f, 0.00011773061f };
-		if ( material == "E-FEL1" ) return { 2.3534484f, -0.010330438f, 0.014097325f, 0.00087167875f, -6.998197e-05f, 5.7867359e-06f };
-		if ( material == "E-FEL2" ) return { 2.3317983f, -0.0097042192f, 0.014032761f, 0.00064822896f, -4.0813761e-05f, 3.9064873e-06f };
-		if ( material == "E-FEL6" ) return { 2.3068946f, -0.0096888755f, 0.01309702f, 0.00065013927f, -4.2328222e-05f, 3.5888777e-06f };
-		if ( material == "E-FL5" ) return { 2.4465754f, -0.010107041f, 0.017759132f, 0.00087970259f, -5.7014929e-05f, 6.0924663e-06f };
-		if ( material == "E-FL6" ) return { 2.4079653f, -0.011135638f, 0.015704715f, 0.00099186507f, -7.9934653e-05f, 7.0985473e-06f };
-		if ( material == "E-LAF7" ) return { 2.9704178f, -0.013290679f, 0.028359006f, 0.0017661786f, -0.00012453482f, 1.3951937e-05f };
-		if ( material == "FC5" ) return { 2.1894054f, -0.0099044908f, 0.008640337f, 0.00022263067f, -1.2291942e-05f, 5.9386349e-07f };
-		if ( material == "FCD100" ) return { 2.0482157f, -0.0043211222f, 0.0061826755f, 3.141148e-05f, 3.5370793e-06f, -1.6694497e-07f };
-		if ( material == "FCD10A" ) return { 2.1085888f, -0.0046553722f, 0.006954748f, 3.2184141e-05f, 5.2670946e-06f, -2.7164844e-07f };
-		if ( material == "FCD10" ) return { 2.103249f, -0.0050247988f, 0.0065323077f, 0.00013078405f, -6.3652072e-06f, 1.9254745e-07f };
-		if ( material == "FCD1B" ) return { 2.2189068f, -0.0061707065f, 0.0080887631f, 0.00013357782f, 1.9476186e-07f, -2.2577804e-07f };
-		if ( material == "FCD1" ) return { 2.2181132f, -0.005799427f, 0.0083470679f, 6.5046523e-05f, 8.5142186e-06f, -5.8852269e-07f };
-		if ( material == "FCD505" ) return { 2.502355f, -0.0072080042f, 0.012012743f, 0.00034920842f, -2.4729676e-05f, 1.3801567e-06f };
-		if ( material == "FCD515" ) return { 2.502355f, -0.0072080042f, 0.012012743f, 0.00034920842f, -2.4729676e-05f, 1.3801567e-06f };
-		if ( material == "FCD705" ) return { 2.3742832f, -0.0062014418f, 0.010582967f, 6.3100703e-05f, 8.196715e-06f, -3.4424446e-07f };
-		if ( material == "FD110" ) return { 3.0534415f, -0.01275181f, 0.040609369f, 0.0022706109f, -7.8086606e-05f, 1.9874026e-05f };
-		if ( material == "FD140" ) return { 2.9851294f, -0.014237988f, 0.035496437f, 0.0028457557f, -0.00019006799f, 2.4309252e-05f };
-		if ( material == "FD225" ) return { 3.1189869f, -0.015820772f, 0.044425024f, 0.0035834882f, -0.00023943449f, 3.8756542e-05f };
-		if ( material == "FD60-W" ) return { 3.1171483f, -0.011616277f, 0.044864975f, 0.0016588491f, 2.5716854e-05f, 1.4757657e-05f };
-		if ( material == "FD60" ) return { 3.1171483f, -0.011616277f, 0.044864975f, 0.0016588491f, 2.5716854e-05f, 1.4757657e-05f };
-		if ( material == "FDS16-W" ) return { 3.6906098f, -0.027849024f, 0.063139051f, 0.012443698f, -0.0014774085f, 0.00017478701f };
-		if ( material == "FDS18-W" ) return { 3.563784f, -0.025449644f, 0.058401659f, 0.0092310983f, -0.00095499727f, 0.00011777456f };
-		if ( material == "FDS18" ) return { 3.563784f, -0.025449644f, 0.058401659f, 0.0092310983f, -0.00095499727f, 0.00011777456f };
-		if ( material == "FDS24" ) return { 3.5126327f, -0.0153015f, 0.053936061f, 0.0034949369f, -0.00017950295f, 3.4403181e-05f };
-		if ( material == "FDS90(P)" ) return { 3.2565619f, -0.015803965f, 0.044330322f, 0.0043620098f, -0.00036912261f, 4.2999682e-05f };
-		if ( material == "FDS90-SG" ) return { 3.2606321f, -0.017780398f, 0.040902938f, 0.0056076934f, -0.00056434039f, 5.4763391e-05f };
-		if ( material == "FDS90" ) return { 3.2606321f, -0.017780398f, 0.040902938f, 0.0056076934f, -0.00056434039f, 5.4763391e-05f };
-		if ( material == "FF5" ) return { 2.4743324f, -0.010955338f, 0.019293801f, 0.0014497732f, -0.00011038744f, 1.1136008e-05f };
-		if ( material == "FF8" ) return { 2.9564361f, -0.019762195f, 0.029878823f, 0.0051830852f, -0.00054202389f, 4.8463245e-05f };
-		if ( material == "LAC10" ) return { 2.8951998f, -0.011701218f, 0.022126485f, 0.00038494791f, -7.9808302e-06f, 1.5035116e-06f };
-		if ( material == "LAC12" ) return { 2.7634844f, -0.011068339f, 0.018246442f, 0.00037697356f, -1.7788655e-05f, 1.5314262e-06f };
-		if ( material == "LAC13" ) return { 2.8125316f, -0.012915271f, 0.019960339f, 0.00019877888f, 1.7647061e-05f, -4.4767632e-07f };
-		if ( material == "LAC14" ) return { 2.8255229f, -0.013632902f, 0.019791402f, 1.5032564e-05f, 4.0761368e-05f, -1.7527267e-06f };
-		if ( material == "LAC7" ) return { 2.6876223f, -0.014375187f, 0.012545954f, 0.0014642295f, -0.00016982461f, 8.8048639e-06f };
-		if ( material == "LAC8" ) return { 2.8778537f, -0.013832906f, 0.020301185f, 0.00027759871f, 5.905983e-06f, 1.7747647e-07f };
-		if ( material == "LAC9" ) return { 2.8081523f, -0.014167885f, 0.017693707f, 0.00076788759f, -7.4886174e-05f, 4.7044756e-06f };
-		if ( material == "LACL60" ) return { 2.6490884f, -0.014159869f, 0.014451135f, 0.00052707873f, -4.3447523e-05f, 2.4612971e-06f };
-		if ( material == "LAF2" ) return { 2.9657374f, -0.0096571624f, 0.026024525f, 0.00036684641f, 2.8205551e-05f, -1.3739929e-07f };
-		if ( material == "LAF3" ) return { 2.8789799f, -0.008729237f, 0.024425656f, 4.5491773e-05f, 4.2802928e-05f, -7.2834306e-07f };
-		if ( material == "LBC3N" ) return { 2.5388484f, -0.0066855865f, 0.015111456f, -0.00015247241f, 4.8340116e-05f, -2.4061785e-06f };
-		if ( material == "M-BACD12" ) return { 2.468781f, -0.01062639f, 0.01325184f, 0.0004048612f, -2.974799e-05f, 1.825884e-06f };
-		if ( material == "M-BACD15" ) return { 2.590919f, -0.01259476f, 0.01520205f, 0.000299998f, -1.131547e-05f, 9.15464e-07f };
-		if ( material == "M-BACD5N" ) return { 2.48951f, -0.01224496f, 0.01294262f, 0.0003490449f, -1.777228e-05f, 9.113719e-07f };
-		if ( material == "MC-BACD12" ) return { 2.468781f, -0.01062639f, 0.01325184f, 0.0004048612f, -2.974799e-05f, 1.825884e-06f };
-		if ( material == "MC-BACD5N" ) return { 2.48951f, -0.01224496f, 0.01294262f, 0.0003490449f, -1.777228e-05f, 9.113719e-07f };
-		if ( material == "MC-FCD1-M20" ) return { 2.2209418f, -0.0074830372f, 0.0062463392f, 0.00071157759f, -8.2274254e-05f, 4.0430546e-06f };
-		if ( material == "MC-FCD500-20" ) return { 2.3850427f, -0.007914269f, 0.0094886852f, 0.00057980093f, -6.0011677e-05f, 3.0355422e-06f };
-		if ( material == "MC-FDS2" ) return { 3.771581f, -0.020445364f, 0.063942579f, 0.008354547f, -0.00082031984f, 0.00010279507f };
-		if ( material == "MC-FDS910-50" ) return { 3.1667902f, -0.013141416f, 0.047178656f, 0.0022684284f, -5.3672387e-05f, 2.5328422e-05f };
-		if ( material == "MC-LAC130" ) return { 2.813412f, -0.01332448f, 0.01927865f, 0.0004124452f, -9.940432e-06f, 9.622024e-07f };
-		if ( material == "MC-NBF1" ) return { 2.975245f, -0.01425016f, 0.02140074f, 0.0009755337f, -6.97953e-05f, 4.114924e-06f };
-		if ( material == "MC-NBFD135" ) return { 3.1819698f, -0.014926522f, 0.028987649f, 0.0012223654f, -5.2916688e-05f, 4.7807227e-06f };
-		if ( material == "MC-PCD4-40" ) return { 2.5831471f, -0.0097502344f, 0.013615374f, 0.00036346122f, -2.1187082e-05f, 1.1536132e-06f };
-		if ( material == "MC-PCD51-70" ) return { 2.5025436f, -0.010321437f, 0.012433636f, 0.00021866535f, -5.5793977e-06f, 3.0188383e-07f };
-		if ( material == "MC-TAF101-100" ) return { 3.0591566f, -0.013604717f, 0.024624272f, 0.00041834242f, 2.5361908e-06f, 7.998082e-07f };
-		if ( material == "MC-TAF105" ) return { 3.0705638f, -0.013310234f, 0.025280355f, 0.00021829234f, 3.2555293e-05f, -8.1300421e-07f };
-		if ( material == "MC-TAF1" ) return { 3.070806f, -0.012276924f, 0.02456566f, 0.00047436648f, 5.432616e-07f, 6.5976661e-07f };
-		if ( material == "MC-TAF31-15" ) return { 3.164475f, -0.013801295f, 0.027926276f, 0.00057403f, 9.8223773e-07f, 1.3284244e-06f };
-		if ( material == "MC-TAF401" ) return { 3.07279f, -0.01366385f, 0.02527346f, 0.000612182f, -1.147045e-05f, 1.543e-06f };
-		if ( material == "MC-TAFD305" ) return { 3.327184f, -0.01343242f, 0.033398f, 0.001006047f, -2.136908e-05f, 3.972561e-06f };
-		if ( material == "MC-TAFD307" ) return { 3.4286062f, -0.013845333f, 0.037363009f, 0.0011894554f, -1.5979979e-05f, 5.1827398e-06f };
-		if ( material == "MC-TAFD51-50" ) return { 3.2288052f, -0.014433046f, 0.029863488f, 0.00082119282f, -1.0943492e-05f, 2.5804939e-06f };
-		if ( material == "M-FCD1" ) return { 2.2189068f, -0.0061707065f, 0.0080887631f, 0.00013357782f, 1.9476186e-07f, -2.2577804e-07f };
-		if ( material == "M-FCD500" ) return { 2.3841554f, -0.0078084423f, 0.0097130883f, 0.00049959889f, -4.7303224e-05f, 2.3205441e-06f };
-		if ( material == "M-FD80" ) return { 2.761638f, -0.01132633f, 0.02865346f, 0.001529038f, -8.743577e-05f, 1.496579e-05f };
-		if ( material == "M-FDS1" ) return { 3.4984224f, -0.01689542f, 0.057567078f, 0.0051693668f, -0.0003996631f, 6.2368582e-05f };
-		if ( material == "M-FDS2" ) return { 3.771581f, -0.020445364f, 0.063942579f, 0.008354547f, -0.00082031984f, 0.00010279507f };
-		if ( material == "M-FDS910" ) return { 3.165987f, -0.01349196f, 0.04649918f, 0.002471413f, -8.659596e-05f, 2.725927e-05f };
-		if ( material == "M-LAC130" ) return { 2.813412f, -0.01332448f, 0.01927865f, 0.0004124452f, -9.940432e-06f, 9.622024e-07f };
-		if ( material == "M-LAC14" ) return { 2.8278386f, -0.014773939f, 0.018211733f, 0.00049311964f, -2.5486886e-05f, 1.6795487e-06f };
-		if ( material == "M-LAC8" ) return { 2.8817481f, -0.015730804f, 0.017690493f, 0.001052669f, -9.909308e-05f, 5.5248378e-06f };
-		if ( material == "M-LAF81" ) return { 2.9167886f, -0.012398199f, 0.026675237f, 0.00065190504f, 4.6956175e-06f, 2.691054e-06f };
-		if ( material == "M-NBF1" ) return { 2.975245f, -0.01425016f, 0.02140074f, 0.0009755337f, -6.97953e-05f, 4.114924e-06f };
-		if ( material == "M-NBFD10" ) return { 3.264623f, -0.01581977f, 0.03225894f, 0.001709312f, -0.0001081957f, 1.058323e-05f };
-		if ( material == "M-NBFD130" ) return { 3.173794f, -0.01498658f, 0.02906741f, 0.001204829f, -5.355158e-05f, 5.27135e-06f };
-		if ( material == "MP-BACD12" ) return { 2.468781f, -0.01062639f, 0.01325184f, 0.0004048612f, -2.974799e-05f, 1.825884e-06f };
-		if ( material == "MP-BACD15" ) return { 2.590919f, -0.01259476f, 0.01520205f, 0.000299998f, -1.131547e-05f, 9.15464e-07f };
-		if ( material == "MP-BACD5N" ) return { 2.48951f, -0.01224496f, 0.01294262f, 0.0003490449f, -1.777228e-05f, 9.113719e-07f };
-		if ( material == "M-PCD4" ) return { 2.582335f, -0.009952039f, 0.01329184f, 0.0004550621f, -3.327132e-05f, 1.730172e-06f };
-		if ( material == "M-PCD51" ) return { 2.502026f, -0.01108292f, 0.0112772f, 0.0005715408f, -5.587455e-05f, 2.905292e-06f };
-		if ( material == "MP-FCD1-M20" ) return { 2.2209418f, -0.0074830372f, 0.0062463392f, 0.00071157759f, -8.2274254e-05f, 4.0430546e-06f };
-		if ( material == "MP-FCD500-20" ) return { 2.3850427f, -0.007914269f, 0.0094886852f, 0.00057980093f, -6.0011677e-05f, 3.0355422e-06f };
-		if ( material == "MP-FD80" ) return { 2.761638f, -0.01132633f, 0.02865346f, 0.001529038f, -8.743577e-05f, 1.496579e-05f };
-		if ( material == "MP-FDS1" ) return { 3.4984224f, -0.01689542f, 0.057567078f, 0.0051693668f, -0.0003996631f, 6.2368582e-05f };
-		if ( material == "MP-FDS2" ) return { 3.771581f, -0.020445364f, 0.063942579f, 0.008354547f, -0.00082031984f, 0.00010279507f };
-		if ( material == "MP-FDS910-50" ) return { 3.1667902f, -0.013141416f, 0.047178656f, 0.0022684284f, -5.3672387e-05f, 2.5328422e-05f };
-		if ( material == "MP-LAC130" ) return { 2.813412f, -0.01332448f, 0.01927865f, 0.0004124452f, -9.940432e-06f, 9.622024e-07f };
-		if ( material == "MP-LAC14-80" ) return { 2.8306733f, -0.014855863f, 0.018103472f, 0.00053539971f, -3.1929778e-05f, 2.0340983e-06f };
-		if ( material == "MP-LAC8-30" ) return { 2.8827498f, -0.015740789f, 0.017707976f, 0.0010483265f, -9.8332811e-05f, 5.4828685e-06f };
-		if ( material == "MP-LAF81" ) return { 2.9167886f, -0.012398199f, 0.026675237f, 0.00065190504f, 4.6956175e-06f, 2.691054e-06f };
-		if ( material == "MP-NBF1" ) return { 2.975245f, -0.01425016f, 0.02140074f, 0.0009755337f, -6.97953e-05f, 4.114924e-06f };
-		if ( material == "MP-NBFD10-20" ) return { 3.2722586f, -0.018817211f, 0.027264508f, 0.0032789193f, -0.00032827672f, 2.1743362e-05f };
-		if ( material == "MP-NBFD130" ) return { 3.173794f, -0.01498658f, 0.02906741f, 0.001204829f, -5.355158e-05f, 5.27135e-06f };
-		if ( material == "MP-PCD4-40" ) return { 2.5831471f, -0.0097502344f, 0.013615374f, 0.00036346122f, -2.1187082e-05f, 1.1536132e-06f };
-		if ( material == "MP-PCD51-70" ) return { 2.5025436f, -0.010321437f, 0.012433636f, 0.00021866535f, -5.5793977e-06f, 3.0188383e-07f };
-		if ( material == "MP-TAC60-90" ) return { 3.0209214f, -0.0157801f, 0.02114253f, 0.00095556554f, -7.4489819e-05f, 4.360632e-06f };
-		if ( material == "MP-TAC80-60" ) return { 2.9372128f, -0.016185789f, 0.01839514f, 0.0010266071f, -9.2379872e-05f, 5.0509237e-06f };
-		if ( material == "MP-TAF101-100" ) return { 3.0591566f, -0.013604717f, 0.024624272f, 0.00041834242f, 2.5361908e-06f, 7.998082e-07f };
-		if ( material == "MP-TAF105" ) return { 3.0705638f, -0.013310234f, 0.025280355f, 0.00021829234f, 3.2555293e-05f, -8.1300421e-07f };
-		if ( material == "MP-TAF31-15" ) return { 3.164475f, -0.013801295f, 0.027926276f, 0.00057403f, 9.8223773e-07f, 1.3284244e-06f };
-		if ( material == "MP-TAF401" ) return { 3.07279f, -0.01366385f, 0.02527346f, 0.000612182f, -1.147045e-05f, 1.543e-06f };
-		if ( material == "MP-TAFD305" ) return { 3.327184f, -0.01343242f, 0.033398f, 0.001006047f, -2.136908e-05f, 3.972561e-06f };
-		if ( material == "MP-TAFD307" ) return { 3.4286062f, -0.013845333f, 0.037363009f, 0.0011894554f, -1.5979979e-05f, 5.1827398e-06f };
-		if ( material == "MP-TAFD405" ) return { 3.6542352f, -0.015688325f, 0.048094089f, 0.0026498065f, -0.00013971852f, 1.9581201e-05f };
-		if ( material == "MP-TAFD51-50" ) return { 3.2288052f, -0.014433046f, 0.029863488f, 0.00082119282f, -1.0943492e-05f, 2.5804939e-06f };
-		if ( material == "M-TAC60" ) return { 3.017866f, -0.015790934f, 0.021144702f, 0.00093137389f, -6.9379914e-05f, 4.02762e-06f };
-		if ( material == "M-TAC80" ) return { 2.9351948f, -0.016193458f, 0.018392287f, 0.0010086167f, -8.7565474e-05f, 4.6921333e-06f };
-		if ( material == "M-TAF101" ) return { 3.05615f, -0.0138471f, 0.02431126f, 0.0004980027f, -7.318676e-06f, 1.24041e-06f };
-		if ( material == "M-TAF105" ) return { 3.0705638f, -0.013310234f, 0.025280355f, 0.00021829234f, 3.2555293e-05f, -8.1300421e-07f };
-		if ( material == "M-TAF1" ) return { 3.070806f, -0.012276924f, 0.02456566f, 0.00047436648f, 5.432616e-07f, 6.5976661e-07f };
-		if ( material == "M-TAF31" ) return { 3.164358f, -0.01403321f, 0.02767034f, 0.0006403025f, -6.349234e-06f, 1.615744e-06f };
-		if ( material == "M-TAF401" ) return { 3.07279f, -0.01366385f, 0.02527346f, 0.000612182f, -1.147045e-05f, 1.543e-06f };
-		if ( material == "M-TAFD305" ) return { 3.327184f, -0.01343242f, 0.033398f, 0.001006047f, -2.136908e-05f, 3.972561e-06f };
-		if ( material == "M-TAFD307" ) return { 3.4286062f, -0.013845333f, 0.037363009f, 0.0011894554f, -1.5979979e-05f, 5.1827398e-06f };
-		if ( material == "M-TAFD405" ) return { 3.6542352f, -0.015688325f, 0.048094089f, 0.0026498065f, -0.00013971852f, 1.9581201e-05f };
-		if ( material == "M-TAFD51" ) return { 3.227682f, -0.01453816f, 0.0292121f, 0.001057062f, -4.787162e-05f, 4.557239e-06f };
-		if ( material == "NBF1" ) return { 2.9753491f, -0.01461347f, 0.021096383f, 0.001198038f, -0.00011887388f, 7.344435e-06f };
-		if ( material == "NBFD10" ) return { 3.2615573f, -0.014542851f, 0.033470739f, 0.0012266479f, -2.5391842e-05f, 5.5971739e-06f };
-		if ( material == "NBFD11" ) return { 3.1010267f, -0.010022108f, 0.032631687f, -0.00081029268f, 0.0001935011f, -8.0279799e-06f };
-		if ( material == "NBFD12" ) return { 3.1513655f, -0.013052015f, 0.029502111f, 0.00067643437f, 3.6679701e-06f, 1.8233293e-06f };
-		if ( material == "NBFD13" ) return { 3.1729223f, -0.014248534f, 0.029168114f, 0.001342876f, -9.6178753e-05f, 8.4042556e-06f };
-		if ( material == "NBFD15-W" ) return { 3.1540011f, -0.013256753f, 0.034103312f, 0.0018472167f, -0.00010807332f, 1.2975901e-05f };
-		if ( material == "NBFD15" ) return { 3.1540011f, -0.013256753f, 0.034103312f, 0.0018472167f, -0.00010807332f, 1.2975901e-05f };
-		if ( material == "NBFD3" ) return { 3.1633746f, -0.01327628f, 0.031133309f, 0.0008352338f, 2.9980499e-06f, 2.5568853e-06f };
-		if ( material == "PCD40" ) return { 2.5844463f, -0.0090521858f, 0.014301987f, 0.0001705077f, 4.964536e-06f, -1.2927479e-07f };
-		if ( material == "PCD4" ) return { 2.5807045f, -0.010957538f, 0.01268943f, 0.00066387812f, -6.4849664e-05f, 3.4787863e-06f };
-		if ( material == "PCD51" ) return { 2.5046638f, -0.010149448f, 0.012653769f, 0.00016566642f, 5.3871747e-07f, 5.584093e-08f };
-		if ( material == "TAC2" ) return { 2.9717137f, -0.014952593f, 0.020162868f, 0.00094072283f, -8.8614104e-05f, 5.3191242e-06f };
-		if ( material == "TAC4" ) return { 2.9425645f, -0.013266554f, 0.023559223f, -0.00016399009f, 9.2370759e-05f, -4.8615982e-06f };
-		if ( material == "TAC6" ) return { 3.0182184f, -0.015381633f, 0.021520137f, 0.00064608303f, -3.2355748e-05f, 2.0791593e-06f };
-		if ( material == "TAC8" ) return { 2.9324178f, -0.014603156f, 0.021121636f, 4.8240144e-05f, 4.9669475e-05f, -2.4904491e-06f };
-		if ( material == "TAF1" ) return { 3.0736378f, -0.015501284f, 0.023627699f, 0.00066300852f, -2.8353438e-05f, 2.2090799e-06f };
-		if ( material == "TAF2" ) return { 3.1415564f, -0.014370304f, 0.026483051f, 0.00095642714f, -5.9411087e-05f, 4.703953e-06f };
-		if ( material == "TAF3D" ) return { 3.175337f, -0.014107601f, 0.0278609f, 0.00040102824f, 2.4504764e-05f, 2.4435731e-08f };
-		if ( material == "TAF3" ) return { 3.1743707f, -0.014110466f, 0.028862637f, 3.355949e-05f, 8.0422109e-05f, -2.8956744e-06f };
-		if ( material == "TAF4" ) return { 3.1212281f, -0.014119909f, 0.026520622f, 0.00040415763f, 1.4260634e-05f, 3.164256e-07f };
-		if ( material == "TAF5" ) return { 3.2191571f, -0.015310562f, 0.02636257f, 0.0010534452f, -6.1660412e-05f, 3.9733897e-06f };
-		if ( material == "TAFD25" ) return { 3.4905528f, -0.016325771f, 0.041146322f, 0.0027169124f, -0.00018260518f, 2.0641862e-05f };
-		if ( material == "TAFD30" ) return { 3.4419038f, -0.014175245f, 0.03435104f, 0.0011752271f, -3.9010343e-05f, 3.7417054e-06f };
-		if ( material == "TAFD32" ) return { 3.396108f, -0.013087065f, 0.034853516f, 0.00079083177f, 7.6995212e-06f, 2.3516742e-06f };
-		if ( material == "TAFD33" ) return { 3.4316955f, -0.013156273f, 0.035631862f, 0.00091378109f, -4.0366886e-06f, 3.3867688e-06f };
-		if ( material == "TAFD35" ) return { 3.5274747f, -0.014839948f, 0.039745402f, 0.001803472f, -8.9279334e-05f, 1.1377783e-05f };
-		if ( material == "TAFD37A" ) return { 3.4958125f, -0.014342354f, 0.037807251f, 0.0014184073f, -4.6470269e-05f, 6.919444e-06f };
-		if ( material == "TAFD37" ) return { 3.4943369f, -0.013647624f, 0.03883317f, 0.0011132555f, -7.402237e-06f, 5.3027754e-06f };
-		if ( material == "TAFD40" ) return { 3.8106232f, -0.016351565f, 0.058801097f, 0.0034919026f, -0.0001694811f, 3.2569333e-05f };
-		if ( material == "TAFD45" ) return { 3.672962f, -0.0151805f, 0.0457187f, 0.002186221f, -9.93742e-05f, 1.490466e-05f };
-		if ( material == "TAFD55" ) return { 3.8317578f, -0.015266397f, 0.054573843f, 0.0023109346f, -4.4476201e-05f, 1.6143887e-05f };
-		if ( material == "TAFD5F" ) return { 3.275546f, -0.014470354f, 0.030922062f, 0.00073289981f, 4.6573307e-06f, 1.8242746e-06f };
-		if ( material == "TAFD5G" ) return { 3.2756799f, -0.014485625f, 0.030780102f, 0.00078915515f, -4.0810229e-06f, 2.2273965e-06f };
-		if ( material == "TAFD65" ) return { 4.0113202f, -0.017752009f, 0.05856933f, 0.0043200932f, -0.00031070842f, 3.7485638e-05f };
-		if ( material == "APL1" ) return { 2.2762403f, -0.0096874647f, 0.0092330378f, 0.00038940853f, -3.8018733e-05f, 2.0693225e-06f };
-		if ( material == "BAH10" ) return { 2.730459f, -0.01063385f, 0.01942756f, 0.0008209873f, -5.210457e-05f, 4.447534e-06f };
-		if ( material == "BAH11" ) return { 2.717567f, -0.008666231f, 0.02116288f, 0.0001530768f, 3.227309e-05f, 6.602266e-08f };
-		if ( material == "BAH13" ) return { 2.7229077f, -0.0099369888f, 0.02092378f, 0.00065136672f, -1.9388233e-05f, 3.1119561e-06f };
-		if ( material == "BAH22" ) return { 2.6928266f, -0.0090141372f, 0.025058968f, 0.0010140502f, -3.2164637e-05f, 5.6431441e-06f };
-		if ( material == "BAH26" ) return { 2.7137156f, -0.0093481462f, 0.022190744f, 0.00074154999f, -2.1872211e-05f, 3.821015e-06f };
-		if ( material == "BAH27" ) return { 2.823151f, -0.01090859f, 0.02374898f, 0.000901646f, -3.713171e-05f, 5.48189e-06f };
-		if ( material == "BAH28" ) return { 2.891704f, -0.01284803f, 0.02450539f, 0.001674117f, -0.0001176163f, 1.046904e-05f };
-		if ( material == "BAH30" ) return { 2.6543867f, -0.0084478289f, 0.022275774f, 0.00090008133f, -3.5291806e-05f, 4.7103195e-06f };
-		if ( material == "BAH54" ) return { 2.802774f, -0.011441428f, 0.023830231f, 0.00057322688f, 1.1516047e-05f, 1.2065896e-06f };
-		if ( material == "BAH71" ) return { 2.8219169f, -0.0099182972f, 0.02439388f, 0.00099651859f, -4.5521985e-05f, 5.5512807e-06f };
-		if ( material == "BAH77" ) return { 2.8222929f, -0.010636602f, 0.024365241f, 0.00070591145f, -3.9506977e-06f, 2.9865625e-06f };
-		if ( material == "BAH78" ) return { 2.8884392f, -0.010882671f, 0.026418653f, 0.0011678492f, -5.2245897e-05f, 6.2881561e-06f };
-		if ( material == "BAL11" ) return { 2.433807f, -0.009321052f, 0.01397331f, 0.0001804732f, 7.763637e-06f, -1.184873e-07f };
-		if ( material == "BAL12" ) return { 2.339135f, -0.009645053f, 0.01072238f, 0.0007185158f, -6.911301e-05f, 3.543402e-06f };
-		if ( material == "BAL14" ) return { 2.421996f, -0.009200161f, 0.01374045f, 0.000348582f, -1.664649e-05f, 1.313751e-06f };
-		if ( material == "BAL15" ) return { 2.3876453f, -0.0097564209f, 0.01254688f, 0.00038108489f, -2.3656347e-05f, 1.5068491e-06f };
-		if ( material == "BAL22" ) return { 2.428819f, -0.01160085f, 0.01108574f, 0.00063122f, -6.395123e-05f, 3.440011e-06f };
-		if ( material == "BAL2" ) return { 2.424312f, -0.00858474f, 0.01472045f, 0.0005504561f, -3.170738e-05f, 2.420757e-06f };
-		if ( material == "BAL35" ) return { 2.487525f, -0.01022867f, 0.01374306f, 0.0001662538f, 6.25135e-06f, -2.342041e-07f };
-		if ( material == "BAL3" ) return { 2.426175f, -0.00781539f, 0.01476624f, 0.0003669042f, -1.052689e-05f, 1.039369e-06f };
-		if ( material == "BAL41" ) return { 2.410742f, -0.010238f, 0.01233414f, 0.0003782378f, -2.550448e-05f, 1.456385e-06f };
-		if ( material == "BAL42" ) return { 2.4686122f, -0.0099937773f, 0.013115756f, 0.00045052253f, -3.1570294e-05f, 1.7307442e-06f };
-		if ( material == "BAL50" ) return { 2.3982661f, -0.010222781f, 0.012110445f, 0.00037767581f, -2.7339021e-05f, 1.5701891e-06f };
-		if ( material == "BAL5" ) return { 2.3550985f, -0.0086952235f, 0.013797477f, 0.00027607581f, 9.6025624e-08f, 6.0765812e-07f };
-		if ( material == "BAL7" ) return { 2.4787185f, -0.0085856348f, 0.015210012f, 0.0006044033f, -3.8936391e-05f, 2.7124338e-06f };
-		if ( material == "BAM12" ) return { 2.628582f, -0.009085873f, 0.0195519f, 0.0006698928f, -2.510153e-05f, 3.047777e-06f };
-		if ( material == "BAM21" ) return { 2.579457f, -0.0094225577f, 0.021195926f, 0.0008094349f, -2.4922189e-05f, 3.9861235e-06f };
-		if ( material == "BAM23" ) return { 2.5222179f, -0.0087270222f, 0.020177286f, 0.00061839451f, 1.8063926e-07f, 2.0159505e-06f };
-		if ( material == "BAM25" ) return { 2.513482f, -0.008739639f, 0.0186819f, 0.0007470892f, -3.047596e-05f, 3.39904e-06f };
-		if ( material == "BAM4" ) return { 2.521467f, -0.007991308f, 0.01891922f, 0.000549235f, -1.150794e-05f, 2.505827e-06f };
-		if ( material == "BAM5" ) return { 2.533703f, -0.0090417017f, 0.016851835f, 0.00051005408f, -1.7651257e-05f, 1.8665437e-06f };
-		if ( material == "BAM8" ) return { 2.583052f, -0.0098044767f, 0.017999796f, 0.00062560828f, -3.0382771e-05f, 3.0639765e-06f };
-		if ( material == "BAM9" ) return { 2.6446959f, -0.0094397093f, 0.018905035f, 0.00050396096f, -6.9325864e-06f, 1.5474561e-06f };
-		if ( material == "BPH35" ) return { 2.6413378f, -0.012997513f, 0.02125189f, 0.00074166905f, -1.9814508e-05f, 3.0698879e-06f };
-		if ( material == "BPH40" ) return { 2.737477f, -0.013153125f, 0.023895273f, 0.0011078302f, -4.881918e-05f, 5.4773972e-06f };
-		if ( material == "BPH45" ) return { 2.8619065f, -0.012425617f, 0.02988917f, 0.0010370691f, 1.6015692e-06f, 4.4595212e-06f };
-		if ( material == "BPH50" ) return { 2.9271459f, -0.011970157f, 0.031922538f, 0.0015457537f, -6.3507309e-05f, 9.6835139e-06f };
-		if ( material == "BPM4" ) return { 2.5489492f, -0.012922911f, 0.018433588f, 0.00067483064f, -2.8837579e-05f, 3.057603e-06f };
-		if ( material == "BSL1" ) return { 2.2513548f, -0.0093148277f, 0.010704574f, 0.00012187894f, 1.0654019e-05f, -7.4428165e-07f };
-		if ( material == "BSL21" ) return { 2.234734f, -0.0097856687f, 0.0098367633f, 0.00021398416f, -1.4554893e-05f, 8.7393721e-07f };
-		if ( material == "BSL22" ) return { 2.2739528f, -0.0091160058f, 0.01226882f, -0.00031677862f, 6.0075221e-05f, -2.8098187e-06f };
-		if ( material == "BSL3" ) return { 2.2187568f, -0.010447185f, 0.0095904498f, 0.00028540943f, -1.9183741e-05f, 9.7004548e-07f };
-		if ( material == "BSL7" ) return { 2.2697665f, -0.0096395197f, 0.011025458f, 7.9465126e-05f, 1.0120957e-05f, -4.4096694e-07f };
-		if ( material == "BSM10" ) return { 2.589111f, -0.009879155f, 0.01555047f, 0.0003664276f, -1.829782e-05f, 1.460153e-06f };
-		if ( material == "BSM14" ) return { 2.53088f, -0.01045574f, 0.01393304f, 0.0003172572f, -1.649761e-05f, 1.121198e-06f };
-		if ( material == "BSM15" ) return { 2.59025f, -0.009886858f, 0.01565646f, 0.0002117553f, 5.763945e-06f, -3.134574e-08f };
-		if ( material == "BSM16C" ) return { 2.5858505f, -0.011425977f, 0.013924703f, 0.00050343054f, -3.6074659e-05f, 1.9912627e-06f };
-		if ( material == "BSM16" ) return { 2.585926f, -0.0114351f, 0.01387296f, 0.0005169618f, -3.768293e-05f, 2.058449e-06f };
-		if ( material == "BSM18" ) return { 2.6385199f, -0.010968446f, 0.01597395f, 0.00053519299f, -3.5705726e-05f, 2.6035403e-06f };
-		if ( material == "BSM21" ) return { 2.567869f, -0.008657333f, 0.01659137f, 0.0002865545f, -3.488675e-06f, 8.927552e-07f };
-		if ( material == "BSM23" ) return { 2.5600597f, -0.0097457249f, 0.015970594f, 0.00066802115f, -4.4172822e-05f, 3.1024931e-06f };
-		if ( material == "BSM24" ) return { 2.56958f, -0.0086466584f, 0.016903144f, 7.624944e-05f, 2.6138532e-05f, -7.4670354e-07f };
-		if ( material == "BSM25" ) return { 2.694748f, -0.009564087f, 0.01971919f, 0.0001351695f, 3.250553e-05f, -8.799463e-07f };
-		if ( material == "BSM28" ) return { 2.568088f, -0.01046716f, 0.01660196f, 0.0005809348f, -2.356209e-05f, 2.231142e-06f };
-		if ( material == "BSM2" ) return { 2.540784f, -0.00928151f, 0.01490321f, 0.0003779065f, -1.245295e-05f, 7.093602e-07f };
-		if ( material == "BSM36" ) return { 2.6546711f, -0.012819365f, 0.015197193f, 0.00050420821f, -3.4995634e-05f, 2.0492682e-06f };
-		if ( material == "BSM4" ) return { 2.559693f, -0.01014464f, 0.01426178f, 0.0004753199f, -3.128766e-05f, 1.735988e-06f };
-		if ( material == "BSM6" ) return { 2.5601339f, -0.009371199f, 0.015290933f, 0.00040740566f, -2.1956285e-05f, 1.5738984e-06f };
-		if ( material == "BSM71" ) return { 2.6654566f, -0.0093666483f, 0.018458132f, 0.00016162509f, 2.0907914e-05f, -1.3617346e-07f };
-		if ( material == "BSM7" ) return { 2.5432134f, -0.0102068f, 0.013983216f, 0.00045963235f, -3.2963243e-05f, 1.9413424e-06f };
-		if ( material == "BSM81" ) return { 2.6493149f, -0.014491012f, 0.014390568f, 0.0005294553f, -4.134593e-05f, 2.2951175e-06f };
-		if ( material == "BSM93" ) return { 2.6481267f, -0.011553471f, 0.015517531f, 0.00053211731f, -3.390687e-05f, 2.099346e-06f };
-		if ( material == "FPL51" ) return { 2.2184385f, -0.0059347504f, 0.0080764899f, 0.00016581036f, -8.0553319e-06f, 3.5839492e-07f };
-		if ( material == "FPL52" ) return { 2.1024886f, -0.0053455182f, 0.0060469928f, 0.00028496405f, -2.987651e-05f, 1.539752e-06f };
-		if ( material == "FPL53" ) return { 2.0531286f, -0.0043190085f, 0.0062752442f, -9.8512972e-06f, 1.364971e-05f, -8.9037944e-07f };
-		if ( material == "FSL3" ) return { 2.1205655f, -0.0089437249f, 0.0090242393f, 0.00013786285f, -8.2750398e-07f, 2.6740448e-08f };
-		if ( material == "FSL5" ) return { 2.189801f, -0.0098715424f, 0.0081379561f, 0.00042431698f, -4.3722026e-05f, 2.3005833e-06f };
-		if ( material == "FTL10" ) return { 2.222325f, -0.008576053f, 0.0109677f, 0.0004169366f, -2.746341e-05f, 2.170253e-06f };
-		if ( material == "FTL8" ) return { 2.2498663f, -0.010009969f, 0.010686269f, 0.00098510593f, -0.00010138667f, 7.0446543e-06f };
-		if ( material == "FTM16" ) return { 2.4732588f, -0.010524934f, 0.019876763f, 0.0013151817f, -9.4064852e-05f, 1.0616142e-05f };
-		if ( material == "FTM8" ) return { 2.3063389f, -0.009299434f, 0.014148541f, 0.00061944948f, -3.542134e-05f, 4.3560988e-06f };
-		if ( material == "LAH51" ) return { 3.110662f, -0.014462677f, 0.026457698f, 0.00091877798f, -3.3951573e-05f, 3.325784e-06f };
-		if ( material == "LAH52" ) return { 3.153652f, -0.015630638f, 0.028741717f, 0.00080868084f, -1.0164635e-05f, 2.9615511e-06f };
-		if ( material == "LAH53" ) return { 3.1735908f, -0.014865209f, 0.02954021f, 0.00098366596f, -2.2979104e-05f, 3.8043975e-06f };
-		if ( material == "LAH54" ) return { 3.2126997f, -0.01535137f, 0.028440374f, 0.00079180171f, -1.7032771e-05f, 2.6219094e-06f };
-		if ( material == "LAH55" ) return { 3.2764855f, -0.015309073f, 0.030415926f, 0.00088670657f, -1.718301e-05f, 2.7050718e-06f };
-		if ( material == "LAH58" ) return { 3.4415721f, -0.014237538f, 0.03473123f, 0.0010264409f, -1.6386952e-05f, 2.8714098e-06f };
-		if ( material == "LAH59" ) return { 3.2178118f, -0.014296789f, 0.027199504f, 0.00079036567f, -2.3850632e-05f, 2.0013066e-06f };
-		if ( material == "LAH60" ) return { 3.2618526f, -0.015375794f, 0.033152898f, 0.0014090033f, -5.5295605e-05f, 7.1360367e-06f };
-		if ( material == "LAH63" ) return { 3.1647389f, -0.014742454f, 0.030279435f, 0.0010475442f, -2.4957393e-05f, 4.4251949e-06f };
-		if ( material == "LAH64" ) return { 3.122744f, -0.015173059f, 0.025766499f, 0.00055121032f, 6.0710815e-06f, 4.8871364e-07f };
-		if ( material == "LAH65" ) return { 3.1767027f, -0.015350032f, 0.026690666f, 0.00070784089f, -1.5485093e-05f, 1.9530666e-06f };
-		if ( material == "LAH66" ) return { 3.0731081f, -0.015043205f, 0.023933518f, 0.00055696651f, -1.0082346e-05f, 1.1873265e-06f };
-		if ( material == "LAH67" ) return { 3.1439609f, -0.015541721f, 0.026648169f, 0.00077813143f, -1.9462248e-05f, 2.4668548e-06f };
-		if ( material == "LAH71" ) return { 3.3034137f, -0.013868754f, 0.037625274f, 0.0021067685f, -0.00011821055f, 1.4781395e-05f };
-		if ( material == "LAH75" ) return { 3.3972115f, -0.015825501f, 0.036818916f, 0.0017596445f, -8.4041673e-05f, 1.0522807e-05f };
-		if ( material == "LAL10" ) return { 2.8967406f, -0.01222188f, 0.021099546f, 0.00063090904f, -2.8901915e-05f, 2.1652922e-06f };
-		if ( material == "LAL11" ) return { 2.7037498f, -0.011741892f, 0.0158996f, 0.00061265364f, -4.6676845e-05f, 2.6544952e-06f };
-		if ( material == "LAL12" ) return { 2.7589457f, -0.0087787656f, 0.021173055f, -0.00047262367f, 9.6870749e-05f, -4.0576545e-06f };
-		if ( material == "LAL13" ) return { 2.814252f, -0.013645728f, 0.018724991f, 0.00056380326f, -2.852714e-05f, 1.8227195e-06f };
-		if ( material == "LAL14" ) return { 2.8274666f, -0.014568462f, 0.018525487f, 0.0003748582f, -7.1291749e-06f, 6.7781934e-07f };
-		if ( material == "LAL18" ) return { 2.934239f, -0.015232638f, 0.01968169f, 0.00052343197f, -1.9855288e-05f, 1.1787472e-06f };
-		if ( material == "LAL52" ) return { 2.7418702f, -0.012719153f, 0.016306977f, 0.00061414226f, -4.8242632e-05f, 2.8875864e-06f };
-		if ( material == "LAL54" ) return { 2.6786604f, -0.011137943f, 0.016391023f, 0.00047317724f, -2.4508283e-05f, 1.7003664e-06f };
-		if ( material == "LAL56" ) return { 2.7596566f, -0.010659546f, 0.018646689f, 0.00076127484f, -5.3585332e-05f, 3.7820929e-06f };
-		if ( material == "LAL59" ) return { 2.9466133f, -0.014813612f, 0.020753291f, 0.00071087608f, -4.178079e-05f, 2.5896668e-06f };
-		if ( material == "LAL60" ) return { 2.9223334f, -0.015268924f, 0.020070735f, 0.00049690538f, -1.5326299e-05f, 1.0772354e-06f };
-		if ( material == "LAL61" ) return { 2.9706808f, -0.015058733f, 0.021490548f, 0.00038566151f, 4.1252602e-06f, 1.0912892e-07f };
-		if ( material == "LAL7" ) return { 2.6833808f, -0.012303485f, 0.015614129f, 0.00047439815f, -2.7935643e-05f, 1.5441332e-06f };
-		if ( material == "LAL8" ) return { 2.8795551f, -0.01462241f, 0.019128502f, 0.00061342737f, -3.5439045e-05f, 2.1550362e-06f };
-		if ( material == "LAL9" ) return { 2.8062228f, -0.01325307f, 0.019370701f, 0.00013885534f, 2.596583e-05f, -9.3551589e-07f };
-		if ( material == "LAM2" ) return { 2.967968f, -0.011312544f, 0.024812309f, 0.00067776202f, -1.0278339e-05f, 2.1968703e-06f };
-		if ( material == "LAM3" ) return { 2.8826295f, -0.01060676f, 0.022303134f, 0.00055786284f, -1.1488225e-05f, 1.8527798e-06f };
-		if ( material == "LAM51" ) return { 2.830675f, -0.01254193f, 0.01928173f, 0.00113639f, -8.838415e-05f, 5.822869e-06f };
-		if ( material == "LAM52" ) return { 2.888081f, -0.01133043f, 0.02306135f, 0.001004485f, -5.630208e-05f, 5.248466e-06f };
-		if ( material == "LAM54" ) return { 3.019994f, -0.015777485f, 0.022691302f, 0.00093505681f, -5.6267103e-05f, 4.0846095e-06f };
-		if ( material == "LAM55" ) return { 3.0211799f, -0.012311284f, 0.027355503f, 0.0011031515f, -5.0726902e-05f, 6.4572101e-06f };
-		if ( material == "LAM60" ) return { 2.9745038f, -0.014898498f, 0.022058854f, 0.0007492073f, -4.2104743e-05f, 3.1048673e-06f };
-		if ( material == "LAM66" ) return { 3.1437117f, -0.015620045f, 0.031893839f, 0.0017196133f, -9.6995128e-05f, 1.1680925e-05f };
-		if ( material == "NSL2" ) return { 2.264123f, -0.008475121f, 0.01223501f, 0.0001944071f, 3.353212e-07f, 3.831994e-07f };
-		if ( material == "NSL33" ) return { 2.2582399f, -0.0079875836f, 0.012575688f, 0.00022130477f, 1.0685962e-06f, 3.9764383e-07f };
-		if ( material == "NSL36" ) return { 2.266208f, -0.008895249f, 0.01260385f, 0.0003758541f, -1.385868e-05f, 1.28332e-06f };
-		if ( material == "NSL3" ) return { 2.269695f, -0.007150002f, 0.01337006f, -0.0002761508f, 6.605453e-05f, -3.180633e-06f };
-		if ( material == "NSL5" ) return { 2.284302f, -0.008132863f, 0.01240948f, -7.446766e-06f, 2.86937e-05f, -1.237616e-06f };
-		if ( material == "NSL7" ) return { 2.2524157f, -0.008626195f, 0.011155352f, 0.00020721565f, -2.6893015e-07f, 3.8724966e-08f };
-		if ( material == "PBH10" ) return { 2.8778739f, -0.010244063f, 0.033846634f, 0.0018336135f, -7.8721902e-05f, 1.4142908e-05f };
-		if ( material == "PBH11W" ) return { 3.0523317f, -0.010699896f, 0.040026761f, 0.0027411266f, -0.00016825655f, 2.453957e-05f };
-		if ( material == "PBH11" ) return { 3.0523317f, -0.010699896f, 0.040026761f, 0.0027411266f, -0.00016825655f, 2.453957e-05f };
-		if ( material == "PBH13W" ) return { 2.9161406f, -0.010147718f, 0.035077729f, 0.0020869984f, -0.00011077712f, 1.7236453e-05f };
-		if ( material == "PBH13" ) return { 2.9161406f, -0.010147718f, 0.035077729f, 0.0020869984f, -0.00011077712f, 1.7236453e-05f };
-		if ( material == "PBH14W" ) return { 2.9836628f, -0.012013213f, 0.035225183f, 0.0031766736f, -0.000253238f, 2.7797101e-05f };
-		if ( material == "PBH14" ) return { 2.9836628f, -0.012013213f, 0.035225183f, 0.0031766736f, -0.000253238f, 2.7797101e-05f };
-		if ( material == "PBH18" ) return { 2.8593245f, -0.010210027f, 0.031973162f, 0.0020206869f, -0.00011399314f, 1.4012932e-05f };
-		if ( material == "PBH21" ) return { 3.494462f, -0.01184144f, 0.05819278f, 0.00520064f, -0.0003667622f, 5.308036e-05f };
-		if ( material == "PBH23W" ) return { 3.0554324f, -0.010867434f, 0.038522891f, 0.0030173971f, -0.0002129474f, 2.4864803e-05f };
-		if ( material == "PBH23" ) return { 3.0554324f, -0.010867434f, 0.038522891f, 0.0030173971f, -0.0002129474f, 2.4864803e-05f };
-		if ( material == "PBH25W" ) return { 2.983028f, -0.01043595f, 0.03634647f, 0.002619412f, -0.0001751318f, 2.13251e-05f };
-		if ( material == "PBH25" ) return { 2.9830277f, -0.010435952f, 0.036346467f, 0.0026194115f, -0.00017513176f, 2.1325099e-05f };
-		if ( material == "PBH3W" ) return { 2.9157717f, -0.0100817f, 0.03409894f, 0.0021965014f, -0.00012386955f, 1.5766843e-05f };
-		if ( material == "PBH4W" ) return { 2.961379f, -0.0098262329f, 0.036779565f, 0.0020712902f, -9.3348652e-05f, 1.5491439e-05f };
-		if ( material == "PBH4" ) return { 2.961379f, -0.0098262329f, 0.036779565f, 0.0020712902f, -9.3348652e-05f, 1.5491439e-05f };
-		if ( material == "PBH53W" ) return { 3.2498918f, -0.010466366f, 0.048000686f, 0.0031859922f, -0.00015447369f, 2.6258671e-05f };
-		if ( material == "PBH53" ) return { 3.2498918f, -0.010466366f, 0.048000686f, 0.0031859922f, -0.00015447369f, 2.6258671e-05f };
-		if ( material == "PBH6W" ) return { 3.120642f, -0.011286328f, 0.040543249f, 0.0033876996f, -0.00024180036f, 2.7440285e-05f };
-		if ( material == "PBH6" ) return { 3.120642f, -0.011286328f, 0.040543249f, 0.0033876996f, -0.00024180036f, 2.7440285e-05f };
-		if ( material == "PBH72" ) return { 3.4684938f, -0.010731638f, 0.058252246f, 0.0046536748f, -0.0003034305f, 4.8216298e-05f };
-		if ( material == "PBL1" ) return { 2.3489663f, -0.0075869873f, 0.016684762f, 0.00017147637f, 2.5194777e-05f, 1.8523864e-07f };
-		if ( material == "PBL21" ) return { 2.4238569f, -0.0094940065f, 0.016206639f, 0.0010105149f, -7.2683761e-05f, 5.4198492e-06f };
-		if ( material == "PBL22" ) return { 2.466622f, -0.0076071728f, 0.02016524f, 0.00028279173f, 3.0879156e-05f, 6.6471743e-07f };
-		if ( material == "PBL25" ) return { 2.4465509f, -0.0097768464f, 0.01753112f, 0.00095250889f, -5.4837761e-05f, 4.7303899e-06f };
-		if ( material == "PBL27" ) return { 2.4269332f, -0.0089789895f, 0.017578385f, 0.00079125417f, -4.3016897e-05f, 4.2474552e-06f };
-		if ( material == "PBL2" ) return { 2.3302166f, -0.0085474969f, 0.014788612f, 0.00048017066f, -1.9221577e-05f, 2.1710005e-06f };
-		if ( material == "PBL6" ) return { 2.3036685f, -0.0076028355f, 0.014811205f, 0.00024182527f, 4.8392964e-06f, 8.9395406e-07f };
-		if ( material == "PBL7" ) return { 2.3529256f, -0.0089081938f, 0.015048987f, 0.00070028858f, -4.7518872e-05f, 3.8995587e-06f };
-		if ( material == "PBM11" ) return { 2.5613591f, -0.01200739f, 0.020780357f, 0.001425606f, -0.00011027477f, 1.1477786e-05f };
-		if ( material == "PBM1" ) return { 2.5743849f, -0.010002464f, 0.02166382f, 0.0013463294f, -8.3887231e-05f, 7.8154722e-06f };
-		if ( material == "PBM22" ) return { 2.6360314f, -0.0089450876f, 0.025228056f, 0.0011120943f, -3.7887387e-05f, 6.3760973e-06f };
-		if ( material == "PBM25" ) return { 2.7107551f, -0.0092889162f, 0.027542314f, 0.0013512557f, -5.4563909e-05f, 8.3261074e-06f };
-		if ( material == "PBM27" ) return { 2.6124109f, -0.0087316589f, 0.024857782f, 0.00088778616f, -9.2640255e-06f, 4.5028723e-06f };
-		if ( material == "PBM28W" ) return { 2.75779f, -0.0087331797f, 0.030379663f, 0.0011503031f, -1.9167784e-05f, 7.4745415e-06f };
-		if ( material == "PBM28" ) return { 2.75779f, -0.0087331797f, 0.030379663f, 0.0011503031f, -1.9167784e-05f, 7.4745415e-06f };
-		if ( material == "PBM2" ) return { 2.5569657f, -0.0097056299f, 0.02134251f, 0.0012399367f, -7.4499334e-05f, 7.145644e-06f };
-		if ( material == "PBM35" ) return { 2.7934634f, -0.011916323f, 0.027252732f, 0.0026477261f, -0.00022721609f, 2.0411942e-05f };
-		if ( material == "PBM39" ) return { 2.6957457f, -0.010264221f, 0.025940795f, 0.0014263975f, -6.8645974e-05f, 8.2048945e-06f };
-		if ( material == "PBM4" ) return { 2.5463724f, -0.0093446264f, 0.021462247f, 0.001051989f, -4.8504181e-05f, 5.6183745e-06f };
-		if ( material == "PBM5" ) return { 2.5078369f, -0.008947152f, 0.020469459f, 0.00089114494f, -3.6312577e-05f, 4.5477906e-06f };
-		if ( material == "PBM6" ) return { 2.6040004f, -0.0089503263f, 0.023811801f, 0.00097080592f, -3.0707494e-05f, 5.4397201e-06f };
-		if ( material == "PBM8" ) return { 2.4842899f, -0.0082629825f, 0.020412922f, 0.00059654654f, -4.9991757e-06f, 2.8060192e-06f };
-		if ( material == "PBM9" ) return { 2.5602323f, -0.0095632018f, 0.021495089f, 0.00085071191f, -3.3535727e-05f, 4.8953255e-06f };
-		if ( material == "PHM51" ) return { 2.5759016f, -0.010553544f, 0.013895937f, 0.00026498331f, -1.9680543e-06f, 1.0989977e-07f };
-		if ( material == "PHM52" ) return { 2.5782413f, -0.0089850999f, 0.014069295f, 0.0002504459f, -3.6968898e-06f, 2.5223758e-07f };
-		if ( material == "PHM53" ) return { 2.5332354f, -0.0095005403f, 0.012923982f, 0.00030691131f, -1.7660009e-05f, 1.0516051e-06f };
-		if ( material == "S-APL1" ) return { 2.2762403f, -0.0096874647f, 0.0092330378f, 0.00038940853f, -3.8018733e-05f, 2.0693225e-06f };
-		if ( material == "S-APL" ) return { 2.27624f, -0.009687465f, 0.009233038f, 0.0003894085f, -3.801873e-05f, 2.069323e-06f };
-		if ( material == "S-BAH54" ) return { 2.802774f, -0.011441428f, 0.023830231f, 0.00057322688f, 1.1516047e-05f, 1.2065896e-06f };
-		if ( material == "S-BAL50" ) return { 2.3982661f, -0.010222781f, 0.012110445f, 0.00037767581f, -2.7339021e-05f, 1.5701891e-06f };
-		if ( material == "S-BSM36" ) return { 2.6546711f, -0.012819365f, 0.015197193f, 0.00050420821f, -3.4995634e-05f, 2.0492682e-06f };
-		if ( material == "S-BSM93" ) return { 2.6481267f, -0.011553471f, 0.015517531f, 0.00053211731f, -3.390687e-05f, 2.099346e-06f };
-		if ( material == "S-LAH54" ) return { 3.2126997f, -0.01535137f, 0.028440374f, 0.00079180171f, -1.7032771e-05f, 2.6219094e-06f };
-		if ( material == "S-LAH67" ) return { 3.1439609f, -0.015541721f, 0.026648169f, 0.00077813143f, -1.9462248e-05f, 2.4668548e-06f };
-		if ( material == "S-LAH75" ) return { 3.397212f, -0.0158255f, 0.03681892f, 0.001759645f, -8.404167e-05f, 1.052281e-05f };
-		if ( material == "S-LAL11" ) return { 2.7037498f, -0.011741892f, 0.0158996f, 0.00061265364f, -4.6676845e-05f, 2.6544952e-06f };
-		if ( material == "S-LAL52" ) return { 2.7418702f, -0.012719153f, 0.016306977f, 0.00061414226f, -4.8242632e-05f, 2.8875864e-06f };
-		if ( material == "S-LAL60" ) return { 2.9223334f, -0.015268924f, 0.020070735f, 0.00049690538f, -1.5326299e-05f, 1.0772354e-06f };
-		if ( material == "S-PHM51" ) return { 2.5759016f, -0.010553544f, 0.013895937f, 0.00026498331f, -1.9680543e-06f, 1.0989977e-07f };
-		if ( material == "SSL2" ) return { 2.3006861f, -0.0098822575f, 0.013878959f, 0.00016341277f, 1.4393331e-05f, -9.3322118e-08f };
-		if ( material == "SSL5" ) return { 2.279329f, -0.010732907f, 0.012001392f, 0.00058141137f, -4.6205948e-05f, 2.9557679e-06f };
-		if ( material == "S-YGH52" ) return { 3.1224406f, -0.015600077f, 0.023832255f, 0.00072563954f, -3.0563799e-05f, 2.0883401e-06f };
-		if ( material == "TIH11" ) return { 3.0547581f, -0.013301755f, 0.039295435f, 0.0028224343f, -0.00017708961f, 2.6536608e-05f };
-		if ( material == "TIH14" ) return { 2.9828967f, -0.013103151f, 0.036731099f, 0.0025467663f, -0.00015569271f, 2.3553872e-05f };
-		if ( material == "TIH23" ) return { 3.0578382f, -0.013332336f, 0.038204824f, 0.0028735627f, -0.00019421032f, 2.6269529e-05f };
-		if ( material == "TIH53" ) return { 3.2534707f, -0.014523589f, 0.046505136f, 0.0036159629f, -0.00024194408f, 3.5879606e-05f };
-		if ( material == "TIH6" ) return { 3.1200483f, -0.012774901f, 0.042416181f, 0.0025526467f, -0.00011907015f, 2.3448425e-05f };
-		if ( material == "TIM11" ) return { 2.5613591f, -0.01200739f, 0.020780357f, 0.001425606f, -0.00011027477f, 1.1477786e-05f };
-		if ( material == "TPH55" ) return { 2.9569821f, -0.013856476f, 0.037265687f, 0.0029140249f, -0.00020079792f, 2.945722e-05f };
-		if ( material == "YGH51" ) return { 3.0180334f, -0.015399743f, 0.021762822f, 0.00053963162f, -1.3760417e-05f, 9.9935993e-07f };
-		if ( material == "YGH52" ) return { 3.1224406f, -0.015600077f, 0.023832255f, 0.00072563954f, -3.0563799e-05f, 2.0883401e-06f };
 
-		if ( material == "BAF2" ) return { 2.41667247f, -0.00746725517f, 0.0168668464f, -1.29697272e-05f, 5.159926024e-05f, -1.81803614e-06f };
-		if ( material == "BAF4" ) return { 2.451472f, -0.0065118879f, 0.019377342f, -0.00030637647f, 0.00010174985f, -3.9270356e-06f };
-		if ( material == "BAF5" ) return { 2.52216221f, -0.00832442891f, 0.0186334008f, 0.000582653358f, -1.12806453e-05f, 2.08955914e-06f };
-		if ( material == "BAF7" ) return { 2.5436416f, -0.0086925216f, 0.020049192f, 0.00089795352f, -4.9734473e-05f, 5.3556e-06f };
-		if ( material == "D-FK61" ) return { 2.21665351f, -0.00466455116f, 0.00907679939f, -0.000109123599f, 2.81347967e-05f, -1.39681747e-06f };
-		if ( material == "D-K59" ) return { 2.27042265f, -0.00876481814f, 0.0132414328f, -0.000548580823f, 9.37358416e-05f, -4.41911546e-06f };
-		if ( material == "D-K9" ) return { 2.27154844f, -0.0108815116f, 0.00996474656f, 0.000380487041f, -2.93440524e-05f, 1.45099948e-06f };
-		if ( material == "D-LAF050" ) return { 3.0588612f, -0.014713037f, 0.023619508f, 0.00067085861f, -2.760135e-05f, 2.1299817e-06f };
-		if ( material == "D-LAF50" ) return { 3.07490611f, -0.0115747081f, 0.0253759637f, 0.000221233049f, 3.69552724e-05f, -1.22052174e-06f };
-		if ( material == "D-LAF53" ) return { 2.97237085f, -0.0132859996f, 0.0235602874f, 0.000319211658f, 1.70425085e-05f, -8.96802291e-08f };
-		if ( material == "D-LAF79" ) return { 2.9216709f, -0.016405602f, 0.024564777f, 0.0010630152f, -3.3184678e-05f, 4.2899849e-06f };
-		if ( material == "D-LAF82L" ) return { 2.9384022f, -0.011000275f, 0.026895091f, -0.00074423432f, 0.00016294737f, -7.3175367e-06f };
-		if ( material == "D-LAK5" ) return { 2.76433988f, -0.0131613327f, 0.0182673276f, 0.000301224328f, 4.56200323e-06f, -2.05087278e-09f };
-		if ( material == "D-LAK6" ) return { 2.81430513f, -0.0134495125f, 0.0196569671f, 0.000249252546f, 1.98274573e-05f, -8.02641015e-07f };
-		if ( material == "D-LAK70" ) return { 2.73281949f, -0.0114137973f, 0.0202755954f, -0.000478308953f, 0.000110158258f, -5.30283301e-06f };
-		if ( material == "D-PK3" ) return { 2.29778839f, -0.00944743443f, 0.0107674711f, -7.59126906e-05f, 2.70221688e-05f, -1.2965337e-06f };
-		if ( material == "D-ZF10" ) return { 2.7595094f, -0.0104875429f, 0.0298924037f, 0.00121551438f, -3.91801667e-05f, 1.10580161e-05f };
-		if ( material == "D-ZF93" ) return { 3.80125332f, -0.0264815939f, 0.0481190715f, 0.0121421023f, -0.00148894236f, 0.000136817158f };
-		if ( material == "D-ZK2" ) return { 2.46827466f, -0.0104485861f, 0.01366454f, 0.000255364655f, -4.77558494e-06f, 3.20543262e-07f };
-		if ( material == "D-ZK3" ) return { 2.48968705f, -0.0121700502f, 0.0125749866f, 0.000532456449f, -5.1039362e-05f, 2.86502873e-06f };
-		if ( material == "D-ZK79" ) return { 2.54530492f, -0.00968163858f, 0.0157167913f, 3.66972503e-05f, 2.96132095e-05f, -1.32380367e-06f };
-		if ( material == "D-ZLAF50" ) return { 3.17013467f, -0.0130614687f, 0.0284367701f, 0.000413884621f, 2.91645398e-05f, -3.26598959e-07f };
-		if ( material == "D-ZLAF52LA" ) return { 3.1753525f, -0.00848750283f, 0.0371301651f, -0.00109609062f, 0.00024418582f, -8.94583294e-06f };
-		if ( material == "D-ZLAF61" ) return { 3.23113634f, -0.0129344158f, 0.0306465184f, 0.0006186837f, 1.99460431e-05f, 9.30145697e-07f };
-		if ( material == "D-ZLAF67" ) return { 3.43595778f, -0.014299558f, 0.036984078f, 0.00131399739f, -2.83852011e-05f, 5.77405361e-06f };
-		if ( material == "D-ZLAF81" ) return { 3.1745656f, -0.0098395711f, 0.034884391f, -0.00052006433f, 0.00017902813f, -6.3116821e-06f };
-		if ( material == "D-ZLAF85L" ) return { 3.33472677f, -0.0126400664f, 0.0345933295f, 0.000546091024f, 4.29052791e-05f, 2.50964053e-07f };
-		if ( material == "D-ZPK1A" ) return { 2.5865056f, -0.00836488456f, 0.014712994f, 6.50980579e-05f, 2.0373089e-05f, -9.57408813e-07f };
-		if ( material == "F13" ) return { 2.56957078f, -0.00760403138f, 0.0249680705f, 0.000334501945f, 5.6815438e-05f, 6.07326285e-07f };
-		if ( material == "F1" ) return { 2.5059651f, -0.0078686119f, 0.021574214f, 0.00059867966f, -9.5194606e-07f, 2.9024858e-06f };
-		if ( material == "F2" ) return { 2.53265982f, -0.00773825354f, 0.0231731432f, 0.000409362855f, 3.78046829e-05f, 1.03464346e-06f };
-		if ( material == "F3" ) return { 2.54428229f, -0.00835307611f, 0.0228231808f, 0.000670214922f, 1.04294821e-06f, 3.03297376e-06f };
-		if ( material == "F4" ) return { 2.5544667f, -0.00847847799f, 0.0232832892f, 0.000583809482f, 2.1963001e-05f, 1.96537708e-06f };
-		if ( material == "F5" ) return { 2.56837524f, -0.00914046228f, 0.0225979637f, 0.000999853488f, -3.66330712e-05f, 4.93324803e-06f };
-		if ( material == "F6" ) return { 2.56849722f, -0.00836232123f, 0.0234448291f, 0.000828924343f, -1.18355482e-05f, 4.09561662e-06f };
-		if ( material == "F7" ) return { 2.6027537f, -0.0084678903f, 0.0246596174f, 0.00074451296f, -4.85328405e-06f, 4.25920114e-06f };
-		if ( material == "H-BAF2" ) return { 2.41711733f, -0.00823177266f, 0.0168544799f, -3.47350495e-05f, 5.15389783e-05f, -1.33117437e-06f };
-		if ( material == "H-BAF3" ) return { 2.45168402f, -0.00862082666f, 0.0153497797f, 0.000182555027f, 1.41449954e-05f, -1.68159962e-07f };
-		if ( material == "H-BAF4" ) return { 2.45376994f, -0.00813614699f, 0.0179634979f, 0.000111641611f, 3.86804485e-05f, -3.17507239e-07f };
-		if ( material == "H-BAF5" ) return { 2.52420606f, -0.0105526237f, 0.0179847388f, 0.000680268445f, -2.35420343e-05f, 3.35670967e-06f };
-		if ( material == "H-BAF6" ) return { 2.53242221f, -0.00913744794f, 0.0181613436f, 0.000464889992f, -9.77023624e-06f, 2.46562672e-06f };
-		if ( material == "H-BAF7" ) return { 2.5419557f, -0.00867236761f, 0.0216670486f, 0.000351132658f, 2.45600301e-05f, 2.23930385e-06f };
-		if ( material == "H-BAF8" ) return { 2.57817643f, -0.00908880991f, 0.0220196312f, 0.000598073894f, -4.33206771e-06f, 4.0384407e-06f };
-		if ( material == "H-BAK1" ) return { 2.30865698f, -0.00872904002f, 0.0119533972f, 0.000159700912f, 6.99805905e-06f, -3.33717539e-07f };
-		if ( material == "H-BAK2" ) return { 2.33527993f, -0.0078806451f, 0.0135145071f, -0.000142281768f, 4.61865579e-05f, -2.07689693e-06f };
-		if ( material == "H-BAK3" ) return { 2.35870163f, -0.00950600467f, 0.0127948403f, -8.28951235e-05f, 3.5627075e-05f, -1.74142152e-06f };
-		if ( material == "H-BAK4" ) return { 2.37934396f, -0.0111573292f, 0.010770657f, 0.000537494005f, -4.85885263e-05f, 2.43110267e-06f };
-		if ( material == "H-BAK5" ) return { 2.39698774f, -0.00814093911f, 0.0141635533f, -1.31826571e-05f, 3.09378511e-05f, -1.33359749e-06f };
-		if ( material == "H-BAK6" ) return { 2.40421729f, -0.00689279508f, 0.0171159715f, -0.00118980816f, 0.000211469997f, -1.18837301e-05f };
-		if ( material == "H-BAK7GT" ) return { 2.41803544f, -0.0076261289f, 0.0165596275f, -0.000521246254f, 0.000106128523f, -4.8581855e-06f };
-		if ( material == "H-BAK7" ) return { 2.41803544f, -0.0076261289f, 0.0165596275f, -0.000521246254f, 0.000106128523f, -4.8581855e-06f };
-		if ( material == "H-BAK8" ) return { 2.43343745f, -0.00872725497f, 0.0139111043f, 0.000238516088f, 1.02781404e-06f, 1.01938839e-07f };
-		if ( material == "H-F13" ) return { 2.57016399f, -0.00927948027f, 0.0256258559f, -5.72485798e-05f, 0.000120086571f, -1.72844835e-06f };
-		if ( material == "H-F1" ) return { 2.50656956f, -0.00926894171f, 0.021861508f, 0.000431237321f, 1.69302544e-05f, 3.4236134e-06f };
-		if ( material == "H-F2" ) return { 2.5360648f, -0.01059228f, 0.021518011f, 0.00087655888f, -4.3936258e-05f, 7.5438308e-06f };
-		if ( material == "H-F4" ) return { 2.56216381f, -0.0130775362f, 0.0181084716f, 0.00231573055f, -0.000264961402f, 2.07458046e-05f };
-		if ( material == "H-F51" ) return { 2.6334392f, -0.023786997f, 0.013503973f, 0.0039049789f, -0.0004141067f, 2.7097419e-05f };
-		if ( material == "H-FK61B" ) return { 2.21667349f, -0.00493991656f, 0.00915004725f, -0.00012667557f, 2.8243403e-05f, -1.31517813e-06f };
-		if ( material == "H-FK61" ) return { 2.21667349f, -0.00493991656f, 0.00915004725f, -0.00012667557f, 2.8243403e-05f, -1.31517813e-06f };
-		if ( material == "H-FK71" ) return { 2.103249f, -0.0050247988f, 0.0065323077f, 0.00013078405f, -6.3652072e-06f, 1.9254745e-07f };
-		if ( material == "H-K10" ) return { 2.26857433f, -0.00685600163f, 0.0140981051f, -0.000498309358f, 9.50956734e-05f, -4.50515754e-06f };
-		if ( material == "H-K11" ) return { 2.29500524f, -0.00752634179f, 0.0130212465f, -0.000143116298f, 4.31227975e-05f, -1.8646905e-06f };
-		if ( material == "H-K12" ) return { 2.31506425f, -0.00827156166f, 0.0129535559f, 0.000268505199f, -5.46028268e-06f, 6.24325621e-07f };
-		if ( material == "H-K1" ) return { 2.2199551f, -0.00854352351f, 0.0103698555f, 0.000273240959f, -1.58736064e-05f, 9.73235567e-07f };
-		if ( material == "H-K2" ) return { 2.22522177f, -0.010126267f, 0.00954719533f, 0.000310146735f, -2.84359869e-05f, 1.63632169e-06f };
-		if ( material == "H-K3" ) return { 2.23568924f, -0.0101322782f, 0.0109219541f, -5.77272119e-05f, 2.68720113e-05f, -1.16041466e-06f };
-		if ( material == "H-K50" ) return { 2.2834436f, -0.00800379011f, 0.0130801119f, -0.000224166591f, 6.15548619e-05f, -2.94342401e-06f };
-		if ( material == "H-K51" ) return { 2.28704699f, -0.00896946455f, 0.0115278522f, 0.00030799622f, -7.93584686e-06f, 2.91898123e-07f };
-		if ( material == "H-K5" ) return { 2.25018356f, -0.00894066156f, 0.0114317829f, -7.33393278e-05f, 3.49616695e-05f, -1.80100775e-06f };
-		if ( material == "H-K6" ) return { 2.25024516f, -0.00758714819f, 0.0126303778f, -0.000229001819f, 5.80225939e-05f, -2.84094604e-06f };
-		if ( material == "H-K7" ) return { 2.25978818f, -0.00693885931f, 0.0134488547f, -0.000405904363f, 7.64411122e-05f, -3.51928135e-06f };
-		if ( material == "H-K8" ) return { 2.26289162f, -0.00770544885f, 0.0130033906f, -3.10393046e-05f, 3.16686868e-05f, -1.27242154e-06f };
-		if ( material == "H-K9LGT" ) return { 2.27196941f, -0.00991721869f, 0.0103697525f, 0.000311903798f, -2.64582145e-05f, 1.64750848e-06f };
-		if ( material == "H-K9Lstar" ) return { 2.27196941f, -0.00991721869f, 0.0103697525f, 0.000311903798f, -2.64582145e-05f, 1.64750848e-06f };
-		if ( material == "H-K9L" ) return { 2.27196941f, -0.00991721869f, 0.0103697525f, 0.000311903798f, -2.64582145e-05f, 1.64750848e-06f };
-		if ( material == "H-KF6" ) return { 2.26924681f, -0.0111135716f, 0.010955079f, 0.000811179449f, -7.07180723e-05f, 4.69509667e-06f };
-		if ( material == "H-LAF10LA" ) return { 3.12042876f, -0.0138076336f, 0.0272349388f, 0.000140668568f, 5.42355668e-05f, -1.61404497e-06f };
-		if ( material == "H-LAF1" ) return { 2.81903533f, -0.0164493508f, 0.0136602235f, 0.0024815081f, -0.000258533047f, 1.30918358e-05f };
-		if ( material == "H-LAF2" ) return { 2.87222927f, -0.00570883559f, 0.0292421752f, -0.00146115324f, 0.000252525251f, -1.08672409e-05f };
-		if ( material == "H-LAF3B" ) return { 2.96108042f, -0.00745575504f, 0.029397524f, -0.000709734612f, 0.000179647406f, -7.42813844e-06f };
-		if ( material == "H-LAF4GT" ) return { 2.95612047f, -0.00557678753f, 0.0372582362f, -0.000718686091f, 0.000199998634f, -2.80025194e-06f };
-		if ( material == "H-LAF4" ) return { 2.95612047f, -0.00557678753f, 0.0372582362f, -0.000718686091f, 0.000199998634f, -2.80025194e-06f };
-		if ( material == "H-LAF50B" ) return { 3.07031881f, -0.0135921167f, 0.0258190179f, -1.6644976e-05f, 6.94966225e-05f, -2.88382024e-06f };
-		if ( material == "H-LAF51" ) return { 2.82740564f, -0.0113834621f, 0.0217208712f, 0.000385985738f, 1.31857828e-05f, 6.83783132e-07f };
-		if ( material == "H-LAF52" ) return { 3.10868845f, -0.0135809895f, 0.027901619f, 0.000460094924f, 3.20811469e-05f, -2.81458925e-07f };
-		if ( material == "H-LAF53" ) return { 2.96765171f, -0.0109098989f, 0.0265455309f, -0.000515952248f, 0.000124492897f, -5.16337751e-06f };
-		if ( material == "H-LAF54" ) return { 3.14470202f, -0.010105906f, 0.0343096974f, -0.000833127912f, 0.000217008428f, -8.70147899e-06f };
-		if ( material == "H-LAF55" ) return { 3.01845855f, -0.0104580593f, 0.0288640175f, 0.000697086524f, 6.35741467e-06f, 2.82444289e-06f };
-		if ( material == "H-LAF62" ) return { 2.88929239f, -0.0118090997f, 0.0220839611f, 0.00132896557f, -9.97765672e-05f, 6.8989327e-06f };
-		if ( material == "H-LAF6LA" ) return { 3.01970241f, -0.0158473652f, 0.0227654052f, 0.000979523125f, -6.86654467e-05f, 4.74327269e-06f };
-		if ( material == "H-LAF7" ) return { 3.0798693f, -0.0120988227f, 0.0313371888f, 0.000985836878f, -1.3379864e-05f, 5.4990762e-06f };
-		if ( material == "H-LAFL5" ) return { 2.98452959f, -0.0112966796f, 0.0309775151f, 0.000431829146f, 4.82383023e-05f, 2.94612279e-06f };
-		if ( material == "H-LAK10" ) return { 2.67519359f, -0.00927946143f, 0.018891795f, -0.000239296657f, 7.29098315e-05f, -3.36344313e-06f };
-		if ( material == "H-LAK11" ) return { 2.71757958f, -0.00952801665f, 0.0196309871f, -0.000237384298f, 8.48314788e-05f, -4.09640039e-06f };
-		if ( material == "H-LAK12" ) return { 2.82673774f, -0.0136335725f, 0.0190474212f, 0.000204685509f, 8.81193052e-06f, -2.15937861e-08f };
-		if ( material == "H-LAK1" ) return { 2.70432455f, -0.0100067787f, 0.018102254f, -2.16494884e-05f, 3.81507477e-05f, -1.57874424e-06f };
-		if ( material == "H-LAK2A" ) return { 2.80801074f, -0.0109758888f, 0.0197813052f, 0.000143229802f, 2.39192838e-05f, -7.82772539e-07f };
-		if ( material == "H-LAK3" ) return { 2.98365374f, -0.0123163831f, 0.0255848948f, -0.000570810681f, 0.000147648023f, -7.54741056e-06f };
-		if ( material == "H-LAK4L" ) return { 2.64769834f, -0.0137710798f, 0.015665045f, 9.82676335e-05f, 2.2112348e-05f, -1.07455498e-06f };
-		if ( material == "H-LAK50A" ) return { 2.68411905f, -0.013655729f, 0.0156617129f, 0.00038271126f, -8.02343758e-06f, 1.71633677e-07f };
-		if ( material == "H-LAK51A" ) return { 2.82348938f, -0.0126281485f, 0.0212484444f, -0.000445653258f, 0.0001038003f, -4.7255594e-06f };
-		if ( material == "H-LAK52" ) return { 2.92799279f, -0.0122458967f, 0.0239216813f, -0.000731304876f, 0.000147071309f, -6.91523554e-06f };
-		if ( material == "H-LAK53A" ) return { 3.01460463f, -0.0136968806f, 0.0241031658f, -0.000167588963f, 8.27221505e-05f, -3.77703053e-06f };
-		if ( material == "H-LAK53B" ) return { 3.01623609f, -0.0144609479f, 0.0229095394f, 0.000216967699f, 2.73048039e-05f, -9.80684551e-07f };
-		if ( material == "H-LAK54" ) return { 2.94175946f, -0.0126663226f, 0.0243839518f, -0.000490360525f, 0.000138790487f, -7.39070455e-06f };
-		if ( material == "H-LAK59A" ) return { 2.79972754f, -0.00873189032f, 0.0230159159f, -0.000850193825f, 0.000152864586f, -6.91746601e-06f };
-		if ( material == "H-LAK5A" ) return { 2.76282776f, -0.0110853656f, 0.0190396002f, 5.14224172e-05f, 3.63740807e-05f, -1.55525971e-06f };
-		if ( material == "H-LAK61" ) return { 2.96883578f, -0.0137037464f, 0.0224806873f, 0.00013022706f, 3.52478352e-05f, -1.34827056e-06f };
-		if ( material == "H-LAK67" ) return { 2.7410828f, -0.016285022f, 0.015866919f, 0.0010819231f, -7.7131038e-05f, 4.033333e-06f };
-		if ( material == "H-LAK6A" ) return { 2.81484052f, -0.0147823622f, 0.0190209745f, 0.000336628211f, 1.35687736e-05f, -5.85525604e-07f };
-		if ( material == "H-LAK7A" ) return { 2.87982167f, -0.0147537347f, 0.0188595645f, 0.000746887433f, -6.23723325e-05f, 3.88098485e-06f };
-		if ( material == "H-LAK8A" ) return { 2.89697306f, -0.0143738053f, 0.0222280432f, 0.000105067282f, 5.16989124e-05f, -1.90417816e-06f };
-		if ( material == "H-LAK8B" ) return { 2.8950254f, -0.0117106099f, 0.0225402373f, 0.000146324301f, 4.12272418e-05f, -1.47798073e-06f };
-		if ( material == "H-QF14" ) return { 2.48489196f, -0.00931778798f, 0.0204890803f, 0.000525537026f, -2.39700021e-06f, 4.02659016e-06f };
-		if ( material == "H-QF1" ) return { 2.35209772f, -0.00953088569f, 0.0149480904f, 0.0006139718f, -3.07481422e-05f, 3.26363142e-06f };
-		if ( material == "H-QF3" ) return { 2.42501025f, -0.00862223052f, 0.0193144869f, 0.000210375528f, 3.29751181e-05f, 1.50559094e-06f };
-		if ( material == "H-QF50A" ) return { 2.44404966f, -0.00918670215f, 0.0196254289f, 0.000277356083f, 3.30397755e-05f, 1.33695258e-06f };
-		if ( material == "H-QF56" ) return { 2.40441893f, -0.00857629873f, 0.0176754574f, 0.000438205807f, -1.42198699e-06f, 2.74287911e-06f };
-		if ( material == "H-QF6A" ) return { 2.30458321f, -0.00865226981f, 0.0147424307f, 0.000146916808f, 2.49577574e-05f, 4.79637168e-07f };
-		if ( material == "H-QF8" ) return { 2.32749417f, -0.007674586f, 0.017076264f, -0.000306358071f, 9.60375308e-05f, -3.46437878e-06f };
-		if ( material == "H-QK1" ) return { 2.13732812f, -0.00894176765f, 0.00967010992f, -6.31093115e-05f, 2.62713578e-05f, -1.27152263e-06f };
-		if ( material == "H-QK3L" ) return { 2.18873391f, -0.00969305681f, 0.00915154799f, 6.46567507e-05f, 9.18900583e-06f, -4.71149273e-07f };
-		if ( material == "H-TF3L" ) return { 2.5493446f, -0.012566087f, 0.018232175f, 0.00067809743f, -2.8500371e-05f, 3.2560812e-06f };
-		if ( material == "H-TF5" ) return { 2.66774774f, -0.0123753603f, 0.0236856508f, 0.000348562611f, 4.13195176e-05f, 7.37775936e-07f };
-		if ( material == "H-TF8" ) return { 2.87079347f, -0.0122606251f, 0.029586462f, 0.000868012172f, 6.58046251e-06f, 4.82032902e-06f };
-		if ( material == "H-ZBAF16" ) return { 2.7163405f, -0.00800848114f, 0.0220673585f, -0.000143211774f, 7.67032228e-05f, -2.71338303e-06f };
-		if ( material == "H-ZBAF1" ) return { 2.57943f, -0.00757753047f, 0.0201786053f, -0.000845832798f, 0.000178126935f, -9.19232657e-06f };
-		if ( material == "H-ZBAF20" ) return { 2.82081937f, -0.0100823647f, 0.0255084629f, 0.00032956767f, 5.02565379e-05f, 6.00432403e-07f };
-		if ( material == "H-ZBAF21" ) return { 2.88488353f, -0.00963959047f, 0.029172134f, 0.000302410773f, 5.7628195e-05f, 2.46415353e-06f };
-		if ( material == "H-ZBAF3" ) return { 2.69165216f, -0.0101363344f, 0.0186481237f, 0.000358040785f, 6.16688889e-06f, 5.75545763e-07f };
-		if ( material == "H-ZBAF4" ) return { 2.69163001f, -0.00984427132f, 0.0256830841f, 0.000843697635f, -1.65735681e-05f, 6.7123065e-06f };
-		if ( material == "H-ZBAF50" ) return { 2.69045194f, -0.00736356688f, 0.0226992125f, -0.000794594575f, 0.000161075119f, -6.92969544e-06f };
-		if ( material == "H-ZBAF52" ) return { 2.72624888f, -0.00858990967f, 0.0222509606f, -2.894972e-05f, 6.84239255e-05f, -2.15508588e-06f };
-		if ( material == "H-ZBAF5" ) return { 2.7282151f, -0.00801785321f, 0.0232797778f, -0.000366897021f, 0.000117676258f, -4.64381474e-06f };
-		if ( material == "H-ZF10" ) return { 2.7617586f, -0.011254039f, 0.028221737f, 0.0017540315f, -0.00012127053f, 1.5522384e-05f };
-		if ( material == "H-ZF11" ) return { 2.79257889f, -0.0123189318f, 0.0282213886f, 0.00233803553f, -0.000193264698f, 2.03435598e-05f };
-		if ( material == "H-ZF12" ) return { 2.98833616f, -0.01558083f, 0.0325585737f, 0.00407634444f, -0.000423585266f, 4.04422209e-05f };
-		if ( material == "H-ZF13GT" ) return { 3.05150937f, -0.0123177102f, 0.0421532614f, 0.00181669625f, -2.87661517e-05f, 1.88518506e-05f };
-		if ( material == "H-ZF13" ) return { 3.05150937f, -0.0123177102f, 0.0421532614f, 0.00181669625f, -2.87661517e-05f, 1.88518506e-05f };
-		if ( material == "H-ZF1" ) return { 2.636187f, -0.0097034146f, 0.0255502623f, 0.00100610407f, -4.2521904e-05f, 9.06375385e-06f };
-		if ( material == "H-ZF2" ) return { 2.70748536f, -0.00876853099f, 0.030735315f, 0.000240155352f, 8.93430086e-05f, 3.65229043e-06f };
-		if ( material == "H-ZF39" ) return { 2.69566345f, -0.0106305729f, 0.0263464696f, 0.0012869122f, -6.75605612e-05f, 1.09913394e-05f };
-		if ( material == "H-ZF3" ) return { 2.85722177f, -0.0177283648f, 0.0259634053f, 0.0034434958f, -0.000319318567f, 2.68269122e-05f };
-		if ( material == "H-ZF4AGT" ) return { 2.87667041f, -0.0108521785f, 0.0348454207f, 0.00163571517f, -8.15344316e-05f, 1.79346084e-05f };
-		if ( material == "H-ZF4A" ) return { 2.87667041f, -0.0108521785f, 0.0348454207f, 0.00163571517f, -8.15344316e-05f, 1.79346084e-05f };
-		if ( material == "H-ZF50" ) return { 2.92360946f, -0.0149760388f, 0.03002329f, 0.0038613679f, -0.000421158445f, 3.86612695e-05f };
-		if ( material == "H-ZF52A" ) return { 3.2506862f, -0.0133942217f, 0.0483625913f, 0.00314442751f, -0.000197073674f, 3.47645679e-05f };
-		if ( material == "H-ZF52GT" ) return { 3.26760058f, -0.0205384566f, 0.0351507672f, 0.00770151348f, -0.000908139817f, 7.52649555e-05f };
-		if ( material == "H-ZF52TT" ) return { 3.26760058f, -0.0205384566f, 0.0351507672f, 0.00770151348f, -0.000908139817f, 7.52649555e-05f };
-		if ( material == "H-ZF52" ) return { 3.26760058f, -0.0205384566f, 0.0351507672f, 0.00770151348f, -0.000908139817f, 7.52649555e-05f };
-		if ( material == "H-ZF5" ) return { 2.91358387f, -0.0105930316f, 0.0366349235f, 0.00134643008f, -3.4696778e-05f, 1.5917092e-05f };
-		if ( material == "H-ZF62" ) return { 3.50341992f, -0.0191891965f, 0.0536641379f, 0.00664979774f, -0.000678415522f, 8.33179504e-05f };
-		if ( material == "H-ZF6" ) return { 2.9632067f, -0.0121274947f, 0.0364365808f, 0.00212579927f, -0.000130100151f, 2.14141061e-05f };
-		if ( material == "H-ZF71" ) return { 3.12457417f, -0.0184343398f, 0.0395426536f, 0.0055116689f, -0.000577885043f, 6.1110918e-05f };
-		if ( material == "H-ZF72A" ) return { 3.49933112f, -0.0270915729f, 0.0477045173f, 0.0109646331f, -0.00132276177f, 0.000133630751f };
-		if ( material == "H-ZF7LAGT" ) return { 3.11930169f, -0.0120954989f, 0.0427579381f, 0.00249825483f, -0.000116785147f, 2.28047853e-05f };
-		if ( material == "H-ZF7LA" ) return { 3.11930169f, -0.0120954989f, 0.0427579381f, 0.00249825483f, -0.000116785147f, 2.28047853e-05f };
-		if ( material == "H-ZF88" ) return { 3.57552387f, -0.0303712686f, 0.0482363566f, 0.013150654f, -0.00163641867f, 0.000162274903f };
-		if ( material == "H-ZK10L" ) return { 2.5987875f, -0.01767092f, 0.011069609f, 0.0013151858f, -0.00010779203f, 4.5458961e-06f };
-		if ( material == "H-ZK10" ) return { 2.5840705f, -0.0087264109f, 0.017569665f, -0.00030815451f, 8.8794888e-05f, -4.7409985e-06f };
-		if ( material == "H-ZK11" ) return { 2.6370236f, -0.010212072f, 0.017024722f, 0.00021432422f, 7.4387689e-06f, 4.3580605e-07f };
-		if ( material == "H-ZK14" ) return { 2.53022442f, -0.0101985443f, 0.0142843974f, 0.000253350969f, -1.29976369e-05f, 1.10420609e-06f };
-		if ( material == "H-ZK1" ) return { 2.42695876f, -0.0107508507f, 0.012802243f, 9.25440065e-05f, 1.33568132e-05f, -5.38892285e-07f };
-		if ( material == "H-ZK20" ) return { 2.56416217f, -0.00663710078f, 0.0191195924f, -0.000520583562f, 0.000117796641f, -5.72026705e-06f };
-		if ( material == "H-ZK21" ) return { 2.59019466f, -0.0103261557f, 0.0158597885f, 0.000158705075f, 8.97501936e-06f, -9.7736858e-08f };
-		if ( material == "H-ZK2" ) return { 2.46852235f, -0.0101871678f, 0.0133916752f, 0.000329060714f, -1.21986536e-05f, 6.59142401e-07f };
-		if ( material == "H-ZK3A" ) return { 2.48635025f, -0.00969802289f, 0.0145444434f, -6.42693019e-05f, 3.4793343e-05f, -1.53631738e-06f };
-		if ( material == "H-ZK3" ) return { 2.48804118f, -0.0104146168f, 0.0133178501f, 0.000319390239f, -1.887969e-05f, 1.1928548e-06f };
-		if ( material == "H-ZK4" ) return { 2.54489747f, -0.00883488409f, 0.0159113795f, -5.14042928e-05f, 3.62073286e-05f, -1.50010238e-06f };
-		if ( material == "H-ZK50GT" ) return { 2.54140617f, -0.00972103422f, 0.0143707512f, 0.000594894245f, -4.88938359e-05f, 2.80646352e-06f };
-		if ( material == "H-ZK50" ) return { 2.54140617f, -0.00972103422f, 0.0143707512f, 0.000594894245f, -4.88938359e-05f, 2.80646352e-06f };
-		if ( material == "H-ZK5" ) return { 2.54498193f, -0.00576275042f, 0.0196014743f, -0.000812786508f, 0.000138354802f, -6.16579204e-06f };
-		if ( material == "H-ZK6" ) return { 2.55828763f, -0.00978781657f, 0.0153557077f, 0.000130481426f, 1.76143611e-05f, -7.13242444e-07f };
-		if ( material == "H-ZK7" ) return { 2.56229558f, -0.0108844706f, 0.0140997791f, 0.000379257039f, -2.41612681e-05f, 1.41616214e-06f };
-		if ( material == "H-ZK8" ) return { 2.55701495f, -0.00765926112f, 0.0176261795f, -0.0002049981f, 6.81299541e-05f, -3.07368383e-06f };
-		if ( material == "H-ZK9A" ) return { 2.58407802f, -0.0111281379f, 0.0154281597f, 2.64033929e-05f, 2.77466467e-05f, -1.24493904e-06f };
-		if ( material == "H-ZK9B" ) return { 2.5813755f, -0.00958578041f, 0.0171950468f, -0.000507547344f, 0.000101126924f, -4.80045747e-06f };
-		if ( material == "H-ZLAF1" ) return { 3.16228962f, -0.014206768f, 0.0294595374f, 0.000212856988f, 6.58725595e-05f, -1.65992623e-06f };
-		if ( material == "H-ZLAF2A" ) return { 3.16963751f, -0.0138628788f, 0.0288233041f, -1.62994843e-05f, 8.61841046e-05f, -3.37002982e-06f };
-		if ( material == "H-ZLAF3" ) return { 3.33260614f, -0.0142217301f, 0.0366299952f, 0.00102037909f, -3.17481272e-06f, 5.76556277e-06f };
-		if ( material == "H-ZLAF4LA" ) return { 3.52200128f, -0.0121473151f, 0.0435909987f, 0.000593247086f, 8.40620002e-05f, 2.27233268e-06f };
-		if ( material == "H-ZLAF50D" ) return { 3.17122941f, -0.0123809285f, 0.0303628745f, -0.000417232894f, 0.000142630066f, -6.197583e-06f };
-		if ( material == "H-ZLAF50E" ) return { 3.17475472f, -0.0138702913f, 0.0278405909f, 0.000351405611f, 4.08115849e-05f, -1.46429081e-06f };
-		if ( material == "H-ZLAF51" ) return { 3.16163938f, -0.0127262423f, 0.0325482205f, 0.000373836955f, 6.46085816e-05f, 7.28177708e-08f };
-		if ( material == "H-ZLAF52A" ) return { 3.16845789f, -0.0114753166f, 0.0326408875f, 9.57006606e-05f, 9.63026379e-05f, -2.45219866e-06f };
-		if ( material == "H-ZLAF52" ) return { 3.16943454f, -0.0124379117f, 0.0322101116f, 0.000181456299f, 8.90652926e-05f, -1.91933145e-06f };
-		if ( material == "H-ZLAF53BGT" ) return { 3.25780649f, -0.0123377843f, 0.0355171622f, 0.000705690228f, 4.3498733e-05f, 1.95613611e-06f };
-		if ( material == "H-ZLAF53B" ) return { 3.25780649f, -0.0123377843f, 0.0355171622f, 0.000705690228f, 4.3498733e-05f, 1.95613611e-06f };
-		if ( material == "H-ZLAF55C" ) return { 3.27170954f, -0.0126721575f, 0.0335300924f, -2.4910401e-05f, 0.00010247728f, -2.87496464e-06f };
-		if ( material == "H-ZLAF55D" ) return { 3.27258827f, -0.0129423515f, 0.032844328f, 0.000183315988f, 7.64020197e-05f, -1.75379429e-06f };
-		if ( material == "H-ZLAF56B" ) return { 3.14933428f, -0.0111549297f, 0.0375191596f, 0.000787288786f, 2.9727118e-05f, 7.44861477e-06f };
-		if ( material == "H-ZLAF66GT" ) return { 3.13578304f, -0.0105336277f, 0.0366011503f, 0.000398524293f, 7.65525829e-05f, 3.24358098e-06f };
-		if ( material == "H-ZLAF66" ) return { 3.13578304f, -0.0105336277f, 0.0366011503f, 0.000398524293f, 7.65525829e-05f, 3.24358098e-06f };
-		if ( material == "H-ZLAF68B" ) return { 3.43418261f, -0.0106199538f, 0.0400046303f, -0.000637942235f, 0.000216353029f, -8.49876445e-06f };
-		if ( material == "H-ZLAF68C" ) return { 3.4376406f, -0.0115726315f, 0.0371406216f, 0.000330923804f, 7.3366651e-05f, -1.36270312e-06f };
-		if ( material == "H-ZLAF68N" ) return { 3.43465461f, -0.0126976179f, 0.0380366168f, 0.000397530666f, 8.03440262e-05f, -6.06964244e-07f };
-		if ( material == "H-ZLAF69" ) return { 3.2148109f, -0.012992517f, 0.029243707f, 0.00018800218f, 5.7106547e-05f, -1.9571482e-06f };
-		if ( material == "H-ZLAF71" ) return { 3.30457034f, -0.0157032075f, 0.0374207147f, 0.00217455908f, -0.000149305709f, 1.85063226e-05f };
-		if ( material == "H-ZLAF75A" ) return { 3.48751324f, -0.0149732265f, 0.0432288095f, 0.00210592206f, -0.000100284898f, 1.62326633e-05f };
-		if ( material == "H-ZLAF75B" ) return { 3.48346668f, -0.0133305235f, 0.046504237f, 0.00100655469f, 5.58112511e-05f, 7.97155171e-06f };
-		if ( material == "H-ZLAF76" ) return { 3.29759774f, -0.0171679311f, 0.0386912114f, 0.00268188761f, -0.00020390322f, 2.43325022e-05f };
-		if ( material == "H-ZLAF78B" ) return { 3.49322693f, -0.0132987683f, 0.0400277433f, 0.000823139853f, 3.93075178e-05f, 2.86901814e-06f };
-		if ( material == "H-ZLAF89L" ) return { 3.66932806f, -0.0136919991f, 0.0484216361f, 0.00132160482f, 2.4217258e-05f, 8.50124351e-06f };
-		if ( material == "H-ZLAF90" ) return { 3.81589583f, -0.0188810016f, 0.0545200672f, 0.00508907678f, -0.000444175735f, 5.0454684e-05f };
-		if ( material == "H-ZLAF92" ) return { 3.83592109f, -0.0155216804f, 0.0558392182f, 0.0025842306f, -9.64328404e-05f, 2.26279197e-05f };
-		if ( material == "H-ZPK1A" ) return { 2.57612635f, -0.00780401598f, 0.0152465014f, -2.0774016e-05f, 2.28544414e-05f, -8.23333227e-07f };
-		if ( material == "H-ZPK2A" ) return { 2.53073192f, -0.0083442991f, 0.0146551845f, -0.000216647389f, 5.35525389e-05f, -2.46158263e-06f };
-		if ( material == "H-ZPK3" ) return { 2.50355665f, -0.00956011816f, 0.0134870279f, -0.000107119645f, 3.74651897e-05f, -1.78002982e-06f };
-		if ( material == "H-ZPK5" ) return { 2.50010619f, -0.00601517032f, 0.0134084346f, -5.81410931e-05f, 3.0979864e-05f, -1.43396992e-06f };
-		if ( material == "K4A" ) return { 2.24187488f, -0.00891932146f, 0.0126251741f, -0.000298598739f, 5.95648836e-05f, -2.58633231e-06f };
-		if ( material == "QF1" ) return { 2.3504951f, -0.0086857021f, 0.016092857f, 0.00018705912f, 4.2149581e-05f, -1.3216062e-06f };
-		if ( material == "QF3" ) return { 2.4245509f, -0.0079714057f, 0.019149892f, 0.00035505098f, 1.3941882e-05f, 1.705772e-06f };
-		if ( material == "QF50" ) return { 2.4427964f, -0.00775720479f, 0.0201147743f, 0.000157059447f, 5.32738337e-05f, -6.98910829e-07f };
-		if ( material == "QF5" ) return { 2.4440594f, -0.0067974631f, 0.021425387f, -0.00038544649f, 0.00012195244f, -4.2162236e-06f };
-		if ( material == "QF6" ) return { 2.3044884f, -0.0083782321f, 0.014424342f, 0.00033374311f, -4.4657456e-06f, 1.3349929e-06f };
-		if ( material == "QF8" ) return { 2.3287431f, -0.00786798f, 0.015763854f, 0.00019794235f, 1.8002892e-05f, 3.6533474e-07f };
-		if ( material == "TF3" ) return { 2.54141593f, -0.0106607788f, 0.021716721f, -0.000401848477f, 0.000122475727f, -4.7776413e-06f };
-		if ( material == "ZBAF17" ) return { 2.7114815f, -0.0083031047f, 0.023733195f, 0.00028197729f, 3.9409899e-05f, 7.1756265e-07f };
-		if ( material == "ZBAF2" ) return { 2.6324147f, -0.0087251762f, 0.019124302f, 0.00044859331f, -1.7473295e-05f, 2.8601145e-06f };
-		if ( material == "ZBAF51" ) return { 2.7590164f, -0.0058180526f, 0.026609946f, -0.00075485994f, 0.00017640459f, -6.7271173e-06f };
-		if ( material == "ZF10" ) return { 2.75929053f, -0.00920455833f, 0.0293164338f, 0.00148740799f, -7.05223488e-05f, 9.9538848e-06f };
-		if ( material == "ZF11" ) return { 2.7906689f, -0.010644977f, 0.029071854f, 0.0021286607f, -0.00015815625f, 1.7145247e-05f };
-		if ( material == "ZF12" ) return { 2.99506991f, -0.0165672521f, 0.0256701429f, 0.00670445128f, -0.000837476647f, 6.26402774e-05f };
-		if ( material == "ZF13" ) return { 3.06161235f, -0.0145895142f, 0.0328146593f, 0.00523989954f, -0.000560505494f, 4.64234125e-05f };
-		if ( material == "ZF1" ) return { 2.6356161f, -0.008839642f, 0.025644781f, 0.00096522374f, -1.8304798e-05f, 5.5563517e-06f };
-		if ( material == "ZF2" ) return { 2.70820441f, -0.00794171159f, 0.0292224783f, 0.000884931615f, 6.6862056e-07f, 5.65902766e-06f };
-		if ( material == "ZF3" ) return { 2.84758519f, -0.0105088281f, 0.0309450925f, 0.00213696398f, -0.00013104012f, 1.42428874e-05f };
-		if ( material == "ZF4" ) return { 2.89234898f, -0.0179339416f, 0.0230094722f, 0.00563906172f, -0.000698154951f, 5.25289979e-05f };
-		if ( material == "ZF50" ) return { 2.9228084f, -0.013029549f, 0.029540007f, 0.0041308365f, -0.00044721542f, 3.7137603e-05f };
-		if ( material == "ZF51" ) return { 3.06187076f, -0.0138733563f, 0.032985222f, 0.00507141578f, -0.000538606629f, 4.36089245e-05f };
-		if ( material == "ZF52" ) return { 3.242645f, -0.00779545833f, 0.0533808621f, 0.00151154152f, 7.22194744e-05f, 1.6602659e-05f };
-		if ( material == "ZF5" ) return { 2.9160432f, -0.010435647f, 0.033907872f, 0.0022728802f, -0.00013563213f, 1.6527592e-05f };
-		if ( material == "ZF6" ) return { 2.96285995f, -0.0104077823f, 0.0356441238f, 0.00245699205f, -0.000149615893f, 1.77827751e-05f };
-		if ( material == "ZF7LGT" ) return { 3.11724527f, -0.00977958678f, 0.0431752564f, 0.00252279577f, -0.00011739974f, 2.07881157e-05f };
-		if ( material == "ZF7L" ) return { 3.11724527f, -0.00977958678f, 0.0431752564f, 0.00252279577f, -0.00011739974f, 2.07881157e-05f };
-		if ( material == "ZF7" ) return { 3.1221966f, -0.010649791f, 0.042191871f, 0.002893766f, -0.00016523594f, 2.329181e-05f };
-		if ( material == "ZF8" ) return { 2.6567173f, -0.0091117044f, 0.025815197f, 0.0011203564f, -4.1066817e-05f, 6.9242011e-06f };
-		if ( material == "K-BaF8" ) return { 2.5830562f, -0.01131971f, 0.018817464f, 0.00027063309f, 2.1527561e-05f, 7.7761941e-07f };
-		if ( material == "K-BaF9" ) return { 2.6455399f, -0.010990833f, 0.018955207f, 0.00040800743f, 9.934634e-06f, 9.3197902e-07f };
-		if ( material == "K-BaFn1" ) return { 2.7669297f, -0.011669996f, 0.02151984f, 0.00070810281f, -2.495822e-05f, 3.7747946e-06f };
-		if ( material == "K-BaFn3" ) return { 2.7128944f, -0.010619935f, 0.019653632f, 0.00040051165f, 1.1626539e-06f, 1.1579589e-06f };
-		if ( material == "K-BaSF4" ) return { 2.6590501f, -0.011944106f, 0.02185629f, 0.0011761807f, -7.8567029e-05f, 8.1413835e-06f };
-		if ( material == "K-BaSF5" ) return { 2.5165762f, -0.01183779f, 0.017631594f, 0.00095834052f, -6.7623905e-05f, 6.2543393e-06f };
-		if ( material == "K-BK7" ) return { 2.2705778f, -0.010059376f, 0.010414999f, 0.00028872517f, -2.2214495e-05f, 1.4258559e-06f };
-		if ( material == "K-BOC20" ) return { 3.8410887f, -0.015801048f, 0.055983447f, 0.0030905124f, -0.00016655999f, 2.7794823e-05f };
-		if ( material == "K-BOC30" ) return { 3.8354813f, -0.015056123f, 0.060329996f, 0.002453809f, 1.7392287e-05f, 1.7174222e-05f };
-		if ( material == "K-BPG2" ) return { 2.3909284f, -0.0090241173f, 0.014036614f, 0.00033108428f, -9.985229e-06f, 1.1070906e-06f };
-		if ( material == "K-CaFK95(M)" ) return { 2.0377918f, -0.0045854882f, 0.0057460341f, 0.00014824175f, -1.2924899e-05f, 6.7640906e-07f };
-		if ( material == "K-CaFK95" ) return { 2.0408226f, -0.0045471403f, 0.0058631038f, 0.00012966471f, -1.1902639e-05f, 6.9279944e-07f };
-		if ( material == "K-CD120(M)" ) return { 2.8398034f, -0.011893586f, 0.03115793f, 0.0018504658f, -0.00010451266f, 1.6018658e-05f };
-		if ( material == "K-CD120" ) return { 2.8630662f, -0.011977981f, 0.032706279f, 0.0016821116f, -7.4783483e-05f, 1.4696883e-05f };
-		if ( material == "K-CD45(M)" ) return { 2.7618542f, -0.011387611f, 0.02681912f, 0.0011728044f, -3.975188e-05f, 8.2439775e-06f };
-		if ( material == "K-CD45" ) return { 2.780768f, -0.011432782f, 0.02823867f, 0.0009260712f, 5.9615098e-06f, 5.5996227e-06f };
-		if ( material == "K-CSK120(M)" ) return { 2.4722418f, -0.01073376f, 0.013736108f, 0.00027440551f, -9.8995396e-06f, 8.2295122e-07f };
-		if ( material == "K-CSK120" ) return { 2.4804566f, -0.01071977f, 0.0135632f, 0.00034918608f, -2.3041786e-05f, 1.5937217e-06f };
-		if ( material == "K-FIR97UV" ) return { 2.0169979f, -0.0038361684f, 0.0058184635f, 4.503131e-05f, 6.6434463e-07f, 5.0922311e-09f };
-		if ( material == "K-FIR98UV" ) return { 2.0158016f, -0.0038179076f, 0.0058067887f, 4.2558748e-05f, 7.6622455e-07f, 1.6716816e-09f };
-		if ( material == "K-FK5" ) return { 2.189197f, -0.0097642231f, 0.0086917382f, 0.00023646623f, -1.7699987e-05f, 9.6989631e-07f };
-		if ( material == "K-GFK68(M)" ) return { 2.4921178f, -0.0059252429f, 0.012541311f, 0.00020379328f, -3.7798198e-06f, 2.5829936e-07f };
-		if ( material == "K-GFK68" ) return { 2.4994867f, -0.0059285872f, 0.012743526f, 0.00015469636f, 3.9947612e-06f, -1.760356e-07f };
-		if ( material == "K-GFK70(M)" ) return { 2.4208616f, -0.0057307899f, 0.011396384f, 0.00014964607f, 3.8084377e-06f, -3.2734834e-07f };
-		if ( material == "K-GFK70" ) return { 2.4293935f, -0.0057591097f, 0.011512013f, 0.0001324924f, 7.3250033e-06f, -5.7195445e-07f };
-		if ( material == "K-GIR140" ) return { 2.9854628f, -0.0065859032f, 0.026407911f, 0.00084695423f, -3.2505558e-05f, 3.1878545e-06f };
-		if ( material == "K-GIR79" ) return { 3.3195074f, -0.0085801253f, 0.039978521f, 0.0014465322f, -3.0453007e-05f, 7.8005005e-06f };
-		if ( material == "K-LaF2" ) return { 2.969235f, -0.01236657f, 0.024178838f, 0.00087063153f, -4.4196612e-05f, 4.4742987e-06f };
-		if ( material == "K-LaFK50(M)" ) return { 3.0568421f, -0.011998981f, 0.024194996f, 0.0004815051f, 2.2084112e-06f, 4.3040075e-07f };
-		if ( material == "K-LaFK50T(M)" ) return { 3.0365333f, -0.012640924f, 0.023542665f, 0.00054022154f, 3.5952261e-06f, -3.549746e-07f };
-		if ( material == "K-LaFK50T" ) return { 3.0499602f, -0.012620328f, 0.023782461f, 0.00047558583f, 1.3668355e-05f, -8.9484311e-07f };
-		if ( material == "K-LaFK50" ) return { 3.070131f, -0.012037535f, 0.023978866f, 0.00056153238f, -1.0529871e-05f, 1.1710915e-06f };
-		if ( material == "K-LaFK55(M)" ) return { 2.8008078f, -0.013188685f, 0.01809632f, 0.00040852782f, -1.2855113e-05f, 1.0513058e-06f };
-		if ( material == "K-LaFK55" ) return { 2.8185206f, -0.013230603f, 0.018037587f, 0.00045589602f, -2.131672e-05f, 1.5724724e-06f };
-		if ( material == "K-LaFK58(M)" ) return { 2.8101512f, -0.012726602f, 0.017535146f, 0.00035913422f, -8.8851874e-06f, 6.1852602e-07f };
-		if ( material == "K-LaFK58" ) return { 2.8262394f, -0.012783119f, 0.017254526f, 0.00043487714f, -1.9342271e-05f, 1.18082e-06f };
-		if ( material == "K-LaFK60(M)" ) return { 2.6117274f, -0.01021392f, 0.014472638f, 0.00020938021f, 2.8785693e-06f, -9.063171e-08f };
-		if ( material == "K-LaFK60" ) return { 2.6248172f, -0.010251149f, 0.0143793f, 0.00024017461f, -1.041901e-06f, 1.0237991e-07f };
-		if ( material == "K-LaFK65(M)" ) return { 2.6875081f, -0.011599607f, 0.015290297f, 0.00024225647f, 4.1061121e-06f, -2.0740076e-07f };
-		if ( material == "K-LaFK65" ) return { 2.7016579f, -0.011617767f, 0.015597681f, 0.00019111207f, 1.132323e-05f, -5.9630893e-07f };
-		if ( material == "K-LaFn11" ) return { 2.8917009f, -0.011920903f, 0.022558933f, 0.00079204231f, -4.0820426e-05f, 4.1373045e-06f };
-		if ( material == "K-LaFn3" ) return { 2.827081f, -0.010220727f, 0.021224097f, 0.0006653956f, -3.3316539e-05f, 3.16429e-06f };
-		if ( material == "K-LaFn5" ) return { 2.9746618f, -0.015490396f, 0.021676376f, 0.0007907947f, -3.5069226e-05f, 2.1235401e-06f };
-		if ( material == "K-LaK10" ) return { 2.8960747f, -0.011713123f, 0.021599254f, 0.00043811038f, 5.752903e-06f, -1.7364157e-07f };
-		if ( material == "K-LaK11" ) return { 2.703071f, -0.011555097f, 0.016440907f, 0.00044044678f, -2.1866961e-05f, 1.3531002e-06f };
-		if ( material == "K-LaK12" ) return { 2.7644388f, -0.011785176f, 0.017957173f, 0.00034733134f, 3.6439617e-06f, -3.286378e-07f };
-		if ( material == "K-LaK14" ) return { 2.8277206f, -0.013838479f, 0.0179847f, 0.00057777884f, -3.7712827e-05f, 2.2935918e-06f };
-		if ( material == "K-LaK18" ) return { 2.9333796f, -0.014920134f, 0.020207432f, 0.00041238589f, -1.230332e-05f, 1.1436994e-06f };
-		if ( material == "K-LaK6" ) return { 2.6532657f, -0.011570116f, 0.015955637f, 0.00023811283f, 1.7165459e-05f, -1.4129709e-06f };
-		if ( material == "K-LaK7" ) return { 2.6835737f, -0.012086498f, 0.015193489f, 0.00064847987f, -5.2423893e-05f, 2.8301452e-06f };
-		if ( material == "K-LaK8" ) return { 2.8797142f, -0.015009518f, 0.01933782f, 0.00048379963f, -1.1367908e-05f, 7.0484275e-07f };
-		if ( material == "K-LaK9" ) return { 2.8065086f, -0.012084694f, 0.018509723f, 0.00045689652f, -1.5275984e-05f, 1.0018509e-06f };
-		if ( material == "K-LaKn11" ) return { 2.6994624f, -0.011441236f, 0.017672891f, 0.00039604649f, -3.5739234e-06f, 7.0861608e-07f };
-		if ( material == "K-LaKn14" ) return { 2.9713549f, -0.015047149f, 0.020748381f, 0.00068239287f, -4.5897244e-05f, 3.0151479e-06f };
-		if ( material == "K-LaKn2" ) return { 2.6498456f, -0.013078949f, 0.014887079f, 0.0003621869f, -1.1506273e-05f, 6.1300945e-07f };
-		if ( material == "K-LaKn4" ) return { 2.744955f, -0.013026744f, 0.016661518f, 0.00048278001f, -2.5815825e-05f, 1.5241247e-06f };
-		if ( material == "K-LaKn5" ) return { 2.6761221f, -0.012108757f, 0.016143507f, 0.00051920927f, -2.8395319e-05f, 1.8554978e-06f };
-		if ( material == "K-LaKn7" ) return { 2.735741f, -0.011476747f, 0.017975035f, 0.00072020288f, -5.1933951e-05f, 3.5980087e-06f };
-		if ( material == "K-LaSFn10" ) return { 3.2128137f, -0.015587464f, 0.028249299f, 0.00086439607f, -2.9175496e-05f, 2.9912535e-06f };
-		if ( material == "K-LaSFn14" ) return { 3.2643191f, -0.016265121f, 0.03202838f, 0.0015271854f, -4.7775544e-05f, 5.7345907e-06f };
-		if ( material == "K-LaSFn16" ) return { 3.124535f, -0.014985014f, 0.024795878f, 0.00096271556f, -6.4587038e-05f, 4.6162437e-06f };
-		if ( material == "K-LaSFn17" ) return { 3.4434117f, -0.015474743f, 0.033695975f, 0.0012878574f, -4.547423e-05f, 3.867959e-06f };
-		if ( material == "K-LaSFn1" ) return { 3.1704478f, -0.012872124f, 0.030711328f, 0.00091467552f, -4.2179151e-05f, 5.885503e-06f };
-		if ( material == "K-LaSFn21" ) return { 3.3040338f, -0.016019748f, 0.037645989f, 0.0021532464f, -0.00020498123f, 2.7623217e-05f };
-		if ( material == "K-LaSFn22" ) return { 3.477103f, -0.01493764f, 0.040192699f, 0.0018404932f, -0.00010009344f, 1.4346776e-05f };
-		if ( material == "K-LaSFn23" ) return { 3.527437f, -0.014640706f, 0.040393831f, 0.0015495078f, -4.5667249e-05f, 9.0971269e-06f };
-		if ( material == "K-LaSFn2" ) return { 3.1666472f, -0.014823032f, 0.030366123f, 0.0010942894f, -4.2108569e-05f, 5.7186779e-06f };
-		if ( material == "K-LaSFn3" ) return { 3.1507226f, -0.012460963f, 0.029910697f, 0.00050733106f, 3.6278868e-05f, -2.5019766e-08f };
-		if ( material == "K-LaSFn4" ) return { 3.1049984f, -0.013342479f, 0.027506526f, 0.00075451621f, -1.6565687e-05f, 2.780481e-06f };
-		if ( material == "K-LaSFn6" ) return { 3.1766024f, -0.015214563f, 0.026674405f, 0.00074674513f, -2.63508e-05f, 2.7514981e-06f };
-		if ( material == "K-LaSFn7" ) return { 3.0728806f, -0.014815338f, 0.024064142f, 0.00049961497f, 1.2852807e-06f, 5.2262074e-07f };
-		if ( material == "LASFN7" ) return { 3.0728806f, -0.014815338f, 0.024064142f, 0.00049961497f, 1.2852807e-06f, 5.2262074e-07f };
-		if ( material == "K-LaSFn8" ) return { 3.2767321f, -0.015115573f, 0.030753445f, 0.00078350578f, -3.4594495e-06f, 2.0542573e-06f };
-		if ( material == "K-LaSFn9" ) return { 3.2184433f, -0.014906369f, 0.02692619f, 0.00087409748f, -4.0331281e-05f, 3.1677745e-06f };
-		if ( material == "K-LaSKn1" ) return { 3.0176028f, -0.01512239f, 0.021959514f, 0.00052144528f, -1.8693935e-05f, 1.6369365e-06f };
-		if ( material == "K-LCV93(M)" ) return { 2.710346f, -0.012314299f, 0.019185803f, 0.00080136306f, -5.2048587e-05f, 3.7543007e-06f };
-		if ( material == "K-LCV93" ) return { 2.7157014f, -0.012306139f, 0.019299156f, 0.00076108019f, -4.4909824e-05f, 3.3413499e-06f };
-		if ( material == "K-PBK40(M)" ) return { 2.2666695f, -0.010697246f, 0.010455014f, 0.00024731938f, -9.4216199e-06f, 3.3360125e-07f };
-		if ( material == "K-PBK40" ) return { 2.2744024f, -0.01070289f, 0.010577306f, 0.00022857431f, -7.2914225e-06f, 2.4124054e-07f };
-		if ( material == "K-PBK50(M)" ) return { 2.2812358f, -0.010469171f, 0.010938493f, 0.00025045867f, -1.2796276e-05f, 7.9827772e-07f };
-		if ( material == "K-PBK50" ) return { 2.2879519f, -0.010513752f, 0.010963175f, 0.00027027054f, -1.7054549e-05f, 1.0857039e-06f };
-		if ( material == "K-PFK80(M)" ) return { 2.212796f, -0.0056313014f, 0.0083136801f, 0.00015790111f, -1.2884506e-05f, 8.4786533e-07f };
-		if ( material == "K-PFK80" ) return { 2.2178347f, -0.0055966846f, 0.0083703747f, 0.0001097485f, -3.3983937e-06f, 2.5836351e-07f };
-		if ( material == "K-PFK85(M)" ) return { 2.180434f, -0.0050369414f, 0.007415342f, 0.000191031f, -1.3017551e-05f, 6.1457339e-07f };
-		if ( material == "K-PFK85" ) return { 2.1858326f, -0.0050155632f, 0.0075107775f, 0.00017770562f, -1.2164148e-05f, 6.1341005e-07f };
-		if ( material == "K-PFK90(M)" ) return { 2.1052634f, -0.0048076047f, 0.0067206257f, 8.8399512e-05f, -3.9955764e-08f, -6.7493689e-08f };
-		if ( material == "K-PFK90" ) return { 2.1094643f, -0.0048026812f, 0.0067645351f, 8.3329962e-05f, 3.4196126e-07f, -8.4933854e-08f };
-		if ( material == "K-PG325(M)" ) return { 2.2385136f, -0.0070158219f, 0.0095692073f, 0.00018606584f, -8.4285475e-06f, 5.3174439e-07f };
-		if ( material == "K-PG325" ) return { 2.2433502f, -0.0070443238f, 0.0095932746f, 0.00019364616f, -9.8585539e-06f, 6.1088785e-07f };
-		if ( material == "K-PG375(M)" ) return { 2.3359595f, -0.0077028465f, 0.011800095f, 0.00020814746f, -3.5241725e-06f, 3.1241519e-07f };
-		if ( material == "K-PG375" ) return { 2.345943f, -0.0077317211f, 0.011783664f, 0.00025239185f, -1.2352344e-05f, 8.7540057e-07f };
-		if ( material == "K-PG395(M)" ) return { 2.6598043f, -0.0097241142f, 0.023341531f, 0.0010595162f, -4.9515252e-05f, 7.5464331e-06f };
-		if ( material == "K-PG395" ) return { 2.6754764f, -0.0097406258f, 0.023844634f, 0.00098091134f, -3.8466006e-05f, 6.9920317e-06f };
-		if ( material == "K-PMK30(M)" ) return { 2.2835931f, -0.0098380554f, 0.010317986f, -3.5867157e-06f, 2.1079335e-05f, -1.145809e-06f };
-		if ( material == "K-PMK30" ) return { 2.2984199f, -0.0098977917f, 0.010454435f, -1.1762246e-05f, 2.220678e-05f, -1.2212713e-06f };
-		if ( material == "K-PSFn173(M)" ) return { 4.2616161f, -0.013994195f, 0.095197887f, 0.0078651735f, -0.00053525936f, 0.00012395474f };
-		if ( material == "K-PSFn173" ) return { 4.2785429f, -0.014012371f, 0.096019323f, 0.0077567166f, -0.00051560398f, 0.00012285966f };
-		if ( material == "K-PSFn1(M)" ) return { 3.418365f, -0.015830577f, 0.056024892f, 0.0042907055f, -0.00027089374f, 4.8560287e-05f };
-		if ( material == "K-PSFn1" ) return { 3.4407637f, -0.015750622f, 0.059024249f, 0.0035647556f, -0.00012641103f, 4.0309245e-05f };
-		if ( material == "K-PSFn202(M)" ) return { 3.8290543f, -0.016470594f, 0.065112852f, 0.0059865818f, -0.00053116084f, 7.8076366e-05f };
-		if ( material == "K-PSFn202" ) return { 3.8508789f, -0.016529344f, 0.066096066f, 0.0058480521f, -0.0005055984f, 7.6558669e-05f };
-		if ( material == "K-PSFn203(M)" ) return { 3.812992f, -0.016672868f, 0.067171636f, 0.0057116528f, -0.00042822929f, 7.1278944e-05f };
-		if ( material == "K-PSFn203" ) return { 3.8348467f, -0.016749417f, 0.068052702f, 0.0056319146f, -0.00041721893f, 7.0964768e-05f };
-		if ( material == "K-PSFn214(M)" ) return { 4.2564848f, -0.015091057f, 0.086600358f, 0.011001775f, -0.0012680564f, 0.00017404024f };
-		if ( material == "K-PSFn214" ) return { 4.2741747f, -0.015216929f, 0.086704477f, 0.011238379f, -0.0013209006f, 0.00017823575f };
-		if ( material == "K-PSFn215" ) return { 4.2994108f, -0.014091413f, 0.097855062f, 0.0076857652f, -0.00046786841f, 0.00012218724f };
-		if ( material == "K-PSFn2(M)" ) return { 3.7527514f, -0.013079452f, 0.07043447f, 0.0041015753f, -0.00012706916f, 4.6413732e-05f };
-		if ( material == "K-PSFn2" ) return { 3.7699503f, -0.013004151f, 0.072310519f, 0.0035123072f, -1.0361594e-05f, 3.8615781e-05f };
-		if ( material == "K-PSFn3(M)" ) return { 3.2096325f, -0.014576663f, 0.046141656f, 0.0029954432f, -0.00015107775f, 3.0074532e-05f };
-		if ( material == "K-PSFn3" ) return { 3.2268914f, -0.014590158f, 0.047763869f, 0.0027173637f, -9.5689164e-05f, 2.7097845e-05f };
-		if ( material == "K-PSFn4(M)" ) return { 3.2298971f, -0.011389181f, 0.047192351f, 0.0024487094f, -6.4886719e-05f, 2.1045135e-05f };
-		if ( material == "K-PSFn4" ) return { 3.2452002f, -0.011397767f, 0.048209487f, 0.0022384274f, -2.8034687e-05f, 1.8880187e-05f };
-		if ( material == "K-PSFn5(M)" ) return { 3.480338f, -0.011368322f, 0.05808586f, 0.0034779702f, -0.0001519768f, 3.6318702e-05f };
-		if ( material == "K-PSFn5" ) return { 3.4965005f, -0.011373234f, 0.059139817f, 0.0031967827f, -9.7424772e-05f, 3.2744737e-05f };
-		if ( material == "K-PSK100(M)" ) return { 2.4831321f, -0.0090721125f, 0.013641591f, 0.00021543576f, 8.6973883e-06f, -6.5012493e-07f };
-		if ( material == "K-PSK100" ) return { 2.4948235f, -0.0091228463f, 0.013721276f, 0.00023830265f, 4.1915859e-06f, -3.8958137e-07f };
-		if ( material == "K-PSK11(M)" ) return { 2.3980346f, -0.0090774696f, 0.012465635f, 0.00027492499f, -9.3436202e-06f, 7.809668e-07f };
-		if ( material == "K-PSK11" ) return { 2.4158701f, -0.0091407676f, 0.012869238f, 0.0001991764f, 2.7958423e-06f, 8.1672946e-08f };
-		if ( material == "K-PSK200(M)" ) return { 2.5524515f, -0.0088629121f, 0.014923738f, 0.00026036731f, -2.7057207e-06f, 4.8084913e-07f };
-		if ( material == "K-PSK200" ) return { 2.5593395f, -0.0088787219f, 0.015115397f, 0.0002035651f, 7.5991137e-06f, -1.5375246e-07f };
-		if ( material == "K-PSK300(M)" ) return { 2.5141824f, -0.0093945858f, 0.012823443f, 0.00025005056f, -3.928511e-06f, 4.4650519e-08f };
-		if ( material == "K-PSK300" ) return { 2.5225185f, -0.0094325814f, 0.012753583f, 0.00028565036f, -8.905806e-06f, 2.8110143e-07f };
-		if ( material == "K-PSK400(M)" ) return { 2.4983595f, -0.0073445422f, 0.012430575f, 0.00026343152f, -1.3169766e-05f, 8.1753544e-07f };
-		if ( material == "K-PSK400" ) return { 2.5082353f, -0.0073346094f, 0.012618342f, 0.00023225231f, -9.8397157e-06f, 6.9870981e-07f };
-		if ( material == "K-PSK500(M)" ) return { 2.3725199f, -0.0067756972f, 0.01066551f, 0.00018548975f, -5.7674134e-06f, 3.2946743e-07f };
-		if ( material == "K-PSK500" ) return { 2.3790067f, -0.0067863375f, 0.01075028f, 0.00017281188f, -3.9024656e-06f, 2.2878462e-07f };
-		if ( material == "K-PSKn2" ) return { 2.578886f, -0.010381408f, 0.014233563f, 0.00012483021f, 1.7477672e-05f, -9.6204805e-07f };
-		if ( material == "K-SFLD11" ) return { 3.052913f, -0.012276955f, 0.041487837f, 0.0019043764f, -3.1653157e-05f, 1.7320425e-05f };
-		if ( material == "K-SFLD14" ) return { 2.9793916f, -0.011878549f, 0.03964328f, 0.0014928665f, 1.9358213e-05f, 1.2712921e-05f };
-		if ( material == "K-SFLD1" ) return { 2.8465679f, -0.01179579f, 0.032766631f, 0.0014514223f, -4.8225155e-05f, 1.2981324e-05f };
-		if ( material == "K-SFLD4" ) return { 2.9621759f, -0.011836005f, 0.037648353f, 0.0015341601f, -1.0776303e-05f, 1.378924e-05f };
-		if ( material == "K-SFLD66" ) return { 3.09503f, -0.012322111f, 0.043740379f, 0.0024511569f, -9.9218754e-05f, 2.3715962e-05f };
-		if ( material == "K-SFLD6" ) return { 3.1176009f, -0.012108189f, 0.044689743f, 0.0016574765f, 4.1984442e-05f, 1.29135e-05f };
-		if ( material == "SFLD6" ) return { 3.1176009f, -0.012108189f, 0.044689743f, 0.0016574765f, 4.1984442e-05f, 1.29135e-05f };
-		if ( material == "K-SFLD8" ) return { 2.7609221f, -0.011601354f, 0.029309701f, 0.0012957192f, -3.6971081e-05f, 9.8723481e-06f };
-		if ( material == "K-SFLDn3" ) return { 3.2503692f, -0.013195714f, 0.049790724f, 0.0022430157f, -7.7567761e-06f, 2.1169316e-05f };
-		if ( material == "K-SK14" ) return { 2.5313894f, -0.010956275f, 0.013803544f, 0.00029803889f, -6.2451964e-06f, 2.5686024e-07f };
-		if ( material == "K-SK15" ) return { 2.5918508f, -0.010567563f, 0.014411695f, 0.00063226961f, -5.7927037e-05f, 3.4193172e-06f };
-		if ( material == "K-SK16RH" ) return { 2.5853303f, -0.011740187f, 0.014496524f, 0.0003287161f, -1.5804639e-05f, 1.1016183e-06f };
-		if ( material == "K-SK18RH" ) return { 2.6368942f, -0.00998234f, 0.017151413f, 0.00011644223f, 3.4189945e-05f, -1.8645959e-06f };
-		if ( material == "K-SK18" ) return { 2.6383229f, -0.010806956f, 0.016153414f, 0.00046673954f, -2.5414619e-05f, 1.9703165e-06f };
-		if ( material == "K-SK4" ) return { 2.5587726f, -0.0098095616f, 0.014840563f, 0.0003193166f, -1.016436e-05f, 6.6518794e-07f };
-		if ( material == "K-SK5" ) return { 2.4895419f, -0.011359477f, 0.012448401f, 0.00055781133f, -5.0555753e-05f, 2.8679508e-06f };
-		if ( material == "K-SK7" ) return { 2.5429277f, -0.01031719f, 0.014356944f, 0.00031433872f, -1.0824341e-05f, 6.8100892e-07f };
-		if ( material == "K-SKF6(M)" ) return { 2.2407767f, -0.008821111f, 0.011852627f, 0.00046630703f, -2.7146793e-05f, 2.5187584e-06f };
-		if ( material == "K-SKF6" ) return { 2.2505164f, -0.0088684142f, 0.012260534f, 0.00042234633f, -2.1095054e-05f, 2.2440064e-06f };
-		if ( material == "K-SKLD120(M)" ) return { 2.47209f, -0.011710437f, 0.013292551f, 0.00033538382f, -1.3094931e-05f, 4.3086267e-07f };
-		if ( material == "K-SKLD120" ) return { 2.4809256f, -0.011763845f, 0.013309488f, 0.00032545605f, -9.9643058e-06f, 2.0790854e-07f };
-		if ( material == "K-SSK1" ) return { 2.5692173f, -0.010022582f, 0.016067095f, 0.00039868115f, -1.5698671e-05f, 1.1774033e-06f };
-		if ( material == "K-SSK3" ) return { 2.5591851f, -0.0099057522f, 0.016577727f, 0.00054738619f, -3.5329686e-05f, 2.4596919e-06f };
-		if ( material == "K-SSK4" ) return { 2.5720683f, -0.010564186f, 0.015625643f, 0.00040593207f, -1.3424134e-05f, 6.4355621e-07f };
-		if ( material == "K-SSK9" ) return { 2.5737917f, -0.0093452955f, 0.017645209f, 0.00035765081f, 1.1614434e-06f, 1.16034e-06f };
-		if ( material == "K-VC100(M)" ) return { 3.1544352f, -0.014806744f, 0.027996766f, 0.00079379644f, -1.0802615e-05f, 2.172329e-06f };
-		if ( material == "K-VC100" ) return { 3.1712708f, -0.014897108f, 0.028163952f, 0.00083222761f, -1.9276093e-05f, 2.7257034e-06f };
-		if ( material == "K-VC179(M)" ) return { 3.1342666f, -0.013761215f, 0.028817199f, 0.00082006501f, -5.3846865e-06f, 2.2272066e-06f };
-		if ( material == "K-VC179" ) return { 3.1494851f, -0.013835107f, 0.029184533f, 0.00080707995f, -6.1706552e-06f, 2.3930989e-06f };
-		if ( material == "K-VC181(M)" ) return { 3.1735917f, -0.01381902f, 0.029219972f, 0.0011233335f, -4.4143284e-05f, 4.6335289e-06f };
-		if ( material == "K-VC181" ) return { 3.1886895f, -0.013820455f, 0.029631617f, 0.0010659501f, -3.7795055e-05f, 4.3966629e-06f };
-		if ( material == "K-VC185(M)" ) return { 3.3218568f, -0.014962898f, 0.032206874f, 0.0011931823f, -5.072415e-05f, 5.1953408e-06f };
-		if ( material == "K-VC185" ) return { 3.3380677f, -0.014969129f, 0.032739414f, 0.0011048947f, -3.8597399e-05f, 4.5931893e-06f };
-		if ( material == "K-VC78(M)" ) return { 2.7266185f, -0.012222673f, 0.017519329f, 0.00043056615f, -2.0621869e-05f, 1.440444e-06f };
-		if ( material == "K-VC78" ) return { 2.7376882f, -0.012269245f, 0.017439403f, 0.00047088707f, -2.7150134e-05f, 1.8172045e-06f };
-		if ( material == "K-VC79(M)" ) return { 2.5419536f, -0.011244659f, 0.014723741f, 0.00042825747f, -3.3933216e-05f, 2.2129238e-06f };
-		if ( material == "K-VC79" ) return { 2.5520489f, -0.011234947f, 0.014455084f, 0.00046725318f, -3.6714004e-05f, 2.2810504e-06f };
-		if ( material == "K-VC80(M)" ) return { 2.800208f, -0.012536465f, 0.019904622f, 0.00012816526f, 4.6545827e-05f, -2.8784776e-06f };
-		if ( material == "K-VC80" ) return { 2.8135722f, -0.012577591f, 0.019933465f, 0.00015711222f, 4.0676176e-05f, -2.4977604e-06f };
-		if ( material == "K-VC82(M)" ) return { 2.9914895f, -0.01436707f, 0.024650584f, 0.00071568019f, -2.7938999e-05f, 3.2293973e-06f };
-		if ( material == "K-VC82" ) return { 3.0092545f, -0.014428442f, 0.024950143f, 0.0006532589f, -1.7536585e-05f, 2.6440099e-06f };
-		if ( material == "K-VC89(M)" ) return { 3.1717081f, -0.013708448f, 0.029629026f, 0.0011150095f, -5.5576606e-05f, 5.6941122e-06f };
-		if ( material == "K-VC89" ) return { 3.1860388f, -0.013756822f, 0.029614017f, 0.0012383727f, -8.0134175e-05f, 7.2330635e-06f };
-		if ( material == "K-VC90(M)" ) return { 3.3149515f, -0.013619007f, 0.033842693f, 0.001108869f, -2.8110622e-05f, 5.1120171e-06f };
-		if ( material == "K-VC90" ) return { 3.3299316f, -0.013661207f, 0.034088332f, 0.0010979548f, -2.7983676e-05f, 5.172898e-06f };
-		if ( material == "K-VC91(M)" ) return { 3.4226561f, -0.014620569f, 0.037712137f, 0.0019015089f, -0.00011042813f, 1.2477487e-05f };
-		if ( material == "K-VC91" ) return { 3.4399333f, -0.014633437f, 0.037625197f, 0.0021748752f, -0.00016417982f, 1.5817576e-05f };
-		if ( material == "K-VC99(M)" ) return { 3.3130252f, -0.01525551f, 0.031799975f, 0.0010027504f, -2.7509191e-05f, 3.4290858e-06f };
-		if ( material == "K-VC99" ) return { 3.3294765f, -0.015324675f, 0.031941277f, 0.0010078745f, -2.8400554e-05f, 3.488686e-06f };
-		if ( material == "K-ZnSF8(M)" ) return { 2.8508369f, -0.012006057f, 0.025904826f, 0.0009056149f, -2.8090015e-05f, 4.695922e-06f };
-		if ( material == "K-ZnSF8" ) return { 2.8600337f, -0.012073452f, 0.026131306f, 0.00091303268f, -3.0467767e-05f, 4.891802e-06f };
+	// data from https://refractiveindex.info/ (eq. 3)
+	{ "BAF10", { 2.708194f, 0.004899893f, 0.03147874f, -0.002304342f, 0.0003414449f, -1.465281e-05f } },
+	{ "BAF11", { 2.718364f, -0.009306715f, 0.02090148f, 0.0001588714f, 4.065932e-05f, -8.563966e-07f } },
+	{ "BAF3", { 2.438682f, 0.001609961f, 0.02688829f, -0.002446579f, 0.0003965661f, -1.973046e-05f } },
+	{ "BAF4", { 2.504959f, 0.003324741f, 0.02831428f, -0.002044138f, 0.0003343099f, -1.534858e-05f } },
+	{ "BAF8", { 2.576356f, -0.004964319f, 0.02151531f, -0.0002533858f, 7.507447e-05f, -1.820369e-06f } },
+	{ "BAK2", { 2.319725f, 0.002602493f, 0.02249807f, -0.002672041f, 0.0003926686f, -2.043303e-05f } },
+	{ "BAK4", { 2.414299f, -0.002829974f, 0.01680892f, -8.945119e-05f, -1.350522e-05f, 4.145336e-06f } },
+	{ "BASF12", { 2.729422f, -0.01897808f, 0.01735778f, 0.002340995f, -0.000198277f, 1.222741e-05f } },
+	{ "BASF2", { 2.677014f, 0.003011704f, 0.03312038f, -0.0009256636f, 0.0001805364f, -2.622153e-06f } },
+	{ "BASF4", { 2.653252f, -0.006578821f, 0.02439776f, 0.0005194976f, 2.48777e-05f, 1.560994e-06f } },
+	{ "BASF6", { 2.718163f, -0.01334622f, 0.02057831f, 0.0009283221f, -1.411159e-05f, 1.659476e-06f } },
+	{ "BASF7", { 2.83515f, -0.01785081f, 0.01539786f, 0.003719055f, -0.0004884822f, 3.290179e-05f } },
+	{ "BASF8", { 2.881495f, -0.006454381f, 0.03074684f, -0.0001396031f, 0.0001314241f, -2.44494e-06f } },
+	{ "E-BAF10", { 2.72932262f, -0.0106085219f, 0.0204478583f, 0.000484576944f, -3.06411426e-06f, 1.63981487e-06f } },
+	{ "E-BAF11", { 2.71954649f, -0.0100472501f, 0.0200301385f, 0.000465868302f, -7.51633336e-06f, 1.77544989e-06f } },
+	{ "E-BAF12", { 2.62833748f, -0.0100974072f, 0.0203176439f, 0.000375302287f, 1.45983254e-05f, 1.37126433e-06f } },
+	{ "E-BAF3", { 2.43868193f, 0.00160996098f, 0.0268882943f, -0.00244657917f, 0.000396566086f, -1.9730459e-05f } },
+	{ "E-BAF4", { 2.50495857f, 0.00332474118f, 0.0283142796f, -0.00204413784f, 0.000334309924f, -1.53485779e-05f } },
+	{ "E-BAF8", { 2.58072694f, -0.00826682499f, 0.0192773695f, 0.000287391647f, 1.54399962e-05f, 4.63747358e-07f } },
+	{ "E-BAK1", { 2.44353274f, -0.0161455184f, 0.00881927898f, 0.00144687542f, -0.000136331798f, 6.03309808e-06f } },
+	{ "E-BAK2", { 2.33664322f, -0.00862588382f, 0.0125079902f, 0.000175550187f, 4.02268677e-06f, -3.58785019e-08f } },
+	{ "E-BAK4", { 2.4220474f, -0.00935286439f, 0.0138282404f, 0.000292097262f, -5.77819731e-06f, 7.05644888e-07f } },
+	{ "E-BALF4", { 2.45999845f, -0.0140695372f, 0.0104962988f, 0.00154266669f, -0.000169174126f, 9.43510859e-06f } },
+	{ "E-BASF2", { 2.67701358f, 0.00301170374f, 0.033120376f, -0.000925663558f, 0.000180536382f, -2.62215298e-06f } },
+	{ "E-BASF6", { 2.71377616f, -0.00941072521f, 0.0221914885f, 0.000735180213f, -2.11522864e-05f, 3.73099495e-06f } },
+	{ "E-BASF7", { 2.83515039f, -0.0178508143f, 0.0153978598f, 0.00371905515f, -0.000488482182f, 3.29017911e-05f } },
+	{ "E-BASF8", { 2.88848579f, -0.0117260382f, 0.0269121453f, 0.000931846805f, -1.77180132e-05f, 5.63107499e-06f } },
+	{ "E-BK7", { 2.271192f, -0.00966126763f, 0.0110306969f, 7.00379964e-05f, 1.39658544e-05f, -7.62560454e-07f } },
+	{ "E-F16", { 2.47196413f, -0.0100810083f, 0.0208698749f, 0.000995620952f, -4.77932855e-05f, 8.07129922e-06f } },
+	{ "E-F1", { 2.56251919f, -0.00314623487f, 0.0291600242f, -0.000870730012f, 0.000226533195f, -8.61239946e-06f } },
+	{ "E-F2", { 2.55739282f, -0.0107951229f, 0.0216807328f, 0.00105165979f, -5.36309816e-05f, 7.7466326e-06f } },
+	{ "E-F3", { 2.52228312f, -0.00104823034f, 0.029395765f, -0.00139163033f, 0.000289680505f, -1.26508887e-05f } },
+	{ "E-F5", { 2.50863619f, -0.0101869365f, 0.0204516474f, 0.000841069518f, -3.63565381e-05f, 5.99712664e-06f } },
+	{ "E-F8", { 2.47286461f, -0.00151192688f, 0.0276004612f, -0.00152550371f, 0.000290711488f, -1.28484326e-05f } },
+	{ "E-FK01", { 2.22250469f, -0.00850804282f, 0.005666787f, 0.00084184905f, -9.804141e-05f, 4.91868528e-06f } },
+	{ "E-FK5", { 2.1887621f, -0.0095572007f, 0.0089915232f, 0.00014560516f, -5.2843067e-06f, 3.458801e-07f } },
+	{ "E-FKH1", { 2.22025427f, -0.00513496818f, 0.00841587708f, 5.4263553e-05f, 7.61288219e-06f, -4.89857441e-07f } },
+	{ "E-FKH2", { 2.10176037f, -0.00475364874f, 0.00656506916f, 0.000110380259f, -6.14897591e-06f, 3.33432784e-07f } },
+	{ "E-K3", { 2.2707833f, -0.00772009861f, 0.0126286148f, -4.60005382e-05f, 3.30622876e-05f, -1.37462973e-06f } },
+	{ "E-K5", { 2.25937934f, 0.00909050374f, 0.0263394215f, -0.00377741843f, 0.000522870195f, -2.62918185e-05f } },
+	{ "E-KF6", { 2.24955402f, 0.00226224485f, 0.0221746519f, -0.00228248782f, 0.000344437297f, -1.73774146e-05f } },
+	{ "E-LAF010", { 2.96201742f, -0.00690787335f, 0.0295340678f, -0.00139338248f, 0.000252317172f, -1.245434e-05f } },
+	{ "E-LAF016", { 3.14158865f, -0.0147653343f, 0.0334231042f, 0.00125430167f, -3.49277287e-05f, 8.7589435e-06f } },
+	{ "E-LAF01", { 2.82762091f, -0.0112227553f, 0.0213169098f, 0.000559325355f, -1.3357138e-05f, 1.86385587e-06f } },
+	{ "E-LAF02", { 2.88761613f, -0.0113224055f, 0.0234620658f, 0.000879155778f, -3.93727241e-05f, 4.43531743e-06f } },
+	{ "E-LAF04", { 3.01654365f, -0.0142462083f, 0.0251223164f, 0.000195992997f, 4.35063641e-05f, -7.85606637e-07f } },
+	{ "E-LAF05", { 3.02046444f, -0.0121632364f, 0.028023846f, 0.000861441681f, -1.40486471e-05f, 4.5613035e-06f } },
+	{ "E-LAF09", { 2.82115249f, -0.0128420041f, 0.0195742767f, 0.000851971209f, -3.82046776e-05f, 2.42425127e-06f } },
+	{ "E-LAF11", { 2.98504551f, -0.012861773f, 0.0312839577f, 0.00217089493f, -0.000162580251f, 1.82003929e-05f } },
+	{ "E-LAF2", { 2.9684827f, -0.0116032701f, 0.0244833672f, 0.000775976856f, -2.44342622e-05f, 3.01832049e-06f } },
+	{ "E-LAF3", { 2.88218387f, -0.0106317724f, 0.0227527853f, 0.000397667212f, 1.25478223e-05f, 5.87511175e-07f } },
+	{ "E-LAF7", { 2.96631279f, -0.0109274208f, 0.0314277188f, 0.000703288732f, 4.43317688e-05f, 2.65190331e-06f } },
+	{ "E-LAF9", { 3.100922f, -0.01374983f, 0.03780926f, 0.002077998f, -9.162097e-05f, 1.798297e-05f } },
+	{ "E-LAFH2", { 3.1493362f, -0.0148382096f, 0.0335324542f, 0.00159644183f, -7.06244061e-05f, 1.15814159e-05f } },
+	{ "E-LAK011", { 2.97199342f, -0.0152435249f, 0.0202061158f, 0.000875252167f, -7.67180744e-05f, 4.84807195e-06f } },
+	{ "E-LAK01", { 2.64816555f, -0.0139955727f, 0.0152775593f, 0.000227366594f, 4.86219531e-06f, -2.33276501e-07f } },
+	{ "E-LAK02", { 2.74241958f, -0.0130203862f, 0.0159689321f, 0.000709178831f, -6.08192466e-05f, 3.51166538e-06f } },
+	{ "E-LAK04", { 2.6768086f, -0.0102173269f, 0.0177389501f, 2.82247162e-05f, 4.32740016e-05f, -2.15847266e-06f } },
+	{ "E-LAK06", { 2.77078533f, -0.0176502071f, 0.011803041f, 0.0027975002f, -0.000346617455f, 2.01612172e-05f } },
+	{ "E-LAK09", { 2.95310231f, -0.0196724731f, 0.0174257922f, 0.00152866545f, -0.000137028672f, 6.72353302e-06f } },
+	{ "E-LAK10", { 2.89528358f, -0.0117686807f, 0.0222295765f, 0.000269351264f, 2.23005932e-05f, -4.3546434e-07f } },
+	{ "E-LAK12", { 2.78094755f, -0.0236624998f, 0.00867653717f, 0.00294181002f, -0.000351554137f, 1.84406503e-05f } },
+	{ "E-LAK13", { 2.81365515f, -0.0134879998f, 0.0191920754f, 0.000414986834f, -7.45390097e-06f, 7.65453719e-07f } },
+	{ "E-LAK14", { 2.8276674f, -0.0146359226f, 0.0183760559f, 0.000420548979f, -1.31827801e-05f, 9.74806017e-07f } },
+	{ "E-LAK18", { 2.93385862f, -0.0150347642f, 0.0198579837f, 0.000500310675f, -2.05752531e-05f, 1.37499776e-06f } },
+	{ "LAK18", { 2.93385862f, -0.0150347642f, 0.0198579837f, 0.000500310675f, -2.05752531e-05f, 1.37499776e-06f } }, // ??
+	{ "E-LAK7", { 2.68241693f, -0.0118445415f, 0.016242269f, 0.000303298585f, -8.32486246e-06f, 7.74390846e-07f } },
+	{ "E-LAK8", { 2.87864541f, -0.0142314931f, 0.0198025768f, 0.00040117957f, -6.68878586e-06f, 7.86869747e-07f } },
+	{ "E-LAK9", { 2.78211953f, 0.00386988792f, 0.0322993842f, -0.00317915886f, 0.000435836848f, -2.06224134e-05f } },
+	{ "E-LASF010", { 3.26060903f, -0.0148581563f, 0.0340319193f, 0.00114204288f, -1.89155362e-05f, 5.34279856e-06f } },
+	{ "E-LASF013", { 3.16454973f, -0.0146684282f, 0.030386787f, 0.00102933823f, -2.54435589e-05f, 4.67271608e-06f } },
+	{ "E-LASF014", { 3.12215038f, -0.0147958367f, 0.0260452483f, 0.000507811768f, 5.71446833e-06f, 8.82357872e-07f } },
+	{ "E-LASF015", { 3.17656194f, -0.0153426611f, 0.0268472584f, 0.00064503193f, -5.1739717e-06f, 1.3910812e-06f } },
+	{ "E-LASF016", { 3.07241378f, -0.0146849804f, 0.0244285857f, 0.000398183255f, 1.22802438e-05f, 1.23709929e-07f } },
+	{ "E-LASF017", { 3.14429212f, -0.0156560059f, 0.026364495f, 0.000879416097f, -3.51678468e-05f, 3.33709709e-06f } },
+	{ "E-LASF01", { 3.10625626f, -0.0130242032f, 0.0300056853f, -0.000279459588f, 0.000147953845f, -6.92451309e-06f } },
+	{ "E-LASF02", { 3.15611691f, -0.0172799726f, 0.0273336859f, 0.00119991815f, -6.25674387e-05f, 5.65571879e-06f } },
+	{ "E-LASF03", { 3.19737166f, -0.032023626f, 0.0167812195f, 0.00429709196f, -0.000439299261f, 2.40669567e-05f } },
+	{ "E-LASF04", { 3.20360786f, -0.00877554777f, 0.0332446054f, -0.000432887979f, 0.000134715955f, -4.716471e-06f } },
+	{ "E-LASF05", { 3.27555498f, -0.0149587295f, 0.0310927229f, 0.000682586922f, 9.41310743e-06f, 1.5045853e-06f } },
+	{ "E-LASF08", { 3.44097798f, -0.0140195736f, 0.0351597803f, 0.000893152796f, 2.96132309e-06f, 1.83226713e-06f } },
+	{ "E-LASF09", { 3.21588388f, -0.0133880786f, 0.0285023144f, 0.000406364414f, 2.70180277e-05f, -4.64955706e-07f } },
+	{ "E-LASFH2", { 3.04964021f, -0.0143753567f, 0.0247919447f, 0.000638849518f, -1.05068423e-05f, 1.83387657e-06f } },
+	{ "E-LASFH9", { 3.49989132f, -0.014925507f, 0.0384731987f, 0.00184372906f, -9.49882953e-05f, 1.04373643e-05f } },
+	{ "E-LASKH2", { 3.01740929f, -0.0150192115f, 0.0220799937f, 0.000476675587f, -9.36464002e-06f, 9.63541852e-07f } },
+	{ "E-LF5", { 2.44577168f, -0.0100665627f, 0.0184371468f, 0.000644165105f, -1.74180822e-05f, 3.77641526e-06f } },
+	{ "E-LF6", { 2.4026161f, -0.00531026402f, 0.0170623068f, 0.000992586995f, -0.000110715814f, 9.21295404e-06f } },
+	{ "E-LF7", { 2.42793483f, -0.0101841542f, 0.01737719f, 0.000782340309f, -4.23035005e-05f, 5.02350788e-06f } },
+	{ "E-LLF1", { 2.35111949f, -0.00904795254f, 0.0155546832f, 0.000449505996f, -1.02073128e-05f, 2.3449403e-06f } },
+	{ "E-LLF2", { 2.31105643f, 0.00359211226f, 0.0263534925f, -0.0028618174f, 0.000442961085f, -2.22792621e-05f } },
+	{ "E-LLF6", { 2.30466f, -0.00864131348f, 0.0145944618f, 0.000206597874f, 1.88931616e-05f, 1.82626789e-07f } },
+	{ "E-PKH1", { 2.27969929f, -0.00967939699f, 0.00983301659f, 0.000165890669f, -3.86343967e-06f, 1.39369901e-07f } },
+	{ "E-PSK02", { 2.57651436f, -0.00817396399f, 0.0152706397f, -0.000117385023f, 4.69952008e-05f, -2.25968944e-06f } },
+	{ "E-PSK03", { 2.53132391f, -0.00865579054f, 0.0142829487f, -0.000115110582f, 4.15511576e-05f, -1.9869836e-06f } },
+	{ "E-SF03", { 3.25492893f, -0.0156026034f, 0.0458228209f, 0.0037273634f, -0.000238976694f, 3.42745142e-05f } },
+	{ "E-SF10", { 2.87968193f, -0.0123038115f, 0.033443025f, 0.00183471163f, -8.12508073e-05f, 1.59440837e-05f } },
+	{ "E-SF11", { 3.05654935f, -0.0143159709f, 0.0381593027f, 0.00315675913f, -0.000223523385f, 2.90021069e-05f } },
+	{ "E-SF13", { 2.92006212f, -0.0134436038f, 0.0333556844f, 0.00246092959f, -0.000160492168f, 2.11511846e-05f } },
+	{ "E-SF14", { 2.98384614f, -0.0128995609f, 0.035639664f, 0.00296907641f, -0.00022269905f, 2.67423649e-05f } },
+	{ "E-SF15", { 2.7903158f, -0.0118464509f, 0.0305751341f, 0.00141030608f, -4.15895631e-05f, 1.14740935e-05f } },
+	{ "E-SF1", { 2.84827856f, -0.0122548479f, 0.0316736954f, 0.00170745362f, -7.33008941e-05f, 1.41012815e-05f } },
+	{ "E-SF2", { 2.63429594f, -0.00920840209f, 0.0274266023f, 0.000225441472f, 9.97644221e-05f, 1.76259116e-08f } },
+	{ "E-SF4", { 2.96469762f, -0.0128650713f, 0.0357299793f, 0.00216572877f, -0.000102243404f, 1.82439835e-05f } },
+	{ "E-SF5", { 2.71201742f, -0.0111228641f, 0.0276913413f, 0.00113193687f, -2.4225064e-05f, 8.91515336e-06f } },
+	{ "E-SF6", { 3.117837f, -0.0119410737f, 0.0443602265f, 0.00181348056f, 4.69669929e-06f, 1.61754136e-05f } },
+	{ "E-SF7", { 2.60224509f, -0.00228272809f, 0.0313239043f, -0.00110981516f, 0.00028447243f, -1.2054467e-05f } },
+	{ "E-SF8", { 2.76155381f, -0.0116348386f, 0.0286355735f, 0.00155293137f, -7.94510589e-05f, 1.28609539e-05f } },
+	{ "E-SFS3", { 3.05701152f, -0.0132251945f, 0.0390853018f, 0.0025148016f, -0.000131876542f, 2.24898958e-05f } },
+	{ "E-SK10", { 2.58912326f, -0.0100115186f, 0.0156165805f, 0.000328758605f, -9.84858579e-06f, 7.82877169e-07f } },
+	{ "E-SK11", { 2.41034365f, -0.0101286559f, 0.0126748412f, 0.000257347078f, -6.24279133e-06f, 3.35932224e-07f } },
+	{ "E-SK12", { 2.46638796f, -0.00865760981f, 0.0144628215f, 7.9427451e-05f, 1.55773822e-05f, -5.24586883e-07f } },
+	{ "E-SK14", { 2.53104523f, -0.0107742896f, 0.0140100006f, 0.000247886041f, -1.0881644e-06f, 1.03415548e-07f } },
+	{ "E-SK15", { 2.59512882f, -0.0133017463f, 0.0129505299f, 0.000946976976f, -9.28161846e-05f, 5.07474225e-06f } },
+	{ "E-SK16", { 2.58572188f, -0.0114561541f, 0.0140913669f, 0.000439966701f, -2.67679001e-05f, 1.51331053e-06f } },
+	{ "E-SK18", { 2.65253732f, -0.0207076891f, 0.00823565189f, 0.00259890034f, -0.00030272324f, 1.591967e-05f } },
+	{ "E-SK2", { 2.5423297f, -0.0100137205f, 0.0136627069f, 0.000828586571f, -8.59026849e-05f, 5.07949629e-06f } },
+	{ "E-SK4", { 2.55935739f, -0.0101666557f, 0.01458787f, 0.00036544107f, -1.59151229e-05f, 9.9861439e-07f } },
+	{ "E-SK5", { 2.48616859f, -0.00962090414f, 0.0146866348f, -0.000117877135f, 4.43876615e-05f, -2.05228288e-06f } },
+	{ "E-SSK1", { 2.56935287f, -0.0103280973f, 0.0161803173f, 0.000314456596f, -8.91235286e-08f, 6.08967029e-07f } },
+	{ "E-SSK5", { 2.69603796f, -0.0100729839f, 0.0188657945f, 0.00036803849f, 4.06084448e-06f, 4.57460676e-07f } },
+	{ "E-SSK8", { 2.57047824f, -0.0119686463f, 0.0149712411f, 0.00112845548f, -0.000110413826f, 7.39815032e-06f } },
+	{ "F1", { 2.562519f, -0.003146235f, 0.02916002f, -0.00087073f, 0.0002265332f, -8.612399e-06f } },
+	{ "F2", { 2.545002f, -0.001337396f, 0.02801151f, -0.0005417021f, 0.0001501754f, -3.617071e-06f } },
+	{ "F3", { 2.522283f, -0.00104823f, 0.02939577f, -0.00139163f, 0.0002896805f, -1.265089e-05f } },
+	{ "F5", { 2.527725f, -0.02381908f, 0.01020504f, 0.003480576f, -0.0003603615f, 2.057311e-05f } },
+	{ "F8", { 2.472865f, -0.001511927f, 0.02760046f, -0.001525504f, 0.0002907115f, -1.284843e-05f } },
+	{ "K3", { 2.27187f, -0.008333884f, 0.0119425f, 0.0001494434f, 8.303797e-06f, -2.694974e-07f } },
+	{ "K5", { 2.259379f, 0.009090504f, 0.02633942f, -0.003777418f, 0.0005228702f, -2.629182e-05f } },
+	{ "KF6", { 2.249554f, 0.002262245f, 0.02217465f, -0.002282488f, 0.0003444373f, -1.737741e-05f } },
+	{ "KZFH1", { 2.547175f, -0.01287115f, 0.01838384f, 0.0005862006f, -1.624561e-05f, 2.266107e-06f } },
+	{ "KZFH2", { 2.723491f, -0.01309285f, 0.02374514f, 0.0007951295f, -1.290725e-05f, 3.339887e-06f } },
+	{ "KZFS4", { 2.554362f, -0.0165228f, 0.01560256f, 0.001407955f, -0.0001318867f, 8.507447e-06f } },
+	{ "LAF09", { 2.821152f, -0.012842f, 0.01957428f, 0.0008519712f, -3.820468e-05f, 2.424251e-06f } },
+	{ "LAF11", { 2.809631f, 0.1142767f, 0.1251064f, -0.0221709f, 0.002916176f, -0.0001356855f } },
+	{ "LAF2", { 2.966463f, -0.01184749f, 0.02659597f, 7.166823e-05f, 6.759269e-05f, -1.704166e-06f } },
+	{ "LAF3", { 2.830874f, 0.02556412f, 0.05044859f, -0.00670398f, 0.0008789224f, -4.052452e-05f } },
+	{ "LAF7", { 2.871638f, 0.05586319f, 0.08260113f, -0.01257133f, 0.00171414f, -7.977217e-05f } },
+	{ "LAF9", { 3.097921f, -0.01112466f, 0.0388245f, 0.001949184f, -6.840198e-05f, 1.330305e-05f } },
+	{ "LAK011", { 2.971993f, -0.01524352f, 0.02020612f, 0.0008752522f, -7.671807e-05f, 4.848072e-06f } },
+	{ "LAK04", { 2.676809f, -0.01021733f, 0.01773895f, 2.822472e-05f, 4.3274e-05f, -2.158473e-06f } },
+	{ "LAK09", { 2.953102f, -0.01967247f, 0.01742579f, 0.001528665f, -0.0001370287f, 6.723533e-06f } },
+	{ "LAK12", { 2.780948f, -0.0236625f, 0.008676537f, 0.00294181f, -0.0003515541f, 1.844065e-05f } },
+	{ "LAK7", { 2.684146f, -0.01282175f, 0.01520999f, 0.0005791021f, -4.197895e-05f, 2.32621e-06f } },
+	{ "LAK9", { 2.78212f, 0.003869888f, 0.03229938f, -0.003179159f, 0.0004358368f, -2.062241e-05f } },
+	{ "LASF010", { 3.162451f, 0.04629811f, 0.09621568f, -0.01807107f, 0.002856517f, -0.0001616506f } },
+	{ "LASF01", { 3.106256f, -0.0130242f, 0.03000569f, -0.0002794596f, 0.0001479538f, -6.924513e-06f } },
+	{ "LASF02", { 3.156117f, -0.01727997f, 0.02733369f, 0.001199918f, -6.256744e-05f, 5.655719e-06f } },
+	{ "LASFH6", { 3.167451f, -0.02220547f, 0.02630248f, 0.004028856f, -0.0004018775f, 2.821967e-05f } },
+	{ "LF5", { 2.439252f, -0.005116676f, 0.02191912f, -0.000308089f, 0.0001181173f, -4.409047e-06f } },
+	{ "LF6", { 2.402616f, -0.005310264f, 0.01706231f, 0.000992587f, -0.0001107158f, 9.212954e-06f } },
+	{ "LF7", { 2.440824f, -0.02002119f, 0.01089699f, 0.002343396f, -0.0002198222f, 1.221823e-05f } },
+	{ "LLF1", { 2.362448f, -0.01634943f, 0.008894781f, 0.002311903f, -0.000257494f, 1.457859e-05f } },
+	{ "LLF2", { 2.311056f, 0.003592112f, 0.02635349f, -0.002861817f, 0.0004429611f, -2.227926e-05f } },
+	{ "LLF6", { 2.326858f, -0.02496168f, 0.002979231f, 0.003164392f, -0.0003498773f, 1.777229e-05f } },
+	{ "P-FK01S", { 2.2209843f, -0.00850617932f, 0.00565991749f, 0.000843578948f, -9.83647071e-05f, 4.93916644e-06f } },
+	{ "P-FKH2S", { 2.10062741f, -0.0047428655f, 0.00658636025f, 0.00010373696f, -5.35155073e-06f, 2.98151037e-07f } },
+	{ "PK1", { 2.23377f, -0.009387074f, 0.01057538f, -3.481847e-05f, 2.380097e-05f, -1.340308e-06f } },
+	{ "PK2", { 2.268721f, -0.005772466f, 0.01533408f, -0.001159258f, 0.0001697392f, -8.270431e-06f } },
+	{ "SF03", { 3.261335f, -0.01832792f, 0.0415517f, 0.00494909f, -0.0003884548f, 3.837014e-05f } },
+	{ "SF10", { 2.842085f, 0.01641576f, 0.05206046f, -0.002610463f, 0.000446977f, -9.429829e-06f } },
+	{ "SF11", { 3.127487f, -0.0637466f, -0.0009890957f, 0.01363913f, -0.001588824f, 9.646333e-05f } },
+	{ "SF12", { 2.620359f, 0.002381459f, 0.03560544f, -0.001773085f, 0.0003452771f, -1.282207e-05f } },
+	{ "SF13", { 2.92263f, -0.01150018f, 0.02875835f, 0.004472855f, -0.0004973006f, 4.089372e-05f } },
+	{ "SF14", { 2.983846f, -0.01289956f, 0.03563966f, 0.002969076f, -0.000222699f, 2.674236e-05f } },
+	{ "SF15", { 2.787118f, -0.006950628f, 0.03016016f, 0.00207609f, -0.0001855962f, 2.047325e-05f } },
+	{ "SF1", { 2.839803f, -0.004469128f, 0.03464028f, 0.001334322f, -5.451762e-05f, 1.214724e-05f } },
+	{ "SF2", { 2.612482f, 0.007294838f, 0.03844929f, -0.002459877f, 0.0004247475f, -1.668865e-05f } },
+	{ "SF4", { 2.988119f, -0.03043514f, 0.0237723f, 0.005097428f, -0.0004379463f, 3.025835e-05f } },
+	{ "SF5", { 2.735991f, -0.0272415f, 0.01394696f, 0.004883728f, -0.0004997414f, 2.996089e-05f } },
+	{ "SF6", { 3.080799f, 0.01530035f, 0.06350134f, -0.002963535f, 0.0006026374f, -1.590891e-05f } },
+	{ "SF7", { 2.602245f, -0.002282728f, 0.0313239f, -0.001109815f, 0.0002844724f, -1.205447e-05f } },
+	{ "SF8", { 2.798858f, -0.03718093f, 0.007630191f, 0.007231691f, -0.0008073847f, 4.696667e-05f } },
+	{ "SF9", { 2.661342f, -0.01187903f, 0.02328061f, 0.001777729f, -0.0001298549f, 1.138748e-05f } },
+	{ "SFS3", { 3.071402f, -0.02168875f, 0.02943887f, 0.005498532f, -0.0005380916f, 4.131754e-05f } },
+	{ "SK15", { 2.595129f, -0.01330175f, 0.01295053f, 0.000946977f, -9.281618e-05f, 5.074742e-06f } },
+	{ "SK16", { 2.592001f, -0.01540969f, 0.0102268f, 0.001581559f, -0.0001877149f, 1.012515e-05f } },
+	{ "SK18", { 2.652537f, -0.02070769f, 0.008235652f, 0.0025989f, -0.0003027232f, 1.591967e-05f } },
+	{ "SK2", { 2.54233f, -0.01001372f, 0.01366271f, 0.0008285866f, -8.590268e-05f, 5.079496e-06f } },
+	{ "SK4", { 2.542124f, 0.002965422f, 0.02316274f, -0.001681083f, 0.0002235719f, -1.000551e-05f } },
+	{ "SK9", { 2.564248f, -0.01337038f, 0.01398205f, 0.0007030773f, -4.206054e-05f, 2.098576e-06f } },
+	{ "SSK1", { 2.577488f, -0.01546625f, 0.01135863f, 0.001651928f, -0.0001733264f, 9.058966e-06f } },
+	{ "SSK2", { 2.591243f, -0.01427206f, 0.01239656f, 0.00153774f, -0.0001592745f, 8.552111e-06f } },
+	{ "SSK8", { 2.570478f, -0.01196865f, 0.01497124f, 0.001128455f, -0.0001104138f, 7.39815e-06f } },
+	{ "BAC4", { 2.4196645f, -0.0083329314f, 0.01539739f, -0.00017391654f, 6.218322e-05f, -3.062131e-06f } },
+	{ "BACD11", { 2.4095163f, -0.0091904415f, 0.012939968f, 0.0002346143f, -1.1130589e-05f, 1.0131863e-06f } },
+	{ "BACD14", { 2.5335256f, -0.011903338f, 0.012257249f, 0.00079172149f, -7.7381829e-05f, 3.9935441e-06f } },
+	{ "BACD15", { 2.5864832f, -0.0080357829f, 0.018080573f, -0.00045974172f, 8.8484321e-05f, -3.7544765e-06f } },
+	{ "BACD16", { 2.5859898f, -0.011940432f, 0.013995502f, 0.00048974502f, -3.9120717e-05f, 2.2611915e-06f } },
+	{ "BACD18", { 2.6365277f, -0.0097558464f, 0.017143665f, 0.00022592497f, 3.0855342e-06f, 4.5831917e-07f } },
+	{ "BACD2", { 2.5393255f, -0.0087207883f, 0.015909566f, 8.8163036e-05f, 2.5876593e-05f, -1.1733523e-06f } },
+	{ "BACD4", { 2.5584621f, -0.0097457283f, 0.015110495f, 0.00023273333f, 1.1137249e-06f, 1.6424767e-07f } },
+	{ "BACD5", { 2.4861499f, -0.0095684845f, 0.014685059f, -0.00011216487f, 4.1978777e-05f, -1.885619e-06f } },
+	{ "BACED5", { 2.6934245f, -0.008637014f, 0.02049645f, -9.3205453e-05f, 6.2709747e-05f, -2.0834652e-06f } },
+	{ "BAF10", { 2.7324621f, -0.01249046f, 0.018562334f, 0.00099990536f, -6.8388552e-05f, 4.9257931e-06f } },
+	{ "BAF11", { 2.7272955f, -0.013470236f, 0.014809271f, 0.0019615335f, -0.00019787663f, 1.0851117e-05f } },
+	{ "BAFD7", { 2.8217211f, -0.0097265483f, 0.024345979f, 0.00078406305f, -2.2431497e-05f, 4.6726029e-06f } },
+	{ "BAFD8", { 2.8863236f, -0.009802724f, 0.027654256f, 0.00089006367f, -3.6309109e-05f, 7.6181062e-06f } },
+	{ "BSC7", { 2.2702566f, -0.0091988101f, 0.011609706f, -7.6123911e-05f, 2.8558727e-05f, -1.2566486e-06f } },
+	{ "E-ADF10", { 2.5528983f, -0.015709364f, 0.015647688f, 0.0014461641f, -0.00014458879f, 9.5275733e-06f } },
+	{ "E-ADF50", { 2.6680422f, -0.013184258f, 0.023930479f, 0.00023928655f, 5.0697941e-05f, 9.1240958e-07f } },
+	{ "E-BACD10", { 2.5906326f, -0.010608994f, 0.014490916f, 0.00067542247f, -5.5303116e-05f, 3.0061364e-06f } },
+	{ "E-BACED20", { 2.6667537f, -0.0097319259f, 0.017436284f, 0.00047558015f, -1.7144989e-05f, 1.1049589e-06f } },
+	{ "E-BAF8", { 2.5801121f, -0.0079717945f, 0.019728054f, 0.00013876076f, 3.7632071e-05f, -7.4634717e-07f } },
+	{ "E-C3", { 2.2725452f, -0.008410491f, 0.011306843f, 0.00037782297f, -2.6903423e-05f, 1.5976489e-06f } },
+	{ "E-CF6", { 2.2668912f, -0.0093866212f, 0.012174195f, 0.0005076903f, -3.3573414e-05f, 2.9059013e-06f } },
+	{ "E-F1", { 2.5730565f, -0.010203605f, 0.023095784f, 0.00087114252f, -3.0730079e-05f, 6.9457986e-06f } },
+	{ "E-F2", { 2.5561822f, -0.010237038f, 0.022470348f, 0.00084580679f, -3.3087089e-05f, 7.1054919e-06f } },
+	{ "E-F3", { 2.5362697f, -0.010610424f, 0.021233821f, 0.00099012105f, -5.9984348e-05f, 8.2354366e-06f } },
+	{ "E-F5", { 2.5095673f, -0.010862661f, 0.019894774f, 0.0010137134f, -6.2697117e-05f, 7.5080045e-06f } },
+	{ "E-F8", { 2.4866561f, -0.010188484f, 0.019287417f, 0.00088553737f, -5.0937106e-05f, 6.4256956e-06f } },
+	{ "E-FD10", { 2.881518f, -0.013228312f, 0.03145559f, 0.0026851666f, -0.00022577544f, 2.4693268e-05f } },
+	{ "E-FD13", { 2.9205906f, -0.013681618f, 0.03256776f, 0.0028725519f, -0.00024277107f, 2.6614514e-05f } },
+	{ "E-FD15", { 2.7919943f, -0.012311206f, 0.028802741f, 0.0021430059f, -0.00016932119f, 1.9741766e-05f } },
+	{ "E-FD1", { 2.8508499f, -0.01323461f, 0.029415325f, 0.0025542666f, -0.00021232133f, 2.2261936e-05f } },
+	{ "E-FD2", { 2.6399644f, -0.011645718f, 0.023061733f, 0.0017348219f, -0.00013986059f, 1.391667e-05f } },
+	{ "E-FD4", { 2.9673173f, -0.013989565f, 0.03345668f, 0.0030717804f, -0.00026682435f, 2.8950241e-05f } },
+	{ "E-FD5", { 2.7135839f, -0.011419719f, 0.026133708f, 0.0017576479f, -0.00013307737f, 1.5203351e-05f } },
+	{ "E-FD7", { 2.6165865f, -0.011427854f, 0.022534361f, 0.001551289f, -0.00011769852f, 1.2401891e-05f } },
+	{ "E-FD8", { 2.7617586f, -0.011254039f, 0.028221737f, 0.0017540315f, -0.00012127053f, 1.5522384e-05f } },
+	{ "E-FDS1-W", { 3.5044639f, -0.020333833f, 0.0538027f, 0.0062874192f, -0.00056922176f, 7.3559387e-05f } },
+	{ "E-FDS1", { 3.5044639f, -0.020333833f, 0.0538027f, 0.0062874192f, -0.00056922176f, 7.3559387e-05f } },
+	{ "E-FDS2", { 3.7672603f, -0.017001227f, 0.069849634f, 0.0063862892f, -0.00050812539f, 8.4455529e-05f } },
+	{ "E-FDS3", { 4.1120387f, -0.01822767f, 0.089852105f, 0.00787144f, -0.00052228008f, 0.00011773061f } },
+	{ "E-FEL1", { 2.3534484f, -0.010330438f, 0.014097325f, 0.00087167875f, -6.998197e-05f, 5.7867359e-06f } },
+	{ "E-FEL2", { 2.3317983f, -0.0097042192f, 0.014032761f, 0.00064822896f, -4.0813761e-05f, 3.9064873e-06f } },
+	{ "E-FEL6", { 2.3068946f, -0.0096888755f, 0.01309702f, 0.00065013927f, -4.2328222e-05f, 3.5888777e-06f } },
+	{ "E-FL5", { 2.4465754f, -0.010107041f, 0.017759132f, 0.00087970259f, -5.7014929e-05f, 6.0924663e-06f } },
+	{ "E-FL6", { 2.4079653f, -0.011135638f, 0.015704715f, 0.00099186507f, -7.9934653e-05f, 7.0985473e-06f } },
+	{ "E-LAF7", { 2.9704178f, -0.013290679f, 0.028359006f, 0.0017661786f, -0.00012453482f, 1.3951937e-05f } },
+	{ "FC5", { 2.1894054f, -0.0099044908f, 0.008640337f, 0.00022263067f, -1.2291942e-05f, 5.9386349e-07f } },
+	{ "FCD100", { 2.0482157f, -0.0043211222f, 0.0061826755f, 3.141148e-05f, 3.5370793e-06f, -1.6694497e-07f } },
+	{ "FCD10A", { 2.1085888f, -0.0046553722f, 0.006954748f, 3.2184141e-05f, 5.2670946e-06f, -2.7164844e-07f } },
+	{ "FCD10", { 2.103249f, -0.0050247988f, 0.0065323077f, 0.00013078405f, -6.3652072e-06f, 1.9254745e-07f } },
+	{ "FCD1B", { 2.2189068f, -0.0061707065f, 0.0080887631f, 0.00013357782f, 1.9476186e-07f, -2.2577804e-07f } },
+	{ "FCD1", { 2.2181132f, -0.005799427f, 0.0083470679f, 6.5046523e-05f, 8.5142186e-06f, -5.8852269e-07f } },
+	{ "FCD505", { 2.502355f, -0.0072080042f, 0.012012743f, 0.00034920842f, -2.4729676e-05f, 1.3801567e-06f } },
+	{ "FCD515", { 2.502355f, -0.0072080042f, 0.012012743f, 0.00034920842f, -2.4729676e-05f, 1.3801567e-06f } },
+	{ "FCD705", { 2.3742832f, -0.0062014418f, 0.010582967f, 6.3100703e-05f, 8.196715e-06f, -3.4424446e-07f } },
+	{ "FD110", { 3.0534415f, -0.01275181f, 0.040609369f, 0.0022706109f, -7.8086606e-05f, 1.9874026e-05f } },
+	{ "FD140", { 2.9851294f, -0.014237988f, 0.035496437f, 0.0028457557f, -0.00019006799f, 2.4309252e-05f } },
+	{ "FD225", { 3.1189869f, -0.015820772f, 0.044425024f, 0.0035834882f, -0.00023943449f, 3.8756542e-05f } },
+	{ "FD60-W", { 3.1171483f, -0.011616277f, 0.044864975f, 0.0016588491f, 2.5716854e-05f, 1.4757657e-05f } },
+	{ "FD60", { 3.1171483f, -0.011616277f, 0.044864975f, 0.0016588491f, 2.5716854e-05f, 1.4757657e-05f } },
+	{ "FDS16-W", { 3.6906098f, -0.027849024f, 0.063139051f, 0.012443698f, -0.0014774085f, 0.00017478701f } },
+	{ "FDS18-W", { 3.563784f, -0.025449644f, 0.058401659f, 0.0092310983f, -0.00095499727f, 0.00011777456f } },
+	{ "FDS18", { 3.563784f, -0.025449644f, 0.058401659f, 0.0092310983f, -0.00095499727f, 0.00011777456f } },
+	{ "FDS24", { 3.5126327f, -0.0153015f, 0.053936061f, 0.0034949369f, -0.00017950295f, 3.4403181e-05f } },
+	{ "FDS90(P)", { 3.2565619f, -0.015803965f, 0.044330322f, 0.0043620098f, -0.00036912261f, 4.2999682e-05f } },
+	{ "FDS90-SG", { 3.2606321f, -0.017780398f, 0.040902938f, 0.0056076934f, -0.00056434039f, 5.4763391e-05f } },
+	{ "FDS90", { 3.2606321f, -0.017780398f, 0.040902938f, 0.0056076934f, -0.00056434039f, 5.4763391e-05f } },
+	{ "FF5", { 2.4743324f, -0.010955338f, 0.019293801f, 0.0014497732f, -0.00011038744f, 1.1136008e-05f } },
+	{ "FF8", { 2.9564361f, -0.019762195f, 0.029878823f, 0.0051830852f, -0.00054202389f, 4.8463245e-05f } },
+	{ "LAC10", { 2.8951998f, -0.011701218f, 0.022126485f, 0.00038494791f, -7.9808302e-06f, 1.5035116e-06f } },
+	{ "LAC12", { 2.7634844f, -0.011068339f, 0.018246442f, 0.00037697356f, -1.7788655e-05f, 1.5314262e-06f } },
+	{ "LAC13", { 2.8125316f, -0.012915271f, 0.019960339f, 0.00019877888f, 1.7647061e-05f, -4.4767632e-07f } },
+	{ "LAC14", { 2.8255229f, -0.013632902f, 0.019791402f, 1.5032564e-05f, 4.0761368e-05f, -1.7527267e-06f } },
+	{ "LAC7", { 2.6876223f, -0.014375187f, 0.012545954f, 0.0014642295f, -0.00016982461f, 8.8048639e-06f } },
+	{ "LAC8", { 2.8778537f, -0.013832906f, 0.020301185f, 0.00027759871f, 5.905983e-06f, 1.7747647e-07f } },
+	{ "LAC9", { 2.8081523f, -0.014167885f, 0.017693707f, 0.00076788759f, -7.4886174e-05f, 4.7044756e-06f } },
+	{ "LACL60", { 2.6490884f, -0.014159869f, 0.014451135f, 0.00052707873f, -4.3447523e-05f, 2.4612971e-06f } },
+	{ "LAF2", { 2.9657374f, -0.0096571624f, 0.026024525f, 0.00036684641f, 2.8205551e-05f, -1.3739929e-07f } },
+	{ "LAF3", { 2.8789799f, -0.008729237f, 0.024425656f, 4.5491773e-05f, 4.2802928e-05f, -7.2834306e-07f } },
+	{ "LBC3N", { 2.5388484f, -0.0066855865f, 0.015111456f, -0.00015247241f, 4.8340116e-05f, -2.4061785e-06f } },
+	{ "M-BACD12", { 2.468781f, -0.01062639f, 0.01325184f, 0.0004048612f, -2.974799e-05f, 1.825884e-06f } },
+	{ "M-BACD15", { 2.590919f, -0.01259476f, 0.01520205f, 0.000299998f, -1.131547e-05f, 9.15464e-07f } },
+	{ "M-BACD5N", { 2.48951f, -0.01224496f, 0.01294262f, 0.0003490449f, -1.777228e-05f, 9.113719e-07f } },
+	{ "MC-BACD12", { 2.468781f, -0.01062639f, 0.01325184f, 0.0004048612f, -2.974799e-05f, 1.825884e-06f } },
+	{ "MC-BACD5N", { 2.48951f, -0.01224496f, 0.01294262f, 0.0003490449f, -1.777228e-05f, 9.113719e-07f } },
+	{ "MC-FCD1-M20", { 2.2209418f, -0.0074830372f, 0.0062463392f, 0.00071157759f, -8.2274254e-05f, 4.0430546e-06f } },
+	{ "MC-FCD500-20", { 2.3850427f, -0.007914269f, 0.0094886852f, 0.00057980093f, -6.0011677e-05f, 3.0355422e-06f } },
+	{ "MC-FDS2", { 3.771581f, -0.020445364f, 0.063942579f, 0.008354547f, -0.00082031984f, 0.00010279507f } },
+	{ "MC-FDS910-50", { 3.1667902f, -0.013141416f, 0.047178656f, 0.0022684284f, -5.3672387e-05f, 2.5328422e-05f } },
+	{ "MC-LAC130", { 2.813412f, -0.01332448f, 0.01927865f, 0.0004124452f, -9.940432e-06f, 9.622024e-07f } },
+	{ "MC-NBF1", { 2.975245f, -0.01425016f, 0.02140074f, 0.0009755337f, -6.97953e-05f, 4.114924e-06f } },
+	{ "MC-NBFD135", { 3.1819698f, -0.014926522f, 0.028987649f, 0.0012223654f, -5.2916688e-05f, 4.7807227e-06f } },
+	{ "MC-PCD4-40", { 2.5831471f, -0.0097502344f, 0.013615374f, 0.00036346122f, -2.1187082e-05f, 1.1536132e-06f } },
+	{ "MC-PCD51-70", { 2.5025436f, -0.010321437f, 0.012433636f, 0.00021866535f, -5.5793977e-06f, 3.0188383e-07f } },
+	{ "MC-TAF101-100", { 3.0591566f, -0.013604717f, 0.024624272f, 0.00041834242f, 2.5361908e-06f, 7.998082e-07f } },
+	{ "MC-TAF105", { 3.0705638f, -0.013310234f, 0.025280355f, 0.00021829234f, 3.2555293e-05f, -8.1300421e-07f } },
+	{ "MC-TAF1", { 3.070806f, -0.012276924f, 0.02456566f, 0.00047436648f, 5.432616e-07f, 6.5976661e-07f } },
+	{ "MC-TAF31-15", { 3.164475f, -0.013801295f, 0.027926276f, 0.00057403f, 9.8223773e-07f, 1.3284244e-06f } },
+	{ "MC-TAF401", { 3.07279f, -0.01366385f, 0.02527346f, 0.000612182f, -1.147045e-05f, 1.543e-06f } },
+	{ "MC-TAFD305", { 3.327184f, -0.01343242f, 0.033398f, 0.001006047f, -2.136908e-05f, 3.972561e-06f } },
+	{ "MC-TAFD307", { 3.4286062f, -0.013845333f, 0.037363009f, 0.0011894554f, -1.5979979e-05f, 5.1827398e-06f } },
+	{ "MC-TAFD51-50", { 3.2288052f, -0.014433046f, 0.029863488f, 0.00082119282f, -1.0943492e-05f, 2.5804939e-06f } },
+	{ "M-FCD1", { 2.2189068f, -0.0061707065f, 0.0080887631f, 0.00013357782f, 1.9476186e-07f, -2.2577804e-07f } },
+	{ "M-FCD500", { 2.3841554f, -0.0078084423f, 0.0097130883f, 0.00049959889f, -4.7303224e-05f, 2.3205441e-06f } },
+	{ "M-FD80", { 2.761638f, -0.01132633f, 0.02865346f, 0.001529038f, -8.743577e-05f, 1.496579e-05f } },
+	{ "M-FDS1", { 3.4984224f, -0.01689542f, 0.057567078f, 0.0051693668f, -0.0003996631f, 6.2368582e-05f } },
+	{ "M-FDS2", { 3.771581f, -0.020445364f, 0.063942579f, 0.008354547f, -0.00082031984f, 0.00010279507f } },
+	{ "M-FDS910", { 3.165987f, -0.01349196f, 0.04649918f, 0.002471413f, -8.659596e-05f, 2.725927e-05f } },
+	{ "M-LAC130", { 2.813412f, -0.01332448f, 0.01927865f, 0.0004124452f, -9.940432e-06f, 9.622024e-07f } },
+	{ "M-LAC14", { 2.8278386f, -0.014773939f, 0.018211733f, 0.00049311964f, -2.5486886e-05f, 1.6795487e-06f } },
+	{ "M-LAC8", { 2.8817481f, -0.015730804f, 0.017690493f, 0.001052669f, -9.909308e-05f, 5.5248378e-06f } },
+	{ "M-LAF81", { 2.9167886f, -0.012398199f, 0.026675237f, 0.00065190504f, 4.6956175e-06f, 2.691054e-06f } },
+	{ "M-NBF1", { 2.975245f, -0.01425016f, 0.02140074f, 0.0009755337f, -6.97953e-05f, 4.114924e-06f } },
+	{ "M-NBFD10", { 3.264623f, -0.01581977f, 0.03225894f, 0.001709312f, -0.0001081957f, 1.058323e-05f } },
+	{ "M-NBFD130", { 3.173794f, -0.01498658f, 0.02906741f, 0.001204829f, -5.355158e-05f, 5.27135e-06f } },
+	{ "MP-BACD12", { 2.468781f, -0.01062639f, 0.01325184f, 0.0004048612f, -2.974799e-05f, 1.825884e-06f } },
+	{ "MP-BACD15", { 2.590919f, -0.01259476f, 0.01520205f, 0.000299998f, -1.131547e-05f, 9.15464e-07f } },
+	{ "MP-BACD5N", { 2.48951f, -0.01224496f, 0.01294262f, 0.0003490449f, -1.777228e-05f, 9.113719e-07f } },
+	{ "M-PCD4", { 2.582335f, -0.009952039f, 0.01329184f, 0.0004550621f, -3.327132e-05f, 1.730172e-06f } },
+	{ "M-PCD51", { 2.502026f, -0.01108292f, 0.0112772f, 0.0005715408f, -5.587455e-05f, 2.905292e-06f } },
+	{ "MP-FCD1-M20", { 2.2209418f, -0.0074830372f, 0.0062463392f, 0.00071157759f, -8.2274254e-05f, 4.0430546e-06f } },
+	{ "MP-FCD500-20", { 2.3850427f, -0.007914269f, 0.0094886852f, 0.00057980093f, -6.0011677e-05f, 3.0355422e-06f } },
+	{ "MP-FD80", { 2.761638f, -0.01132633f, 0.02865346f, 0.001529038f, -8.743577e-05f, 1.496579e-05f } },
+	{ "MP-FDS1", { 3.4984224f, -0.01689542f, 0.057567078f, 0.0051693668f, -0.0003996631f, 6.2368582e-05f } },
+	{ "MP-FDS2", { 3.771581f, -0.020445364f, 0.063942579f, 0.008354547f, -0.00082031984f, 0.00010279507f } },
+	{ "MP-FDS910-50", { 3.1667902f, -0.013141416f, 0.047178656f, 0.0022684284f, -5.3672387e-05f, 2.5328422e-05f } },
+	{ "MP-LAC130", { 2.813412f, -0.01332448f, 0.01927865f, 0.0004124452f, -9.940432e-06f, 9.622024e-07f } },
+	{ "MP-LAC14-80", { 2.8306733f, -0.014855863f, 0.018103472f, 0.00053539971f, -3.1929778e-05f, 2.0340983e-06f } },
+	{ "MP-LAC8-30", { 2.8827498f, -0.015740789f, 0.017707976f, 0.0010483265f, -9.8332811e-05f, 5.4828685e-06f } },
+	{ "MP-LAF81", { 2.9167886f, -0.012398199f, 0.026675237f, 0.00065190504f, 4.6956175e-06f, 2.691054e-06f } },
+	{ "MP-NBF1", { 2.975245f, -0.01425016f, 0.02140074f, 0.0009755337f, -6.97953e-05f, 4.114924e-06f } },
+	{ "MP-NBFD10-20", { 3.2722586f, -0.018817211f, 0.027264508f, 0.0032789193f, -0.00032827672f, 2.1743362e-05f } },
+	{ "MP-NBFD130", { 3.173794f, -0.01498658f, 0.02906741f, 0.001204829f, -5.355158e-05f, 5.27135e-06f } },
+	{ "MP-PCD4-40", { 2.5831471f, -0.0097502344f, 0.013615374f, 0.00036346122f, -2.1187082e-05f, 1.1536132e-06f } },
+	{ "MP-PCD51-70", { 2.5025436f, -0.010321437f, 0.012433636f, 0.00021866535f, -5.5793977e-06f, 3.0188383e-07f } },
+	{ "MP-TAC60-90", { 3.0209214f, -0.0157801f, 0.02114253f, 0.00095556554f, -7.4489819e-05f, 4.360632e-06f } },
+	{ "MP-TAC80-60", { 2.9372128f, -0.016185789f, 0.01839514f, 0.0010266071f, -9.2379872e-05f, 5.0509237e-06f } },
+	{ "MP-TAF101-100", { 3.0591566f, -0.013604717f, 0.024624272f, 0.00041834242f, 2.5361908e-06f, 7.998082e-07f } },
+	{ "MP-TAF105", { 3.0705638f, -0.013310234f, 0.025280355f, 0.00021829234f, 3.2555293e-05f, -8.1300421e-07f } },
+	{ "MP-TAF31-15", { 3.164475f, -0.013801295f, 0.027926276f, 0.00057403f, 9.8223773e-07f, 1.3284244e-06f } },
+	{ "MP-TAF401", { 3.07279f, -0.01366385f, 0.02527346f, 0.000612182f, -1.147045e-05f, 1.543e-06f } },
+	{ "MP-TAFD305", { 3.327184f, -0.01343242f, 0.033398f, 0.001006047f, -2.136908e-05f, 3.972561e-06f } },
+	{ "MP-TAFD307", { 3.4286062f, -0.013845333f, 0.037363009f, 0.0011894554f, -1.5979979e-05f, 5.1827398e-06f } },
+	{ "MP-TAFD405", { 3.6542352f, -0.015688325f, 0.048094089f, 0.0026498065f, -0.00013971852f, 1.9581201e-05f } },
+	{ "MP-TAFD51-50", { 3.2288052f, -0.014433046f, 0.029863488f, 0.00082119282f, -1.0943492e-05f, 2.5804939e-06f } },
+	{ "M-TAC60", { 3.017866f, -0.015790934f, 0.021144702f, 0.00093137389f, -6.9379914e-05f, 4.02762e-06f } },
+	{ "M-TAC80", { 2.9351948f, -0.016193458f, 0.018392287f, 0.0010086167f, -8.7565474e-05f, 4.6921333e-06f } },
+	{ "M-TAF101", { 3.05615f, -0.0138471f, 0.02431126f, 0.0004980027f, -7.318676e-06f, 1.24041e-06f } },
+	{ "M-TAF105", { 3.0705638f, -0.013310234f, 0.025280355f, 0.00021829234f, 3.2555293e-05f, -8.1300421e-07f } },
+	{ "M-TAF1", { 3.070806f, -0.012276924f, 0.02456566f, 0.00047436648f, 5.432616e-07f, 6.5976661e-07f } },
+	{ "M-TAF31", { 3.164358f, -0.01403321f, 0.02767034f, 0.0006403025f, -6.349234e-06f, 1.615744e-06f } },
+	{ "M-TAF401", { 3.07279f, -0.01366385f, 0.02527346f, 0.000612182f, -1.147045e-05f, 1.543e-06f } },
+	{ "M-TAFD305", { 3.327184f, -0.01343242f, 0.033398f, 0.001006047f, -2.136908e-05f, 3.972561e-06f } },
+	{ "M-TAFD307", { 3.4286062f, -0.013845333f, 0.037363009f, 0.0011894554f, -1.5979979e-05f, 5.1827398e-06f } },
+	{ "M-TAFD405", { 3.6542352f, -0.015688325f, 0.048094089f, 0.0026498065f, -0.00013971852f, 1.9581201e-05f } },
+	{ "M-TAFD51", { 3.227682f, -0.01453816f, 0.0292121f, 0.001057062f, -4.787162e-05f, 4.557239e-06f } },
+	{ "NBF1", { 2.9753491f, -0.01461347f, 0.021096383f, 0.001198038f, -0.00011887388f, 7.344435e-06f } },
+	{ "NBFD10", { 3.2615573f, -0.014542851f, 0.033470739f, 0.0012266479f, -2.5391842e-05f, 5.5971739e-06f } },
+	{ "NBFD11", { 3.1010267f, -0.010022108f, 0.032631687f, -0.00081029268f, 0.0001935011f, -8.0279799e-06f } },
+	{ "NBFD12", { 3.1513655f, -0.013052015f, 0.029502111f, 0.00067643437f, 3.6679701e-06f, 1.8233293e-06f } },
+	{ "NBFD13", { 3.1729223f, -0.014248534f, 0.029168114f, 0.001342876f, -9.6178753e-05f, 8.4042556e-06f } },
+	{ "NBFD15-W", { 3.1540011f, -0.013256753f, 0.034103312f, 0.0018472167f, -0.00010807332f, 1.2975901e-05f } },
+	{ "NBFD15", { 3.1540011f, -0.013256753f, 0.034103312f, 0.0018472167f, -0.00010807332f, 1.2975901e-05f } },
+	{ "NBFD3", { 3.1633746f, -0.01327628f, 0.031133309f, 0.0008352338f, 2.9980499e-06f, 2.5568853e-06f } },
+	{ "PCD40", { 2.5844463f, -0.0090521858f, 0.014301987f, 0.0001705077f, 4.964536e-06f, -1.2927479e-07f } },
+	{ "PCD4", { 2.5807045f, -0.010957538f, 0.01268943f, 0.00066387812f, -6.4849664e-05f, 3.4787863e-06f } },
+	{ "PCD51", { 2.5046638f, -0.010149448f, 0.012653769f, 0.00016566642f, 5.3871747e-07f, 5.584093e-08f } },
+	{ "TAC2", { 2.9717137f, -0.014952593f, 0.020162868f, 0.00094072283f, -8.8614104e-05f, 5.3191242e-06f } },
+	{ "TAC4", { 2.9425645f, -0.013266554f, 0.023559223f, -0.00016399009f, 9.2370759e-05f, -4.8615982e-06f } },
+	{ "TAC6", { 3.0182184f, -0.015381633f, 0.021520137f, 0.00064608303f, -3.2355748e-05f, 2.0791593e-06f } },
+	{ "TAC8", { 2.9324178f, -0.014603156f, 0.021121636f, 4.8240144e-05f, 4.9669475e-05f, -2.4904491e-06f } },
+	{ "TAF1", { 3.0736378f, -0.015501284f, 0.023627699f, 0.00066300852f, -2.8353438e-05f, 2.2090799e-06f } },
+	{ "TAF2", { 3.1415564f, -0.014370304f, 0.026483051f, 0.00095642714f, -5.9411087e-05f, 4.703953e-06f } },
+	{ "TAF3D", { 3.175337f, -0.014107601f, 0.0278609f, 0.00040102824f, 2.4504764e-05f, 2.4435731e-08f } },
+	{ "TAF3", { 3.1743707f, -0.014110466f, 0.028862637f, 3.355949e-05f, 8.0422109e-05f, -2.8956744e-06f } },
+	{ "TAF4", { 3.1212281f, -0.014119909f, 0.026520622f, 0.00040415763f, 1.4260634e-05f, 3.164256e-07f } },
+	{ "TAF5", { 3.2191571f, -0.015310562f, 0.02636257f, 0.0010534452f, -6.1660412e-05f, 3.9733897e-06f } },
+	{ "TAFD25", { 3.4905528f, -0.016325771f, 0.041146322f, 0.0027169124f, -0.00018260518f, 2.0641862e-05f } },
+	{ "TAFD30", { 3.4419038f, -0.014175245f, 0.03435104f, 0.0011752271f, -3.9010343e-05f, 3.7417054e-06f } },
+	{ "TAFD32", { 3.396108f, -0.013087065f, 0.034853516f, 0.00079083177f, 7.6995212e-06f, 2.3516742e-06f } },
+	{ "TAFD33", { 3.4316955f, -0.013156273f, 0.035631862f, 0.00091378109f, -4.0366886e-06f, 3.3867688e-06f } },
+	{ "TAFD35", { 3.5274747f, -0.014839948f, 0.039745402f, 0.001803472f, -8.9279334e-05f, 1.1377783e-05f } },
+	{ "TAFD37A", { 3.4958125f, -0.014342354f, 0.037807251f, 0.0014184073f, -4.6470269e-05f, 6.919444e-06f } },
+	{ "TAFD37", { 3.4943369f, -0.013647624f, 0.03883317f, 0.0011132555f, -7.402237e-06f, 5.3027754e-06f } },
+	{ "TAFD40", { 3.8106232f, -0.016351565f, 0.058801097f, 0.0034919026f, -0.0001694811f, 3.2569333e-05f } },
+	{ "TAFD45", { 3.672962f, -0.0151805f, 0.0457187f, 0.002186221f, -9.93742e-05f, 1.490466e-05f } },
+	{ "TAFD55", { 3.8317578f, -0.015266397f, 0.054573843f, 0.0023109346f, -4.4476201e-05f, 1.6143887e-05f } },
+	{ "TAFD5F", { 3.275546f, -0.014470354f, 0.030922062f, 0.00073289981f, 4.6573307e-06f, 1.8242746e-06f } },
+	{ "TAFD5G", { 3.2756799f, -0.014485625f, 0.030780102f, 0.00078915515f, -4.0810229e-06f, 2.2273965e-06f } },
+	{ "TAFD65", { 4.0113202f, -0.017752009f, 0.05856933f, 0.0043200932f, -0.00031070842f, 3.7485638e-05f } },
+	{ "APL1", { 2.2762403f, -0.0096874647f, 0.0092330378f, 0.00038940853f, -3.8018733e-05f, 2.0693225e-06f } },
+	{ "BAH10", { 2.730459f, -0.01063385f, 0.01942756f, 0.0008209873f, -5.210457e-05f, 4.447534e-06f } },
+	{ "BAH11", { 2.717567f, -0.008666231f, 0.02116288f, 0.0001530768f, 3.227309e-05f, 6.602266e-08f } },
+	{ "BAH13", { 2.7229077f, -0.0099369888f, 0.02092378f, 0.00065136672f, -1.9388233e-05f, 3.1119561e-06f } },
+	{ "BAH22", { 2.6928266f, -0.0090141372f, 0.025058968f, 0.0010140502f, -3.2164637e-05f, 5.6431441e-06f } },
+	{ "BAH26", { 2.7137156f, -0.0093481462f, 0.022190744f, 0.00074154999f, -2.1872211e-05f, 3.821015e-06f } },
+	{ "BAH27", { 2.823151f, -0.01090859f, 0.02374898f, 0.000901646f, -3.713171e-05f, 5.48189e-06f } },
+	{ "BAH28", { 2.891704f, -0.01284803f, 0.02450539f, 0.001674117f, -0.0001176163f, 1.046904e-05f } },
+	{ "BAH30", { 2.6543867f, -0.0084478289f, 0.022275774f, 0.00090008133f, -3.5291806e-05f, 4.7103195e-06f } },
+	{ "BAH54", { 2.802774f, -0.011441428f, 0.023830231f, 0.00057322688f, 1.1516047e-05f, 1.2065896e-06f } },
+	{ "BAH71", { 2.8219169f, -0.0099182972f, 0.02439388f, 0.00099651859f, -4.5521985e-05f, 5.5512807e-06f } },
+	{ "BAH77", { 2.8222929f, -0.010636602f, 0.024365241f, 0.00070591145f, -3.9506977e-06f, 2.9865625e-06f } },
+	{ "BAH78", { 2.8884392f, -0.010882671f, 0.026418653f, 0.0011678492f, -5.2245897e-05f, 6.2881561e-06f } },
+	{ "BAL11", { 2.433807f, -0.009321052f, 0.01397331f, 0.0001804732f, 7.763637e-06f, -1.184873e-07f } },
+	{ "BAL12", { 2.339135f, -0.009645053f, 0.01072238f, 0.0007185158f, -6.911301e-05f, 3.543402e-06f } },
+	{ "BAL14", { 2.421996f, -0.009200161f, 0.01374045f, 0.000348582f, -1.664649e-05f, 1.313751e-06f } },
+	{ "BAL15", { 2.3876453f, -0.0097564209f, 0.01254688f, 0.00038108489f, -2.3656347e-05f, 1.5068491e-06f } },
+	{ "BAL22", { 2.428819f, -0.01160085f, 0.01108574f, 0.00063122f, -6.395123e-05f, 3.440011e-06f } },
+	{ "BAL2", { 2.424312f, -0.00858474f, 0.01472045f, 0.0005504561f, -3.170738e-05f, 2.420757e-06f } },
+	{ "BAL35", { 2.487525f, -0.01022867f, 0.01374306f, 0.0001662538f, 6.25135e-06f, -2.342041e-07f } },
+	{ "BAL3", { 2.426175f, -0.00781539f, 0.01476624f, 0.0003669042f, -1.052689e-05f, 1.039369e-06f } },
+	{ "BAL41", { 2.410742f, -0.010238f, 0.01233414f, 0.0003782378f, -2.550448e-05f, 1.456385e-06f } },
+	{ "BAL42", { 2.4686122f, -0.0099937773f, 0.013115756f, 0.00045052253f, -3.1570294e-05f, 1.7307442e-06f } },
+	{ "BAL50", { 2.3982661f, -0.010222781f, 0.012110445f, 0.00037767581f, -2.7339021e-05f, 1.5701891e-06f } },
+	{ "BAL5", { 2.3550985f, -0.0086952235f, 0.013797477f, 0.00027607581f, 9.6025624e-08f, 6.0765812e-07f } },
+	{ "BAL7", { 2.4787185f, -0.0085856348f, 0.015210012f, 0.0006044033f, -3.8936391e-05f, 2.7124338e-06f } },
+	{ "BAM12", { 2.628582f, -0.009085873f, 0.0195519f, 0.0006698928f, -2.510153e-05f, 3.047777e-06f } },
+	{ "BAM21", { 2.579457f, -0.0094225577f, 0.021195926f, 0.0008094349f, -2.4922189e-05f, 3.9861235e-06f } },
+	{ "BAM23", { 2.5222179f, -0.0087270222f, 0.020177286f, 0.00061839451f, 1.8063926e-07f, 2.0159505e-06f } },
+	{ "BAM25", { 2.513482f, -0.008739639f, 0.0186819f, 0.0007470892f, -3.047596e-05f, 3.39904e-06f } },
+	{ "BAM4", { 2.521467f, -0.007991308f, 0.01891922f, 0.000549235f, -1.150794e-05f, 2.505827e-06f } },
+	{ "BAM5", { 2.533703f, -0.0090417017f, 0.016851835f, 0.00051005408f, -1.7651257e-05f, 1.8665437e-06f } },
+	{ "BAM8", { 2.583052f, -0.0098044767f, 0.017999796f, 0.00062560828f, -3.0382771e-05f, 3.0639765e-06f } },
+	{ "BAM9", { 2.6446959f, -0.0094397093f, 0.018905035f, 0.00050396096f, -6.9325864e-06f, 1.5474561e-06f } },
+	{ "BPH35", { 2.6413378f, -0.012997513f, 0.02125189f, 0.00074166905f, -1.9814508e-05f, 3.0698879e-06f } },
+	{ "BPH40", { 2.737477f, -0.013153125f, 0.023895273f, 0.0011078302f, -4.881918e-05f, 5.4773972e-06f } },
+	{ "BPH45", { 2.8619065f, -0.012425617f, 0.02988917f, 0.0010370691f, 1.6015692e-06f, 4.4595212e-06f } },
+	{ "BPH50", { 2.9271459f, -0.011970157f, 0.031922538f, 0.0015457537f, -6.3507309e-05f, 9.6835139e-06f } },
+	{ "BPM4", { 2.5489492f, -0.012922911f, 0.018433588f, 0.00067483064f, -2.8837579e-05f, 3.057603e-06f } },
+	{ "BSL1", { 2.2513548f, -0.0093148277f, 0.010704574f, 0.00012187894f, 1.0654019e-05f, -7.4428165e-07f } },
+	{ "BSL21", { 2.234734f, -0.0097856687f, 0.0098367633f, 0.00021398416f, -1.4554893e-05f, 8.7393721e-07f } },
+	{ "BSL22", { 2.2739528f, -0.0091160058f, 0.01226882f, -0.00031677862f, 6.0075221e-05f, -2.8098187e-06f } },
+	{ "BSL3", { 2.2187568f, -0.010447185f, 0.0095904498f, 0.00028540943f, -1.9183741e-05f, 9.7004548e-07f } },
+	{ "BSL7", { 2.2697665f, -0.0096395197f, 0.011025458f, 7.9465126e-05f, 1.0120957e-05f, -4.4096694e-07f } },
+	{ "BSM10", { 2.589111f, -0.009879155f, 0.01555047f, 0.0003664276f, -1.829782e-05f, 1.460153e-06f } },
+	{ "BSM14", { 2.53088f, -0.01045574f, 0.01393304f, 0.0003172572f, -1.649761e-05f, 1.121198e-06f } },
+	{ "BSM15", { 2.59025f, -0.009886858f, 0.01565646f, 0.0002117553f, 5.763945e-06f, -3.134574e-08f } },
+	{ "BSM16C", { 2.5858505f, -0.011425977f, 0.013924703f, 0.00050343054f, -3.6074659e-05f, 1.9912627e-06f } },
+	{ "BSM16", { 2.585926f, -0.0114351f, 0.01387296f, 0.0005169618f, -3.768293e-05f, 2.058449e-06f } },
+	{ "BSM18", { 2.6385199f, -0.010968446f, 0.01597395f, 0.00053519299f, -3.5705726e-05f, 2.6035403e-06f } },
+	{ "BSM21", { 2.567869f, -0.008657333f, 0.01659137f, 0.0002865545f, -3.488675e-06f, 8.927552e-07f } },
+	{ "BSM23", { 2.5600597f, -0.0097457249f, 0.015970594f, 0.00066802115f, -4.4172822e-05f, 3.1024931e-06f } },
+	{ "BSM24", { 2.56958f, -0.0086466584f, 0.016903144f, 7.624944e-05f, 2.6138532e-05f, -7.4670354e-07f } },
+	{ "BSM25", { 2.694748f, -0.009564087f, 0.01971919f, 0.0001351695f, 3.250553e-05f, -8.799463e-07f } },
+	{ "BSM28", { 2.568088f, -0.01046716f, 0.01660196f, 0.0005809348f, -2.356209e-05f, 2.231142e-06f } },
+	{ "BSM2", { 2.540784f, -0.00928151f, 0.01490321f, 0.0003779065f, -1.245295e-05f, 7.093602e-07f } },
+	{ "BSM36", { 2.6546711f, -0.012819365f, 0.015197193f, 0.00050420821f, -3.4995634e-05f, 2.0492682e-06f } },
+	{ "BSM4", { 2.559693f, -0.01014464f, 0.01426178f, 0.0004753199f, -3.128766e-05f, 1.735988e-06f } },
+	{ "BSM6", { 2.5601339f, -0.009371199f, 0.015290933f, 0.00040740566f, -2.1956285e-05f, 1.5738984e-06f } },
+	{ "BSM71", { 2.6654566f, -0.0093666483f, 0.018458132f, 0.00016162509f, 2.0907914e-05f, -1.3617346e-07f } },
+	{ "BSM7", { 2.5432134f, -0.0102068f, 0.013983216f, 0.00045963235f, -3.2963243e-05f, 1.9413424e-06f } },
+	{ "BSM81", { 2.6493149f, -0.014491012f, 0.014390568f, 0.0005294553f, -4.134593e-05f, 2.2951175e-06f } },
+	{ "BSM93", { 2.6481267f, -0.011553471f, 0.015517531f, 0.00053211731f, -3.390687e-05f, 2.099346e-06f } },
+	{ "FPL51", { 2.2184385f, -0.0059347504f, 0.0080764899f, 0.00016581036f, -8.0553319e-06f, 3.5839492e-07f } },
+	{ "FPL52", { 2.1024886f, -0.0053455182f, 0.0060469928f, 0.00028496405f, -2.987651e-05f, 1.539752e-06f } },
+	{ "FPL53", { 2.0531286f, -0.0043190085f, 0.0062752442f, -9.8512972e-06f, 1.364971e-05f, -8.9037944e-07f } },
+	{ "FSL3", { 2.1205655f, -0.0089437249f, 0.0090242393f, 0.00013786285f, -8.2750398e-07f, 2.6740448e-08f } },
+	{ "FSL5", { 2.189801f, -0.0098715424f, 0.0081379561f, 0.00042431698f, -4.3722026e-05f, 2.3005833e-06f } },
+	{ "FTL10", { 2.222325f, -0.008576053f, 0.0109677f, 0.0004169366f, -2.746341e-05f, 2.170253e-06f } },
+	{ "FTL8", { 2.2498663f, -0.010009969f, 0.010686269f, 0.00098510593f, -0.00010138667f, 7.0446543e-06f } },
+	{ "FTM16", { 2.4732588f, -0.010524934f, 0.019876763f, 0.0013151817f, -9.4064852e-05f, 1.0616142e-05f } },
+	{ "FTM8", { 2.3063389f, -0.009299434f, 0.014148541f, 0.00061944948f, -3.542134e-05f, 4.3560988e-06f } },
+	{ "LAH51", { 3.110662f, -0.014462677f, 0.026457698f, 0.00091877798f, -3.3951573e-05f, 3.325784e-06f } },
+	{ "LAH52", { 3.153652f, -0.015630638f, 0.028741717f, 0.00080868084f, -1.0164635e-05f, 2.9615511e-06f } },
+	{ "LAH53", { 3.1735908f, -0.014865209f, 0.02954021f, 0.00098366596f, -2.2979104e-05f, 3.8043975e-06f } },
+	{ "LAH54", { 3.2126997f, -0.01535137f, 0.028440374f, 0.00079180171f, -1.7032771e-05f, 2.6219094e-06f } },
+	{ "LAH55", { 3.2764855f, -0.015309073f, 0.030415926f, 0.00088670657f, -1.718301e-05f, 2.7050718e-06f } },
+	{ "LAH58", { 3.4415721f, -0.014237538f, 0.03473123f, 0.0010264409f, -1.6386952e-05f, 2.8714098e-06f } },
+	{ "LAH59", { 3.2178118f, -0.014296789f, 0.027199504f, 0.00079036567f, -2.3850632e-05f, 2.0013066e-06f } },
+	{ "LAH60", { 3.2618526f, -0.015375794f, 0.033152898f, 0.0014090033f, -5.5295605e-05f, 7.1360367e-06f } },
+	{ "LAH63", { 3.1647389f, -0.014742454f, 0.030279435f, 0.0010475442f, -2.4957393e-05f, 4.4251949e-06f } },
+	{ "LAH64", { 3.122744f, -0.015173059f, 0.025766499f, 0.00055121032f, 6.0710815e-06f, 4.8871364e-07f } },
+	{ "LAH65", { 3.1767027f, -0.015350032f, 0.026690666f, 0.00070784089f, -1.5485093e-05f, 1.9530666e-06f } },
+	{ "LAH66", { 3.0731081f, -0.015043205f, 0.023933518f, 0.00055696651f, -1.0082346e-05f, 1.1873265e-06f } },
+	{ "LAH67", { 3.1439609f, -0.015541721f, 0.026648169f, 0.00077813143f, -1.9462248e-05f, 2.4668548e-06f } },
+	{ "LAH71", { 3.3034137f, -0.013868754f, 0.037625274f, 0.0021067685f, -0.00011821055f, 1.4781395e-05f } },
+	{ "LAH75", { 3.3972115f, -0.015825501f, 0.036818916f, 0.0017596445f, -8.4041673e-05f, 1.0522807e-05f } },
+	{ "LAL10", { 2.8967406f, -0.01222188f, 0.021099546f, 0.00063090904f, -2.8901915e-05f, 2.1652922e-06f } },
+	{ "LAL11", { 2.7037498f, -0.011741892f, 0.0158996f, 0.00061265364f, -4.6676845e-05f, 2.6544952e-06f } },
+	{ "LAL12", { 2.7589457f, -0.0087787656f, 0.021173055f, -0.00047262367f, 9.6870749e-05f, -4.0576545e-06f } },
+	{ "LAL13", { 2.814252f, -0.013645728f, 0.018724991f, 0.00056380326f, -2.852714e-05f, 1.8227195e-06f } },
+	{ "LAL14", { 2.8274666f, -0.014568462f, 0.018525487f, 0.0003748582f, -7.1291749e-06f, 6.7781934e-07f } },
+	{ "LAL18", { 2.934239f, -0.015232638f, 0.01968169f, 0.00052343197f, -1.9855288e-05f, 1.1787472e-06f } },
+	{ "LAL52", { 2.7418702f, -0.012719153f, 0.016306977f, 0.00061414226f, -4.8242632e-05f, 2.8875864e-06f } },
+	{ "LAL54", { 2.6786604f, -0.011137943f, 0.016391023f, 0.00047317724f, -2.4508283e-05f, 1.7003664e-06f } },
+	{ "LAL56", { 2.7596566f, -0.010659546f, 0.018646689f, 0.00076127484f, -5.3585332e-05f, 3.7820929e-06f } },
+	{ "LAL59", { 2.9466133f, -0.014813612f, 0.020753291f, 0.00071087608f, -4.178079e-05f, 2.5896668e-06f } },
+	{ "LAL60", { 2.9223334f, -0.015268924f, 0.020070735f, 0.00049690538f, -1.5326299e-05f, 1.0772354e-06f } },
+	{ "LAL61", { 2.9706808f, -0.015058733f, 0.021490548f, 0.00038566151f, 4.1252602e-06f, 1.0912892e-07f } },
+	{ "LAL7", { 2.6833808f, -0.012303485f, 0.015614129f, 0.00047439815f, -2.7935643e-05f, 1.5441332e-06f } },
+	{ "LAL8", { 2.8795551f, -0.01462241f, 0.019128502f, 0.00061342737f, -3.5439045e-05f, 2.1550362e-06f } },
+	{ "LAL9", { 2.8062228f, -0.01325307f, 0.019370701f, 0.00013885534f, 2.596583e-05f, -9.3551589e-07f } },
+	{ "LAM2", { 2.967968f, -0.011312544f, 0.024812309f, 0.00067776202f, -1.0278339e-05f, 2.1968703e-06f } },
+	{ "LAM3", { 2.8826295f, -0.01060676f, 0.022303134f, 0.00055786284f, -1.1488225e-05f, 1.8527798e-06f } },
+	{ "LAM51", { 2.830675f, -0.01254193f, 0.01928173f, 0.00113639f, -8.838415e-05f, 5.822869e-06f } },
+	{ "LAM52", { 2.888081f, -0.01133043f, 0.02306135f, 0.001004485f, -5.630208e-05f, 5.248466e-06f } },
+	{ "LAM54", { 3.019994f, -0.015777485f, 0.022691302f, 0.00093505681f, -5.6267103e-05f, 4.0846095e-06f } },
+	{ "LAM55", { 3.0211799f, -0.012311284f, 0.027355503f, 0.0011031515f, -5.0726902e-05f, 6.4572101e-06f } },
+	{ "LAM60", { 2.9745038f, -0.014898498f, 0.022058854f, 0.0007492073f, -4.2104743e-05f, 3.1048673e-06f } },
+	{ "LAM66", { 3.1437117f, -0.015620045f, 0.031893839f, 0.0017196133f, -9.6995128e-05f, 1.1680925e-05f } },
+	{ "NSL2", { 2.264123f, -0.008475121f, 0.01223501f, 0.0001944071f, 3.353212e-07f, 3.831994e-07f } },
+	{ "NSL33", { 2.2582399f, -0.0079875836f, 0.012575688f, 0.00022130477f, 1.0685962e-06f, 3.9764383e-07f } },
+	{ "NSL36", { 2.266208f, -0.008895249f, 0.01260385f, 0.0003758541f, -1.385868e-05f, 1.28332e-06f } },
+	{ "NSL3", { 2.269695f, -0.007150002f, 0.01337006f, -0.0002761508f, 6.605453e-05f, -3.180633e-06f } },
+	{ "NSL5", { 2.284302f, -0.008132863f, 0.01240948f, -7.446766e-06f, 2.86937e-05f, -1.237616e-06f } },
+	{ "NSL7", { 2.2524157f, -0.008626195f, 0.011155352f, 0.00020721565f, -2.6893015e-07f, 3.8724966e-08f } },
+	{ "PBH10", { 2.8778739f, -0.010244063f, 0.033846634f, 0.0018336135f, -7.8721902e-05f, 1.4142908e-05f } },
+	{ "PBH11W", { 3.0523317f, -0.010699896f, 0.040026761f, 0.0027411266f, -0.00016825655f, 2.453957e-05f } },
+	{ "PBH11", { 3.0523317f, -0.010699896f, 0.040026761f, 0.0027411266f, -0.00016825655f, 2.453957e-05f } },
+	{ "PBH13W", { 2.9161406f, -0.010147718f, 0.035077729f, 0.0020869984f, -0.00011077712f, 1.7236453e-05f } },
+	{ "PBH13", { 2.9161406f, -0.010147718f, 0.035077729f, 0.0020869984f, -0.00011077712f, 1.7236453e-05f } },
+	{ "PBH14W", { 2.9836628f, -0.012013213f, 0.035225183f, 0.0031766736f, -0.000253238f, 2.7797101e-05f } },
+	{ "PBH14", { 2.9836628f, -0.012013213f, 0.035225183f, 0.0031766736f, -0.000253238f, 2.7797101e-05f } },
+	{ "PBH18", { 2.8593245f, -0.010210027f, 0.031973162f, 0.0020206869f, -0.00011399314f, 1.4012932e-05f } },
+	{ "PBH21", { 3.494462f, -0.01184144f, 0.05819278f, 0.00520064f, -0.0003667622f, 5.308036e-05f } },
+	{ "PBH23W", { 3.0554324f, -0.010867434f, 0.038522891f, 0.0030173971f, -0.0002129474f, 2.4864803e-05f } },
+	{ "PBH23", { 3.0554324f, -0.010867434f, 0.038522891f, 0.0030173971f, -0.0002129474f, 2.4864803e-05f } },
+	{ "PBH25W", { 2.983028f, -0.01043595f, 0.03634647f, 0.002619412f, -0.0001751318f, 2.13251e-05f } },
+	{ "PBH25", { 2.9830277f, -0.010435952f, 0.036346467f, 0.0026194115f, -0.00017513176f, 2.1325099e-05f } },
+	{ "PBH3W", { 2.9157717f, -0.0100817f, 0.03409894f, 0.0021965014f, -0.00012386955f, 1.5766843e-05f } },
+	{ "PBH4W", { 2.961379f, -0.0098262329f, 0.036779565f, 0.0020712902f, -9.3348652e-05f, 1.5491439e-05f } },
+	{ "PBH4", { 2.961379f, -0.0098262329f, 0.036779565f, 0.0020712902f, -9.3348652e-05f, 1.5491439e-05f } },
+	{ "PBH53W", { 3.2498918f, -0.010466366f, 0.048000686f, 0.0031859922f, -0.00015447369f, 2.6258671e-05f } },
+	{ "PBH53", { 3.2498918f, -0.010466366f, 0.048000686f, 0.0031859922f, -0.00015447369f, 2.6258671e-05f } },
+	{ "PBH6W", { 3.120642f, -0.011286328f, 0.040543249f, 0.0033876996f, -0.00024180036f, 2.7440285e-05f } },
+	{ "PBH6", { 3.120642f, -0.011286328f, 0.040543249f, 0.0033876996f, -0.00024180036f, 2.7440285e-05f } },
+	{ "PBH72", { 3.4684938f, -0.010731638f, 0.058252246f, 0.0046536748f, -0.0003034305f, 4.8216298e-05f } },
+	{ "PBL1", { 2.3489663f, -0.0075869873f, 0.016684762f, 0.00017147637f, 2.5194777e-05f, 1.8523864e-07f } },
+	{ "PBL21", { 2.4238569f, -0.0094940065f, 0.016206639f, 0.0010105149f, -7.2683761e-05f, 5.4198492e-06f } },
+	{ "PBL22", { 2.466622f, -0.0076071728f, 0.02016524f, 0.00028279173f, 3.0879156e-05f, 6.6471743e-07f } },
+	{ "PBL25", { 2.4465509f, -0.0097768464f, 0.01753112f, 0.00095250889f, -5.4837761e-05f, 4.7303899e-06f } },
+	{ "PBL27", { 2.4269332f, -0.0089789895f, 0.017578385f, 0.00079125417f, -4.3016897e-05f, 4.2474552e-06f } },
+	{ "PBL2", { 2.3302166f, -0.0085474969f, 0.014788612f, 0.00048017066f, -1.9221577e-05f, 2.1710005e-06f } },
+	{ "PBL6", { 2.3036685f, -0.0076028355f, 0.014811205f, 0.00024182527f, 4.8392964e-06f, 8.9395406e-07f } },
+	{ "PBL7", { 2.3529256f, -0.0089081938f, 0.015048987f, 0.00070028858f, -4.7518872e-05f, 3.8995587e-06f } },
+	{ "PBM11", { 2.5613591f, -0.01200739f, 0.020780357f, 0.001425606f, -0.00011027477f, 1.1477786e-05f } },
+	{ "PBM1", { 2.5743849f, -0.010002464f, 0.02166382f, 0.0013463294f, -8.3887231e-05f, 7.8154722e-06f } },
+	{ "PBM22", { 2.6360314f, -0.0089450876f, 0.025228056f, 0.0011120943f, -3.7887387e-05f, 6.3760973e-06f } },
+	{ "PBM25", { 2.7107551f, -0.0092889162f, 0.027542314f, 0.0013512557f, -5.4563909e-05f, 8.3261074e-06f } },
+	{ "PBM27", { 2.6124109f, -0.0087316589f, 0.024857782f, 0.00088778616f, -9.2640255e-06f, 4.5028723e-06f } },
+	{ "PBM28W", { 2.75779f, -0.0087331797f, 0.030379663f, 0.0011503031f, -1.9167784e-05f, 7.4745415e-06f } },
+	{ "PBM28", { 2.75779f, -0.0087331797f, 0.030379663f, 0.0011503031f, -1.9167784e-05f, 7.4745415e-06f } },
+	{ "PBM2", { 2.5569657f, -0.0097056299f, 0.02134251f, 0.0012399367f, -7.4499334e-05f, 7.145644e-06f } },
+	{ "PBM35", { 2.7934634f, -0.011916323f, 0.027252732f, 0.0026477261f, -0.00022721609f, 2.0411942e-05f } },
+	{ "PBM39", { 2.6957457f, -0.010264221f, 0.025940795f, 0.0014263975f, -6.8645974e-05f, 8.2048945e-06f } },
+	{ "PBM4", { 2.5463724f, -0.0093446264f, 0.021462247f, 0.001051989f, -4.8504181e-05f, 5.6183745e-06f } },
+	{ "PBM5", { 2.5078369f, -0.008947152f, 0.020469459f, 0.00089114494f, -3.6312577e-05f, 4.5477906e-06f } },
+	{ "PBM6", { 2.6040004f, -0.0089503263f, 0.023811801f, 0.00097080592f, -3.0707494e-05f, 5.4397201e-06f } },
+	{ "PBM8", { 2.4842899f, -0.0082629825f, 0.020412922f, 0.00059654654f, -4.9991757e-06f, 2.8060192e-06f } },
+	{ "PBM9", { 2.5602323f, -0.0095632018f, 0.021495089f, 0.00085071191f, -3.3535727e-05f, 4.8953255e-06f } },
+	{ "PHM51", { 2.5759016f, -0.010553544f, 0.013895937f, 0.00026498331f, -1.9680543e-06f, 1.0989977e-07f } },
+	{ "PHM52", { 2.5782413f, -0.0089850999f, 0.014069295f, 0.0002504459f, -3.6968898e-06f, 2.5223758e-07f } },
+	{ "PHM53", { 2.5332354f, -0.0095005403f, 0.012923982f, 0.00030691131f, -1.7660009e-05f, 1.0516051e-06f } },
+	{ "S-APL1", { 2.2762403f, -0.0096874647f, 0.0092330378f, 0.00038940853f, -3.8018733e-05f, 2.0693225e-06f } },
+	{ "S-APL", { 2.27624f, -0.009687465f, 0.009233038f, 0.0003894085f, -3.801873e-05f, 2.069323e-06f } },
+	{ "S-BAH54", { 2.802774f, -0.011441428f, 0.023830231f, 0.00057322688f, 1.1516047e-05f, 1.2065896e-06f } },
+	{ "S-BAL50", { 2.3982661f, -0.010222781f, 0.012110445f, 0.00037767581f, -2.7339021e-05f, 1.5701891e-06f } },
+	{ "S-BSM36", { 2.6546711f, -0.012819365f, 0.015197193f, 0.00050420821f, -3.4995634e-05f, 2.0492682e-06f } },
+	{ "S-BSM93", { 2.6481267f, -0.011553471f, 0.015517531f, 0.00053211731f, -3.390687e-05f, 2.099346e-06f } },
+	{ "S-LAH54", { 3.2126997f, -0.01535137f, 0.028440374f, 0.00079180171f, -1.7032771e-05f, 2.6219094e-06f } },
+	{ "S-LAH67", { 3.1439609f, -0.015541721f, 0.026648169f, 0.00077813143f, -1.9462248e-05f, 2.4668548e-06f } },
+	{ "S-LAH75", { 3.397212f, -0.0158255f, 0.03681892f, 0.001759645f, -8.404167e-05f, 1.052281e-05f } },
+	{ "S-LAL11", { 2.7037498f, -0.011741892f, 0.0158996f, 0.00061265364f, -4.6676845e-05f, 2.6544952e-06f } },
+	{ "S-LAL52", { 2.7418702f, -0.012719153f, 0.016306977f, 0.00061414226f, -4.8242632e-05f, 2.8875864e-06f } },
+	{ "S-LAL60", { 2.9223334f, -0.015268924f, 0.020070735f, 0.00049690538f, -1.5326299e-05f, 1.0772354e-06f } },
+	{ "S-PHM51", { 2.5759016f, -0.010553544f, 0.013895937f, 0.00026498331f, -1.9680543e-06f, 1.0989977e-07f } },
+	{ "SSL2", { 2.3006861f, -0.0098822575f, 0.013878959f, 0.00016341277f, 1.4393331e-05f, -9.3322118e-08f } },
+	{ "SSL5", { 2.279329f, -0.010732907f, 0.012001392f, 0.00058141137f, -4.6205948e-05f, 2.9557679e-06f } },
+	{ "S-YGH52", { 3.1224406f, -0.015600077f, 0.023832255f, 0.00072563954f, -3.0563799e-05f, 2.0883401e-06f } },
+	{ "TIH11", { 3.0547581f, -0.013301755f, 0.039295435f, 0.0028224343f, -0.00017708961f, 2.6536608e-05f } },
+	{ "TIH14", { 2.9828967f, -0.013103151f, 0.036731099f, 0.0025467663f, -0.00015569271f, 2.3553872e-05f } },
+	{ "TIH23", { 3.0578382f, -0.013332336f, 0.038204824f, 0.0028735627f, -0.00019421032f, 2.6269529e-05f } },
+	{ "TIH53", { 3.2534707f, -0.014523589f, 0.046505136f, 0.0036159629f, -0.00024194408f, 3.5879606e-05f } },
+	{ "TIH6", { 3.1200483f, -0.012774901f, 0.042416181f, 0.0025526467f, -0.00011907015f, 2.3448425e-05f } },
+	{ "TIM11", { 2.5613591f, -0.01200739f, 0.020780357f, 0.001425606f, -0.00011027477f, 1.1477786e-05f } },
+	{ "TPH55", { 2.9569821f, -0.013856476f, 0.037265687f, 0.0029140249f, -0.00020079792f, 2.945722e-05f } },
+	{ "YGH51", { 3.0180334f, -0.015399743f, 0.021762822f, 0.00053963162f, -1.3760417e-05f, 9.9935993e-07f } },
+	{ "YGH52", { 3.1224406f, -0.015600077f, 0.023832255f, 0.00072563954f, -3.0563799e-05f, 2.0883401e-06f } },
+
+	{ "BAF2", { 2.41667247f, -0.00746725517f, 0.0168668464f, -1.29697272e-05f, 5.159926024e-05f, -1.81803614e-06f } },
+	{ "BAF4", { 2.451472f, -0.0065118879f, 0.019377342f, -0.00030637647f, 0.00010174985f, -3.9270356e-06f } },
+	{ "BAF5", { 2.52216221f, -0.00832442891f, 0.0186334008f, 0.000582653358f, -1.12806453e-05f, 2.08955914e-06f } },
+	{ "BAF7", { 2.5436416f, -0.0086925216f, 0.020049192f, 0.00089795352f, -4.9734473e-05f, 5.3556e-06f } },
+	{ "D-FK61", { 2.21665351f, -0.00466455116f, 0.00907679939f, -0.000109123599f, 2.81347967e-05f, -1.39681747e-06f } },
+	{ "D-K59", { 2.27042265f, -0.00876481814f, 0.0132414328f, -0.000548580823f, 9.37358416e-05f, -4.41911546e-06f } },
+	{ "D-K9", { 2.27154844f, -0.0108815116f, 0.00996474656f, 0.000380487041f, -2.93440524e-05f, 1.45099948e-06f } },
+	{ "D-LAF050", { 3.0588612f, -0.014713037f, 0.023619508f, 0.00067085861f, -2.760135e-05f, 2.1299817e-06f } },
+	{ "D-LAF50", { 3.07490611f, -0.0115747081f, 0.0253759637f, 0.000221233049f, 3.69552724e-05f, -1.22052174e-06f } },
+	{ "D-LAF53", { 2.97237085f, -0.0132859996f, 0.0235602874f, 0.000319211658f, 1.70425085e-05f, -8.96802291e-08f } },
+	{ "D-LAF79", { 2.9216709f, -0.016405602f, 0.024564777f, 0.0010630152f, -3.3184678e-05f, 4.2899849e-06f } },
+	{ "D-LAF82L", { 2.9384022f, -0.011000275f, 0.026895091f, -0.00074423432f, 0.00016294737f, -7.3175367e-06f } },
+	{ "D-LAK5", { 2.76433988f, -0.0131613327f, 0.0182673276f, 0.000301224328f, 4.56200323e-06f, -2.05087278e-09f } },
+	{ "D-LAK6", { 2.81430513f, -0.0134495125f, 0.0196569671f, 0.000249252546f, 1.98274573e-05f, -8.02641015e-07f } },
+	{ "D-LAK70", { 2.73281949f, -0.0114137973f, 0.0202755954f, -0.000478308953f, 0.000110158258f, -5.30283301e-06f } },
+	{ "D-PK3", { 2.29778839f, -0.00944743443f, 0.0107674711f, -7.59126906e-05f, 2.70221688e-05f, -1.2965337e-06f } },
+	{ "D-ZF10", { 2.7595094f, -0.0104875429f, 0.0298924037f, 0.00121551438f, -3.91801667e-05f, 1.10580161e-05f } },
+	{ "D-ZF93", { 3.80125332f, -0.0264815939f, 0.0481190715f, 0.0121421023f, -0.00148894236f, 0.000136817158f } },
+	{ "D-ZK2", { 2.46827466f, -0.0104485861f, 0.01366454f, 0.000255364655f, -4.77558494e-06f, 3.20543262e-07f } },
+	{ "D-ZK3", { 2.48968705f, -0.0121700502f, 0.0125749866f, 0.000532456449f, -5.1039362e-05f, 2.86502873e-06f } },
+	{ "D-ZK79", { 2.54530492f, -0.00968163858f, 0.0157167913f, 3.66972503e-05f, 2.96132095e-05f, -1.32380367e-06f } },
+	{ "D-ZLAF50", { 3.17013467f, -0.0130614687f, 0.0284367701f, 0.000413884621f, 2.91645398e-05f, -3.26598959e-07f } },
+	{ "D-ZLAF52LA", { 3.1753525f, -0.00848750283f, 0.0371301651f, -0.00109609062f, 0.00024418582f, -8.94583294e-06f } },
+	{ "D-ZLAF61", { 3.23113634f, -0.0129344158f, 0.0306465184f, 0.0006186837f, 1.99460431e-05f, 9.30145697e-07f } },
+	{ "D-ZLAF67", { 3.43595778f, -0.014299558f, 0.036984078f, 0.00131399739f, -2.83852011e-05f, 5.77405361e-06f } },
+	{ "D-ZLAF81", { 3.1745656f, -0.0098395711f, 0.034884391f, -0.00052006433f, 0.00017902813f, -6.3116821e-06f } },
+	{ "D-ZLAF85L", { 3.33472677f, -0.0126400664f, 0.0345933295f, 0.000546091024f, 4.29052791e-05f, 2.50964053e-07f } },
+	{ "D-ZPK1A", { 2.5865056f, -0.00836488456f, 0.014712994f, 6.50980579e-05f, 2.0373089e-05f, -9.57408813e-07f } },
+	{ "F13", { 2.56957078f, -0.00760403138f, 0.0249680705f, 0.000334501945f, 5.6815438e-05f, 6.07326285e-07f } },
+	{ "F1", { 2.5059651f, -0.0078686119f, 0.021574214f, 0.00059867966f, -9.5194606e-07f, 2.9024858e-06f } },
+	{ "F2", { 2.53265982f, -0.00773825354f, 0.0231731432f, 0.000409362855f, 3.78046829e-05f, 1.03464346e-06f } },
+	{ "F3", { 2.54428229f, -0.00835307611f, 0.0228231808f, 0.000670214922f, 1.04294821e-06f, 3.03297376e-06f } },
+	{ "F4", { 2.5544667f, -0.00847847799f, 0.0232832892f, 0.000583809482f, 2.1963001e-05f, 1.96537708e-06f } },
+	{ "F5", { 2.56837524f, -0.00914046228f, 0.0225979637f, 0.000999853488f, -3.66330712e-05f, 4.93324803e-06f } },
+	{ "F6", { 2.56849722f, -0.00836232123f, 0.0234448291f, 0.000828924343f, -1.18355482e-05f, 4.09561662e-06f } },
+	{ "F7", { 2.6027537f, -0.0084678903f, 0.0246596174f, 0.00074451296f, -4.85328405e-06f, 4.25920114e-06f } },
+	{ "H-BAF2", { 2.41711733f, -0.00823177266f, 0.0168544799f, -3.47350495e-05f, 5.15389783e-05f, -1.33117437e-06f } },
+	{ "H-BAF3", { 2.45168402f, -0.00862082666f, 0.0153497797f, 0.000182555027f, 1.41449954e-05f, -1.68159962e-07f } },
+	{ "H-BAF4", { 2.45376994f, -0.00813614699f, 0.0179634979f, 0.000111641611f, 3.86804485e-05f, -3.17507239e-07f } },
+	{ "H-BAF5", { 2.52420606f, -0.0105526237f, 0.0179847388f, 0.000680268445f, -2.35420343e-05f, 3.35670967e-06f } },
+	{ "H-BAF6", { 2.53242221f, -0.00913744794f, 0.0181613436f, 0.000464889992f, -9.77023624e-06f, 2.46562672e-06f } },
+	{ "H-BAF7", { 2.5419557f, -0.00867236761f, 0.0216670486f, 0.000351132658f, 2.45600301e-05f, 2.23930385e-06f } },
+	{ "H-BAF8", { 2.57817643f, -0.00908880991f, 0.0220196312f, 0.000598073894f, -4.33206771e-06f, 4.0384407e-06f } },
+	{ "H-BAK1", { 2.30865698f, -0.00872904002f, 0.0119533972f, 0.000159700912f, 6.99805905e-06f, -3.33717539e-07f } },
+	{ "H-BAK2", { 2.33527993f, -0.0078806451f, 0.0135145071f, -0.000142281768f, 4.61865579e-05f, -2.07689693e-06f } },
+	{ "H-BAK3", { 2.35870163f, -0.00950600467f, 0.0127948403f, -8.28951235e-05f, 3.5627075e-05f, -1.74142152e-06f } },
+	{ "H-BAK4", { 2.37934396f, -0.0111573292f, 0.010770657f, 0.000537494005f, -4.85885263e-05f, 2.43110267e-06f } },
+	{ "H-BAK5", { 2.39698774f, -0.00814093911f, 0.0141635533f, -1.31826571e-05f, 3.09378511e-05f, -1.33359749e-06f } },
+	{ "H-BAK6", { 2.40421729f, -0.00689279508f, 0.0171159715f, -0.00118980816f, 0.000211469997f, -1.18837301e-05f } },
+	{ "H-BAK7GT", { 2.41803544f, -0.0076261289f, 0.0165596275f, -0.000521246254f, 0.000106128523f, -4.8581855e-06f } },
+	{ "H-BAK7", { 2.41803544f, -0.0076261289f, 0.0165596275f, -0.000521246254f, 0.000106128523f, -4.8581855e-06f } },
+	{ "H-BAK8", { 2.43343745f, -0.00872725497f, 0.0139111043f, 0.000238516088f, 1.02781404e-06f, 1.01938839e-07f } },
+	{ "H-F13", { 2.57016399f, -0.00927948027f, 0.0256258559f, -5.72485798e-05f, 0.000120086571f, -1.72844835e-06f } },
+	{ "H-F1", { 2.50656956f, -0.00926894171f, 0.021861508f, 0.000431237321f, 1.69302544e-05f, 3.4236134e-06f } },
+	{ "H-F2", { 2.5360648f, -0.01059228f, 0.021518011f, 0.00087655888f, -4.3936258e-05f, 7.5438308e-06f } },
+	{ "H-F4", { 2.56216381f, -0.0130775362f, 0.0181084716f, 0.00231573055f, -0.000264961402f, 2.07458046e-05f } },
+	{ "H-F51", { 2.6334392f, -0.023786997f, 0.013503973f, 0.0039049789f, -0.0004141067f, 2.7097419e-05f } },
+	{ "H-FK61B", { 2.21667349f, -0.00493991656f, 0.00915004725f, -0.00012667557f, 2.8243403e-05f, -1.31517813e-06f } },
+	{ "H-FK61", { 2.21667349f, -0.00493991656f, 0.00915004725f, -0.00012667557f, 2.8243403e-05f, -1.31517813e-06f } },
+	{ "H-FK71", { 2.103249f, -0.0050247988f, 0.0065323077f, 0.00013078405f, -6.3652072e-06f, 1.9254745e-07f } },
+	{ "H-K10", { 2.26857433f, -0.00685600163f, 0.0140981051f, -0.000498309358f, 9.50956734e-05f, -4.50515754e-06f } },
+	{ "H-K11", { 2.29500524f, -0.00752634179f, 0.0130212465f, -0.000143116298f, 4.31227975e-05f, -1.8646905e-06f } },
+	{ "H-K12", { 2.31506425f, -0.00827156166f, 0.0129535559f, 0.000268505199f, -5.46028268e-06f, 6.24325621e-07f } },
+	{ "H-K1", { 2.2199551f, -0.00854352351f, 0.0103698555f, 0.000273240959f, -1.58736064e-05f, 9.73235567e-07f } },
+	{ "H-K2", { 2.22522177f, -0.010126267f, 0.00954719533f, 0.000310146735f, -2.84359869e-05f, 1.63632169e-06f } },
+	{ "H-K3", { 2.23568924f, -0.0101322782f, 0.0109219541f, -5.77272119e-05f, 2.68720113e-05f, -1.16041466e-06f } },
+	{ "H-K50", { 2.2834436f, -0.00800379011f, 0.0130801119f, -0.000224166591f, 6.15548619e-05f, -2.94342401e-06f } },
+	{ "H-K51", { 2.28704699f, -0.00896946455f, 0.0115278522f, 0.00030799622f, -7.93584686e-06f, 2.91898123e-07f } },
+	{ "H-K5", { 2.25018356f, -0.00894066156f, 0.0114317829f, -7.33393278e-05f, 3.49616695e-05f, -1.80100775e-06f } },
+	{ "H-K6", { 2.25024516f, -0.00758714819f, 0.0126303778f, -0.000229001819f, 5.80225939e-05f, -2.84094604e-06f } },
+	{ "H-K7", { 2.25978818f, -0.00693885931f, 0.0134488547f, -0.000405904363f, 7.64411122e-05f, -3.51928135e-06f } },
+	{ "H-K8", { 2.26289162f, -0.00770544885f, 0.0130033906f, -3.10393046e-05f, 3.16686868e-05f, -1.27242154e-06f } },
+	{ "H-K9LGT", { 2.27196941f, -0.00991721869f, 0.0103697525f, 0.000311903798f, -2.64582145e-05f, 1.64750848e-06f } },
+	{ "H-K9Lstar", { 2.27196941f, -0.00991721869f, 0.0103697525f, 0.000311903798f, -2.64582145e-05f, 1.64750848e-06f } },
+	{ "H-K9L", { 2.27196941f, -0.00991721869f, 0.0103697525f, 0.000311903798f, -2.64582145e-05f, 1.64750848e-06f } },
+	{ "H-KF6", { 2.26924681f, -0.0111135716f, 0.010955079f, 0.000811179449f, -7.07180723e-05f, 4.69509667e-06f } },
+	{ "H-LAF10LA", { 3.12042876f, -0.0138076336f, 0.0272349388f, 0.000140668568f, 5.42355668e-05f, -1.61404497e-06f } },
+	{ "H-LAF1", { 2.81903533f, -0.0164493508f, 0.0136602235f, 0.0024815081f, -0.000258533047f, 1.30918358e-05f } },
+	{ "H-LAF2", { 2.87222927f, -0.00570883559f, 0.0292421752f, -0.00146115324f, 0.000252525251f, -1.08672409e-05f } },
+	{ "H-LAF3B", { 2.96108042f, -0.00745575504f, 0.029397524f, -0.000709734612f, 0.000179647406f, -7.42813844e-06f } },
+	{ "H-LAF4GT", { 2.95612047f, -0.00557678753f, 0.0372582362f, -0.000718686091f, 0.000199998634f, -2.80025194e-06f } },
+	{ "H-LAF4", { 2.95612047f, -0.00557678753f, 0.0372582362f, -0.000718686091f, 0.000199998634f, -2.80025194e-06f } },
+	{ "H-LAF50B", { 3.07031881f, -0.0135921167f, 0.0258190179f, -1.6644976e-05f, 6.94966225e-05f, -2.88382024e-06f } },
+	{ "H-LAF51", { 2.82740564f, -0.0113834621f, 0.0217208712f, 0.000385985738f, 1.31857828e-05f, 6.83783132e-07f } },
+	{ "H-LAF52", { 3.10868845f, -0.0135809895f, 0.027901619f, 0.000460094924f, 3.20811469e-05f, -2.81458925e-07f } },
+	{ "H-LAF53", { 2.96765171f, -0.0109098989f, 0.0265455309f, -0.000515952248f, 0.000124492897f, -5.16337751e-06f } },
+	{ "H-LAF54", { 3.14470202f, -0.010105906f, 0.0343096974f, -0.000833127912f, 0.000217008428f, -8.70147899e-06f } },
+	{ "H-LAF55", { 3.01845855f, -0.0104580593f, 0.0288640175f, 0.000697086524f, 6.35741467e-06f, 2.82444289e-06f } },
+	{ "H-LAF62", { 2.88929239f, -0.0118090997f, 0.0220839611f, 0.00132896557f, -9.97765672e-05f, 6.8989327e-06f } },
+	{ "H-LAF6LA", { 3.01970241f, -0.0158473652f, 0.0227654052f, 0.000979523125f, -6.86654467e-05f, 4.74327269e-06f } },
+	{ "H-LAF7", { 3.0798693f, -0.0120988227f, 0.0313371888f, 0.000985836878f, -1.3379864e-05f, 5.4990762e-06f } },
+	{ "H-LAFL5", { 2.98452959f, -0.0112966796f, 0.0309775151f, 0.000431829146f, 4.82383023e-05f, 2.94612279e-06f } },
+	{ "H-LAK10", { 2.67519359f, -0.00927946143f, 0.018891795f, -0.000239296657f, 7.29098315e-05f, -3.36344313e-06f } },
+	{ "H-LAK11", { 2.71757958f, -0.00952801665f, 0.0196309871f, -0.000237384298f, 8.48314788e-05f, -4.09640039e-06f } },
+	{ "H-LAK12", { 2.82673774f, -0.0136335725f, 0.0190474212f, 0.000204685509f, 8.81193052e-06f, -2.15937861e-08f } },
+	{ "H-LAK1", { 2.70432455f, -0.0100067787f, 0.018102254f, -2.16494884e-05f, 3.81507477e-05f, -1.57874424e-06f } },
+	{ "H-LAK2A", { 2.80801074f, -0.0109758888f, 0.0197813052f, 0.000143229802f, 2.39192838e-05f, -7.82772539e-07f } },
+	{ "H-LAK3", { 2.98365374f, -0.0123163831f, 0.0255848948f, -0.000570810681f, 0.000147648023f, -7.54741056e-06f } },
+	{ "H-LAK4L", { 2.64769834f, -0.0137710798f, 0.015665045f, 9.82676335e-05f, 2.2112348e-05f, -1.07455498e-06f } },
+	{ "H-LAK50A", { 2.68411905f, -0.013655729f, 0.0156617129f, 0.00038271126f, -8.02343758e-06f, 1.71633677e-07f } },
+	{ "H-LAK51A", { 2.82348938f, -0.0126281485f, 0.0212484444f, -0.000445653258f, 0.0001038003f, -4.7255594e-06f } },
+	{ "H-LAK52", { 2.92799279f, -0.0122458967f, 0.0239216813f, -0.000731304876f, 0.000147071309f, -6.91523554e-06f } },
+	{ "H-LAK53A", { 3.01460463f, -0.0136968806f, 0.0241031658f, -0.000167588963f, 8.27221505e-05f, -3.77703053e-06f } },
+	{ "H-LAK53B", { 3.01623609f, -0.0144609479f, 0.0229095394f, 0.000216967699f, 2.73048039e-05f, -9.80684551e-07f } },
+	{ "H-LAK54", { 2.94175946f, -0.0126663226f, 0.0243839518f, -0.000490360525f, 0.000138790487f, -7.39070455e-06f } },
+	{ "H-LAK59A", { 2.79972754f, -0.00873189032f, 0.0230159159f, -0.000850193825f, 0.000152864586f, -6.91746601e-06f } },
+	{ "H-LAK5A", { 2.76282776f, -0.0110853656f, 0.0190396002f, 5.14224172e-05f, 3.63740807e-05f, -1.55525971e-06f } },
+	{ "H-LAK61", { 2.96883578f, -0.0137037464f, 0.0224806873f, 0.00013022706f, 3.52478352e-05f, -1.34827056e-06f } },
+	{ "H-LAK67", { 2.7410828f, -0.016285022f, 0.015866919f, 0.0010819231f, -7.7131038e-05f, 4.033333e-06f } },
+	{ "H-LAK6A", { 2.81484052f, -0.0147823622f, 0.0190209745f, 0.000336628211f, 1.35687736e-05f, -5.85525604e-07f } },
+	{ "H-LAK7A", { 2.87982167f, -0.0147537347f, 0.0188595645f, 0.000746887433f, -6.23723325e-05f, 3.88098485e-06f } },
+	{ "H-LAK8A", { 2.89697306f, -0.0143738053f, 0.0222280432f, 0.000105067282f, 5.16989124e-05f, -1.90417816e-06f } },
+	{ "H-LAK8B", { 2.8950254f, -0.0117106099f, 0.0225402373f, 0.000146324301f, 4.12272418e-05f, -1.47798073e-06f } },
+	{ "H-QF14", { 2.48489196f, -0.00931778798f, 0.0204890803f, 0.000525537026f, -2.39700021e-06f, 4.02659016e-06f } },
+	{ "H-QF1", { 2.35209772f, -0.00953088569f, 0.0149480904f, 0.0006139718f, -3.07481422e-05f, 3.26363142e-06f } },
+	{ "H-QF3", { 2.42501025f, -0.00862223052f, 0.0193144869f, 0.000210375528f, 3.29751181e-05f, 1.50559094e-06f } },
+	{ "H-QF50A", { 2.44404966f, -0.00918670215f, 0.0196254289f, 0.000277356083f, 3.30397755e-05f, 1.33695258e-06f } },
+	{ "H-QF56", { 2.40441893f, -0.00857629873f, 0.0176754574f, 0.000438205807f, -1.42198699e-06f, 2.74287911e-06f } },
+	{ "H-QF6A", { 2.30458321f, -0.00865226981f, 0.0147424307f, 0.000146916808f, 2.49577574e-05f, 4.79637168e-07f } },
+	{ "H-QF8", { 2.32749417f, -0.007674586f, 0.017076264f, -0.000306358071f, 9.60375308e-05f, -3.46437878e-06f } },
+	{ "H-QK1", { 2.13732812f, -0.00894176765f, 0.00967010992f, -6.31093115e-05f, 2.62713578e-05f, -1.27152263e-06f } },
+	{ "H-QK3L", { 2.18873391f, -0.00969305681f, 0.00915154799f, 6.46567507e-05f, 9.18900583e-06f, -4.71149273e-07f } },
+	{ "H-TF3L", { 2.5493446f, -0.012566087f, 0.018232175f, 0.00067809743f, -2.8500371e-05f, 3.2560812e-06f } },
+	{ "H-TF5", { 2.66774774f, -0.0123753603f, 0.0236856508f, 0.000348562611f, 4.13195176e-05f, 7.37775936e-07f } },
+	{ "H-TF8", { 2.87079347f, -0.0122606251f, 0.029586462f, 0.000868012172f, 6.58046251e-06f, 4.82032902e-06f } },
+	{ "H-ZBAF16", { 2.7163405f, -0.00800848114f, 0.0220673585f, -0.000143211774f, 7.67032228e-05f, -2.71338303e-06f } },
+	{ "H-ZBAF1", { 2.57943f, -0.00757753047f, 0.0201786053f, -0.000845832798f, 0.000178126935f, -9.19232657e-06f } },
+	{ "H-ZBAF20", { 2.82081937f, -0.0100823647f, 0.0255084629f, 0.00032956767f, 5.02565379e-05f, 6.00432403e-07f } },
+	{ "H-ZBAF21", { 2.88488353f, -0.00963959047f, 0.029172134f, 0.000302410773f, 5.7628195e-05f, 2.46415353e-06f } },
+	{ "H-ZBAF3", { 2.69165216f, -0.0101363344f, 0.0186481237f, 0.000358040785f, 6.16688889e-06f, 5.75545763e-07f } },
+	{ "H-ZBAF4", { 2.69163001f, -0.00984427132f, 0.0256830841f, 0.000843697635f, -1.65735681e-05f, 6.7123065e-06f } },
+	{ "H-ZBAF50", { 2.69045194f, -0.00736356688f, 0.0226992125f, -0.000794594575f, 0.000161075119f, -6.92969544e-06f } },
+	{ "H-ZBAF52", { 2.72624888f, -0.00858990967f, 0.0222509606f, -2.894972e-05f, 6.84239255e-05f, -2.15508588e-06f } },
+	{ "H-ZBAF5", { 2.7282151f, -0.00801785321f, 0.0232797778f, -0.000366897021f, 0.000117676258f, -4.64381474e-06f } },
+	{ "H-ZF10", { 2.7617586f, -0.011254039f, 0.028221737f, 0.0017540315f, -0.00012127053f, 1.5522384e-05f } },
+	{ "H-ZF11", { 2.79257889f, -0.0123189318f, 0.0282213886f, 0.00233803553f, -0.000193264698f, 2.03435598e-05f } },
+	{ "H-ZF12", { 2.98833616f, -0.01558083f, 0.0325585737f, 0.00407634444f, -0.000423585266f, 4.04422209e-05f } },
+	{ "H-ZF13GT", { 3.05150937f, -0.0123177102f, 0.0421532614f, 0.00181669625f, -2.87661517e-05f, 1.88518506e-05f } },
+	{ "H-ZF13", { 3.05150937f, -0.0123177102f, 0.0421532614f, 0.00181669625f, -2.87661517e-05f, 1.88518506e-05f } },
+	{ "H-ZF1", { 2.636187f, -0.0097034146f, 0.0255502623f, 0.00100610407f, -4.2521904e-05f, 9.06375385e-06f } },
+	{ "H-ZF2", { 2.70748536f, -0.00876853099f, 0.030735315f, 0.000240155352f, 8.93430086e-05f, 3.65229043e-06f } },
+	{ "H-ZF39", { 2.69566345f, -0.0106305729f, 0.0263464696f, 0.0012869122f, -6.75605612e-05f, 1.09913394e-05f } },
+	{ "H-ZF3", { 2.85722177f, -0.0177283648f, 0.0259634053f, 0.0034434958f, -0.000319318567f, 2.68269122e-05f } },
+	{ "H-ZF4AGT", { 2.87667041f, -0.0108521785f, 0.0348454207f, 0.00163571517f, -8.15344316e-05f, 1.79346084e-05f } },
+	{ "H-ZF4A", { 2.87667041f, -0.0108521785f, 0.0348454207f, 0.00163571517f, -8.15344316e-05f, 1.79346084e-05f } },
+	{ "H-ZF50", { 2.92360946f, -0.0149760388f, 0.03002329f, 0.0038613679f, -0.000421158445f, 3.86612695e-05f } },
+	{ "H-ZF52A", { 3.2506862f, -0.0133942217f, 0.0483625913f, 0.00314442751f, -0.000197073674f, 3.47645679e-05f } },
+	{ "H-ZF52GT", { 3.26760058f, -0.0205384566f, 0.0351507672f, 0.00770151348f, -0.000908139817f, 7.52649555e-05f } },
+	{ "H-ZF52TT", { 3.26760058f, -0.0205384566f, 0.0351507672f, 0.00770151348f, -0.000908139817f, 7.52649555e-05f } },
+	{ "H-ZF52", { 3.26760058f, -0.0205384566f, 0.0351507672f, 0.00770151348f, -0.000908139817f, 7.52649555e-05f } },
+	{ "H-ZF5", { 2.91358387f, -0.0105930316f, 0.0366349235f, 0.00134643008f, -3.4696778e-05f, 1.5917092e-05f } },
+	{ "H-ZF62", { 3.50341992f, -0.0191891965f, 0.0536641379f, 0.00664979774f, -0.000678415522f, 8.33179504e-05f } },
+	{ "H-ZF6", { 2.9632067f, -0.0121274947f, 0.0364365808f, 0.00212579927f, -0.000130100151f, 2.14141061e-05f } },
+	{ "H-ZF71", { 3.12457417f, -0.0184343398f, 0.0395426536f, 0.0055116689f, -0.000577885043f, 6.1110918e-05f } },
+	{ "H-ZF72A", { 3.49933112f, -0.0270915729f, 0.0477045173f, 0.0109646331f, -0.00132276177f, 0.000133630751f } },
+	{ "H-ZF7LAGT", { 3.11930169f, -0.0120954989f, 0.0427579381f, 0.00249825483f, -0.000116785147f, 2.28047853e-05f } },
+	{ "H-ZF7LA", { 3.11930169f, -0.0120954989f, 0.0427579381f, 0.00249825483f, -0.000116785147f, 2.28047853e-05f } },
+	{ "H-ZF88", { 3.57552387f, -0.0303712686f, 0.0482363566f, 0.013150654f, -0.00163641867f, 0.000162274903f } },
+	{ "H-ZK10L", { 2.5987875f, -0.01767092f, 0.011069609f, 0.0013151858f, -0.00010779203f, 4.5458961e-06f } },
+	{ "H-ZK10", { 2.5840705f, -0.0087264109f, 0.017569665f, -0.00030815451f, 8.8794888e-05f, -4.7409985e-06f } },
+	{ "H-ZK11", { 2.6370236f, -0.010212072f, 0.017024722f, 0.00021432422f, 7.4387689e-06f, 4.3580605e-07f } },
+	{ "H-ZK14", { 2.53022442f, -0.0101985443f, 0.0142843974f, 0.000253350969f, -1.29976369e-05f, 1.10420609e-06f } },
+	{ "H-ZK1", { 2.42695876f, -0.0107508507f, 0.012802243f, 9.25440065e-05f, 1.33568132e-05f, -5.38892285e-07f } },
+	{ "H-ZK20", { 2.56416217f, -0.00663710078f, 0.0191195924f, -0.000520583562f, 0.000117796641f, -5.72026705e-06f } },
+	{ "H-ZK21", { 2.59019466f, -0.0103261557f, 0.0158597885f, 0.000158705075f, 8.97501936e-06f, -9.7736858e-08f } },
+	{ "H-ZK2", { 2.46852235f, -0.0101871678f, 0.0133916752f, 0.000329060714f, -1.21986536e-05f, 6.59142401e-07f } },
+	{ "H-ZK3A", { 2.48635025f, -0.00969802289f, 0.0145444434f, -6.42693019e-05f, 3.4793343e-05f, -1.53631738e-06f } },
+	{ "H-ZK3", { 2.48804118f, -0.0104146168f, 0.0133178501f, 0.000319390239f, -1.887969e-05f, 1.1928548e-06f } },
+	{ "H-ZK4", { 2.54489747f, -0.00883488409f, 0.0159113795f, -5.14042928e-05f, 3.62073286e-05f, -1.50010238e-06f } },
+	{ "H-ZK50GT", { 2.54140617f, -0.00972103422f, 0.0143707512f, 0.000594894245f, -4.88938359e-05f, 2.80646352e-06f } },
+	{ "H-ZK50", { 2.54140617f, -0.00972103422f, 0.0143707512f, 0.000594894245f, -4.88938359e-05f, 2.80646352e-06f } },
+	{ "H-ZK5", { 2.54498193f, -0.00576275042f, 0.0196014743f, -0.000812786508f, 0.000138354802f, -6.16579204e-06f } },
+	{ "H-ZK6", { 2.55828763f, -0.00978781657f, 0.0153557077f, 0.000130481426f, 1.76143611e-05f, -7.13242444e-07f } },
+	{ "H-ZK7", { 2.56229558f, -0.0108844706f, 0.0140997791f, 0.000379257039f, -2.41612681e-05f, 1.41616214e-06f } },
+	{ "H-ZK8", { 2.55701495f, -0.00765926112f, 0.0176261795f, -0.0002049981f, 6.81299541e-05f, -3.07368383e-06f } },
+	{ "H-ZK9A", { 2.58407802f, -0.0111281379f, 0.0154281597f, 2.64033929e-05f, 2.77466467e-05f, -1.24493904e-06f } },
+	{ "H-ZK9B", { 2.5813755f, -0.00958578041f, 0.0171950468f, -0.000507547344f, 0.000101126924f, -4.80045747e-06f } },
+	{ "H-ZLAF1", { 3.16228962f, -0.014206768f, 0.0294595374f, 0.000212856988f, 6.58725595e-05f, -1.65992623e-06f } },
+	{ "H-ZLAF2A", { 3.16963751f, -0.0138628788f, 0.0288233041f, -1.62994843e-05f, 8.61841046e-05f, -3.37002982e-06f } },
+	{ "H-ZLAF3", { 3.33260614f, -0.0142217301f, 0.0366299952f, 0.00102037909f, -3.17481272e-06f, 5.76556277e-06f } },
+	{ "H-ZLAF4LA", { 3.52200128f, -0.0121473151f, 0.0435909987f, 0.000593247086f, 8.40620002e-05f, 2.27233268e-06f } },
+	{ "H-ZLAF50D", { 3.17122941f, -0.0123809285f, 0.0303628745f, -0.000417232894f, 0.000142630066f, -6.197583e-06f } },
+	{ "H-ZLAF50E", { 3.17475472f, -0.0138702913f, 0.0278405909f, 0.000351405611f, 4.08115849e-05f, -1.46429081e-06f } },
+	{ "H-ZLAF51", { 3.16163938f, -0.0127262423f, 0.0325482205f, 0.000373836955f, 6.46085816e-05f, 7.28177708e-08f } },
+	{ "H-ZLAF52A", { 3.16845789f, -0.0114753166f, 0.0326408875f, 9.57006606e-05f, 9.63026379e-05f, -2.45219866e-06f } },
+	{ "H-ZLAF52", { 3.16943454f, -0.0124379117f, 0.0322101116f, 0.000181456299f, 8.90652926e-05f, -1.91933145e-06f } },
+	{ "H-ZLAF53BGT", { 3.25780649f, -0.0123377843f, 0.0355171622f, 0.000705690228f, 4.3498733e-05f, 1.95613611e-06f } },
+	{ "H-ZLAF53B", { 3.25780649f, -0.0123377843f, 0.0355171622f, 0.000705690228f, 4.3498733e-05f, 1.95613611e-06f } },
+	{ "H-ZLAF55C", { 3.27170954f, -0.0126721575f, 0.0335300924f, -2.4910401e-05f, 0.00010247728f, -2.87496464e-06f } },
+	{ "H-ZLAF55D", { 3.27258827f, -0.0129423515f, 0.032844328f, 0.000183315988f, 7.64020197e-05f, -1.75379429e-06f } },
+	{ "H-ZLAF56B", { 3.14933428f, -0.0111549297f, 0.0375191596f, 0.000787288786f, 2.9727118e-05f, 7.44861477e-06f } },
+	{ "H-ZLAF66GT", { 3.13578304f, -0.0105336277f, 0.0366011503f, 0.000398524293f, 7.65525829e-05f, 3.24358098e-06f } },
+	{ "H-ZLAF66", { 3.13578304f, -0.0105336277f, 0.0366011503f, 0.000398524293f, 7.65525829e-05f, 3.24358098e-06f } },
+	{ "H-ZLAF68B", { 3.43418261f, -0.0106199538f, 0.0400046303f, -0.000637942235f, 0.000216353029f, -8.49876445e-06f } },
+	{ "H-ZLAF68C", { 3.4376406f, -0.0115726315f, 0.0371406216f, 0.000330923804f, 7.3366651e-05f, -1.36270312e-06f } },
+	{ "H-ZLAF68N", { 3.43465461f, -0.0126976179f, 0.0380366168f, 0.000397530666f, 8.03440262e-05f, -6.06964244e-07f } },
+	{ "H-ZLAF69", { 3.2148109f, -0.012992517f, 0.029243707f, 0.00018800218f, 5.7106547e-05f, -1.9571482e-06f } },
+	{ "H-ZLAF71", { 3.30457034f, -0.0157032075f, 0.0374207147f, 0.00217455908f, -0.000149305709f, 1.85063226e-05f } },
+	{ "H-ZLAF75A", { 3.48751324f, -0.0149732265f, 0.0432288095f, 0.00210592206f, -0.000100284898f, 1.62326633e-05f } },
+	{ "H-ZLAF75B", { 3.48346668f, -0.0133305235f, 0.046504237f, 0.00100655469f, 5.58112511e-05f, 7.97155171e-06f } },
+	{ "H-ZLAF76", { 3.29759774f, -0.0171679311f, 0.0386912114f, 0.00268188761f, -0.00020390322f, 2.43325022e-05f } },
+	{ "H-ZLAF78B", { 3.49322693f, -0.0132987683f, 0.0400277433f, 0.000823139853f, 3.93075178e-05f, 2.86901814e-06f } },
+	{ "H-ZLAF89L", { 3.66932806f, -0.0136919991f, 0.0484216361f, 0.00132160482f, 2.4217258e-05f, 8.50124351e-06f } },
+	{ "H-ZLAF90", { 3.81589583f, -0.0188810016f, 0.0545200672f, 0.00508907678f, -0.000444175735f, 5.0454684e-05f } },
+	{ "H-ZLAF92", { 3.83592109f, -0.0155216804f, 0.0558392182f, 0.0025842306f, -9.64328404e-05f, 2.26279197e-05f } },
+	{ "H-ZPK1A", { 2.57612635f, -0.00780401598f, 0.0152465014f, -2.0774016e-05f, 2.28544414e-05f, -8.23333227e-07f } },
+	{ "H-ZPK2A", { 2.53073192f, -0.0083442991f, 0.0146551845f, -0.000216647389f, 5.35525389e-05f, -2.46158263e-06f } },
+	{ "H-ZPK3", { 2.50355665f, -0.00956011816f, 0.0134870279f, -0.000107119645f, 3.74651897e-05f, -1.78002982e-06f } },
+	{ "H-ZPK5", { 2.50010619f, -0.00601517032f, 0.0134084346f, -5.81410931e-05f, 3.0979864e-05f, -1.43396992e-06f } },
+	{ "K4A", { 2.24187488f, -0.00891932146f, 0.0126251741f, -0.000298598739f, 5.95648836e-05f, -2.58633231e-06f } },
+	{ "QF1", { 2.3504951f, -0.0086857021f, 0.016092857f, 0.00018705912f, 4.2149581e-05f, -1.3216062e-06f } },
+	{ "QF3", { 2.4245509f, -0.0079714057f, 0.019149892f, 0.00035505098f, 1.3941882e-05f, 1.705772e-06f } },
+	{ "QF50", { 2.4427964f, -0.00775720479f, 0.0201147743f, 0.000157059447f, 5.32738337e-05f, -6.98910829e-07f } },
+	{ "QF5", { 2.4440594f, -0.0067974631f, 0.021425387f, -0.00038544649f, 0.00012195244f, -4.2162236e-06f } },
+	{ "QF6", { 2.3044884f, -0.0083782321f, 0.014424342f, 0.00033374311f, -4.4657456e-06f, 1.3349929e-06f } },
+	{ "QF8", { 2.3287431f, -0.00786798f, 0.015763854f, 0.00019794235f, 1.8002892e-05f, 3.6533474e-07f } },
+	{ "TF3", { 2.54141593f, -0.0106607788f, 0.021716721f, -0.000401848477f, 0.000122475727f, -4.7776413e-06f } },
+	{ "ZBAF17", { 2.7114815f, -0.0083031047f, 0.023733195f, 0.00028197729f, 3.9409899e-05f, 7.1756265e-07f } },
+	{ "ZBAF2", { 2.6324147f, -0.0087251762f, 0.019124302f, 0.00044859331f, -1.7473295e-05f, 2.8601145e-06f } },
+	{ "ZBAF51", { 2.7590164f, -0.0058180526f, 0.026609946f, -0.00075485994f, 0.00017640459f, -6.7271173e-06f } },
+	{ "ZF10", { 2.75929053f, -0.00920455833f, 0.0293164338f, 0.00148740799f, -7.05223488e-05f, 9.9538848e-06f } },
+	{ "ZF11", { 2.7906689f, -0.010644977f, 0.029071854f, 0.0021286607f, -0.00015815625f, 1.7145247e-05f } },
+	{ "ZF12", { 2.99506991f, -0.0165672521f, 0.0256701429f, 0.00670445128f, -0.000837476647f, 6.26402774e-05f } },
+	{ "ZF13", { 3.06161235f, -0.0145895142f, 0.0328146593f, 0.00523989954f, -0.000560505494f, 4.64234125e-05f } },
+	{ "ZF1", { 2.6356161f, -0.008839642f, 0.025644781f, 0.00096522374f, -1.8304798e-05f, 5.5563517e-06f } },
+	{ "ZF2", { 2.70820441f, -0.00794171159f, 0.0292224783f, 0.000884931615f, 6.6862056e-07f, 5.65902766e-06f } },
+	{ "ZF3", { 2.84758519f, -0.0105088281f, 0.0309450925f, 0.00213696398f, -0.00013104012f, 1.42428874e-05f } },
+	{ "ZF4", { 2.89234898f, -0.0179339416f, 0.0230094722f, 0.00563906172f, -0.000698154951f, 5.25289979e-05f } },
+	{ "ZF50", { 2.9228084f, -0.013029549f, 0.029540007f, 0.0041308365f, -0.00044721542f, 3.7137603e-05f } },
+	{ "ZF51", { 3.06187076f, -0.0138733563f, 0.032985222f, 0.00507141578f, -0.000538606629f, 4.36089245e-05f } },
+	{ "ZF52", { 3.242645f, -0.00779545833f, 0.0533808621f, 0.00151154152f, 7.22194744e-05f, 1.6602659e-05f } },
+	{ "ZF5", { 2.9160432f, -0.010435647f, 0.033907872f, 0.0022728802f, -0.00013563213f, 1.6527592e-05f } },
+	{ "ZF6", { 2.96285995f, -0.0104077823f, 0.0356441238f, 0.00245699205f, -0.000149615893f, 1.77827751e-05f } },
+	{ "ZF7LGT", { 3.11724527f, -0.00977958678f, 0.0431752564f, 0.00252279577f, -0.00011739974f, 2.07881157e-05f } },
+	{ "ZF7L", { 3.11724527f, -0.00977958678f, 0.0431752564f, 0.00252279577f, -0.00011739974f, 2.07881157e-05f } },
+	{ "ZF7", { 3.1221966f, -0.010649791f, 0.042191871f, 0.002893766f, -0.00016523594f, 2.329181e-05f } },
+	{ "ZF8", { 2.6567173f, -0.0091117044f, 0.025815197f, 0.0011203564f, -4.1066817e-05f, 6.9242011e-06f } },
+	{ "K-BaF8", { 2.5830562f, -0.01131971f, 0.018817464f, 0.00027063309f, 2.1527561e-05f, 7.7761941e-07f } },
+	{ "K-BaF9", { 2.6455399f, -0.010990833f, 0.018955207f, 0.00040800743f, 9.934634e-06f, 9.3197902e-07f } },
+	{ "K-BaFn1", { 2.7669297f, -0.011669996f, 0.02151984f, 0.00070810281f, -2.495822e-05f, 3.7747946e-06f } },
+	{ "K-BaFn3", { 2.7128944f, -0.010619935f, 0.019653632f, 0.00040051165f, 1.1626539e-06f, 1.1579589e-06f } },
+	{ "K-BaSF4", { 2.6590501f, -0.011944106f, 0.02185629f, 0.0011761807f, -7.8567029e-05f, 8.1413835e-06f } },
+	{ "K-BaSF5", { 2.5165762f, -0.01183779f, 0.017631594f, 0.00095834052f, -6.7623905e-05f, 6.2543393e-06f } },
+	{ "K-BK7", { 2.2705778f, -0.010059376f, 0.010414999f, 0.00028872517f, -2.2214495e-05f, 1.4258559e-06f } },
+	{ "K-BOC20", { 3.8410887f, -0.015801048f, 0.055983447f, 0.0030905124f, -0.00016655999f, 2.7794823e-05f } },
+	{ "K-BOC30", { 3.8354813f, -0.015056123f, 0.060329996f, 0.002453809f, 1.7392287e-05f, 1.7174222e-05f } },
+	{ "K-BPG2", { 2.3909284f, -0.0090241173f, 0.014036614f, 0.00033108428f, -9.985229e-06f, 1.1070906e-06f } },
+	{ "K-CaFK95(M)", { 2.0377918f, -0.0045854882f, 0.0057460341f, 0.00014824175f, -1.2924899e-05f, 6.7640906e-07f } },
+	{ "K-CaFK95", { 2.0408226f, -0.0045471403f, 0.0058631038f, 0.00012966471f, -1.1902639e-05f, 6.9279944e-07f } },
+	{ "K-CD120(M)", { 2.8398034f, -0.011893586f, 0.03115793f, 0.0018504658f, -0.00010451266f, 1.6018658e-05f } },
+	{ "K-CD120", { 2.8630662f, -0.011977981f, 0.032706279f, 0.0016821116f, -7.4783483e-05f, 1.4696883e-05f } },
+	{ "K-CD45(M)", { 2.7618542f, -0.011387611f, 0.02681912f, 0.0011728044f, -3.975188e-05f, 8.2439775e-06f } },
+	{ "K-CD45", { 2.780768f, -0.011432782f, 0.02823867f, 0.0009260712f, 5.9615098e-06f, 5.5996227e-06f } },
+	{ "K-CSK120(M)", { 2.4722418f, -0.01073376f, 0.013736108f, 0.00027440551f, -9.8995396e-06f, 8.2295122e-07f } },
+	{ "K-CSK120", { 2.4804566f, -0.01071977f, 0.0135632f, 0.00034918608f, -2.3041786e-05f, 1.5937217e-06f } },
+	{ "K-FIR97UV", { 2.0169979f, -0.0038361684f, 0.0058184635f, 4.503131e-05f, 6.6434463e-07f, 5.0922311e-09f } },
+	{ "K-FIR98UV", { 2.0158016f, -0.0038179076f, 0.0058067887f, 4.2558748e-05f, 7.6622455e-07f, 1.6716816e-09f } },
+	{ "K-FK5", { 2.189197f, -0.0097642231f, 0.0086917382f, 0.00023646623f, -1.7699987e-05f, 9.6989631e-07f } },
+	{ "K-GFK68(M)", { 2.4921178f, -0.0059252429f, 0.012541311f, 0.00020379328f, -3.7798198e-06f, 2.5829936e-07f } },
+	{ "K-GFK68", { 2.4994867f, -0.0059285872f, 0.012743526f, 0.00015469636f, 3.9947612e-06f, -1.760356e-07f } },
+	{ "K-GFK70(M)", { 2.4208616f, -0.0057307899f, 0.011396384f, 0.00014964607f, 3.8084377e-06f, -3.2734834e-07f } },
+	{ "K-GFK70", { 2.4293935f, -0.0057591097f, 0.011512013f, 0.0001324924f, 7.3250033e-06f, -5.7195445e-07f } },
+	{ "K-GIR140", { 2.9854628f, -0.0065859032f, 0.026407911f, 0.00084695423f, -3.2505558e-05f, 3.1878545e-06f } },
+	{ "K-GIR79", { 3.3195074f, -0.0085801253f, 0.039978521f, 0.0014465322f, -3.0453007e-05f, 7.8005005e-06f } },
+	{ "K-LaF2", { 2.969235f, -0.01236657f, 0.024178838f, 0.00087063153f, -4.4196612e-05f, 4.4742987e-06f } },
+	{ "K-LaFK50(M)", { 3.0568421f, -0.011998981f, 0.024194996f, 0.0004815051f, 2.2084112e-06f, 4.3040075e-07f } },
+	{ "K-LaFK50T(M)", { 3.0365333f, -0.012640924f, 0.023542665f, 0.00054022154f, 3.5952261e-06f, -3.549746e-07f } },
+	{ "K-LaFK50T", { 3.0499602f, -0.012620328f, 0.023782461f, 0.00047558583f, 1.3668355e-05f, -8.9484311e-07f } },
+	{ "K-LaFK50", { 3.070131f, -0.012037535f, 0.023978866f, 0.00056153238f, -1.0529871e-05f, 1.1710915e-06f } },
+	{ "K-LaFK55(M)", { 2.8008078f, -0.013188685f, 0.01809632f, 0.00040852782f, -1.2855113e-05f, 1.0513058e-06f } },
+	{ "K-LaFK55", { 2.8185206f, -0.013230603f, 0.018037587f, 0.00045589602f, -2.131672e-05f, 1.5724724e-06f } },
+	{ "K-LaFK58(M)", { 2.8101512f, -0.012726602f, 0.017535146f, 0.00035913422f, -8.8851874e-06f, 6.1852602e-07f } },
+	{ "K-LaFK58", { 2.8262394f, -0.012783119f, 0.017254526f, 0.00043487714f, -1.9342271e-05f, 1.18082e-06f } },
+	{ "K-LaFK60(M)", { 2.6117274f, -0.01021392f, 0.014472638f, 0.00020938021f, 2.8785693e-06f, -9.063171e-08f } },
+	{ "K-LaFK60", { 2.6248172f, -0.010251149f, 0.0143793f, 0.00024017461f, -1.041901e-06f, 1.0237991e-07f } },
+	{ "K-LaFK65(M)", { 2.6875081f, -0.011599607f, 0.015290297f, 0.00024225647f, 4.1061121e-06f, -2.0740076e-07f } },
+	{ "K-LaFK65", { 2.7016579f, -0.011617767f, 0.015597681f, 0.00019111207f, 1.132323e-05f, -5.9630893e-07f } },
+	{ "K-LaFn11", { 2.8917009f, -0.011920903f, 0.022558933f, 0.00079204231f, -4.0820426e-05f, 4.1373045e-06f } },
+	{ "K-LaFn3", { 2.827081f, -0.010220727f, 0.021224097f, 0.0006653956f, -3.3316539e-05f, 3.16429e-06f } },
+	{ "K-LaFn5", { 2.9746618f, -0.015490396f, 0.021676376f, 0.0007907947f, -3.5069226e-05f, 2.1235401e-06f } },
+	{ "K-LaK10", { 2.8960747f, -0.011713123f, 0.021599254f, 0.00043811038f, 5.752903e-06f, -1.7364157e-07f } },
+	{ "K-LaK11", { 2.703071f, -0.011555097f, 0.016440907f, 0.00044044678f, -2.1866961e-05f, 1.3531002e-06f } },
+	{ "K-LaK12", { 2.7644388f, -0.011785176f, 0.017957173f, 0.00034733134f, 3.6439617e-06f, -3.286378e-07f } },
+	{ "K-LaK14", { 2.8277206f, -0.013838479f, 0.0179847f, 0.00057777884f, -3.7712827e-05f, 2.2935918e-06f } },
+	{ "K-LaK18", { 2.9333796f, -0.014920134f, 0.020207432f, 0.00041238589f, -1.230332e-05f, 1.1436994e-06f } },
+	{ "K-LaK6", { 2.6532657f, -0.011570116f, 0.015955637f, 0.00023811283f, 1.7165459e-05f, -1.4129709e-06f } },
+	{ "K-LaK7", { 2.6835737f, -0.012086498f, 0.015193489f, 0.00064847987f, -5.2423893e-05f, 2.8301452e-06f } },
+	{ "K-LaK8", { 2.8797142f, -0.015009518f, 0.01933782f, 0.00048379963f, -1.1367908e-05f, 7.0484275e-07f } },
+	{ "K-LaK9", { 2.8065086f, -0.012084694f, 0.018509723f, 0.00045689652f, -1.5275984e-05f, 1.0018509e-06f } },
+	{ "K-LaKn11", { 2.6994624f, -0.011441236f, 0.017672891f, 0.00039604649f, -3.5739234e-06f, 7.0861608e-07f } },
+	{ "K-LaKn14", { 2.9713549f, -0.015047149f, 0.020748381f, 0.00068239287f, -4.5897244e-05f, 3.0151479e-06f } },
+	{ "K-LaKn2", { 2.6498456f, -0.013078949f, 0.014887079f, 0.0003621869f, -1.1506273e-05f, 6.1300945e-07f } },
+	{ "K-LaKn4", { 2.744955f, -0.013026744f, 0.016661518f, 0.00048278001f, -2.5815825e-05f, 1.5241247e-06f } },
+	{ "K-LaKn5", { 2.6761221f, -0.012108757f, 0.016143507f, 0.00051920927f, -2.8395319e-05f, 1.8554978e-06f } },
+	{ "K-LaKn7", { 2.735741f, -0.011476747f, 0.017975035f, 0.00072020288f, -5.1933951e-05f, 3.5980087e-06f } },
+	{ "K-LaSFn10", { 3.2128137f, -0.015587464f, 0.028249299f, 0.00086439607f, -2.9175496e-05f, 2.9912535e-06f } },
+	{ "K-LaSFn14", { 3.2643191f, -0.016265121f, 0.03202838f, 0.0015271854f, -4.7775544e-05f, 5.7345907e-06f } },
+	{ "K-LaSFn16", { 3.124535f, -0.014985014f, 0.024795878f, 0.00096271556f, -6.4587038e-05f, 4.6162437e-06f } },
+	{ "K-LaSFn17", { 3.4434117f, -0.015474743f, 0.033695975f, 0.0012878574f, -4.547423e-05f, 3.867959e-06f } },
+	{ "K-LaSFn1", { 3.1704478f, -0.012872124f, 0.030711328f, 0.00091467552f, -4.2179151e-05f, 5.885503e-06f } },
+	{ "K-LaSFn21", { 3.3040338f, -0.016019748f, 0.037645989f, 0.0021532464f, -0.00020498123f, 2.7623217e-05f } },
+	{ "K-LaSFn22", { 3.477103f, -0.01493764f, 0.040192699f, 0.0018404932f, -0.00010009344f, 1.4346776e-05f } },
+	{ "K-LaSFn23", { 3.527437f, -0.014640706f, 0.040393831f, 0.0015495078f, -4.5667249e-05f, 9.0971269e-06f } },
+	{ "K-LaSFn2", { 3.1666472f, -0.014823032f, 0.030366123f, 0.0010942894f, -4.2108569e-05f, 5.7186779e-06f } },
+	{ "K-LaSFn3", { 3.1507226f, -0.012460963f, 0.029910697f, 0.00050733106f, 3.6278868e-05f, -2.5019766e-08f } },
+	{ "K-LaSFn4", { 3.1049984f, -0.013342479f, 0.027506526f, 0.00075451621f, -1.6565687e-05f, 2.780481e-06f } },
+	{ "K-LaSFn6", { 3.1766024f, -0.015214563f, 0.026674405f, 0.00074674513f, -2.63508e-05f, 2.7514981e-06f } },
+	{ "K-LaSFn7", { 3.0728806f, -0.014815338f, 0.024064142f, 0.00049961497f, 1.2852807e-06f, 5.2262074e-07f } },
+	{ "LASFN7", { 3.0728806f, -0.014815338f, 0.024064142f, 0.00049961497f, 1.2852807e-06f, 5.2262074e-07f } },
+	{ "K-LaSFn8", { 3.2767321f, -0.015115573f, 0.030753445f, 0.00078350578f, -3.4594495e-06f, 2.0542573e-06f } },
+	{ "K-LaSFn9", { 3.2184433f, -0.014906369f, 0.02692619f, 0.00087409748f, -4.0331281e-05f, 3.1677745e-06f } },
+	{ "K-LaSKn1", { 3.0176028f, -0.01512239f, 0.021959514f, 0.00052144528f, -1.8693935e-05f, 1.6369365e-06f } },
+	{ "K-LCV93(M)", { 2.710346f, -0.012314299f, 0.019185803f, 0.00080136306f, -5.2048587e-05f, 3.7543007e-06f } },
+	{ "K-LCV93", { 2.7157014f, -0.012306139f, 0.019299156f, 0.00076108019f, -4.4909824e-05f, 3.3413499e-06f } },
+	{ "K-PBK40(M)", { 2.2666695f, -0.010697246f, 0.010455014f, 0.00024731938f, -9.4216199e-06f, 3.3360125e-07f } },
+	{ "K-PBK40", { 2.2744024f, -0.01070289f, 0.010577306f, 0.00022857431f, -7.2914225e-06f, 2.4124054e-07f } },
+	{ "K-PBK50(M)", { 2.2812358f, -0.010469171f, 0.010938493f, 0.00025045867f, -1.2796276e-05f, 7.9827772e-07f } },
+	{ "K-PBK50", { 2.2879519f, -0.010513752f, 0.010963175f, 0.00027027054f, -1.7054549e-05f, 1.0857039e-06f } },
+	{ "K-PFK80(M)", { 2.212796f, -0.0056313014f, 0.0083136801f, 0.00015790111f, -1.2884506e-05f, 8.4786533e-07f } },
+	{ "K-PFK80", { 2.2178347f, -0.0055966846f, 0.0083703747f, 0.0001097485f, -3.3983937e-06f, 2.5836351e-07f } },
+	{ "K-PFK85(M)", { 2.180434f, -0.0050369414f, 0.007415342f, 0.000191031f, -1.3017551e-05f, 6.1457339e-07f } },
+	{ "K-PFK85", { 2.1858326f, -0.0050155632f, 0.0075107775f, 0.00017770562f, -1.2164148e-05f, 6.1341005e-07f } },
+	{ "K-PFK90(M)", { 2.1052634f, -0.0048076047f, 0.0067206257f, 8.8399512e-05f, -3.9955764e-08f, -6.7493689e-08f } },
+	{ "K-PFK90", { 2.1094643f, -0.0048026812f, 0.0067645351f, 8.3329962e-05f, 3.4196126e-07f, -8.4933854e-08f } },
+	{ "K-PG325(M)", { 2.2385136f, -0.0070158219f, 0.0095692073f, 0.00018606584f, -8.4285475e-06f, 5.3174439e-07f } },
+	{ "K-PG325", { 2.2433502f, -0.0070443238f, 0.0095932746f, 0.00019364616f, -9.8585539e-06f, 6.1088785e-07f } },
+	{ "K-PG375(M)", { 2.3359595f, -0.0077028465f, 0.011800095f, 0.00020814746f, -3.5241725e-06f, 3.1241519e-07f } },
+	{ "K-PG375", { 2.345943f, -0.0077317211f, 0.011783664f, 0.00025239185f, -1.2352344e-05f, 8.7540057e-07f } },
+	{ "K-PG395(M)", { 2.6598043f, -0.0097241142f, 0.023341531f, 0.0010595162f, -4.9515252e-05f, 7.5464331e-06f } },
+	{ "K-PG395", { 2.6754764f, -0.0097406258f, 0.023844634f, 0.00098091134f, -3.8466006e-05f, 6.9920317e-06f } },
+	{ "K-PMK30(M)", { 2.2835931f, -0.0098380554f, 0.010317986f, -3.5867157e-06f, 2.1079335e-05f, -1.145809e-06f } },
+	{ "K-PMK30", { 2.2984199f, -0.0098977917f, 0.010454435f, -1.1762246e-05f, 2.220678e-05f, -1.2212713e-06f } },
+	{ "K-PSFn173(M)", { 4.2616161f, -0.013994195f, 0.095197887f, 0.0078651735f, -0.00053525936f, 0.00012395474f } },
+	{ "K-PSFn173", { 4.2785429f, -0.014012371f, 0.096019323f, 0.0077567166f, -0.00051560398f, 0.00012285966f } },
+	{ "K-PSFn1(M)", { 3.418365f, -0.015830577f, 0.056024892f, 0.0042907055f, -0.00027089374f, 4.8560287e-05f } },
+	{ "K-PSFn1", { 3.4407637f, -0.015750622f, 0.059024249f, 0.0035647556f, -0.00012641103f, 4.0309245e-05f } },
+	{ "K-PSFn202(M)", { 3.8290543f, -0.016470594f, 0.065112852f, 0.0059865818f, -0.00053116084f, 7.8076366e-05f } },
+	{ "K-PSFn202", { 3.8508789f, -0.016529344f, 0.066096066f, 0.0058480521f, -0.0005055984f, 7.6558669e-05f } },
+	{ "K-PSFn203(M)", { 3.812992f, -0.016672868f, 0.067171636f, 0.0057116528f, -0.00042822929f, 7.1278944e-05f } },
+	{ "K-PSFn203", { 3.8348467f, -0.016749417f, 0.068052702f, 0.0056319146f, -0.00041721893f, 7.0964768e-05f } },
+	{ "K-PSFn214(M)", { 4.2564848f, -0.015091057f, 0.086600358f, 0.011001775f, -0.0012680564f, 0.00017404024f } },
+	{ "K-PSFn214", { 4.2741747f, -0.015216929f, 0.086704477f, 0.011238379f, -0.0013209006f, 0.00017823575f } },
+	{ "K-PSFn215", { 4.2994108f, -0.014091413f, 0.097855062f, 0.0076857652f, -0.00046786841f, 0.00012218724f } },
+	{ "K-PSFn2(M)", { 3.7527514f, -0.013079452f, 0.07043447f, 0.0041015753f, -0.00012706916f, 4.6413732e-05f } },
+	{ "K-PSFn2", { 3.7699503f, -0.013004151f, 0.072310519f, 0.0035123072f, -1.0361594e-05f, 3.8615781e-05f } },
+	{ "K-PSFn3(M)", { 3.2096325f, -0.014576663f, 0.046141656f, 0.0029954432f, -0.00015107775f, 3.0074532e-05f } },
+	{ "K-PSFn3", { 3.2268914f, -0.014590158f, 0.047763869f, 0.0027173637f, -9.5689164e-05f, 2.7097845e-05f } },
+	{ "K-PSFn4(M)", { 3.2298971f, -0.011389181f, 0.047192351f, 0.0024487094f, -6.4886719e-05f, 2.1045135e-05f } },
+	{ "K-PSFn4", { 3.2452002f, -0.011397767f, 0.048209487f, 0.0022384274f, -2.8034687e-05f, 1.8880187e-05f } },
+	{ "K-PSFn5(M)", { 3.480338f, -0.011368322f, 0.05808586f, 0.0034779702f, -0.0001519768f, 3.6318702e-05f } },
+	{ "K-PSFn5", { 3.4965005f, -0.011373234f, 0.059139817f, 0.0031967827f, -9.7424772e-05f, 3.2744737e-05f } },
+	{ "K-PSK100(M)", { 2.4831321f, -0.0090721125f, 0.013641591f, 0.00021543576f, 8.6973883e-06f, -6.5012493e-07f } },
+	{ "K-PSK100", { 2.4948235f, -0.0091228463f, 0.013721276f, 0.00023830265f, 4.1915859e-06f, -3.8958137e-07f } },
+	{ "K-PSK11(M)", { 2.3980346f, -0.0090774696f, 0.012465635f, 0.00027492499f, -9.3436202e-06f, 7.809668e-07f } },
+	{ "K-PSK11", { 2.4158701f, -0.0091407676f, 0.012869238f, 0.0001991764f, 2.7958423e-06f, 8.1672946e-08f } },
+	{ "K-PSK200(M)", { 2.5524515f, -0.0088629121f, 0.014923738f, 0.00026036731f, -2.7057207e-06f, 4.8084913e-07f } },
+	{ "K-PSK200", { 2.5593395f, -0.0088787219f, 0.015115397f, 0.0002035651f, 7.5991137e-06f, -1.5375246e-07f } },
+	{ "K-PSK300(M)", { 2.5141824f, -0.0093945858f, 0.012823443f, 0.00025005056f, -3.928511e-06f, 4.4650519e-08f } },
+	{ "K-PSK300", { 2.5225185f, -0.0094325814f, 0.012753583f, 0.00028565036f, -8.905806e-06f, 2.8110143e-07f } },
+	{ "K-PSK400(M)", { 2.4983595f, -0.0073445422f, 0.012430575f, 0.00026343152f, -1.3169766e-05f, 8.1753544e-07f } },
+	{ "K-PSK400", { 2.5082353f, -0.0073346094f, 0.012618342f, 0.00023225231f, -9.8397157e-06f, 6.9870981e-07f } },
+	{ "K-PSK500(M)", { 2.3725199f, -0.0067756972f, 0.01066551f, 0.00018548975f, -5.7674134e-06f, 3.2946743e-07f } },
+	{ "K-PSK500", { 2.3790067f, -0.0067863375f, 0.01075028f, 0.00017281188f, -3.9024656e-06f, 2.2878462e-07f } },
+	{ "K-PSKn2", { 2.578886f, -0.010381408f, 0.014233563f, 0.00012483021f, 1.7477672e-05f, -9.6204805e-07f } },
+	{ "K-SFLD11", { 3.052913f, -0.012276955f, 0.041487837f, 0.0019043764f, -3.1653157e-05f, 1.7320425e-05f } },
+	{ "K-SFLD14", { 2.9793916f, -0.011878549f, 0.03964328f, 0.0014928665f, 1.9358213e-05f, 1.2712921e-05f } },
+	{ "K-SFLD1", { 2.8465679f, -0.01179579f, 0.032766631f, 0.0014514223f, -4.8225155e-05f, 1.2981324e-05f } },
+	{ "K-SFLD4", { 2.9621759f, -0.011836005f, 0.037648353f, 0.0015341601f, -1.0776303e-05f, 1.378924e-05f } },
+	{ "K-SFLD66", { 3.09503f, -0.012322111f, 0.043740379f, 0.0024511569f, -9.9218754e-05f, 2.3715962e-05f } },
+	{ "K-SFLD6", { 3.1176009f, -0.012108189f, 0.044689743f, 0.0016574765f, 4.1984442e-05f, 1.29135e-05f } },
+	{ "SFLD6", { 3.1176009f, -0.012108189f, 0.044689743f, 0.0016574765f, 4.1984442e-05f, 1.29135e-05f } },
+	{ "K-SFLD8", { 2.7609221f, -0.011601354f, 0.029309701f, 0.0012957192f, -3.6971081e-05f, 9.8723481e-06f } },
+	{ "K-SFLDn3", { 3.2503692f, -0.013195714f, 0.049790724f, 0.0022430157f, -7.7567761e-06f, 2.1169316e-05f } },
+	{ "K-SK14", { 2.5313894f, -0.010956275f, 0.013803544f, 0.00029803889f, -6.2451964e-06f, 2.5686024e-07f } },
+	{ "K-SK15", { 2.5918508f, -0.010567563f, 0.014411695f, 0.00063226961f, -5.7927037e-05f, 3.4193172e-06f } },
+	{ "K-SK16RH", { 2.5853303f, -0.011740187f, 0.014496524f, 0.0003287161f, -1.5804639e-05f, 1.1016183e-06f } },
+	{ "K-SK18RH", { 2.6368942f, -0.00998234f, 0.017151413f, 0.00011644223f, 3.4189945e-05f, -1.8645959e-06f } },
+	{ "K-SK18", { 2.6383229f, -0.010806956f, 0.016153414f, 0.00046673954f, -2.5414619e-05f, 1.9703165e-06f } },
+	{ "K-SK4", { 2.5587726f, -0.0098095616f, 0.014840563f, 0.0003193166f, -1.016436e-05f, 6.6518794e-07f } },
+	{ "K-SK5", { 2.4895419f, -0.011359477f, 0.012448401f, 0.00055781133f, -5.0555753e-05f, 2.8679508e-06f } },
+	{ "K-SK7", { 2.5429277f, -0.01031719f, 0.014356944f, 0.00031433872f, -1.0824341e-05f, 6.8100892e-07f } },
+	{ "K-SKF6(M)", { 2.2407767f, -0.008821111f, 0.011852627f, 0.00046630703f, -2.7146793e-05f, 2.5187584e-06f } },
+	{ "K-SKF6", { 2.2505164f, -0.0088684142f, 0.012260534f, 0.00042234633f, -2.1095054e-05f, 2.2440064e-06f } },
+	{ "K-SKLD120(M)", { 2.47209f, -0.011710437f, 0.013292551f, 0.00033538382f, -1.3094931e-05f, 4.3086267e-07f } },
+	{ "K-SKLD120", { 2.4809256f, -0.011763845f, 0.013309488f, 0.00032545605f, -9.9643058e-06f, 2.0790854e-07f } },
+	{ "K-SSK1", { 2.5692173f, -0.010022582f, 0.016067095f, 0.00039868115f, -1.5698671e-05f, 1.1774033e-06f } },
+	{ "K-SSK3", { 2.5591851f, -0.0099057522f, 0.016577727f, 0.00054738619f, -3.5329686e-05f, 2.4596919e-06f } },
+	{ "K-SSK4", { 2.5720683f, -0.010564186f, 0.015625643f, 0.00040593207f, -1.3424134e-05f, 6.4355621e-07f } },
+	{ "K-SSK9", { 2.5737917f, -0.0093452955f, 0.017645209f, 0.00035765081f, 1.1614434e-06f, 1.16034e-06f } },
+	{ "K-VC100(M)", { 3.1544352f, -0.014806744f, 0.027996766f, 0.00079379644f, -1.0802615e-05f, 2.172329e-06f } },
+	{ "K-VC100", { 3.1712708f, -0.014897108f, 0.028163952f, 0.00083222761f, -1.9276093e-05f, 2.7257034e-06f } },
+	{ "K-VC179(M)", { 3.1342666f, -0.013761215f, 0.028817199f, 0.00082006501f, -5.3846865e-06f, 2.2272066e-06f } },
+	{ "K-VC179", { 3.1494851f, -0.013835107f, 0.029184533f, 0.00080707995f, -6.1706552e-06f, 2.3930989e-06f } },
+	{ "K-VC181(M)", { 3.1735917f, -0.01381902f, 0.029219972f, 0.0011233335f, -4.4143284e-05f, 4.6335289e-06f } },
+	{ "K-VC181", { 3.1886895f, -0.013820455f, 0.029631617f, 0.0010659501f, -3.7795055e-05f, 4.3966629e-06f } },
+	{ "K-VC185(M)", { 3.3218568f, -0.014962898f, 0.032206874f, 0.0011931823f, -5.072415e-05f, 5.1953408e-06f } },
+	{ "K-VC185", { 3.3380677f, -0.014969129f, 0.032739414f, 0.0011048947f, -3.8597399e-05f, 4.5931893e-06f } },
+	{ "K-VC78(M)", { 2.7266185f, -0.012222673f, 0.017519329f, 0.00043056615f, -2.0621869e-05f, 1.440444e-06f } },
+	{ "K-VC78", { 2.7376882f, -0.012269245f, 0.017439403f, 0.00047088707f, -2.7150134e-05f, 1.8172045e-06f } },
+	{ "K-VC79(M)", { 2.5419536f, -0.011244659f, 0.014723741f, 0.00042825747f, -3.3933216e-05f, 2.2129238e-06f } },
+	{ "K-VC79", { 2.5520489f, -0.011234947f, 0.014455084f, 0.00046725318f, -3.6714004e-05f, 2.2810504e-06f } },
+	{ "K-VC80(M)", { 2.800208f, -0.012536465f, 0.019904622f, 0.00012816526f, 4.6545827e-05f, -2.8784776e-06f } },
+	{ "K-VC80", { 2.8135722f, -0.012577591f, 0.019933465f, 0.00015711222f, 4.0676176e-05f, -2.4977604e-06f } },
+	{ "K-VC82(M)", { 2.9914895f, -0.01436707f, 0.024650584f, 0.00071568019f, -2.7938999e-05f, 3.2293973e-06f } },
+	{ "K-VC82", { 3.0092545f, -0.014428442f, 0.024950143f, 0.0006532589f, -1.7536585e-05f, 2.6440099e-06f } },
+	{ "K-VC89(M)", { 3.1717081f, -0.013708448f, 0.029629026f, 0.0011150095f, -5.5576606e-05f, 5.6941122e-06f } },
+	{ "K-VC89", { 3.1860388f, -0.013756822f, 0.029614017f, 0.0012383727f, -8.0134175e-05f, 7.2330635e-06f } },
+	{ "K-VC90(M)", { 3.3149515f, -0.013619007f, 0.033842693f, 0.001108869f, -2.8110622e-05f, 5.1120171e-06f } },
+	{ "K-VC90", { 3.3299316f, -0.013661207f, 0.034088332f, 0.0010979548f, -2.7983676e-05f, 5.172898e-06f } },
+	{ "K-VC91(M)", { 3.4226561f, -0.014620569f, 0.037712137f, 0.0019015089f, -0.00011042813f, 1.2477487e-05f } },
+	{ "K-VC91", { 3.4399333f, -0.014633437f, 0.037625197f, 0.0021748752f, -0.00016417982f, 1.5817576e-05f } },
+	{ "K-VC99(M)", { 3.3130252f, -0.01525551f, 0.031799975f, 0.0010027504f, -2.7509191e-05f, 3.4290858e-06f } },
+	{ "K-VC99", { 3.3294765f, -0.015324675f, 0.031941277f, 0.0010078745f, -2.8400554e-05f, 3.488686e-06f } },
+	{ "K-ZnSF8(M)", { 2.8508369f, -0.012006057f, 0.025904826f, 0.0009056149f, -2.8090015e-05f, 4.695922e-06f } },
+	{ "K-ZnSF8", { 2.8600337f, -0.012073452f, 0.026131306f, 0.00091303268f, -3.0467767e-05f, 4.891802e-06f } },
+};
+
+inline constexpr int glassCatalogSize = sizeof( glassCatalog ) / sizeof( GlassEntry );
+
+constexpr int CompareGlassNames( const char* a, const char* b )
+{
+	while ( *a && *a == *b ) a++, b++;
+	return (unsigned char)*a - (unsigned char)*b;
+}
+
+//
+// Sorts the catalog by name at compile time, a bottom up merge sort on indices. Merge sort is stable, so of duplicate
+// names the first one in the catalog ends up first, which is the one Glass::Find returns.
+//
+typedef std::array<unsigned short, glassCatalogSize> GlassIndex;
+constexpr GlassIndex SortGlassCatalog()
+{
+	GlassIndex index{}, scratch{};
+	for ( int i = 0; i < glassCatalogSize; i++ ) index[i] = (unsigned short)i;
+	for ( int width = 1; width < glassCatalogSize; width *= 2 )
+	{
+		for ( int left = 0; left < glassCatalogSize; left += 2 * width )
+		{
+			int middle = std::min( left + width, glassCatalogSize ), right = std::min( left + 2 * width, glassCatalogSize );
+			int a = left, b = middle, out = left;
+			while ( a < middle && b < right )
+				scratch[out++] = CompareGlassNames( glassCatalog[index[b]].name, glassCatalog[index[a]].name ) < 0 ? index[b++] : index[a++];
+			while ( a < middle ) scratch[out++] = index[a++];
+			while ( b < right ) scratch[out++] = index[b++];
+		}
+		for ( int i = 0; i < glassCatalogSize; i++ ) index[i] = scratch[i];
+	}
+	return index;
+}
+
+inline constexpr GlassIndex glassCatalogIndex = SortGlassCatalog();
+
+class Glass
+{
+  public:
+	// returns the dispersion constants of a certain glass type, or those of air (after reporting an error) when it is unknown
+	static DispersionConstants GetDispersionConstants( const std::string& material )
+	{
+		const GlassEntry* glass = Find( material.c_str() );
+		if ( glass ) return glass->dc;
 
 		std::cout << "ERROR in loading glass data: Material " + material + " not defined!" << std::endl;
 		return { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
 	}
+
+	// binary search in the sorted index, returns nullptr when the glass is not in the catalog
+	static constexpr const GlassEntry* Find( const char* material )
+	{
+		int first = 0, count = glassCatalogSize;
+		while ( count > 0 )
+		{
+			int half = count / 2;
+			if ( CompareGlassNames( glassCatalog[glassCatalogIndex[first + half]].name, material ) < 0 )
+				first += half + 1, count -= half + 1;
+			else
+				count = half;
+		}
+		if ( first < glassCatalogSize && CompareGlassNames( glassCatalog[glassCatalogIndex[first]].name, material ) == 0 )
+			return &glassCatalog[glassCatalogIndex[first]];
+		return nullptr;
+	}
+
+	// the lookup the sorted index replaced, comparing against every glass in catalog order (kept for Benchmark::Import)
+	static const GlassEntry* FindLinear( const char* material )
+	{
+		for ( int i = 0; i < glassCatalogSize; i++ )
+			if ( strcmp( glassCatalog[i].name, material ) == 0 ) return &glassCatalog[i];
+		return nullptr;
+	}
 };
+
+static_assert( Glass::Find( "AIR" ) == &glassCatalog[0], "glass catalog lookup is broken" );
+static_assert( Glass::Find( "F4" ) == &glassCatalog[2], "glass catalog lookup is broken" );
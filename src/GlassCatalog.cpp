@@ -0,0 +1,227 @@
+#include "precomp.h"
+
+bool GlassCatalog::Find( const std::vector<std::string>& catalogs, const std::string& material, DispersionConstants* dc )
+{
+	for ( const std::string& name : catalogs )
+	{
+		const GlassCatalog* catalog = Get( name );
+		const CachedGlass* glass = catalog ? catalog->Find( material.c_str() ) : nullptr;
+		if ( glass )
+		{
+			*dc = glass->dc;
+			return true;
+		}
+	}
+	return false;
+}
+
+const GlassCatalog* GlassCatalog::Get( const std::string& name )
+{
+	static std::mutex lock;
+	static std::map<std::string, GlassCatalog*> catalogs; // loaded once and kept for the lifetime of the process
+
+	std::lock_guard<std::mutex> guard( lock );
+
+	auto it = catalogs.find( name );
+	if ( it != catalogs.end() ) return it->second;
+
+	GlassCatalog* catalog = new GlassCatalog();
+	std::string path = std::string( GLASS_CATALOG_DIR ) + "/" + name;
+	if ( !catalog->Load( path + ".agf" ) && !catalog->Load( path + ".AGF" ) )
+	{
+		// not worth a warning by itself, most lenses only use glasses that are built in; see LensSystem::ImportFile
+		delete catalog;
+		catalog = nullptr;
+	}
+
+	catalogs[name] = catalog; // also remember the catalogs that don't exist, so we only look for them once
+	return catalog;
+}
+
+bool GlassCatalog::Load( const std::string& agfPath )
+{
+	file.Close();
+	memory.clear();
+	glasses = nullptr;
+	count = 0;
+	fromCache = false;
+
+	std::error_code error;
+	uint64 sourceSize = std::filesystem::file_size( agfPath, error );
+	if ( error ) return false;
+	int64_t sourceTime = (int64_t)std::filesystem::last_write_time( agfPath, error ).time_since_epoch().count();
+	if ( error ) return false;
+
+	//
+	// Use the cache when it was built from this very file
+	//
+	std::string cachePath = agfPath + ".cache";
+	if ( file.Open( cachePath ) && file.size >= sizeof( GlassCacheHeader ) )
+	{
+		const GlassCacheHeader* header = (const GlassCacheHeader*)file.data;
+		if ( memcmp( header->magic, "AGFCACHE", 8 ) == 0 && header->version == GLASS_CACHE_VERSION &&
+			 header->sourceSize == sourceSize && header->sourceTime == sourceTime &&
+			 file.size == sizeof( GlassCacheHeader ) + header->count * sizeof( CachedGlass ) )
+		{
+			glasses = (const CachedGlass*)( file.data + sizeof( GlassCacheHeader ) );
+			count = header->count;
+			fromCache = true;
+			return true;
+		}
+	}
+	file.Close();
+
+	//
+	// Parse the AGF file and build the cache
+	//
+	std::vector<CachedGlass> parsed;
+	if ( !Parse( agfPath, &parsed ) ) return false;
+
+	GlassCacheHeader header = {};
+	memcpy( header.magic, "AGFCACHE", 8 );
+	header.version = GLASS_CACHE_VERSION;
+	header.count = (uint)parsed.size();
+	header.sourceSize = sourceSize;
+	header.sourceTime = sourceTime;
+
+	memory.resize( sizeof( GlassCacheHeader ) + parsed.size() * sizeof( CachedGlass ) );
+	memcpy( memory.data(), &header, sizeof( GlassCacheHeader ) );
+	if ( !parsed.empty() ) memcpy( memory.data() + sizeof( GlassCacheHeader ), parsed.data(), parsed.size() * sizeof( CachedGlass ) );
+
+	// switch to the mapped cache when it could be written, so this process shares the pages with later ones as well
+	if ( MappedFile::WriteAtomic( cachePath, memory.data(), memory.size() ) && file.Open( cachePath ) && file.size == memory.size() )
+	{
+		memory.clear();
+		glasses = (const CachedGlass*)( file.data + sizeof( GlassCacheHeader ) );
+	}
+	else
+	{
+		file.Close();
+		std::cout << "WARNING: couldn't write glass catalog cache " << cachePath << std::endl;
+		glasses = (const CachedGlass*)( memory.data() + sizeof( GlassCacheHeader ) );
+	}
+	count = header.count;
+	return true;
+}
+
+const CachedGlass* GlassCatalog::Find( const char* material ) const
+{
+	int first = 0, n = count;
+	while ( n > 0 )
+	{
+		int half = n / 2;
+		if ( strcmp( glasses[first + half].name, material ) < 0 )
+			first += half + 1, n -= half + 1;
+		else
+			n = half;
+	}
+	if ( first < count && strcmp( glasses[first].name, material ) == 0 ) return &glasses[first];
+	return nullptr;
+}
+
+//
+// Reads the NM (name, formula) and CD (coefficients) records of an AGF file, sorted by name, first one wins on duplicates
+//
+bool GlassCatalog::Parse( const std::string& agfPath, std::vector<CachedGlass>* glasses )
+{
+	std::ifstream infile( agfPath, std::ios::binary );
+	if ( !infile ) return false;
+	std::string text( ( std::istreambuf_iterator<char>( infile ) ), std::istreambuf_iterator<char>() );
+
+	// some vendors ship their catalogs as UTF-16, everything we need is ASCII so dropping the high bytes is enough
+	if ( text.size() >= 2 && (byte)text[0] == 0xFF && (byte)text[1] == 0xFE )
+	{
+		std::string ascii;
+		for ( size_t i = 2; i < text.size(); i += 2 ) ascii += text[i];
+		text = ascii;
+	}
+
+	std::istringstream lines( text );
+	std::string line, name;
+	int formula = 0, skipped = 0;
+	while ( std::getline( lines, line ) )
+	{
+		std::istringstream iss( line );
+		std::string command;
+		iss >> command;
+
+		if ( command == "NM" )
+		{
+			float f = 0;
+			iss >> name >> f;
+			formula = (int)f;
+		}
+
+		if ( command == "CD" && !name.empty() )
+		{
+			double cd[10] = {};
+			for ( int i = 0; i < 10 && ( iss >> cd[i] ); i++ );
+
+			CachedGlass glass = {};
+			if ( name.size() < sizeof( glass.name ) && ConvertGlass( formula, cd, &glass.dc ) )
+			{
+				memcpy( glass.name, name.c_str(), name.size() );
+				glasses->push_back( glass );
+			}
+			else
+				skipped++;
+			name.clear();
+		}
+	}
+
+	std::stable_sort( glasses->begin(), glasses->end(), []( const CachedGlass& a, const CachedGlass& b ) { return strcmp( a.name, b.name ) < 0; } );
+	glasses->erase( std::unique( glasses->begin(), glasses->end(), []( const CachedGlass& a, const CachedGlass& b ) { return strcmp( a.name, b.name ) == 0; } ), glasses->end() );
+
+	std::cout << "Parsed glass catalog " << agfPath << ": " << glasses->size() << " glasses";
+	if ( skipped ) std::cout << ", " << skipped << " skipped (unsupported dispersion formula)";
+	std::cout << std::endl;
+	return true;
+}
+
+//
+// Converts AGF dispersion coefficients to the constants HelperFunctions::CalculateRefractiveIndex expects, which tells the
+// Sellmeier and Schott forms apart by the last constant: a Sellmeier resonance beyond 1 um^2 (there always is one in the
+// infrared for glass) or a tiny Schott coefficient
+//
+bool GlassCatalog::ConvertGlass( int formula, const double* cd, DispersionConstants* dc )
+{
+	switch ( formula )
+	{
+	case 1:	 // Schott: n^2 = a0 + a1 l^2 + a2 l^-2 + a3 l^-4 + a4 l^-6 + a5 l^-8
+	case 10: // Extended 1: Schott + a6 l^-10 + a7 l^-12
+	case 12: // Extended 2: Schott + a6 l^4 + a7 l^6
+		if ( formula != 1 && ( cd[6] != 0 || cd[7] != 0 ) ) return false;
+		if ( cd[5] > 1 ) return false;
+		for ( int i = 0; i < 6; i++ ) ( *dc )[i] = (float)cd[i];
+		return true;
+
+	case 2: // Sellmeier 1: n^2 - 1 = K1 l^2 / ( l^2 - L1 ) + K2 l^2 / ( l^2 - L2 ) + K3 l^2 / ( l^2 - L3 )
+	case 6: // Sellmeier 3, the same with a fourth term
+	{
+		int terms = formula == 2 ? 3 : 4;
+		std::vector<std::pair<double, double>> KL; // ( L, K ), the unused terms left out
+		for ( int i = 0; i < terms; i++ )
+			if ( cd[i * 2] != 0 ) KL.push_back( { cd[i * 2 + 1], cd[i * 2] } );
+		if ( KL.size() > 3 ) return false;
+		std::sort( KL.begin(), KL.end() );
+
+		// the order of the terms doesn't matter, so put the infrared resonance last and pad with empty terms in front
+		while ( KL.size() < 3 ) KL.insert( KL.begin(), { 0.0, 0.0 } );
+		if ( KL[2].first <= 1 )
+		{
+			if ( KL[0].second != 0 ) return false;
+			KL[0].first = 100.0; // an empty term, only there to mark the constants as Sellmeier
+			std::rotate( KL.begin(), KL.begin() + 1, KL.end() );
+		}
+		for ( int i = 0; i < 3; i++ )
+		{
+			( *dc )[i] = (float)KL[i].second;
+			( *dc )[i + 3] = (float)KL[i].first;
+		}
+		return true;
+	}
+
+	default:
+		return false;
+	}
+}
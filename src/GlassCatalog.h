@@ -0,0 +1,54 @@
+#pragma once
+
+#define GLASS_CACHE_VERSION 1
+
+//
+// Layout of a glass catalog cache file: this header, followed by count CachedGlass records sorted by name
+//
+struct GlassCacheHeader
+{
+	char magic[8]; // "AGFCACHE"
+	uint version;
+	uint count;
+	uint64 sourceSize; // size and modification time of the AGF file the cache was built from
+	int64_t sourceTime;
+};
+
+struct CachedGlass
+{
+	char name[24]; // zero terminated
+	DispersionConstants dc;
+};
+
+//
+// A Zemax AGF glass catalog, as named on the GCAT line of a lens file. The text file is only parsed when its binary cache
+// (<file>.cache, next to it) is missing or stale. Otherwise the cache is memory mapped and searched in place, so loading
+// a catalog costs a few system calls and all processes on a machine share the same pages. The glasses are converted to
+// the dispersion constants of Glass.h; AGF formulas other than Schott and Sellmeier (or extended versions of them with
+// the extra terms unused) can't be represented and are left out.
+//
+class GlassCatalog
+{
+  public:
+	// looks a glass up in the given catalogs in order, returns false when none of them has it
+	static bool Find( const std::vector<std::string>& catalogs, const std::string& material, DispersionConstants* dc );
+
+	// the catalog with this name in GLASS_CATALOG_DIR, loaded on first use, or nullptr when there is no such catalog
+	static const GlassCatalog* Get( const std::string& name );
+
+	// loads an AGF file, from its cache when that is up to date, and (re)builds the cache when it isn't
+	bool Load( const std::string& agfPath );
+
+	const CachedGlass* Find( const char* material ) const;
+
+	int count = 0;
+	bool fromCache = false; // whether the last Load could use the cache
+
+  private:
+	static bool Parse( const std::string& agfPath, std::vector<CachedGlass>* glasses );
+	static bool ConvertGlass( int formula, const double* cd, DispersionConstants* dc );
+
+	MappedFile file;
+	std::vector<byte> memory; // the cache contents, only used when the cache file could not be written
+	const CachedGlass* glasses = nullptr;
+};
@@ -19,6 +19,15 @@ class HelperFunctions
 		return j.w > i.w;
 	}
 
+	// 64 bit FNV-1a hash, pass the previous result as hash to continue hashing more data
+	static uint64 FNV1a( const void* data, size_t size, uint64 hash = 14695981039346656037ull )
+	{
+		const byte* bytes = (const byte*)data;
+		for ( size_t i = 0; i < size; i++ )
+			hash = ( hash ^ bytes[i] ) * 1099511628211ull;
+		return hash;
+	}
+
 	static float CircleOfConfusion( float focus_distance, float dist, float focal_length )
 	{
 		return SENSOR_SIZE * ( focus_distance - dist ) * focal_length / ( focus_distance * ( dist - focal_length ) );
@@ -56,7 +65,7 @@ class HelperFunctions
 	//
 	// Gives the refractive index of a material at a specified wavelength (in micrometers)
 	//
-	static float CalculateRefractiveIndex( float wavelength, float *dc )
+	static float CalculateRefractiveIndex( float wavelength, const float *dc )
 	{
 		if ( dc[5] > 1 )
 		{
@@ -76,6 +85,20 @@ class HelperFunctions
 		}
 	}
 
+	// CalculateRefractiveIndex for SIMD_WIDTH wavelengths at once
+	static floatv CalculateRefractiveIndex( floatv wavelength, const float *dc )
+	{
+		floatv w2 = wavelength * wavelength;
+		if ( dc[5] > 1 )
+			return floatv::sqrt( 1.0f + ( dc[0] * w2 ) / ( w2 - dc[3] ) + ( dc[1] * w2 ) / ( w2 - dc[4] ) + ( dc[2] * w2 ) / ( w2 - dc[5] ) );
+
+		floatv w2inv = 1.0f / w2;
+		floatv w4inv = w2inv * w2inv;
+		floatv w6inv = w4inv * w2inv;
+		floatv w8inv = w4inv * w4inv;
+		return floatv::sqrt( dc[0] + dc[1] * w2 + dc[2] * w2inv + dc[3] * w4inv + dc[4] * w6inv + dc[5] * w8inv );
+	}
+
 	static uint float4ToUint( float4 input )
 	{
 		uint r = ( uint )( clamp( 256.0f * input.r, 0.0f, 255.0f ) );
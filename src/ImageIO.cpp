@@ -48,6 +48,26 @@ const float* ImageIO::read_exr_beauty(const char* input) {
 	}
 }
 
+bool ImageIO::read_exr_gray(const char* input, std::vector<float>* out, int* width, int* height) {
+	float* rgba;
+	const char* err = NULL;
+
+	int ret = LoadEXR(&rgba, width, height, input, &err);
+	if (ret != TINYEXR_SUCCESS) {
+		if (err) {
+		fprintf(stderr, "ERR : %s\n", err);
+		FreeEXRErrorMessage(err);
+		}
+		return false;
+	}
+
+	out->resize((size_t)*width * *height);
+	for (size_t i = 0; i < out->size(); i++)
+		(*out)[i] = (rgba[4*i+0] + rgba[4*i+1] + rgba[4*i+2]) / 3.0f;
+	free(rgba);
+	return true;
+}
+
 void ImageIO::save_to_exr(std::vector<float> img, std::string filename, unsigned xres, unsigned yres) {
 	EXRHeader header;
 	InitEXRHeader(&header);
@@ -6,5 +6,7 @@ class ImageIO
 	
 	static const float* read_exr_layer(const char* input, const char* layer_name);
   static const float* read_exr_beauty(const char* input);
+	// one channel, the mean of R, G and B, row by row; returns false when the file can't be read
+	static bool read_exr_gray(const char* input, std::vector<float>* out, int* width, int* height);
 	static void save_to_exr(std::vector<float> img, std::string filename, unsigned xres, unsigned yres);
 };
@@ -0,0 +1,121 @@
+#include "precomp.h"
+
+static float LensData::*const lensFields[LENS_FIELDS] = { &LensData::B, &LensData::C, &LensData::D, &LensData::E, &LensData::F,
+	&LensData::focalLength, &LensData::entrancePupil, &LensData::exitPupil, &LensData::entrancePupilRadius, &LensData::exitPupilRadius,
+	&LensData::principalPlaneFront };
+
+//
+// Sets up the lookup of the knots, which have to subdivide finestCells equal cells over [0, knots.back()]
+//
+void DistanceAxis::Build( const std::vector<float>& knotList, int finestCells )
+{
+	knots = knotList;
+	inverseWidth.resize( knots.size() - 1 );
+	for ( int i = 0; i < (int)inverseWidth.size(); i++ )
+		inverseWidth[i] = 1.0f / ( knots[i + 1] - knots[i] );
+
+	cellsPerUnit = finestCells / knots.back();
+	finestInterval.resize( finestCells );
+	int interval = 0;
+	for ( int cell = 0; cell < finestCells; cell++ )
+	{
+		float center = ( cell + 0.5f ) / cellsPerUnit;
+		while ( interval < (int)inverseWidth.size() - 1 && knots[interval + 1] <= center ) interval++;
+		finestInterval[cell] = (float)interval;
+	}
+}
+
+//
+// The interval of the knots dist falls in, and where in it (0 at knots[interval], 1 at the next knot). Distances
+// nearer than the last knot are clamped to it.
+//
+void DistanceAxis::Locate( float dist, int* interval, float* part ) const
+{
+	float inverse = std::max( 0.0f, std::min( 1.0f / dist, knots.back() ) );
+	int cell = std::min( (int)( inverse * cellsPerUnit ), (int)finestInterval.size() - 1 );
+	*interval = (int)finestInterval[cell];
+	*part = ( inverse - knots[*interval] ) * inverseWidth[*interval];
+}
+
+void DistanceAxis::Locate( const floatv& dist, floatv* interval, floatv* part ) const
+{
+	floatv inverse = floatv::max( 0.0f, floatv::min( 1.0f / dist, knots.back() ) );
+	alignas( 64 ) int index[SIMD_WIDTH];
+	floatv::min( floatv::truncate( inverse * cellsPerUnit ), finestInterval.size() - 1.0f ).store( index );
+	*interval = floatv::gather( finestInterval.data(), index );
+	interval->store( index );
+	*part = ( inverse - floatv::gather( knots.data(), index ) ) * floatv::gather( inverseWidth.data(), index );
+}
+
+//
+// Copies the wavelength x distance lensData table of LensSystem into distance x wavelength planes
+//
+void LensDataTable::Build( const LensData* lensData, const DistanceAxis& distanceAxis )
+{
+	axis = distanceAxis;
+	int size = LOOKUP_SIZE * axis.Count();
+	for ( int field = 0; field < LENS_FIELDS; field++ )
+	{
+		float LensData::*member = lensFields[field];
+		planes[field].resize( size + 1 );
+#ifdef LENS_TABLE_HALF
+		float low = 1E30f, high = -1E30f;
+		for ( int i = 0; i < size; i++ )
+			low = std::min( low, lensData[i].*member ), high = std::max( high, lensData[i].*member );
+		offset[field] = ( low + high ) * 0.5f;
+		scale[field] = high > low ? ( high - low ) * 0.5f : 1.0f;
+#endif
+		for ( int w = 0; w < LOOKUP_SIZE; w++ )
+			for ( int v = 0; v < axis.Count(); v++ )
+			{
+				float value = lensData[w * axis.Count() + v].*member;
+#ifdef LENS_TABLE_HALF
+				planes[field][v * LOOKUP_SIZE + w] = FloatToHalf( ( value - offset[field] ) / scale[field] );
+#else
+				planes[field][v * LOOKUP_SIZE + w] = value;
+#endif
+			}
+		planes[field][size] = planes[field][size - 1];
+	}
+}
+
+//
+// Bilinear lookup of the requested fields for SIMD_WIDTH wavelengths and distances, the same interpolation as
+// LensSystem::GetLensData. out[i] receives fields[i].
+//
+void LensDataTable::Fetch( const floatv& wavelength, const floatv& dist, const LensField* fields, int count, floatv* const* out ) const
+{
+	floatv w = ( wavelength - 0.360f ) * ( ( LOOKUP_SIZE - 1 ) / 0.470f );
+	floatv w1 = floatv::truncate( w );
+	floatv wpart = w - w1; // the next wavelength is read even for the last one, with weight 0
+
+	floatv v1, vpart;
+	axis.Locate( dist, &v1, &vpart );
+
+	alignas( 64 ) int near[SIMD_WIDTH], far[SIMD_WIDTH];
+	( v1 * (float)LOOKUP_SIZE + w1 ).store( near );
+	( ( v1 + 1.0f ) * (float)LOOKUP_SIZE + w1 ).store( far );
+
+	floatv wpart1 = 1.0f - wpart, vpart1 = 1.0f - vpart;
+	floatv weight00 = wpart1 * vpart1, weight10 = wpart * vpart1, weight01 = wpart1 * vpart, weight11 = wpart * vpart;
+
+	for ( int i = 0; i < count; i++ )
+	{
+		const Entry* plane = planes[fields[i]].data();
+		floatv c00, c10, c01, c11;
+#ifdef LENS_TABLE_HALF
+		floatv::gatherHalfPair( plane, near, &c00, &c10 );
+		floatv::gatherHalfPair( plane, far, &c01, &c11 );
+#else
+		c00 = floatv::gather( plane, near );
+		c10 = floatv::gather( plane + 1, near );
+		c01 = floatv::gather( plane, far );
+		c11 = floatv::gather( plane + 1, far );
+#endif
+		floatv value = c00 * weight00 + c10 * weight10 + c01 * weight01 + c11 * weight11;
+#ifdef LENS_TABLE_HALF
+		value = floatv::fmadd( value, scale[fields[i]], offset[fields[i]] );
+#endif
+		*out[i] = value;
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+struct LensData;
+
+//
+// The fields of LensData that ApplySeidelBatch and ApplySSRTBatch read
+//
+enum LensField
+{
+	LENS_B,
+	LENS_C,
+	LENS_D,
+	LENS_E,
+	LENS_F,
+	LENS_FOCAL_LENGTH,
+	LENS_ENTRANCE_PUPIL,
+	LENS_EXIT_PUPIL,
+	LENS_ENTRANCE_PUPIL_RADIUS,
+	LENS_EXIT_PUPIL_RADIUS,
+	LENS_PRINCIPAL_PLANE_FRONT,
+	LENS_FIELDS
+};
+
+//
+// The distance axis of the lensData table: knots in inverse distance (1 / m), from 0 (infinity) up to 1 / LENS_TABLE_NEAR,
+// placed by LensSystem::PrecalculateSeidel. The knots subdivide equal cells by halving, so a uniform grid of the finest
+// cells they can make maps an inverse distance to its interval without a search.
+//
+struct DistanceAxis
+{
+	std::vector<float> knots;		   // ascending inverse distances
+	std::vector<float> inverseWidth;   // per interval, 1 / ( knots[i + 1] - knots[i] )
+	std::vector<float> finestInterval; // per finest cell, the interval it lies in (a float, for floatv::gather)
+	float cellsPerUnit = 0.0f;
+
+	static float Distance( float inverse ) { return 1.0f / std::max( inverse, 1E-6f ); } // infinity as 1000 km
+	void Build( const std::vector<float>& knotList, int finestCells );
+	int Count() const { return (int)knots.size(); }
+	void Locate( float dist, int* interval, float* part ) const;
+	void Locate( const floatv& dist, floatv* interval, floatv* part ) const;
+};
+
+//
+// Structure-of-arrays copy of the LensSystem lensData table for the SIMD batches. Every field is a plane of its own, in
+// rows of LOOKUP_SIZE wavelengths per distance knot, so the samples of a pixel (one distance, all wavelengths) touch a few
+// cache lines per field, and Fetch only gathers the fields the caller asks for. With LENS_TABLE_HALF the planes are
+// stored in half precision, normalized per field, which halves the table and the number of gathers: both wavelength
+// neighbours come in with one 32 bit gather.
+//
+class LensDataTable
+{
+  public:
+	void Build( const LensData* lensData, const DistanceAxis& distanceAxis );
+	void Fetch( const floatv& wavelength, const floatv& dist, const LensField* fields, int count, floatv* const* out ) const;
+	size_t Bytes() const { return planes[0].size() * sizeof( Entry ) * LENS_FIELDS; }
+
+  private:
+#ifdef LENS_TABLE_HALF
+	typedef unsigned short Entry;
+	float offset[LENS_FIELDS], scale[LENS_FIELDS]; // value = offset + scale * entry, with the entries in [-1, 1]
+#else
+	typedef float Entry;
+#endif
+	std::vector<Entry> planes[LENS_FIELDS]; // LOOKUP_SIZE entries per knot and one extra, Fetch always reads the next wavelength
+	DistanceAxis axis;
+};
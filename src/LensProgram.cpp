@@ -0,0 +1,33 @@
+#include "precomp.h"
+
+//
+// Compile the lens prescription, evaluates the dispersion formulas once for every surface and grid wavelength
+//
+void LensProgram::Compile( int num_elements, const std::vector<float>& centers, const std::vector<float>& radii, const std::vector<float>& apertures, const std::vector<float>& dispconstants )
+{
+	num_surfaces = num_elements;
+	rowSize = 2 * num_surfaces;
+
+	surfaces.resize( num_surfaces );
+	for ( int i = 0; i < num_surfaces; i++ )
+	{
+		surfaces[i].center = centers[i];
+		surfaces[i].radius = radii[i];
+		surfaces[i].radius2 = radii[i] * radii[i];
+		surfaces[i].aperture2 = apertures[i] * apertures[i];
+	}
+
+	eta.resize( PROGRAM_WAVELENGTHS * rowSize );
+	for ( int row = 0; row < PROGRAM_WAVELENGTHS; row++ )
+	{
+		float wavelength = 0.360f + row * 0.001f;
+		float n1 = HelperFunctions::CalculateRefractiveIndex( wavelength, &dispconstants[0] );
+		for ( int i = 0; i < num_surfaces; i++ )
+		{
+			float n2 = HelperFunctions::CalculateRefractiveIndex( wavelength, &dispconstants[( i + 1 ) * 6] );
+			eta[row * rowSize + i * 2] = n1 / n2;
+			eta[row * rowSize + i * 2 + 1] = n2 / n1;
+			n1 = n2;
+		}
+	}
+}
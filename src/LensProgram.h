@@ -0,0 +1,59 @@
+#pragma once
+
+#define PROGRAM_WAVELENGTHS 472 // 360 - 831 nm in steps of 1 nm, one extra so interpolation up to 830 nm stays in range
+
+//
+// Geometry of one lens surface, as used by the tracers
+//
+struct LensSurface
+{
+	float center;
+	float radius;
+	float radius2;
+	float aperture2;
+};
+
+//
+// The lens prescription compiled for tracing. The geometry of all surfaces is packed in one small array, and the ratio
+// of refractive indices n1 / n2 at every surface is tabulated on a 1 nm wavelength grid, for both tracing directions.
+// The tracers interpolate linearly between two neighbouring grid rows, so a ray does no dispersion math at all. Has to
+// be recompiled whenever the lens changes, including the aperture stop (see LensSystem::Precalculate).
+//
+class LensProgram
+{
+  public:
+	void Compile( int num_elements, const std::vector<float>& centers, const std::vector<float>& radii, const std::vector<float>& apertures, const std::vector<float>& dispconstants );
+
+	// an aperture change only needs the geometry updated
+	void SetAperture( int surface, float aperture ) { surfaces[surface].aperture2 = aperture * aperture; }
+
+	// finds the first of the two grid rows to interpolate between and the interpolation weight of the second
+	void Lookup( float wavelength, int* row, float* fraction ) const
+	{
+		float w = ( wavelength - 0.360f ) * 1000.0f;
+		*row = clamp( (int)w, 0, PROGRAM_WAVELENGTHS - 2 );
+		*fraction = w - *row;
+	}
+
+	// n1 / n2 at a surface, for a ray going forwards (object -> image plane) or backwards
+	float Eta( int row, float fraction, int surface, bool forwards ) const
+	{
+		const float* eta0 = &eta[row * rowSize + surface * 2 + ( forwards ? 0 : 1 )];
+		const float* eta1 = eta0 + rowSize;
+		return *eta0 + ( *eta1 - *eta0 ) * fraction;
+	}
+
+	// the same for SIMD_WIDTH rays, rowOffset holds row * rowSize for every lane
+	floatv Eta( const int* rowOffset, const floatv& fraction, int surface, bool forwards ) const
+	{
+		const float* base = &eta[surface * 2 + ( forwards ? 0 : 1 )];
+		floatv eta0 = floatv::gather( base, rowOffset );
+		floatv eta1 = floatv::gather( base + rowSize, rowOffset );
+		return eta0 + ( eta1 - eta0 ) * fraction;
+	}
+
+	int num_surfaces = 0;
+	int rowSize = 0; // floats per wavelength row
+	std::vector<LensSurface> surfaces;
+	std::vector<float> eta; // [wavelength][surface][forwards, backwards]
+};
@@ -1,5 +1,9 @@
 #include "precomp.h"
 
+// PrecalculateSeidel starts the distance axis with this many equal intervals in inverse distance, and halves them at
+// most this many times
+static const int distanceIntervals = 8, distanceLevels = 8;
+
 //
 // Returns lensData for a given wavelength and distance. Linearly interpolates between the closest two lensData values.
 //
@@ -10,15 +14,16 @@ LensData LensSystem::GetLensData( float wavelength, float dist )
 	int w2 = std::min( w1 + 1, LOOKUP_SIZE - 1 );
 	float wpart = ( w - w1 );
 
-	float v = std::min( LOOKUP_SIZE - 1.0f, ( dist - 0.2f ) / 15.0f * LOOKUP_SIZE );
-	int v1 = (int)v;
-	int v2 = std::min( v1 + 1, LOOKUP_SIZE - 1 );
-	float vpart = ( v - v1 );
+	int v1;
+	float vpart;
+	distanceAxis.Locate( dist, &v1, &vpart );
+	int v2 = v1 + 1;
 
-	LensData ld1 = lensData[w1 * LOOKUP_SIZE + v1];
-	LensData ld2 = lensData[w2 * LOOKUP_SIZE + v1];
-	LensData ld3 = lensData[w1 * LOOKUP_SIZE + v2];
-	LensData ld4 = lensData[w2 * LOOKUP_SIZE + v2];
+	int count = distanceAxis.Count();
+	LensData ld1 = lensData[w1 * count + v1];
+	LensData ld2 = lensData[w2 * count + v1];
+	LensData ld3 = lensData[w1 * count + v2];
+	LensData ld4 = lensData[w2 * count + v2];
 
 	return HelperFunctions::bilinear( wpart, vpart, ld1, ld2, ld3, ld4 );
 }
@@ -112,11 +117,10 @@ float3 LensSystem::GetNormal3D( float3 O, float3 D, float3 center )
 }
 
 //
-// Refract a ray and returns whether it was successful
+// Refract a ray, n1n2 being the ratio of refractive indices n1 / n2, and returns whether it was successful
 //
-bool LensSystem::Refract( float2* D, float n1, float n2, float2 normal, bool useGaussianOptics = false )
+bool LensSystem::Refract( float2* D, float n1n2, float2 normal, bool useGaussianOptics = false )
 {
-	float n1n2 = n1 / n2;
 	float cosTheta = 1;
 	if ( !useGaussianOptics )
 		cosTheta = normal.dot( *D * -1.0f );
@@ -127,9 +131,8 @@ bool LensSystem::Refract( float2* D, float n1, float n2, float2 normal, bool use
 	*D = *D * n1n2 + normal * ( n1n2 * cosTheta - sqrtf( k ) );
 	return true;
 }
-bool LensSystem::Refract3D( float3* D, float n1, float n2, float3 normal, bool useGaussianOptics = false )
+bool LensSystem::Refract3D( float3* D, float n1n2, float3 normal, bool useGaussianOptics = false )
 {
-	float n1n2 = n1 / n2;
 	float cosTheta = 1;
 	if ( !useGaussianOptics )
 		cosTheta = normal.dot( *D * -1.0f );
@@ -150,26 +153,28 @@ bool LensSystem::TraceRay( float2* O, float2* D, float wavelength, int lowest_el
 	float t = 1.0f;
 	bool valid = true;
 
+	int row;
+	float fraction;
+	program.Lookup( wavelength, &row, &fraction );
+
 	int i = forwards ? lowest_element : highest_element;
 	while ( true )
 	{
 		if ( !( forwards ? i <= highest_element : i >= lowest_element ) ) break;
 
+		const LensSurface& surface = program.surfaces[i];
+
 		// intersect, update rayOrigin
-		if ( !IntersectRay( *O, *D, &t, float2( centers[i], 0 ), radii[i], useGaussianOptics ) )
+		if ( !IntersectRay( *O, *D, &t, float2( surface.center, 0 ), surface.radius, useGaussianOptics ) )
 			valid = false;
 		*O += *D * t;
 
 		// check if we pass through the aperture
-		if ( abs( O->y ) > apertures[i] )
+		if ( O->y * O->y > surface.aperture2 )
 			valid = false;
 
 		// refract ray
-		int prev = forwards ? i : i + 1;
-		int next = forwards ? i + 1 : i;
-		float n1 = HelperFunctions::CalculateRefractiveIndex( wavelength, &dispconstants[prev * 6] );
-		float n2 = HelperFunctions::CalculateRefractiveIndex( wavelength, &dispconstants[next * 6] );
-		if ( !Refract( D, n1, n2, GetNormal( *O, *D, float2( centers[i], 0 ) ), useGaussianOptics ) )
+		if ( !Refract( D, program.Eta( row, fraction, i, forwards ), GetNormal( *O, *D, float2( surface.center, 0 ) ), useGaussianOptics ) )
 			valid = false;
 
 		if ( !valid )
@@ -187,26 +192,28 @@ bool LensSystem::TraceRay3D( float3* O, float3* D, float wavelength, int lowest_
 	float t = 1.0f;
 	bool valid = true;
 
+	int row;
+	float fraction;
+	program.Lookup( wavelength, &row, &fraction );
+
 	int i = forwards ? lowest_element : highest_element;
 	while ( true )
 	{
 		if ( !( forwards ? i <= highest_element : i >= lowest_element ) ) break;
 
+		const LensSurface& surface = program.surfaces[i];
+
 		// intersect, update rayOrigin
-		if ( !IntersectRay3D( *O, *D, &t, float3( 0, 0, centers[i] ), radii[i], useGaussianOptics ) )
+		if ( !IntersectRay3D( *O, *D, &t, float3( 0, 0, surface.center ), surface.radius, useGaussianOptics ) )
 			valid = false;
 		*O += *D * t;
 
 		// check if we pass through the aperture
-		if ( float2( O->x, O->y ).length() > apertures[i] )
+		if ( O->x * O->x + O->y * O->y > surface.aperture2 )
 			valid = false;
 
 		// refract ray
-		int prev = forwards ? i : i + 1;
-		int next = forwards ? i + 1 : i;
-		float n1 = HelperFunctions::CalculateRefractiveIndex( wavelength, &dispconstants[prev * 6] );
-		float n2 = HelperFunctions::CalculateRefractiveIndex( wavelength, &dispconstants[next * 6] );
-		if ( !Refract3D( D, n1, n2, GetNormal3D( *O, *D, float3( 0, 0, centers[i] ) ), useGaussianOptics ) )
+		if ( !Refract3D( D, program.Eta( row, fraction, i, forwards ), GetNormal3D( *O, *D, float3( 0, 0, surface.center ) ), useGaussianOptics ) )
 			valid = false;
 
 		if ( !valid )
@@ -219,28 +226,405 @@ bool LensSystem::TraceRay3D( float3* O, float3* D, float wavelength, int lowest_
 }
 
 //
-// Precalculate lensData values for LOOKUP_SIZE different wavelength values and distances
+// Traces SIMD_WIDTH rays at once, the packet version of TraceRay3D (without Gaussian optics). Lanes that miss a surface,
+// its aperture or are totally internally reflected are masked off and keep being traced along with the others, until
+// the whole packet is invalid. Returns the mask of rays that made it through.
+//
+maskv LensSystem::TraceRay3DPacket( RayPacket* packet, int lowest_element, int highest_element, bool forwards = true )
+{
+	RayPacket& r = *packet;
+
+	// offset of the refractive index ratios in the compiled program for every lane
+	int rowOffset[SIMD_WIDTH];
+	floatv fraction;
+	for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+	{
+		int row;
+		program.Lookup( r.wavelength[lane], &row, &fraction[lane] );
+		rowOffset[lane] = row * program.rowSize;
+	}
+
+	int i = forwards ? lowest_element : highest_element;
+	while ( forwards ? i <= highest_element : i >= lowest_element )
+	{
+		const LensSurface& surface = program.surfaces[i];
+
+		//
+		// intersect, both from the inside and the outside of the sphere, and update the origin
+		//
+		floatv Cx = -r.Ox;
+		floatv Cy = -r.Oy;
+		floatv Cz = surface.center - r.Oz;
+		floatv Csize2 = Cx * Cx + Cy * Cy + Cz * Cz;
+		floatv DdotC = r.Dx * Cx + r.Dy * Cy + r.Dz * Cz;
+		float radius2 = surface.radius2;
+
+		maskv inside = Csize2 <= radius2;
+		floatv a = r.Dx * r.Dx + r.Dy * r.Dy + r.Dz * r.Dz;
+		floatv b = -2.0f * DdotC;
+		floatv c = Csize2 - radius2;
+		floatv tInside = ( -b + floatv::sqrt( b * b - 4.0f * a * c ) ) / ( 2.0f * a );
+
+		floatv Qx = Cx - r.Dx * DdotC;
+		floatv Qy = Cy - r.Dy * DdotC;
+		floatv Qz = Cz - r.Dz * DdotC;
+		floatv p2 = Qx * Qx + Qy * Qy + Qz * Qz;
+		floatv tOutside = DdotC - floatv::sqrt( radius2 - p2 );
+
+		r.valid = r.valid & ( inside | ( p2 <= radius2 ) );
+		floatv t = floatv::select( inside, tInside, tOutside );
+		r.Ox += r.Dx * t;
+		r.Oy += r.Dy * t;
+		r.Oz += r.Dz * t;
+
+		// check if we pass through the aperture
+		r.valid = r.valid & ( ( r.Ox * r.Ox + r.Oy * r.Oy ) <= floatv( surface.aperture2 ) );
+
+		//
+		// refract ray
+		//
+		floatv Nx = r.Ox;
+		floatv Ny = r.Oy;
+		floatv Nz = r.Oz - surface.center;
+		floatv Nscale = 1.0f / floatv::sqrt( Nx * Nx + Ny * Ny + Nz * Nz );
+		Nscale = floatv::select( ( r.Dx * Nx + r.Dy * Ny + r.Dz * Nz ) > 0.0f, -Nscale, Nscale );
+		Nx *= Nscale;
+		Ny *= Nscale;
+		Nz *= Nscale;
+
+		floatv n1n2 = program.Eta( rowOffset, fraction, i, forwards );
+
+		floatv cosTheta = -( Nx * r.Dx + Ny * r.Dy + Nz * r.Dz );
+		floatv k = 1.0f - n1n2 * n1n2 * ( 1.0f - cosTheta * cosTheta );
+		r.valid = r.valid & ( floatv( 0.0f ) <= k );
+
+		floatv Nfactor = n1n2 * cosTheta - floatv::sqrt( k );
+		r.Dx = r.Dx * n1n2 + Nx * Nfactor;
+		r.Dy = r.Dy * n1n2 + Ny * Nfactor;
+		r.Dz = r.Dz * n1n2 + Nz * Nfactor;
+
+		if ( !r.valid.any() )
+			break; //early out
+
+		forwards ? i++ : i--;
+	}
+
+	return r.valid;
+}
+
+//
+// Precalculate lensData values for LOOKUP_SIZE different wavelength values, and the distances PrecalculateSeidel places
 //
 void LensSystem::Precalculate( float aperture )
 {
 	apertures[num_aperturestop] = originalAperture * aperture;
+	program.Compile( num_elements, centers, radii, apertures, dispconstants );
+
+	bool rows[LOOKUP_SIZE];
+	PrecalculatePupils( rows );
+	PrecalculateSeidel();
+	PrecalculateFocus();
+	lensTable.Build( lensData.data(), distanceAxis );
 
+	PrintSummary();
+}
+
+//
+// Focal lengths, Seidel coefficients and focus, as found by Precalculate
+//
+void LensSystem::PrintSummary()
+{
 	float step = 1.0f / ( LOOKUP_SIZE - 1 );
+	int min_focalLength = 0, max_focalLength = 0;
+	for ( int i = 1; i < LOOKUP_SIZE; i++ )
+	{
+		if ( wavelengthData[i].focalLength < wavelengthData[min_focalLength].focalLength ) min_focalLength = i;
+		if ( wavelengthData[i].focalLength > wavelengthData[max_focalLength].focalLength ) max_focalLength = i;
+	}
 
-	meanFocalLength = 0.0f;
-	meanFstop = 0.0f;
-	float min_focalLength = 1E35f;
-	float min_focalLength_wavelength = 0.0f;
-	float max_focalLength = -1E35f;
-	float max_focalLength_wavelength = 0.0f;
+	std::cout << "min  focal length: " << ( 1000 * wavelengthData[min_focalLength].focalLength ) << "mm (at " << (int)( 1000 * ( ( min_focalLength * step ) * 0.470f + 0.360f ) ) << "nm)" << std::endl;
+	std::cout << "mean focal length: " << ( 1000 * meanFocalLength ) << "mm" << std::endl;
+	std::cout << "max  focal length: " << ( 1000 * wavelengthData[max_focalLength].focalLength ) << "mm (at " << (int)( 1000 * ( ( max_focalLength * step ) * 0.470f + 0.360f ) ) << "nm)" << std::endl;
+	std::cout << "mean f-stop: f/" << meanFstop << "" << std::endl;
 
-	//
-	// for each wavelength step
-	//
+	std::cout << "FOV at mean focal length for an image sensor of width " << ( SENSOR_SIZE * 1000 ) << "mm: " << ( 2.0f * atanf( SENSOR_SIZE / ( 2 * meanFocalLength ) ) * 180.0f / PI ) << " degrees" << std::endl;
 
+	LensData meanLensData = GetLensData( 0.550f, FOCUS );
+
+	std::cout << std::endl;
+	std::cout << "Mean Seidel coefficients:" << std::endl;
+	std::cout << "B: " << std::to_string( meanLensData.B ) << std::endl;
+	std::cout << "C: " << std::to_string( meanLensData.C ) << std::endl;
+	std::cout << "D: " << std::to_string( meanLensData.D ) << std::endl;
+	std::cout << "E: " << std::to_string( meanLensData.E ) << std::endl;
+	std::cout << "F: " << std::to_string( meanLensData.F ) << std::endl;
+	std::cout << std::endl;
+
+	std::cout << "Sensor position: " << sensorPosition << std::endl;
+	std::cout << "Focus: " << FOCUS << std::endl;
+	std::cout << "Seidel focus: " << seidelFocus << std::endl;
+
+	std::cout << "Lens data table: " << distanceAxis.Count() << " distances, " << ( lensData.size() * sizeof( LensData ) / 1024 ) << "KB";
+	if ( seidelEvaluations > 0 ) std::cout << ", " << seidelEvaluations << " Seidel evaluations";
+	std::cout << std::endl;
+}
+
+//
+// Change the aperture (relative to the one in the lens file). Within the range of PrecalculateRange this interpolates.
+// Otherwise the pupils are recalculated, and the Seidel coefficients, which only depend on the aperture through the
+// position of the entrance pupil, of the wavelength rows where that moved, at the distances already on the axis. The
+// axis is only placed again (PrecalculateSeidel) when the lens or the table tolerance changes.
+//
+void LensSystem::SetAperture( float aperture )
+{
+	if ( originalAperture * aperture == apertures[num_aperturestop] ) return;
+
+	apertures[num_aperturestop] = originalAperture * aperture;
+	program.SetAperture( num_aperturestop, apertures[num_aperturestop] );
+
+	if ( range.HasAperture( aperture ) )
+	{
+		InterpolateAperture( aperture );
+		if ( !InterpolateFocus() ) PrecalculateFocus();
+		lensTable.Build( lensData.data(), distanceAxis );
+		return;
+	}
+
+	bool rows[LOOKUP_SIZE];
+	PrecalculatePupils( rows );
+	if ( std::find( rows, rows + LOOKUP_SIZE, true ) != rows + LOOKUP_SIZE ) UpdateSeidel( rows );
+	PrecalculateFocus();
+	lensTable.Build( lensData.data(), distanceAxis );
+}
+
+//
+// Change the focus distance. The lensData table covers all distances, so only the sensor position and the Seidel
+// focus are recalculated, or interpolated within the range of PrecalculateRange.
+//
+void LensSystem::SetFocus( float focus )
+{
+	if ( focus == FOCUS ) return;
+
+	FOCUS = focus;
+	if ( !InterpolateFocus() ) PrecalculateFocus();
+}
+
+//
+// Precalculates the lens at apertureSteps apertures from minAperture to maxAperture, and its focus at focusSteps
+// distances from nearFocus to farFocus, evenly in inverse distance. SetAperture and SetFocus interpolate within these
+// ranges from then on, which takes microseconds instead of a Precalculate. All apertures use the distance axis of the
+// middle one. The current aperture and focus stay, taken from the range when it covers them. A range that can't be
+// interpolated (fewer than two steps, or empty) is refused, and SetAperture and SetFocus recalculate as before.
+// The sensor position and the Seidel focus are not linear in the inverse focus distance on every lens, so the middle of
+// every cell is recalculated too, and where interpolating misses it by more than LENS_RANGE_TOLERANCE pixels of defocus
+// blur, SetAperture and SetFocus recalculate the focus within that cell.
+//
+void LensSystem::PrecalculateRange( float minAperture, float maxAperture, int apertureSteps, float nearFocus, float farFocus, int focusSteps )
+{
+	float aperture = apertures[num_aperturestop] / originalAperture, focus = FOCUS;
+	bool rows[LOOKUP_SIZE];
+
+	range = LensRange();
+	if ( apertureSteps < 2 || focusSteps < 2 || !( maxAperture > minAperture ) || !( nearFocus > 0.0f ) || !( farFocus > nearFocus ) )
+	{
+		std::cout << "WARNING: can't precalculate the range of apertures " << minAperture << " to " << maxAperture << " in " << apertureSteps << " steps and focus distances " << nearFocus << " to " << farFocus << " in " << focusSteps << " steps" << std::endl;
+		return;
+	}
+	range.minAperture = minAperture, range.maxAperture = maxAperture;
+	range.nearFocus = nearFocus, range.farFocus = farFocus;
+
+	auto setAperture = [&]( float relative )
+	{
+		apertures[num_aperturestop] = originalAperture * relative;
+		program.SetAperture( num_aperturestop, apertures[num_aperturestop] );
+		PrecalculatePupils( rows );
+	};
+
+	setAperture( ( minAperture + maxAperture ) * 0.5f );
+	PrecalculateSeidel();
+	range.states.distanceAxis = distanceAxis;
+
+	for ( int a = 0; a < apertureSteps; a++ )
+	{
+		setAperture( minAperture + ( maxAperture - minAperture ) * a / ( apertureSteps - 1 ) );
+		if ( std::find( rows, rows + LOOKUP_SIZE, true ) != rows + LOOKUP_SIZE ) UpdateSeidel( rows );
+		StoreState( &range.states );
+
+		for ( int f = 0; f < focusSteps; f++ )
+		{
+			float inverse = 1.0f / farFocus + ( 1.0f / nearFocus - 1.0f / farFocus ) * f / ( focusSteps - 1 );
+			FOCUS = 1.0f / inverse;
+			PrecalculateFocus();
+			range.sensorPosition.push_back( sensorPosition );
+			range.seidelFocus.push_back( 1.0f / seidelFocus );
+		}
+	}
+	range.apertureSteps = apertureSteps;
+	range.focusSteps = focusSteps;
+
+	// the blur diameter on the sensor of an error in the sensor position is about that error times the pupil diameter
+	// over the focal length, and of an error in the inverse Seidel focus that error times both
+	range.exact.assign( ( apertureSteps - 1 ) * ( focusSteps - 1 ), false );
+	for ( int a = 0; a + 1 < apertureSteps; a++ )
+	{
+		setAperture( minAperture + ( maxAperture - minAperture ) * ( a + 0.5f ) / ( apertureSteps - 1 ) );
+		if ( std::find( rows, rows + LOOKUP_SIZE, true ) != rows + LOOKUP_SIZE ) UpdateSeidel( rows );
+		float diameter = meanFocalLength / meanFstop, tolerance = LENS_RANGE_TOLERANCE * SENSOR_SIZE / SCRWIDTH;
+		for ( int f = 0; f + 1 < focusSteps; f++ )
+		{
+			float inverse = 1.0f / farFocus + ( 1.0f / nearFocus - 1.0f / farFocus ) * ( f + 0.5f ) / ( focusSteps - 1 );
+			FOCUS = 1.0f / inverse;
+			PrecalculateFocus();
+			float exactSensor = sensorPosition, exactInverse = 1.0f / seidelFocus;
+			InterpolateFocus();
+			float blur = std::max( fabsf( sensorPosition - exactSensor ) * diameter / meanFocalLength, fabsf( 1.0f / seidelFocus - exactInverse ) * diameter * meanFocalLength );
+			range.exact[a * ( focusSteps - 1 ) + f] = !( blur <= tolerance );
+		}
+	}
+
+	// back to the aperture and focus from before, through SetAperture, which must not take it for unchanged
+	FOCUS = focus;
+	apertures[num_aperturestop] = -1.0f;
+	SetAperture( aperture );
+}
+
+//
+// Change the zoom of a lens file with multiple configurations, from 0 (the first) to 1 (the last). The surfaces that
+// change between them are interpolated linearly. Between the positions of PrecalculateZoom this interpolates the lens
+// data, otherwise the lens is recalculated. The range of PrecalculateRange is of the previous zoom, and dropped.
+//
+void LensSystem::SetZoom( float position )
+{
+	position = clamp( position, 0.0f, 1.0f );
+	if ( zoomOperands.empty() || position == zoom ) return;
+
+	zoom = position;
+	ApplyZoom( zoom );
+	program.Compile( num_elements, centers, radii, apertures, dispconstants );
+	range = LensRange();
+
+	if ( zoomTables.positions > 0 && zoomTables.aperture == apertures[num_aperturestop] )
+	{
+		float p = zoom * ( zoomTables.positions - 1 );
+		int p0 = std::min( (int)p, zoomTables.positions - 2 );
+		float t = p - p0;
+		InterpolateState( zoomTables.states, p0, t );
+		if ( FOCUS == zoomTables.focus )
+		{
+			sensorPosition = zoomTables.sensorPosition[p0] * ( 1.0f - t ) + zoomTables.sensorPosition[p0 + 1] * t;
+			seidelFocus = 1.0f / ( zoomTables.seidelFocus[p0] * ( 1.0f - t ) + zoomTables.seidelFocus[p0 + 1] * t );
+		}
+		else PrecalculateFocus();
+	}
+	else
+	{
+		bool rows[LOOKUP_SIZE];
+		PrecalculatePupils( rows );
+		PrecalculateSeidel();
+		PrecalculateFocus();
+	}
+	lensTable.Build( lensData.data(), distanceAxis );
+}
+
+//
+// Precalculates the lens at positions zoom positions from the first configuration to the last, for the current aperture
+// and focus, so SetZoom interpolates from then on. All positions use the distance axis of the middle one, and each is
+// calculated on a copy of the lens, in parallel.
+//
+void LensSystem::PrecalculateZoom( int positions )
+{
+	if ( zoomOperands.empty() || positions < 2 ) return;
+
+	float position = zoom;
+	LensRange kept = std::move( range ); // not worth a copy per position
+	zoomTables = LensZoom();
+
+	bool rows[LOOKUP_SIZE];
+	ApplyZoom( 0.5f );
+	program.Compile( num_elements, centers, radii, apertures, dispconstants );
+	PrecalculatePupils( rows );
+	PrecalculateSeidel();
+
+	LensZoom tables;
+	tables.aperture = apertures[num_aperturestop];
+	tables.focus = FOCUS;
+	tables.states.distanceAxis = distanceAxis;
+	int size = LOOKUP_SIZE * distanceAxis.Count();
+	tables.states.wavelengthData.resize( positions * LOOKUP_SIZE );
+	tables.states.lensData.resize( positions * size );
+	tables.states.meanFocalLength.resize( positions );
+	tables.states.meanFstop.resize( positions );
+	tables.sensorPosition.resize( positions );
+	tables.seidelFocus.resize( positions );
+
+#pragma omp parallel for schedule( dynamic, 1 )
+	for ( int p = 0; p < positions; p++ )
+	{
+		LensSystem lens = *this;
+		lens.ApplyZoom( p / (float)( positions - 1 ) );
+		lens.program.Compile( num_elements, lens.centers, lens.radii, lens.apertures, dispconstants );
+		bool moved[LOOKUP_SIZE];
+		lens.PrecalculatePupils( moved );
+		std::fill( moved, moved + LOOKUP_SIZE, true );
+		lens.UpdateSeidel( moved );
+		lens.PrecalculateFocus();
+
+		std::copy( lens.wavelengthData, lens.wavelengthData + LOOKUP_SIZE, tables.states.wavelengthData.begin() + p * LOOKUP_SIZE );
+		std::copy( lens.lensData.begin(), lens.lensData.end(), tables.states.lensData.begin() + p * size );
+		tables.states.meanFocalLength[p] = lens.meanFocalLength;
+		tables.states.meanFstop[p] = lens.meanFstop;
+		tables.sensorPosition[p] = lens.sensorPosition;
+		tables.seidelFocus[p] = 1.0f / lens.seidelFocus;
+	}
+	tables.positions = positions;
+	zoomTables = std::move( tables );
+
+	// back to the zoom from before, through SetZoom, which must not take it for unchanged
+	zoom = -1.0f;
+	SetZoom( position );
+	range = std::move( kept );
+}
+
+//
+// The surfaces at a zoom position, the operands interpolated between the two nearest configurations, and the centers
+// that follow from them. The first surface stays where it is.
+//
+void LensSystem::ApplyZoom( float position )
+{
+	float c = position * ( zoomConfigurations - 1 );
+	int c0 = std::min( (int)c, zoomConfigurations - 2 );
+	float t = c - c0;
+
+	for ( const ZoomOperand& op : zoomOperands )
+	{
+		float value = op.values[c0] * ( 1.0f - t ) + op.values[c0 + 1] * t;
+		if ( op.thickness ) thicknesses[op.surface] = value;
+		else radii[op.surface] = -1.0f / value;
+	}
+
+	float vertex = centers[0] + radii[0];
+	for ( int i = 0; i < (int)centers.size(); i++ )
+	{
+		centers[i] = vertex - radii[i];
+		vertex += thicknesses[i];
+	}
+}
+
+//
+// Pupils, focal length and principal planes for every wavelength row, into wavelengthData and every distance of the
+// lensData table. Sets rowsMoved[i] when the entrance pupil of row i changed, as the Seidel coefficients of that row
+// have to be recalculated then.
+//
+void LensSystem::PrecalculatePupils( bool* rowsMoved )
+{
+	float step = 1.0f / ( LOOKUP_SIZE - 1 );
+
+#pragma omp parallel for schedule( dynamic, 1 )
 	for ( int i = 0; i < LOOKUP_SIZE; i++ )
 	{
 		float wavelength = ( i * step ) * 0.470f + 0.360f;
+		LensData& row = wavelengthData[i];
+		float previousEntrancePupil = row.entrancePupil;
 
 		//
 		// entrance and exit pupils
@@ -310,11 +694,8 @@ void LensSystem::Precalculate( float aperture )
 			break;
 		}
 
-		for ( int j = 0; j < LOOKUP_SIZE; j++ )
-		{
-			lensData[i * LOOKUP_SIZE + j].entrancePupil = entrance_pupil;
-			lensData[i * LOOKUP_SIZE + j].exitPupil = exit_pupil;
-		}
+		row.entrancePupil = entrance_pupil;
+		row.exitPupil = exit_pupil;
 
 		// Find the radii by using marginal rays. Use angle_min as that is the largest angle of which we are sure that it passes through the pupils.
 
@@ -335,11 +716,8 @@ void LensSystem::Precalculate( float aperture )
 		float entrance_pupil_radius = abs( ( O1 + D1 * t1 ).y );
 		float exit_pupil_radius = abs( ( O2 + D2 * t2 ).y );
 
-		for ( int j = 0; j < LOOKUP_SIZE; j++ )
-		{
-			lensData[i * LOOKUP_SIZE + j].entrancePupilRadius = entrance_pupil_radius;
-			lensData[i * LOOKUP_SIZE + j].exitPupilRadius = exit_pupil_radius;
-		}
+		row.entrancePupilRadius = entrance_pupil_radius;
+		row.exitPupilRadius = exit_pupil_radius;
 
 		//
 		// Calculate focal lengths and principal planes using matrices (Optics, page 247 - 250)
@@ -378,64 +756,239 @@ void LensSystem::Precalculate( float aperture )
 				T.z * A.y + T.w * A.w );
 		}
 
-		for ( int j = 0; j < LOOKUP_SIZE; j++ )
-		{
-			lensData[i * LOOKUP_SIZE + j].focalLength = -1.0f / A.y;
-			lensData[i * LOOKUP_SIZE + j].principalPlaneFront = centers[0] + radii[0] + ( 1.0f - A.x ) / ( -A.y );
-			lensData[i * LOOKUP_SIZE + j].principalPlaneRear = centers[num_elements - 1] + radii[num_elements - 1] + ( A.w - 1.0f ) / ( -A.y );
-		}
+		row.focalLength = -1.0f / A.y;
+		row.principalPlaneFront = centers[0] + radii[0] + ( 1.0f - A.x ) / ( -A.y );
+		row.principalPlaneRear = centers[num_elements - 1] + radii[num_elements - 1] + ( A.w - 1.0f ) / ( -A.y );
 
-		if ( lensData[i * LOOKUP_SIZE].focalLength < min_focalLength )
-		{
-			min_focalLength = lensData[i * LOOKUP_SIZE].focalLength;
-			min_focalLength_wavelength = wavelength;
-		}
-		if ( lensData[i * LOOKUP_SIZE].focalLength > max_focalLength )
+		// the same at every distance, the Seidel coefficients stay
+		for ( int j = 0; j < distanceAxis.Count(); j++ )
 		{
-			max_focalLength = lensData[i * LOOKUP_SIZE].focalLength;
-			max_focalLength_wavelength = wavelength;
+			LensData& ld = lensData[i * distanceAxis.Count() + j];
+			ld.focalLength = row.focalLength;
+			ld.entrancePupil = row.entrancePupil;
+			ld.exitPupil = row.exitPupil;
+			ld.entrancePupilRadius = row.entrancePupilRadius;
+			ld.exitPupilRadius = row.exitPupilRadius;
+			ld.principalPlaneFront = row.principalPlaneFront;
+			ld.principalPlaneRear = row.principalPlaneRear;
 		}
 
-		meanFocalLength += lensData[i * LOOKUP_SIZE].focalLength;
-		meanFstop += lensData[i * LOOKUP_SIZE].focalLength / ( 2.0f * lensData[i * LOOKUP_SIZE].entrancePupilRadius );
+		rowsMoved[i] = row.entrancePupil != previousEntrancePupil;
 	}
 
+	// summed in a fixed order, so the result does not depend on the number of threads
+	meanFocalLength = 0.0f;
+	meanFstop = 0.0f;
+	for ( int i = 0; i < LOOKUP_SIZE; i++ )
+	{
+		meanFocalLength += wavelengthData[i].focalLength;
+		meanFstop += wavelengthData[i].focalLength / ( 2.0f * wavelengthData[i].entrancePupilRadius );
+	}
 	meanFocalLength /= ( float( LOOKUP_SIZE ) );
 	meanFstop /= ( float( LOOKUP_SIZE ) );
-	std::cout << "min  focal length: " << ( 1000 * min_focalLength ) << "mm (at " << (int)( 1000 * min_focalLength_wavelength ) << "nm)" << std::endl;
-	std::cout << "mean focal length: " << ( 1000 * meanFocalLength ) << "mm" << std::endl;
-	std::cout << "max  focal length: " << ( 1000 * max_focalLength ) << "mm (at " << (int)( 1000 * max_focalLength_wavelength ) << "nm)" << std::endl;
-	std::cout << "mean f-stop: f/" << meanFstop << "" << std::endl;
+}
 
-	std::cout << "FOV at mean focal length for an image sensor of width " << ( SENSOR_SIZE * 1000 ) << "mm: " << ( 2.0f * atanf( SENSOR_SIZE / ( 2 * meanFocalLength ) ) * 180.0f / PI ) << " degrees" << std::endl;
+//
+// Places the knots of the distance axis and fills lensData with the Seidel coefficients of every wavelength row at them.
+// The axis starts as distanceIntervals equal intervals in inverse distance, which spends the knots where the
+// coefficients change: near the lens, while everything beyond a few metres shares a few intervals up to infinity. An
+// interval is halved while, for some wavelength, the coefficients at its midpoint differ from the linear interpolation
+// by more than tableTolerance times the largest magnitude of that coefficient in the row. Halving a smooth interval
+// quarters that error; where it does not at least halve, the interval holds a pole of the coefficients (an object
+// distance imaged onto a surface) or the error is down to float rounding, and it is left as it is.
+//
+void LensSystem::PrecalculateSeidel()
+{
+	static float LensData::*const terms[] = { &LensData::B, &LensData::C, &LensData::D, &LensData::E, &LensData::F, &LensData::s_prime };
+	float step = 1.0f / ( LOOKUP_SIZE - 1 );
 
-	//
-	// Seidel coefficients
-	//
+	// the coefficients of row i at the given inverse distances, the other fields from wavelengthData
+	auto evaluate = [&]( int i, const std::vector<float>& inverse, std::vector<LensData>* out )
+	{
+		std::vector<float> dists( inverse.size() );
+		for ( int j = 0; j < (int)inverse.size(); j++ )
+			dists[j] = DistanceAxis::Distance( inverse[j] );
+		float wavelength = ( i * step ) * 0.470f + 0.360f;
+		out->assign( inverse.size(), wavelengthData[i] );
+		Seidel::GenerateCoefficientsRow( wavelength, num_elements, dispconstants.data(), radii.data(), centers.data(), thicknesses.data(), out->data(), (int)inverse.size(), dists.data() );
+	};
+
+	std::vector<float> knots;
+	std::vector<int> candidates;	// the intervals to test, by their first knot
+	std::vector<float> parentError; // of the interval every candidate is a half of
+	for ( int k = 0; k <= distanceIntervals; k++ )
+	{
+		knots.push_back( ( 1.0f / LENS_TABLE_NEAR ) * k / distanceIntervals );
+		if ( k < distanceIntervals ) candidates.push_back( k ), parentError.push_back( 1E30f );
+	}
 
-	float diststep = 15.0f / LOOKUP_SIZE;
+	std::vector<LensData> rows[LOOKUP_SIZE];
+#pragma omp parallel for schedule( dynamic, 1 )
 	for ( int i = 0; i < LOOKUP_SIZE; i++ )
+		evaluate( i, knots, &rows[i] );
+	seidelEvaluations = LOOKUP_SIZE * (int)knots.size();
+
+	for ( int level = 0; level < distanceLevels && !candidates.empty(); level++ )
 	{
-		float wavelength = ( i * step ) * 0.470f + 0.360f;
-		for ( int j = 0; j < LOOKUP_SIZE; j++ )
+		int count = (int)candidates.size();
+		std::vector<float> midpoints( count );
+		for ( int c = 0; c < count; c++ )
+			midpoints[c] = ( knots[candidates[c]] + knots[candidates[c] + 1] ) * 0.5f;
+
+		std::vector<LensData> middle[LOOKUP_SIZE];
+		std::vector<float> error( LOOKUP_SIZE * count ); // of row i and candidate c at i * count + c
+#pragma omp parallel for schedule( dynamic, 1 )
+		for ( int i = 0; i < LOOKUP_SIZE; i++ )
 		{
-			float dist = j * diststep + 0.2f;
-			Seidel::GenerateCoefficients( wavelength, num_elements, dispconstants, radii, centers, thicknesses, &lensData[i * LOOKUP_SIZE + j], dist );
+			evaluate( i, midpoints, &middle[i] );
+			for ( float LensData::*term : terms )
+			{
+				float magnitude = 0.0f;
+				for ( const LensData& ld : rows[i] )
+					magnitude = std::max( magnitude, fabsf( ld.*term ) );
+				if ( magnitude == 0.0f ) continue; // zero at every knot, and so everywhere in between
+				for ( int c = 0; c < count; c++ )
+				{
+					float interpolated = ( rows[i][candidates[c]].*term + rows[i][candidates[c] + 1].*term ) * 0.5f;
+					error[i * count + c] = std::max( error[i * count + c], fabsf( middle[i][c].*term - interpolated ) / magnitude );
+				}
+			}
+		}
+		seidelEvaluations += LOOKUP_SIZE * count;
+
+		// insert the midpoints of the intervals that are off, their halves are tested on the next level
+		std::vector<float> refined;
+		std::vector<LensData> refinedRows[LOOKUP_SIZE];
+		std::vector<int> next;
+		std::vector<float> nextParentError;
+		for ( int k = 0, c = 0; k < (int)knots.size(); k++ )
+		{
+			refined.push_back( knots[k] );
+			for ( int i = 0; i < LOOKUP_SIZE; i++ ) refinedRows[i].push_back( rows[i][k] );
+			if ( c == count || candidates[c] != k ) continue;
 
+			float worst = 0.0f;
+			for ( int i = 0; i < LOOKUP_SIZE; i++ ) worst = std::max( worst, error[i * count + c] );
+			if ( worst > tableTolerance && worst < parentError[c] * 0.5f )
+			{
+				next.push_back( (int)refined.size() - 1 );
+				next.push_back( (int)refined.size() );
+				nextParentError.push_back( worst );
+				nextParentError.push_back( worst );
+				refined.push_back( midpoints[c] );
+				for ( int i = 0; i < LOOKUP_SIZE; i++ ) refinedRows[i].push_back( middle[i][c] );
+			}
+			c++;
 		}
+
+		knots.swap( refined );
+		for ( int i = 0; i < LOOKUP_SIZE; i++ ) rows[i].swap( refinedRows[i] );
+		candidates.swap( next );
+		parentError.swap( nextParentError );
 	}
 
-	LensData meanLensData = GetLensData( 0.550f, FOCUS );
+	distanceAxis.Build( knots, distanceIntervals << distanceLevels );
+	lensData.resize( LOOKUP_SIZE * knots.size() );
+	for ( int i = 0; i < LOOKUP_SIZE; i++ )
+		std::copy( rows[i].begin(), rows[i].end(), lensData.begin() + i * knots.size() );
+}
 
-	std::cout << std::endl;
-	std::cout << "Mean Seidel coefficients:" << std::endl;
-	std::cout << "B: " << std::to_string( meanLensData.B ) << std::endl;
-	std::cout << "C: " << std::to_string( meanLensData.C ) << std::endl;
-	std::cout << "D: " << std::to_string( meanLensData.D ) << std::endl;
-	std::cout << "E: " << std::to_string( meanLensData.E ) << std::endl;
-	std::cout << "F: " << std::to_string( meanLensData.F ) << std::endl;
-	std::cout << std::endl;
+//
+// Seidel coefficients of the wavelength rows flagged in rows, at the distances already on distanceAxis
+//
+void LensSystem::UpdateSeidel( const bool* rows )
+{
+	float step = 1.0f / ( LOOKUP_SIZE - 1 );
+	int count = distanceAxis.Count();
+	std::vector<float> dists( count );
+	for ( int j = 0; j < count; j++ )
+		dists[j] = DistanceAxis::Distance( distanceAxis.knots[j] );
+
+#pragma omp parallel for schedule( dynamic, 1 )
+	for ( int i = 0; i < LOOKUP_SIZE; i++ )
+	{
+		if ( !rows[i] ) continue;
+
+		float wavelength = ( i * step ) * 0.470f + 0.360f;
+		Seidel::GenerateCoefficientsRow( wavelength, num_elements, dispconstants.data(), radii.data(), centers.data(), thicknesses.data(), &lensData[i * count], count, dists.data() );
+	}
+}
+
+//
+// The lens data of an aperture within the range, from the two nearest apertures of PrecalculateRange
+//
+void LensSystem::InterpolateAperture( float aperture )
+{
+	float a = ( aperture - range.minAperture ) / ( range.maxAperture - range.minAperture ) * ( range.apertureSteps - 1 );
+	int a0 = std::min( (int)a, range.apertureSteps - 2 );
+	InterpolateState( range.states, a0, a - a0 );
+}
+
+//
+// Appends the current lens data to states, whose distance axis it has to be on
+//
+void LensSystem::StoreState( LensStates* states )
+{
+	states->wavelengthData.insert( states->wavelengthData.end(), wavelengthData, wavelengthData + LOOKUP_SIZE );
+	states->lensData.insert( states->lensData.end(), lensData.begin(), lensData.end() );
+	states->meanFocalLength.push_back( meanFocalLength );
+	states->meanFstop.push_back( meanFstop );
+}
+
+//
+// The lens data at t between state index and the next one
+//
+void LensSystem::InterpolateState( const LensStates& states, int index, float t )
+{
+	float t0 = 1.0f - t;
+	for ( int i = 0; i < LOOKUP_SIZE; i++ )
+		wavelengthData[i] = states.wavelengthData[index * LOOKUP_SIZE + i] * t0 + states.wavelengthData[( index + 1 ) * LOOKUP_SIZE + i] * t;
+
+	distanceAxis = states.distanceAxis;
+	int size = LOOKUP_SIZE * distanceAxis.Count();
+	lensData.resize( size );
+	for ( int i = 0; i < size; i++ )
+		lensData[i] = states.lensData[index * size + i] * t0 + states.lensData[( index + 1 ) * size + i] * t;
+
+	meanFocalLength = states.meanFocalLength[index] * t0 + states.meanFocalLength[index + 1] * t;
+	meanFstop = states.meanFstop[index] * t0 + states.meanFstop[index + 1] * t;
+}
+
+//
+// The sensor position and Seidel focus of the current aperture and focus from the range of PrecalculateRange, bilinear
+// in aperture and inverse focus distance. Returns false when the range does not cover them, or they lie in a cell that
+// doesn't interpolate.
+//
+bool LensSystem::InterpolateFocus()
+{
+	float aperture = apertures[num_aperturestop] / originalAperture;
+	if ( !range.HasAperture( aperture ) || !range.HasFocus( FOCUS ) ) return false;
+
+	float a = ( aperture - range.minAperture ) / ( range.maxAperture - range.minAperture ) * ( range.apertureSteps - 1 );
+	int a0 = std::min( (int)a, range.apertureSteps - 2 );
+	float ta = a - a0;
 
+	float f = ( 1.0f / FOCUS - 1.0f / range.farFocus ) / ( 1.0f / range.nearFocus - 1.0f / range.farFocus ) * ( range.focusSteps - 1 );
+	int f0 = std::min( (int)f, range.focusSteps - 2 );
+	float tf = f - f0;
+	if ( range.exact[a0 * ( range.focusSteps - 1 ) + f0] ) return false;
+
+	auto bilinear = [&]( const std::vector<float>& grid )
+	{
+		const float* p = &grid[a0 * range.focusSteps + f0];
+		const float* q = p + range.focusSteps;
+		return ( p[0] * ( 1.0f - tf ) + p[1] * tf ) * ( 1.0f - ta ) + ( q[0] * ( 1.0f - tf ) + q[1] * tf ) * ta;
+	};
+	sensorPosition = bilinear( range.sensorPosition );
+	seidelFocus = 1.0f / bilinear( range.seidelFocus );
+	return true;
+}
+
+//
+// The sensor position for the current focus distance, and the matching focus distance for Seidel
+//
+void LensSystem::PrecalculateFocus()
+{
 	//
 	// Calculate the sensor distance for SSRT. Uses a weighted average (weight = luminance) over the whole spectrum and entrance pupil.
 	//
@@ -466,7 +1019,6 @@ void LensSystem::Precalculate( float aperture )
 	}
 
 	sensorPosition = tempSensorPosition / totalWeight;
-	std::cout << "Sensor position: " << sensorPosition << std::endl;
 
 	//
 	// Calculate the focus distance to be used with Seidel, such that it matches the SSRT as closely as possible.
@@ -502,8 +1054,125 @@ void LensSystem::Precalculate( float aperture )
 	}
 
 	seidelFocus = -tempFocus / totalWeight;
-	std::cout << "Focus: " << FOCUS << std::endl;
-	std::cout << "Seidel focus: " << seidelFocus << std::endl;
+}
+
+//
+// Identifies the lens and its current state (aperture, zoom), what is derived from tracing rays through it depends on.
+// The focus only moves the sensor, which is left out.
+//
+uint64 LensSystem::StateKey() const
+{
+	uint64 key = HelperFunctions::FNV1a( &num_elements, sizeof( int ) );
+	for ( const std::vector<float>* values : { &radii, &centers, &apertures, &dispconstants } )
+		key = HelperFunctions::FNV1a( values->data(), values->size() * sizeof( float ), key );
+	return key;
+}
+
+//
+// An aperture within the range of PrecalculateRange, or a zoom between the positions of PrecalculateZoom: one of the
+// many states interactive changes pass through, not worth keeping anything derived from on disk
+//
+bool LensSystem::Scrubbing() const
+{
+	return range.HasAperture( apertures[num_aperturestop] / originalAperture ) || ( zoomTables.positions > 0 && zoomTables.aperture == apertures[num_aperturestop] );
+}
+
+//
+// Moves a scrubbing lens to the nearest of the apertures of PrecalculateRange, or of the zoom positions of
+// PrecalculateZoom, calculated exactly as those were, so its StateKey is the same every time. What is derived from
+// tracing rays through the lens (RayTable) is kept for these states only, and stands in for the ones in between.
+//
+void LensSystem::SnapToPrecalculated()
+{
+	float aperture = apertures[num_aperturestop] / originalAperture;
+	if ( range.HasAperture( aperture ) )
+	{
+		int a = (int)roundf( ( aperture - range.minAperture ) / ( range.maxAperture - range.minAperture ) * ( range.apertureSteps - 1 ) );
+		SetAperture( range.minAperture + ( range.maxAperture - range.minAperture ) * a / ( range.apertureSteps - 1 ) );
+	}
+	else if ( Scrubbing() )
+	{
+		int p = (int)roundf( zoom * ( zoomTables.positions - 1 ) );
+		SetZoom( p / (float)( zoomTables.positions - 1 ) );
+	}
+}
+
+//
+// The cache key, a hash of everything the precalculated data depends on: the lens file, the glasses it resolved to (the
+// glass catalogs may change independently of the lens file), the aperture and focus, and the layout and range of the
+// table. The code that calculates it is only covered by LENS_CACHE_VERSION.
+//
+uint64 LensSystem::CacheKey( const std::string& fileContents, float aperture )
+{
+	uint parameters[] = { LENS_CACHE_VERSION, LOOKUP_SIZE, distanceIntervals, distanceLevels, (uint)sizeof( LensData ), (uint)num_elements, (uint)num_aperturestop };
+	uint64 key = HelperFunctions::FNV1a( parameters, sizeof( parameters ) );
+	key = HelperFunctions::FNV1a( fileContents.data(), fileContents.size(), key );
+	key = HelperFunctions::FNV1a( dispconstants.data(), dispconstants.size() * sizeof( float ), key );
+	key = HelperFunctions::FNV1a( &aperture, sizeof( float ), key );
+	key = HelperFunctions::FNV1a( &FOCUS, sizeof( float ), key );
+	key = HelperFunctions::FNV1a( &tableTolerance, sizeof( float ), key );
+	float nearest = LENS_TABLE_NEAR;
+	key = HelperFunctions::FNV1a( &nearest, sizeof( float ), key );
+	return key;
+}
+
+//
+// Restores what Precalculate( aperture ) would calculate from the cache, returns false when there is no matching cache.
+// The file is memory mapped and the table copied out of it, so SetFocus and SetAperture can still update it in place.
+//
+bool LensSystem::LoadCache( uint64 key, float aperture )
+{
+	MappedFile file;
+	if ( !file.Open( cachePath ) || file.size < sizeof( LensCacheHeader ) ) return false;
+
+	const LensCacheHeader* header = (const LensCacheHeader*)file.data;
+	if ( memcmp( header->magic, "LENSDATA", 8 ) != 0 || header->version != LENS_CACHE_VERSION || header->lookupSize != LOOKUP_SIZE ||
+		 header->lensDataSize != sizeof( LensData ) || header->key != key || header->distances < 2 ||
+		 file.size != sizeof( LensCacheHeader ) + header->distances * ( sizeof( float ) + LOOKUP_SIZE * sizeof( LensData ) ) )
+		return false;
+
+	apertures[num_aperturestop] = originalAperture * aperture;
+	program.Compile( num_elements, centers, radii, apertures, dispconstants );
+
+	const float* knots = (const float*)( file.data + sizeof( LensCacheHeader ) );
+	distanceAxis.Build( std::vector<float>( knots, knots + header->distances ), distanceIntervals << distanceLevels );
+	lensData.resize( LOOKUP_SIZE * header->distances );
+	memcpy( lensData.data(), knots + header->distances, lensData.size() * sizeof( LensData ) );
+	for ( int i = 0; i < LOOKUP_SIZE; i++ )
+		wavelengthData[i] = lensData[i * header->distances];
+	lensTable.Build( lensData.data(), distanceAxis );
+	seidelEvaluations = 0;
+	meanFocalLength = header->meanFocalLength;
+	meanFstop = header->meanFstop;
+	sensorPosition = header->sensorPosition;
+	seidelFocus = header->seidelFocus;
+	return true;
+}
+
+void LensSystem::SaveCache( uint64 key )
+{
+	LensCacheHeader header = {};
+	memcpy( header.magic, "LENSDATA", 8 );
+	header.version = LENS_CACHE_VERSION;
+	header.lookupSize = LOOKUP_SIZE;
+	header.lensDataSize = sizeof( LensData );
+	header.distances = distanceAxis.Count();
+	header.key = key;
+	header.meanFocalLength = meanFocalLength;
+	header.meanFstop = meanFstop;
+	header.sensorPosition = sensorPosition;
+	header.seidelFocus = seidelFocus;
+
+	size_t knotBytes = distanceAxis.knots.size() * sizeof( float );
+	std::vector<byte> contents( sizeof( LensCacheHeader ) + knotBytes + lensData.size() * sizeof( LensData ) );
+	memcpy( contents.data(), &header, sizeof( LensCacheHeader ) );
+	memcpy( contents.data() + sizeof( LensCacheHeader ), distanceAxis.knots.data(), knotBytes );
+	memcpy( contents.data() + sizeof( LensCacheHeader ) + knotBytes, lensData.data(), lensData.size() * sizeof( LensData ) );
+
+	std::error_code error;
+	std::filesystem::create_directories( std::filesystem::path( cachePath ).parent_path(), error );
+	if ( !MappedFile::WriteAtomic( cachePath, contents.data(), contents.size() ) )
+		std::cout << "WARNING: couldn't write lens data cache " << cachePath << std::endl;
 }
 
 //
@@ -511,7 +1180,9 @@ void LensSystem::Precalculate( float aperture )
 //
 void LensSystem::ImportFile( std::string filepath )
 {
-	std::ifstream infile( filepath );
+	std::ifstream file( filepath, std::ios::binary );
+	std::string contents( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>() );
+	std::istringstream infile( contents );
 
 	float scale = 1.0f;
 
@@ -522,6 +1193,9 @@ void LensSystem::ImportFile( std::string filepath )
 	float aperture = 0;
 	bool ignore_element = false;
 
+	std::vector<int> surfaceNumbers; // of the SURF lines in order, which the multi-configuration operands refer to
+	int zoomCurrent = 1;			 // the configuration of the surfaces
+
 	std::string line;
 	bool started = false;
 	while ( std::getline( infile, line ) )
@@ -545,6 +1219,29 @@ void LensSystem::ImportFile( std::string filepath )
 				std::cout << "ERROR: Couldn't set lens scale, unknown identifier " + split[1] << std::endl;
 		}
 
+		if ( command == "GCAT" )
+			glassCatalogs.assign( split.begin() + 1, split.end() );
+
+		if ( command == "MNUM" )
+		{
+			zoomConfigurations = std::max( 1, std::stoi( split[1] ) );
+			if ( split.size() > 2 ) zoomCurrent = std::stoi( split[2] );
+		}
+
+		// multi-configuration operands: surface number, configuration and value
+		if ( ( command == "THIC" || command == "CRVT" ) && split.size() > 3 && zoomConfigurations > 1 )
+		{
+			bool thickness = command == "THIC";
+			int surface = std::stoi( split[1] ), configuration = std::stoi( split[2] ) - 1;
+			float value = std::stof( split[3] );
+			if ( thickness ) value = value * scale > 1000 ? 0 : value * scale;
+			else value = ( value == 0 ? 0.001f : value ) / scale;
+
+			auto op = std::find_if( zoomOperands.begin(), zoomOperands.end(), [&]( const ZoomOperand& o ) { return o.thickness == thickness && o.surface == surface; } );
+			if ( op == zoomOperands.end() ) op = zoomOperands.insert( zoomOperands.end(), { thickness, surface, std::vector<float>( zoomConfigurations, std::numeric_limits<float>::quiet_NaN() ) } );
+			if ( configuration >= 0 && configuration < zoomConfigurations ) op->values[configuration] = value;
+		}
+
 		if ( !started && command == "SURF" ) started = true;
 		if ( !started ) continue;
 
@@ -591,6 +1288,8 @@ void LensSystem::ImportFile( std::string filepath )
 
 		if ( command == "SURF" )
 		{
+			surfaceNumbers.push_back( std::stoi( split[1] ) );
+
 			//num_elements++;
 			if ( aperture > 1E-4f )
 				num_elements++;
@@ -637,14 +1336,41 @@ void LensSystem::ImportFile( std::string filepath )
 	thicknesses.erase( thicknesses.begin() );
 	thicknesses.erase( thicknesses.begin() );
 
-	// make sure we begin with air
-	if ( materials.at( 0 ) != "AIR" )
-		materials.insert( materials.begin(), "AIR" );
+	// the operands refer to a surface by number, its data went in at the index of the next SURF line and the first two
+	// are gone: the object surface, and what came before the first SURF line
+	for ( auto op = zoomOperands.begin(); op != zoomOperands.end(); )
+	{
+		int index = (int)( std::find( surfaceNumbers.begin(), surfaceNumbers.end(), op->surface ) - surfaceNumbers.begin() ) - 1;
+		if ( index < 0 || index >= (int)thicknesses.size() )
+		{
+			std::cout << "Ignoring the multi-configuration operand of surface " << op->surface << ", which the lens does not have" << std::endl;
+			op = zoomOperands.erase( op );
+			continue;
+		}
+		op->surface = index;
+
+		// configurations without a value keep the one of the surface, as in Zemax
+		for ( float& value : op->values )
+			if ( std::isnan( value ) ) value = op->thickness ? thicknesses[index] : -1.0f / radii[index];
+		op++;
+	}
+
+	// every material is the one behind its surface, so air goes in front of the first one; checking whether the first
+	// material was air left it out for lenses that start with a dummy surface in air, one material short
+	materials.insert( materials.begin(), "AIR" );
 
 	// materials
 	for ( int i = 0; i < materials.size(); i++ )
 	{
-		std::vector<float> dat = Glass::GetDispersionConstants( materials[i] );
+		DispersionConstants dat;
+		if ( !GlassCatalog::Find( glassCatalogs, materials[i], &dat ) )
+		{
+			// only a missing catalog that would have been needed is worth mentioning
+			if ( !Glass::Find( materials[i].c_str() ) )
+				for ( const std::string& name : glassCatalogs )
+					if ( !GlassCatalog::Get( name ) ) std::cout << "Glass catalog " << name << " not found in " << GLASS_CATALOG_DIR << std::endl;
+			dat = Glass::GetDispersionConstants( materials[i] );
+		}
 		for ( int j = 0; j < 6; j++ )
 		{
 			dispconstants.push_back( dat[j] );
@@ -652,9 +1378,33 @@ void LensSystem::ImportFile( std::string filepath )
 	}
 
 	std::cout << "Imported lens containing " + std::to_string( centers.size() ) + " surfaces from file " + filepath << std::endl;
+	if ( !zoomOperands.empty() )
+	{
+		// the surfaces are those of the current configuration
+		zoom = clamp( ( zoomCurrent - 1 ) / (float)( zoomConfigurations - 1 ), 0.0f, 1.0f );
+		std::cout << "Zoom lens with " << zoomConfigurations << " configurations changing " << zoomOperands.size() << " surfaces" << std::endl;
+	}
 
 	originalAperture = apertures[num_aperturestop];
 
-	// precalculate values
+	// precalculate values, or take them from the cache
+#ifdef ENABLE_LENS_CACHE
+	uint64 key = CacheKey( contents, APERTURE );
+	char name[32];
+	snprintf( name, sizeof( name ), "%016llx.lensdata", (unsigned long long)key );
+	cachePath = ( std::filesystem::temp_directory_path() / "seidel_lenscache" / name ).string();
+
+	if ( LoadCache( key, APERTURE ) )
+	{
+		std::cout << "Loaded precalculated lens data from " << cachePath << std::endl;
+		PrintSummary();
+	}
+	else
+	{
+		Precalculate( APERTURE );
+		SaveCache( key );
+	}
+#else
 	Precalculate( APERTURE );
+#endif
 }
\ No newline at end of file
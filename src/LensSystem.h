@@ -1,35 +1,5 @@
 #pragma once
 
-struct float16
-{
-	union {
-		float data[16];
-		__m256 data8[2];
-	};
-
-	inline float16 operator+( float16 a )
-	{
-		float16 output;
-
-		output.data8[0] = _mm256_add_ps( data8[0], a.data8[0] );
-		output.data8[1] = _mm256_add_ps( data8[1], a.data8[1] );
-
-		return output;
-	}
-
-	inline float16 operator*( float f )
-	{
-		float16 output;
-
-		__m256 f8 = _mm256_set1_ps( f );
-
-		output.data8[0] = _mm256_mul_ps( data8[0], f8 );
-		output.data8[1] = _mm256_mul_ps( data8[1], f8 );
-
-		return output;
-	}
-};
-
 struct LensData
 {
 	float B, C, D, E, F; // seidel coefficients
@@ -43,7 +13,7 @@ struct LensData
 	float s_prime;
 	float dummy1, dummy2, dummy3;
 	
-	inline LensData operator+( LensData a )
+	inline LensData operator+( LensData a ) const
 	{
 		LensData output;
 		output.B = B + a.B;
@@ -63,7 +33,7 @@ struct LensData
 		return output;
 	}
 
-	inline LensData operator*( float f )
+	inline LensData operator*( float f ) const
 	{
 		LensData output;
 		output.B = B * f;
@@ -83,14 +53,110 @@ struct LensData
 	}
 };
 
+//
+// SIMD_WIDTH rays in structure-of-arrays form for LensSystem::TraceRay3DPacket, lanes that are vignetted are masked off
+//
+struct RayPacket
+{
+	floatv Ox, Oy, Oz;
+	floatv Dx, Dy, Dz;
+	floatv wavelength;
+	maskv valid;
+};
+
+#define LENS_CACHE_VERSION 5 // increase whenever Precalculate, the Seidel kernel or the import change what ends up in the lens data
+
+//
+// Layout of a lens data cache file: this header, the knots of the distance axis and the LOOKUP_SIZE x distances lensData
+// table
+//
+struct LensCacheHeader
+{
+	char magic[8]; // "LENSDATA"
+	uint version;
+	uint lookupSize;
+	uint lensDataSize;
+	uint distances; // knots of the distance axis
+	uint64 key; // see LensSystem::CacheKey
+	float meanFocalLength;
+	float meanFstop;
+	float sensorPosition;
+	float seidelFocus;
+};
+
+//
+// The lens data of a number of lens states (apertures, zoom positions) on one distance axis, so their lensData tables
+// interpolate entry by entry, see LensSystem::StoreState and LensSystem::InterpolateState
+//
+struct LensStates
+{
+	DistanceAxis distanceAxis;
+	std::vector<LensData> wavelengthData;		   // states x LOOKUP_SIZE
+	std::vector<LensData> lensData;				   // states x LOOKUP_SIZE x distances
+	std::vector<float> meanFocalLength, meanFstop; // per state
+
+	size_t Bytes() const { return ( wavelengthData.size() + lensData.size() ) * sizeof( LensData ); }
+};
+
+//
+// The lens precalculated over a range of apertures and focus distances by LensSystem::PrecalculateRange
+//
+struct LensRange
+{
+	int apertureSteps = 0, focusSteps = 0; // 0 when there is no range
+	float minAperture, maxAperture;		   // relative to the lens file, as for SetAperture
+	float nearFocus, farFocus;			   // sampled evenly in inverse distance
+	LensStates states;					   // per aperture
+	std::vector<float> sensorPosition, seidelFocus; // apertureSteps x focusSteps, seidelFocus as its inverse
+	std::vector<bool> exact; // ( apertureSteps - 1 ) x ( focusSteps - 1 ), the cells that don't interpolate the focus within LENS_RANGE_TOLERANCE
+
+	bool HasAperture( float aperture ) const { return apertureSteps > 0 && aperture >= minAperture && aperture <= maxAperture; }
+	bool HasFocus( float focus ) const { return focusSteps > 0 && focus >= nearFocus && focus <= farFocus; }
+	size_t Bytes() const { return states.Bytes() + sensorPosition.size() * 2 * sizeof( float ) + exact.size() / 8; }
+};
+
+//
+// A Zemax multi-configuration operand that ImportFile understands: the thickness (THIC) or curvature (CRVT) of one
+// surface in every configuration
+//
+struct ZoomOperand
+{
+	bool thickness;			   // or else the curvature
+	int surface;			   // index into thicknesses or radii
+	std::vector<float> values; // per configuration, thicknesses in m and curvatures in 1/m
+};
+
+//
+// The lens precalculated at a number of zoom positions by LensSystem::PrecalculateZoom, for one aperture
+//
+struct LensZoom
+{
+	int positions = 0; // 0 when there are none, spread evenly over the zoom from 0 to 1
+	float aperture;	   // the stop aperture they were calculated with
+	float focus;	   // the focus distance of sensorPosition and seidelFocus
+	LensStates states; // per position
+	std::vector<float> sensorPosition, seidelFocus; // per position, seidelFocus as its inverse
+
+	size_t Bytes() const { return states.Bytes() + sensorPosition.size() * 2 * sizeof( float ); }
+};
+
 class LensSystem
 {
 public:
 	void ImportFile( std::string filepath );
 	bool TraceRay( float2* O, float2* D, float wavelength, int lowest_element, int highest_element, bool forwards, bool useGaussianOptics, int* hit, bool registerHit );
 	bool TraceRay3D( float3* O, float3* D, float wavelength, int lowest_element, int highest_element, bool forwards, bool useGaussianOptics );
+	maskv TraceRay3DPacket( RayPacket* packet, int lowest_element, int highest_element, bool forwards );
 	LensData GetLensData( float wavelength, float dist );
 	void Precalculate( float aperture );
+	void SetAperture( float aperture );
+	void SetFocus( float focus );
+	void PrecalculateRange( float minAperture, float maxAperture, int apertureSteps, float nearFocus, float farFocus, int focusSteps );
+	void SetZoom( float position );
+	void PrecalculateZoom( int positions );
+	uint64 StateKey() const;
+	bool Scrubbing() const; // whether the state is interpolated from PrecalculateRange or PrecalculateZoom
+	void SnapToPrecalculated(); // while scrubbing, moves to the nearest aperture or zoom position that was precalculated
 
 	int num_aperturestop = 0;
 	int num_elements = 0;
@@ -110,20 +176,50 @@ public:
 
 
 	std::vector<std::string> materials;
+	std::vector<std::string> glassCatalogs; // searched in order before the built-in glasses
+
+	LensProgram program;
+	std::string cachePath; // where the precalculated lens data is cached, set by ImportFile
+
+	float tableTolerance = LENS_TABLE_TOLERANCE; // for the next Precalculate, see PrecalculateSeidel
+	int seidelEvaluations = 0;					 // distances times wavelengths the last PrecalculateSeidel evaluated
+	DistanceAxis distanceAxis;					 // of the lensData table, placed by PrecalculateSeidel
+	LensDataTable lensTable;					 // the lens data for the SIMD batches, kept up to date with lensData
+	LensRange range;							 // what SetAperture and SetFocus interpolate, see PrecalculateRange
+
+	int zoomConfigurations = 1;				 // of the lens file, its MNUM line
+	float zoom = 0;							 // from 0 (the first configuration) to 1 (the last), see SetZoom
+	std::vector<ZoomOperand> zoomOperands;	 // what changes between the configurations
+	LensZoom zoomTables;					 // what SetZoom interpolates, see PrecalculateZoom
 
-	byte apertureSprite[65536]; // one channel aperture sprite, 256x256 pixels
-	float spriteMultiplier = 1.0f;
+	ApertureShape apertureShape; // of the aperture stop, with USE_APERTURE_SPRITE
 
 private:
 	float2 GetNormal( float2 O, float2 D, float2 center );
 	bool IntersectRay( float2 O, float2 D, float* t, float2 center, float radius, bool useGaussianOptics );
-	bool Refract( float2* D, float n1, float n2, float2 normal, bool useGaussianOptics );
+	bool Refract( float2* D, float n1n2, float2 normal, bool useGaussianOptics );
 
 	float3 GetNormal3D( float3 O, float3 D, float3 center );
 	bool IntersectRay3D( float3 O, float3 D, float* t, float3 center, float radius, bool useGaussianOptics );
-	bool Refract3D( float3* D, float n1, float n2, float3 normal, bool useGaussianOptics );
+	bool Refract3D( float3* D, float n1n2, float3 normal, bool useGaussianOptics );
+
+	void PrintSummary();
+	uint64 CacheKey( const std::string& fileContents, float aperture );
+	bool LoadCache( uint64 key, float aperture );
+	void SaveCache( uint64 key );
+
+	void PrecalculatePupils( bool* rowsMoved );
+	void PrecalculateSeidel();
+	void UpdateSeidel( const bool* rows );
+	void PrecalculateFocus();
+	void InterpolateAperture( float aperture );
+	bool InterpolateFocus();
+	void StoreState( LensStates* states );
+	void InterpolateState( const LensStates& states, int index, float t );
+	void ApplyZoom( float position );
 
 	float originalAperture;
 
-	LensData lensData[LOOKUP_SIZE * LOOKUP_SIZE];
+	LensData wavelengthData[LOOKUP_SIZE] = {}; // the fields that do not depend on the distance, per wavelength row
+	std::vector<LensData> lensData;			   // LOOKUP_SIZE wavelength rows of distanceAxis.Count() distances
 };
@@ -0,0 +1,103 @@
+#include "precomp.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool MappedFile::Open( const std::string& path )
+{
+	Close();
+
+#ifdef _WIN32
+	HANDLE f = CreateFileA( path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+	if ( f == INVALID_HANDLE_VALUE ) return false;
+
+	LARGE_INTEGER fileSize;
+	if ( !GetFileSizeEx( f, &fileSize ) || fileSize.QuadPart == 0 )
+	{
+		CloseHandle( f );
+		return false;
+	}
+
+	HANDLE m = CreateFileMappingA( f, nullptr, PAGE_READONLY, 0, 0, nullptr );
+	void* view = m ? MapViewOfFile( m, FILE_MAP_READ, 0, 0, 0 ) : nullptr;
+	if ( !view )
+	{
+		if ( m ) CloseHandle( m );
+		CloseHandle( f );
+		return false;
+	}
+
+	file = f;
+	mapping = m;
+	data = (const byte*)view;
+	size = (size_t)fileSize.QuadPart;
+#else
+	int fd = open( path.c_str(), O_RDONLY );
+	if ( fd < 0 ) return false;
+
+	struct stat info;
+	if ( fstat( fd, &info ) != 0 || info.st_size == 0 )
+	{
+		close( fd );
+		return false;
+	}
+
+	void* view = mmap( nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+	close( fd ); // the mapping keeps the file alive
+	if ( view == MAP_FAILED ) return false;
+
+	data = (const byte*)view;
+	size = (size_t)info.st_size;
+#endif
+
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if ( !data ) return;
+
+#ifdef _WIN32
+	UnmapViewOfFile( data );
+	CloseHandle( mapping );
+	CloseHandle( file );
+	file = mapping = nullptr;
+#else
+	munmap( (void*)data, size );
+#endif
+
+	data = nullptr;
+	size = 0;
+}
+
+bool MappedFile::WriteAtomic( const std::string& path, const void* data, size_t size )
+{
+	// unique per process, so processes building the same file at the same time don't write into each other's file
+#ifdef _WIN32
+	std::string temporary = path + "." + std::to_string( GetCurrentProcessId() ) + ".tmp";
+#else
+	std::string temporary = path + "." + std::to_string( getpid() ) + ".tmp";
+#endif
+
+	{
+		std::ofstream out( temporary, std::ios::binary );
+		if ( !out ) return false;
+		out.write( (const char*)data, size );
+		if ( !out ) return false;
+	}
+
+	std::error_code error;
+	std::filesystem::rename( temporary, path, error );
+	if ( error )
+	{
+		std::filesystem::remove( temporary, error );
+		return false;
+	}
+	return true;
+}
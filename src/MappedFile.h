@@ -0,0 +1,30 @@
+#pragma once
+
+//
+// A read-only memory mapping of a whole file. The pages come straight from the OS file cache, so every process on the
+// machine that maps the same file shares one copy of it.
+//
+class MappedFile
+{
+  public:
+	MappedFile() = default;
+	MappedFile( const MappedFile& ) = delete;
+	MappedFile& operator=( const MappedFile& ) = delete;
+	~MappedFile() { Close(); }
+
+	// maps the file, returns false when it does not exist or can't be mapped
+	bool Open( const std::string& path );
+	void Close();
+
+	// writes a file under a temporary name and renames it into place, so readers never see a partially written file
+	static bool WriteAtomic( const std::string& path, const void* data, size_t size );
+
+	const byte* data = nullptr;
+	size_t size = 0;
+
+  private:
+#ifdef _WIN32
+	void* file = nullptr;
+	void* mapping = nullptr;
+#endif
+};
@@ -0,0 +1,685 @@
+#include "precomp.h"
+
+static const int GRID = PSF_GRID_X * PSF_GRID_Y;
+static const int SCOUTS = 32;			// inverse distances at which Prepare finds how far the PSFs reach
+static const int REACH_SAMPLES = 1024; // per grid point and scout
+
+// the source pixel of a grid point, in the middle of its cell
+static int GridX( int g ) { return (int)( ( g % PSF_GRID_X + 0.5f ) * SCRWIDTH / PSF_GRID_X ); }
+static int GridY( int g ) { return (int)( ( g / PSF_GRID_X + 0.5f ) * SCRHEIGHT / PSF_GRID_Y ); }
+
+//
+// Where a pixel lies between the grid points: the four around it, and its bilinear weights, which Weight clamps to the
+// grid and Extrapolate doesn't, for the shifts, which keep growing towards the edges of the frame
+//
+struct GridCell
+{
+	GridCell( int x, int y )
+	{
+		float fx = ( x + 0.5f ) * PSF_GRID_X / SCRWIDTH - 0.5f, fy = ( y + 0.5f ) * PSF_GRID_Y / SCRHEIGHT - 0.5f;
+		int gx = clamp( (int)floorf( fx ), 0, std::max( PSF_GRID_X - 2, 0 ) ), gy = clamp( (int)floorf( fy ), 0, std::max( PSF_GRID_Y - 2, 0 ) );
+		ex = fx - gx, ey = fy - gy;
+		g00 = gy * PSF_GRID_X + gx, g10 = g00 + ( PSF_GRID_X > 1 ), g01 = g00 + ( PSF_GRID_Y > 1 ) * PSF_GRID_X, g11 = g01 + g10 - g00;
+	}
+	template <class Value> float Weight( Value value ) const { return Bilinear( value, clamp( ex, 0.0f, 1.0f ), clamp( ey, 0.0f, 1.0f ) ); }
+	template <class Value> float Extrapolate( Value value ) const { return Bilinear( value, ex, ey ); }
+	template <class Value> float Bilinear( Value value, float tx, float ty ) const
+	{
+		return ( value( g00 ) * ( 1.0f - tx ) + value( g10 ) * tx ) * ( 1.0f - ty ) + ( value( g01 ) * ( 1.0f - tx ) + value( g11 ) * tx ) * ty;
+	}
+
+	int g00, g10, g01, g11;
+	float ex, ey;
+};
+
+//
+// The fitted shift of the PSFs of a knot at a pixel, relative to its source pixel
+//
+static float2 FittedShift( const PSFKnot& knot, float x, float y )
+{
+	float qx = ( x + 0.5f ) / ( SCRWIDTH / 2 ) - 1.0f, qy = ( y + 0.5f - SCRHEIGHT / 2 ) / ( SCRWIDTH / 2 ), r2 = qx * qx + qy * qy;
+	float magnification = knot.shiftFit[2] + knot.shiftFit[3] * r2 + knot.shiftFit[4] * r2 * r2;
+	return float2( knot.shiftFit[0] + qx * magnification, knot.shiftFit[1] + qy * magnification );
+}
+
+//
+// How far Render moves a source pixel for a knot: the shifts of the PSFs of the grid points, which hold exactly at the
+// grid points, interpolated bilinearly, plus what that misses of the fitted shifts in between
+//
+static float2 Shift( const PSFKnot& knot, const GridCell& cell, int x, int y )
+{
+	float2 fitted = FittedShift( knot, (float)x, (float)y );
+	float shift[2];
+	for ( int axis = 0; axis < 2; axis++ )
+	{
+		float interpolated = cell.Extrapolate( [&]( int g ) { return knot.shifts[g * 2 + axis]; } );
+		float fittedInterpolated = cell.Extrapolate( [&]( int g ) { return FittedShift( knot, (float)GridX( g ), (float)GridY( g ) ).cell[axis]; } );
+		shift[axis] = interpolated + fitted.cell[axis] - fittedInterpolated;
+	}
+	return float2( shift[0], shift[1] );
+}
+
+//
+// Solves the n x n system a x = b in place with Gaussian elimination, b becomes x
+//
+static void Solve( double* a, double* b, int n )
+{
+	for ( int column = 0; column < n; column++ )
+	{
+		int pivot = column;
+		for ( int row = column + 1; row < n; row++ )
+			if ( fabs( a[row * n + column] ) > fabs( a[pivot * n + column] ) ) pivot = row;
+		for ( int k = 0; k < n; k++ ) std::swap( a[column * n + k], a[pivot * n + k] );
+		std::swap( b[column], b[pivot] );
+		if ( a[column * n + column] == 0.0 ) continue;
+		for ( int row = column + 1; row < n; row++ )
+		{
+			double factor = a[row * n + column] / a[column * n + column];
+			for ( int k = column; k < n; k++ ) a[row * n + k] -= factor * a[column * n + k];
+			b[row] -= factor * b[column];
+		}
+	}
+	for ( int row = n - 1; row >= 0; row-- )
+	{
+		for ( int k = row + 1; k < n; k++ ) b[row] -= a[row * n + k] * b[k];
+		b[row] = a[row * n + row] != 0.0 ? b[row] / a[row * n + row] : 0.0;
+	}
+}
+
+//
+// The samples of a source pixel through the kernel of the render mode, taken as Application::RenderPixel takes them
+//
+static void SamplePixel( DOF* dof, const PixelSetup& setup, SplatTarget* target, int x, int y, LensSystem* lensSystem, float brightness, int frame, int samples )
+{
+#if ( defined UseSeidel || defined UseSSRT || defined UsePolynomial || defined UseRayTable ) && defined ENABLE_SIMD
+	dof->ApplyBatch( setup, target, x, y, lensSystem, brightness, frame, samples );
+#else
+	for ( int sample = 0; sample < samples; sample++ )
+	{
+		Sampler sampler( dof->sampler, y * SCRWIDTH + x, frame, sample, samples );
+		dof->Apply( setup, target, nullptr, x, y, lensSystem, brightness, false, &sampler );
+	}
+#endif
+}
+
+static double Dot( const float* a, const float* b, int n )
+{
+	float lanes[16] = {}; // independent sums the compiler can vectorize
+	int i = 0;
+	for ( ; i + 16 <= n; i += 16 )
+		for ( int lane = 0; lane < 16; lane++ ) lanes[lane] += a[i + lane] * b[i + lane];
+	double sum = 0.0;
+	for ( ; i < n; i++ ) sum += a[i] * b[i];
+	for ( int lane = 0; lane < 16; lane++ ) sum += lanes[lane];
+	return sum;
+}
+
+//
+// Eigenvalues and eigenvectors (the columns of vectors) of a symmetric n x n matrix with cyclic Jacobi rotations,
+// sorted by decreasing eigenvalue. The matrix is destroyed.
+//
+static void Eigen( std::vector<double>& a, int n, std::vector<double>* vectors, std::vector<double>* values )
+{
+	std::vector<double> v( n * n, 0.0 );
+	for ( int i = 0; i < n; i++ ) v[i * n + i] = 1.0;
+
+	for ( int sweep = 0; sweep < 50; sweep++ )
+	{
+		double off = 0.0, diagonal = 0.0;
+		for ( int p = 0; p < n; p++ )
+		{
+			diagonal += a[p * n + p] * a[p * n + p];
+			for ( int q = p + 1; q < n; q++ ) off += a[p * n + q] * a[p * n + q];
+		}
+		if ( off <= 1E-24 * diagonal ) break;
+
+		for ( int p = 0; p < n; p++ )
+			for ( int q = p + 1; q < n; q++ )
+			{
+				if ( a[p * n + q] == 0.0 ) continue;
+				double theta = ( a[q * n + q] - a[p * n + p] ) / ( 2.0 * a[p * n + q] );
+				double t = ( theta >= 0.0 ? 1.0 : -1.0 ) / ( fabs( theta ) + sqrt( theta * theta + 1.0 ) );
+				double c = 1.0 / sqrt( t * t + 1.0 ), s = t * c;
+				for ( int k = 0; k < n; k++ )
+				{
+					double kp = a[k * n + p], kq = a[k * n + q];
+					a[k * n + p] = c * kp - s * kq, a[k * n + q] = s * kp + c * kq;
+				}
+				for ( int k = 0; k < n; k++ )
+				{
+					double pk = a[p * n + k], qk = a[q * n + k];
+					a[p * n + k] = c * pk - s * qk, a[q * n + k] = s * pk + c * qk;
+				}
+				for ( int k = 0; k < n; k++ )
+				{
+					double kp = v[k * n + p], kq = v[k * n + q];
+					v[k * n + p] = c * kp - s * kq, v[k * n + q] = s * kp + c * kq;
+				}
+			}
+	}
+
+	std::vector<int> order( n );
+	for ( int i = 0; i < n; i++ ) order[i] = i;
+	std::sort( order.begin(), order.end(), [&]( int i, int j ) { return a[i * n + i] > a[j * n + j]; } );
+	vectors->resize( n * n );
+	values->resize( n );
+	for ( int k = 0; k < n; k++ )
+	{
+		( *values )[k] = std::max( a[order[k] * n + order[k]], 0.0 );
+		for ( int i = 0; i < n; i++ ) ( *vectors )[i * n + k] = v[i * n + order[k]];
+	}
+}
+
+//
+// The nearest and farthest inverse distance of the source pixels that take samples, the ones with any light
+//
+void PSFConvolution::DistanceRange( const float4* inputImage, float* nearest, float* farthest )
+{
+	*nearest = 0.0f, *farthest = 1E30f;
+	for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
+	{
+		if ( HelperFunctions::Luminance( inputImage[n].rgb ) <= 0.0f ) continue;
+		float inverse = 1.0f / inputImage[n].a;
+		*nearest = std::max( *nearest, inverse );
+		*farthest = std::min( *farthest, inverse );
+	}
+	if ( *farthest > *nearest ) *nearest = *farthest = 1.0f; // a black image
+}
+
+uint64 PSFConvolution::Key( const DOF* dof, const LensSystem* lensSystem, const float4* inputImage ) const
+{
+	float nearest, farthest;
+	DistanceRange( inputImage, &nearest, &farthest );
+	float values[] = { lensSystem->sensorPosition, dof->meanLensData.principalPlaneRear, nearest, farthest, tolerance, lensSystem->apertureShape.rotation };
+	int settings[] = { budget, dof->heroWavelengths, (int)dof->sampler, (int)lensSystem->apertureShape.type, lensSystem->apertureShape.blades };
+	uint64 key = HelperFunctions::FNV1a( values, sizeof( values ), lensSystem->StateKey() );
+	return HelperFunctions::FNV1a( settings, sizeof( settings ), key );
+}
+
+bool PSFConvolution::Fits( const DOF* dof, const LensSystem* lensSystem, const float4* inputImage ) const
+{
+	return !knots.empty() && key == Key( dof, lensSystem, inputImage );
+}
+
+//
+// How far the PSFs reach from the grid points at an inverse distance, in pixels in x or y, and their spread: the radius
+// of the disk with the same RMS distance from the centroid, the larger of the grid points
+//
+static int Reach( DOF* dof, LensSystem* lensSystem, float inverseDistance, int samples, float* spread )
+{
+	float4 source( 1.0f, 1.0f, 1.0f, 1.0f / inverseDistance );
+	int reach = 0;
+	float largest = 0.0f;
+#pragma omp parallel for schedule( dynamic, 1 ) reduction( max : reach, largest )
+	for ( int g = 0; g < GRID; g++ )
+	{
+		float4 pixel( 0.0f );
+		SplatTarget target( &pixel, GridX( g ), GridY( g ), 0 );
+		SamplePixel( dof, dof->SetupPixel( source, GridX( g ), GridY( g ), lensSystem ), &target, GridX( g ), GridY( g ), lensSystem, 1.0f / samples, 0, samples );
+		reach = std::max( reach, target.reach );
+		float4 m = target.moments;
+		if ( m.x > 0.0f ) largest = std::max( largest, sqrtf( std::max( 2.0f * ( m.w / m.x - ( m.y * m.y + m.z * m.z ) / ( m.x * m.x ) ), 0.0f ) ) );
+	}
+	*spread = largest;
+	return reach;
+}
+
+//
+// Places PSF_KNOTS knots by the spread of the PSFs at SCOUTS inverse distances over the range of the scene, evenly in
+// its relative change (plus a pixel), then samples the PSFs of every knot at the grid points. Not by how far they
+// reach: near the focus that is the faint halo of the aberrations, which hardly changes while the core of the PSFs
+// does. The knots, the samples and the eigen PSFs are fixed budgets, so Prepare takes about the same time for any scene
+// and lens state: half of the samples go to the knots evenly, half by the squares their PSFs cover, which samples the
+// large ones about as densely.
+//
+void PSFConvolution::Prepare( DOF* dof, LensSystem* lensSystem, const float4* inputImage )
+{
+	Timer timer;
+	float nearest, farthest;
+	DistanceRange( inputImage, &nearest, &farthest );
+	samplesTaken = SCOUTS * GRID * REACH_SAMPLES;
+
+	std::vector<float> scouts( SCOUTS ), spreads( SCOUTS ), growth( SCOUTS );
+	std::vector<int> reaches( SCOUTS );
+	for ( int c = 0; c < SCOUTS; c++ )
+	{
+		scouts[c] = farthest + ( nearest - farthest ) * c / ( SCOUTS - 1 );
+		reaches[c] = Reach( dof, lensSystem, scouts[c], REACH_SAMPLES, &spreads[c] );
+		// and a little for every step, which spreads the knots evenly where the PSFs keep their size
+		growth[c] = c == 0 ? 0.0f : growth[c - 1] + fabsf( logf( ( 1.0f + spreads[c] ) / ( 1.0f + spreads[c - 1] ) ) ) + 0.001f;
+	}
+
+	int count = nearest > farthest ? std::max( PSF_KNOTS, 2 ) : 1;
+	knots.resize( count );
+	double squares = 0.0;
+	for ( int k = 0, c = 0; k < count; k++ )
+	{
+		PSFKnot& knot = knots[k];
+		float target = count == 1 ? 0.0f : growth.back() * k / ( count - 1 );
+		while ( c < SCOUTS - 2 && growth[c + 1] < target ) c++;
+		float t = clamp( ( target - growth[c] ) / ( growth[c + 1] - growth[c] ), 0.0f, 1.0f );
+		knot.inverseDistance = scouts[c] + ( scouts[c + 1] - scouts[c] ) * t;
+		// the reach is largest at either end of a stretch between scouts, the focus is a minimum
+		knot.radius = std::min( std::max( reaches[c], reaches[c + 1] ) + 2, PSF_MAX_RADIUS );
+		squares += (double)( 2 * knot.radius + 1 ) * ( 2 * knot.radius + 1 );
+	}
+
+	// half of the budget evenly over the knots, half by the squares their PSFs cover
+	double even = 0.5 * budget / GRID / count, share = 0.5 * budget / GRID / squares;
+	for ( int k = 0; k < count; k++ )
+	{
+		Windows windows;
+		int size = 2 * knots[k].radius + 1;
+		Sample( dof, lensSystem, knots[k], (int)( ( even + share * size * size ) / 2 ), &windows );
+		Decompose( knots[k], windows );
+	}
+
+	key = Key( dof, lensSystem, inputImage );
+	prepareTime = timer.elapsed();
+}
+
+//
+// Samples the PSFs of a knot at the grid points, at PSF_MAX_SUBPIXELS, or less where that would take more than
+// PSF_MAX_TRANSFORM values per channel, in two halves of the given samples with their own frames of the sampler.
+// Whatever the difference of the halves adds to a sum of squares is what their noise adds to that of their sum, which
+// is how Subpixels and Decompose tell the sampling noise from the errors they measure. Then keeps the subpixels the
+// tolerance asks for and centers the PSFs.
+//
+void PSFConvolution::Sample( DOF* dof, LensSystem* lensSystem, PSFKnot& knot, int samples, Windows* windows )
+{
+	int size = 2 * knot.radius + 1, subpixels = PSF_MAX_SUBPIXELS;
+	while ( subpixels > 1 && (size_t)GRID * size * size * subpixels * subpixels > PSF_MAX_TRANSFORM ) subpixels /= 2;
+	int area = size * size * subpixels * subpixels;
+	samplesTaken += GRID * 2 * samples;
+	float4 source( 1.0f, 1.0f, 1.0f, 1.0f / knot.inverseDistance );
+	windows->sums.assign( (size_t)GRID * area, float4( 0.0f ) );
+	windows->differences.assign( (size_t)GRID * area, float4( 0.0f ) );
+	float lost = 0.0f, kept = 0.0f;
+#pragma omp parallel for schedule( dynamic, 1 ) reduction( + : lost, kept )
+	for ( int g = 0; g < GRID; g++ )
+	{
+		float4* halves[2] = { &windows->sums[(size_t)g * area], &windows->differences[(size_t)g * area] };
+		PixelSetup setup = dof->SetupPixel( source, GridX( g ), GridY( g ), lensSystem );
+		for ( int half = 0; half < 2; half++ )
+		{
+			SplatTarget target( halves[half], GridX( g ), GridY( g ), knot.radius, subpixels );
+			SamplePixel( dof, setup, &target, GridX( g ), GridY( g ), lensSystem, 0.5f / samples, half, samples );
+			lost += target.lost;
+		}
+		for ( int p = 0; p < area; p++ )
+		{
+			float4 first = halves[0][p], second = halves[1][p];
+			halves[0][p] = first + second, halves[1][p] = first - second;
+			kept += halves[0][p].a;
+		}
+	}
+	knot.lost = lost > 0.0f ? lost / ( lost + kept ) : 0.0f;
+
+	knot.subpixels = subpixels;
+	Subpixels( knot, windows );
+	Center( knot, windows );
+}
+
+//
+// Render moves the source pixels to the subpixel, and in between bilinearly, so a PSF with s subpixels lands up to
+// half a subpixel off, spread over the four around, where the scatter renderer would put all of its light into the
+// pixels that it lands in then. The PSFs sampled at more subpixels tell how much that is: the pixels of the PSFs half a
+// subpixel of s off against the mean of the pixels of the PSFs at the four subpixels of s around, relative to the
+// pixels, both without their sampling noise. Keeps the fewest subpixels with no more than the tolerance of that,
+// summing the windows down to them.
+//
+void PSFConvolution::Subpixels( PSFKnot& knot, Windows* windows ) const
+{
+	int sampled = knot.subpixels, size = 2 * knot.radius + 1, side = size * sampled;
+	int subpixels = 1;
+	for ( ; subpixels < sampled; subpixels *= 2 )
+	{
+		int step = sampled / subpixels, half = step / 2;
+		// of the sums and of the differences of the halves
+		double squares[2] = {}, differences[2] = {};
+		for ( int h = 0; h < 2; h++ )
+		{
+			const std::vector<float4>& halves = h == 0 ? windows->sums : windows->differences;
+			double squareSum = 0.0, differenceSum = 0.0;
+#pragma omp parallel for schedule( dynamic, 1 ) reduction( + : squareSum, differenceSum )
+			for ( int g = 0; g < GRID; g++ )
+			{
+				const float4* window = &halves[(size_t)g * side * side];
+				auto at = [&]( int x, int y ) { return x >= 0 && y >= 0 && x < side && y < side ? window[y * side + x] : float4( 0.0f ); };
+				auto inside = [&]( int v, int p, int offset ) { return v - p * sampled - offset >= 0 && v - p * sampled - offset < sampled; };
+				for ( int py = -1; py < size; py++ )
+					for ( int px = -1; px < size; px++ )
+					{
+						// every sampled subpixel counts once for the pixel half a subpixel off, and a quarter less for
+						// every one of the four around that it lies in
+						float4 difference( 0.0f ), pixel( 0.0f );
+						for ( int y = py * sampled; y < ( py + 1 ) * sampled + step; y++ )
+							for ( int x = px * sampled; x < ( px + 1 ) * sampled + step; x++ )
+							{
+								bool centered = inside( x, px, half ) && inside( y, py, half );
+								float share = centered ? 1.0f : 0.0f;
+								for ( int oy = 0; oy <= step; oy += step )
+									for ( int ox = 0; ox <= step; ox += step )
+										if ( inside( x, px, ox ) && inside( y, py, oy ) ) share -= 0.25f;
+								float4 value = at( x, y );
+								difference += value * share;
+								if ( centered ) pixel += value;
+							}
+						differenceSum += difference.dot( difference );
+						squareSum += pixel.dot( pixel );
+					}
+			}
+			squares[h] = squareSum, differences[h] = differenceSum;
+		}
+		if ( differences[0] - differences[1] <= tolerance * tolerance * ( squares[0] - squares[1] ) ) break;
+	}
+	knot.subpixels = subpixels;
+	if ( subpixels == sampled ) return;
+
+	int step = sampled / subpixels, kept = size * subpixels;
+	for ( std::vector<float4>* halves : { &windows->sums, &windows->differences } )
+	{
+		std::vector<float4> summed( (size_t)GRID * kept * kept, float4( 0.0f ) );
+		for ( int g = 0; g < GRID; g++ )
+			for ( int p = 0; p < side * side; p++ )
+				summed[( (size_t)g * kept + p / side / step ) * kept + p % side / step] += ( *halves )[(size_t)g * side * side + p];
+		halves->swap( summed );
+	}
+}
+
+//
+// Out of focus the PSFs move over the field, as the magnification changes with the distance, which no few eigen PSFs
+// follow. So the PSFs of the grid points are centered on their light, to the subpixel, and Render moves the source
+// pixels by as much instead. The light of a PSF without any shift lies in the subpixels right of and below the top
+// left corner of the source pixel, so the shifts are measured from there and rounded to the nearest subpixel, which
+// keeps the ones around that from flipping between neighbouring grid points. The radius of the knot shrinks to what the
+// centered PSFs reach. In between the grid points Render follows the shifts of a rotationally symmetric lens: an
+// offset, and a magnification that is a polynomial in the squared distance from the center of the frame, fitted to
+// the centroids of the PSFs.
+//
+void PSFConvolution::Center( PSFKnot& knot, Windows* windows )
+{
+	int subpixels = knot.subpixels, side = ( 2 * knot.radius + 1 ) * subpixels, corner = knot.radius * subpixels, reach = 0;
+	knot.shifts.assign( GRID * 2, 0.0f );
+	std::vector<int> offsets( GRID * 2, 0 ); // the shifts in subpixels
+	double normal[5 * 5] = {}, right[5] = {};
+	for ( int g = 0; g < GRID; g++ )
+	{
+		const float4* window = &windows->sums[(size_t)g * side * side];
+		double x = 0.0, y = 0.0, weight = 0.0;
+		for ( int p = 0; p < side * side; p++ ) x += window[p].a * ( p % side ), y += window[p].a * ( p / side ), weight += window[p].a;
+		if ( weight <= 0.0 ) continue;
+		double centroid[2] = { ( x / weight + 0.5 - corner ) / subpixels, ( y / weight + 0.5 - corner ) / subpixels };
+		int* offset = &offsets[g * 2];
+		offset[0] = (int)floor( centroid[0] * subpixels + 0.5 ), offset[1] = (int)floor( centroid[1] * subpixels + 0.5 );
+		knot.shifts[g * 2] = (float)offset[0] / subpixels, knot.shifts[g * 2 + 1] = (float)offset[1] / subpixels;
+		for ( int p = 0; p < side * side; p++ )
+			if ( window[p].a > 0.0f ) reach = std::max( reach, std::max( abs( p % side - corner - offset[0] ), abs( p / side - corner - offset[1] ) ) );
+
+		// the least squares fit of the offset and the magnification to the centroids
+		float qx = ( GridX( g ) + 0.5f ) / ( SCRWIDTH / 2 ) - 1.0f, qy = ( GridY( g ) + 0.5f - SCRHEIGHT / 2 ) / ( SCRWIDTH / 2 ), r2 = qx * qx + qy * qy;
+		for ( int axis = 0; axis < 2; axis++ )
+		{
+			float q = axis == 0 ? qx : qy;
+			double row[5] = { axis == 0 ? 1.0 : 0.0, axis == 1 ? 1.0 : 0.0, q, q * r2, q * r2 * r2 };
+			for ( int i = 0; i < 5; i++ )
+			{
+				for ( int j = 0; j < 5; j++ ) normal[i * 5 + j] += row[i] * row[j];
+				right[i] += row[i] * centroid[axis];
+			}
+		}
+	}
+	Solve( normal, right, 5 );
+	for ( int i = 0; i < 5; i++ ) knot.shiftFit[i] = (float)right[i];
+
+	int radius = reach / subpixels + 1, centeredSide = ( 2 * radius + 1 ) * subpixels, centeredCorner = radius * subpixels;
+	for ( std::vector<float4>* halves : { &windows->sums, &windows->differences } )
+	{
+		std::vector<float4> centered( (size_t)GRID * centeredSide * centeredSide, float4( 0.0f ) );
+		for ( int g = 0; g < GRID; g++ )
+			for ( int p = 0; p < side * side; p++ )
+			{
+				int x = p % side - corner - offsets[g * 2] + centeredCorner, y = p / side - corner - offsets[g * 2 + 1] + centeredCorner;
+				if ( x >= 0 && y >= 0 && x < centeredSide && y < centeredSide )
+					centered[( (size_t)g * centeredSide + y ) * centeredSide + x] = ( *halves )[(size_t)g * side * side + p];
+			}
+		halves->swap( centered );
+	}
+	knot.radius = radius;
+}
+
+//
+// The low rank approximation of the PSFs of a knot, one per grid point and channel: the eigenvectors of their Gram
+// matrix give the eigen PSFs as combinations of the PSFs, and the weights of every PSF on them
+//
+void PSFConvolution::Decompose( PSFKnot& knot, const Windows& windows ) const
+{
+	int side = ( 2 * knot.radius + 1 ) * knot.subpixels, pixels = side * side, n = GRID * 4;
+	std::vector<float> rows( (size_t)n * pixels );
+	for ( int g = 0; g < GRID; g++ )
+		for ( int p = 0; p < pixels; p++ )
+			for ( int c = 0; c < 4; c++ ) rows[(size_t)( g * 4 + c ) * pixels + p] = windows.sums[(size_t)g * pixels + p].cell[c];
+
+	std::vector<double> gram( n * n );
+#pragma omp parallel for schedule( dynamic, 1 )
+	for ( int i = 0; i < n; i++ )
+		for ( int j = 0; j <= i; j++ )
+			gram[i * n + j] = gram[j * n + i] = Dot( &rows[(size_t)i * pixels], &rows[(size_t)j * pixels], pixels );
+
+	std::vector<double> vectors, values;
+	Eigen( gram, n, &vectors, &values );
+
+	// as many as it takes to leave out less than the tolerance of the squared norm of the PSFs, or less than their
+	// noise, which is spread over all of the eigenvectors rather than kept in the first few, up to PSF_MAX_RANK
+	double noise = 0.0, total = 0.0;
+	for ( const float4& difference : windows.differences ) noise += difference.dot( difference );
+	for ( double value : values ) total += value;
+	int rank = 1;
+	double rest = total - values[0];
+	while ( rank < std::min( n, PSF_MAX_RANK ) && rest > std::max( tolerance * tolerance * total, noise ) ) rest -= values[rank++];
+	knot.rank = rank;
+	knot.error = total > 0.0 ? (float)sqrt( std::max( rest, 0.0 ) / total ) : 0.0f;
+	knot.noise = total > 0.0 ? (float)sqrt( std::min( noise, total ) / total ) : 0.0f;
+
+	knot.psfs.assign( (size_t)rank * pixels, 0.0f );
+	knot.weights.assign( n * rank, 0.0f );
+	for ( int k = 0; k < rank; k++ )
+	{
+		double sigma = sqrt( std::max( values[k], 1E-30 ) );
+		float* psf = &knot.psfs[(size_t)k * pixels];
+		for ( int i = 0; i < n; i++ )
+		{
+			knot.weights[i * rank + k] = (float)( vectors[i * n + k] * sigma );
+			float scale = (float)( vectors[i * n + k] / sigma );
+			const float* row = &rows[(size_t)i * pixels];
+			for ( int p = 0; p < pixels; p++ ) psf[p] += scale * row[p];
+		}
+	}
+}
+
+//
+// Every eigen PSF of a knot takes three FFTs: itself, shared with the next one as the imaginary part, and the scene
+// times its weights in two pairs of channels, red and green, blue and the weight. The spectra are multiplied and summed,
+// and the sums of the two pairs are transformed back at the end of the knot, summed from its subpixels to pixels and
+// added to the output. The transforms of a knot hold the box around the source pixels that reach it, at the subpixels
+// of the knot, moved by the shifts of the knot, so with a margin of the largest shift, at the top left, and the PSFs at
+// the top left too, which puts the result a radius up and left of where it belongs; they are that box plus twice the
+// margin and the radius, rounded up to powers of two, so nothing wraps around. A box that would take more than
+// PSF_MAX_TRANSFORM values is done in strips of rows, each with its own margin.
+//
+void PSFConvolution::Render( const float4* inputImage, float4* output )
+{
+	Timer timer;
+	transforms = 0;
+	int count = (int)knots.size();
+
+	// where every source pixel lies between the knots, negative for the ones without light, and the boxes of the
+	// source pixels of every knot
+	std::vector<float> position( SCRWIDTH * SCRHEIGHT );
+	std::vector<int4> boxes( count, int4( SCRWIDTH, SCRHEIGHT, -1, -1 ) );
+	for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
+	{
+		position[n] = -2.0f;
+		if ( HelperFunctions::Luminance( inputImage[n].rgb ) <= 0.0f ) continue;
+		float inverse = 1.0f / inputImage[n].a;
+		int k = 0;
+		while ( k < count - 2 && knots[k + 1].inverseDistance <= inverse ) k++;
+		position[n] = count == 1 ? 0.0f : k + clamp( ( inverse - knots[k].inverseDistance ) / ( knots[k + 1].inverseDistance - knots[k].inverseDistance ), 0.0f, 1.0f );
+		for ( int j = (int)position[n]; j <= std::min( (int)ceilf( position[n] ), count - 1 ); j++ )
+		{
+			int4& box = boxes[j];
+			int x = n % SCRWIDTH, y = n / SCRWIDTH;
+			box = int4( std::min( box.x, x ), std::min( box.y, y ), std::max( box.z, x ), std::max( box.w, y ) );
+		}
+	}
+
+	for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ ) output[n] = float4( 0.0f );
+	std::vector<float> imageRe, imageIm, spectrumRe, spectrumIm, kernelRe[2], kernelIm[2], sumRe[2], sumIm[2];
+	for ( int k = 0; k < count; k++ )
+	{
+		const PSFKnot& knot = knots[k];
+		const int4& box = boxes[k];
+		if ( box.z < 0 ) continue;
+		int subpixels = knot.subpixels, side = ( 2 * knot.radius + 1 ) * subpixels, pixels = side * side;
+		int spanX = box.z - box.x + 1, spanY = box.w - box.y + 1;
+
+		// the source pixels of the knot, and where they move to, relative to the box
+		struct Source
+		{
+			int n;
+			float share, x, y;
+		};
+		std::vector<Source> sources;
+		int pad = 0; // for the moved source pixels
+		for ( int y = box.y; y <= box.w; y++ )
+			for ( int x = box.x; x <= box.z; x++ )
+			{
+				float share = 1.0f - fabsf( position[y * SCRWIDTH + x] - k );
+				if ( share <= 0.0f ) continue;
+				// by the shift interpolated between the two knots around the source pixel, the same for both, or the
+				// blend of their PSFs would be two images of it
+				GridCell cell( x, y );
+				float sx = 0.0f, sy = 0.0f, around = position[y * SCRWIDTH + x];
+				for ( int j = (int)around; j <= std::min( (int)ceilf( around ), count - 1 ); j++ )
+				{
+					float weight = 1.0f - fabsf( around - j );
+					float2 shift = Shift( knots[j], cell, x, y );
+					sx += weight * shift.x, sy += weight * shift.y;
+				}
+				sources.push_back( { y * SCRWIDTH + x, share, x - box.x + sx, y - box.y + sy } );
+				pad = std::max( pad, (int)ceilf( std::max( fabsf( sx ), fabsf( sy ) ) ) + 1 );
+			}
+		int margin = pad + knot.radius, width = 1, height = 1;
+		while ( width < ( spanX + 2 * margin ) * subpixels ) width *= 2;
+		while ( height < ( spanY + 2 * margin ) * subpixels ) height *= 2;
+		// in strips of rows, if the whole box would take more than PSF_MAX_TRANSFORM
+		while ( height > 1 && (size_t)width * height > PSF_MAX_TRANSFORM && height / 2 > 2 * margin * subpixels ) height /= 2;
+		int rows = std::min( height / subpixels - 2 * margin, spanY );
+		FFT2D fft( width, height );
+
+		size_t floats = (size_t)width * height;
+		for ( std::vector<float>* plane : { &imageRe, &imageIm, &spectrumRe, &spectrumIm, &kernelRe[0], &kernelIm[0], &kernelRe[1], &kernelIm[1] } )
+			plane->resize( floats );
+		int first = 0; // source of the strip
+		for ( int top = box.y; top <= box.w; top += rows )
+		{
+			int bottom = std::min( top + rows, box.w + 1 ), last = first;
+			while ( last < (int)sources.size() && sources[last].n / SCRWIDTH < bottom ) last++;
+			if ( last == first ) continue;
+			for ( int channels = 0; channels < 2; channels++ ) sumRe[channels].assign( floats, 0.0f ), sumIm[channels].assign( floats, 0.0f );
+
+			for ( int e = 0; e < knot.rank; e += 2 )
+			{
+				std::fill( imageRe.begin(), imageRe.end(), 0.0f );
+				std::fill( imageIm.begin(), imageIm.end(), 0.0f );
+				for ( int y = 0; y < side; y++ )
+					for ( int x = 0; x < side; x++ )
+					{
+						imageRe[(size_t)y * width + x] = knot.psfs[(size_t)e * pixels + y * side + x];
+						if ( e + 1 < knot.rank ) imageIm[(size_t)y * width + x] = knot.psfs[(size_t)( e + 1 ) * pixels + y * side + x];
+					}
+				fft.Forward( imageRe.data(), imageIm.data(), spectrumRe.data(), spectrumIm.data(), side );
+				transforms++;
+
+				// apart again, the spectrum of a real image is conjugate symmetric
+#pragma omp parallel for schedule( static )
+				for ( int i = 0; i < width * height; i++ )
+				{
+					int j = fft.Negative( i );
+					float zr = spectrumRe[i], zi = spectrumIm[i], nr = spectrumRe[j], ni = spectrumIm[j];
+					kernelRe[0][i] = 0.5f * ( zr + nr ), kernelIm[0][i] = 0.5f * ( zi - ni );
+					kernelRe[1][i] = 0.5f * ( zi + ni ), kernelIm[1][i] = 0.5f * ( nr - zr );
+				}
+
+				for ( int f = e; f < std::min( e + 2, knot.rank ); f++ )
+				{
+					const float* kr = kernelRe[f - e].data();
+					const float* ki = kernelIm[f - e].data();
+					for ( int channels = 0; channels < 2; channels++ )
+					{
+						std::fill( imageRe.begin(), imageRe.end(), 0.0f );
+						std::fill( imageIm.begin(), imageIm.end(), 0.0f );
+						// bilinearly between the subpixels, in order, as moved source pixels may land on the same ones
+						for ( int i = first; i < last; i++ )
+						{
+							const Source& source = sources[i];
+							GridCell cell( source.n % SCRWIDTH, source.n / SCRWIDTH );
+							float x = ( source.x + pad ) * subpixels, y = ( source.y - ( top - box.y ) + pad ) * subpixels;
+							int ix = (int)floorf( x ), iy = (int)floorf( y );
+							float tx = x - ix, ty = y - iy;
+							size_t destination = (size_t)iy * width + ix;
+							const float4& pixel = inputImage[source.n];
+							for ( int part = 0; part < 2; part++ )
+							{
+								int c = channels * 2 + part;
+								float w = cell.Weight( [&]( int g ) { return knot.weights[( g * 4 + c ) * knot.rank + f]; } );
+								float value = source.share * w * ( c < 3 ? pixel.cell[c] : 1.0f ); // every source pixel with light adds its weight
+								float* image = part == 0 ? imageRe.data() : imageIm.data();
+								image[destination] += value * ( 1.0f - tx ) * ( 1.0f - ty );
+								image[destination + 1] += value * tx * ( 1.0f - ty );
+								image[destination + width] += value * ( 1.0f - tx ) * ty;
+								image[destination + width + 1] += value * tx * ty;
+							}
+						}
+						fft.Forward( imageRe.data(), imageIm.data(), spectrumRe.data(), spectrumIm.data(), ( spanX + 2 * pad ) * subpixels );
+						transforms++;
+
+						float* outRe = sumRe[channels].data();
+						float* outIm = sumIm[channels].data();
+#pragma omp parallel for schedule( static )
+						for ( int i = 0; i < width * height; i++ )
+						{
+							outRe[i] += spectrumRe[i] * kr[i] - spectrumIm[i] * ki[i];
+							outIm[i] += spectrumRe[i] * ki[i] + spectrumIm[i] * kr[i];
+						}
+					}
+				}
+			}
+
+			// the columns and rows of the result that land on the screen
+			int left = std::max( margin - box.x, 0 ), right = std::min( spanX + 2 * margin, SCRWIDTH - box.x + margin );
+			int up = std::max( margin - top, 0 ), down = std::min( bottom - top + 2 * margin, SCRHEIGHT - top + margin );
+			fft.Inverse( sumRe[0].data(), sumIm[0].data(), imageRe.data(), imageIm.data(), left * subpixels, ( right - left ) * subpixels );
+			fft.Inverse( sumRe[1].data(), sumIm[1].data(), spectrumRe.data(), spectrumIm.data(), left * subpixels, ( right - left ) * subpixels );
+			transforms += 2;
+			float scale = 1.0f / ( (float)width * height );
+#pragma omp parallel for schedule( static )
+			for ( int y = up; y < down; y++ )
+				for ( int x = left; x < right; x++ )
+				{
+					// every pixel sums its subpixels, as the scatter renderer adds what lands anywhere in it
+					float4 sum( 0.0f );
+					for ( int sy = 0; sy < subpixels; sy++ )
+						for ( int sx = 0; sx < subpixels; sx++ )
+						{
+							size_t i = (size_t)( y * subpixels + sy ) * width + x * subpixels + sx;
+							sum += float4( imageRe[i], imageIm[i], spectrumRe[i], spectrumIm[i] );
+						}
+					output[( y + top - margin ) * SCRWIDTH + x + box.x - margin] += sum * scale;
+				}
+			first = last;
+		}
+	}
+	renderTime = timer.elapsed();
+}
+
@@ -0,0 +1,78 @@
+#pragma once
+
+//
+// The PSFs of one depth knot of PSFConvolution as a few eigen PSFs and their weights over the frame
+//
+struct PSFKnot
+{
+	float inverseDistance;
+	int radius;	   // of the eigen PSFs, in pixels
+	int subpixels; // of the eigen PSFs per pixel in x and y, so they are ( ( 2 radius + 1 ) subpixels )^2 subpixels
+	int rank;
+	std::vector<float> psfs;	// rank x ( ( 2 radius + 1 ) subpixels )^2, orthonormal
+	std::vector<float> weights; // PSF_GRID_Y x PSF_GRID_X x 4 (r, g, b and the weight) x rank
+	std::vector<float> shifts;	// PSF_GRID_Y x PSF_GRID_X x 2, in pixels but whole subpixels, of the PSFs from their source pixels, which the eigen PSFs lack
+	float shiftFit[5];			// of the shifts over the frame: an offset in x and y, and a radial magnification (see Center)
+	float error;				// of the low rank PSFs relative to the sampled ones, in the Frobenius norm
+	float noise;				// the part of that the sampling noise accounts for
+	float lost;					// share of the light that lands beyond PSF_MAX_RADIUS
+};
+
+//
+// A deterministic alternative to the scatter renderer: the expected image of a frame, computed by convolving the scene
+// with the PSFs of the lens. The PSFs are sampled with DOF::ApplyBatch (so with the kernel of the render mode, its
+// vignetting and chromatic aberration) at PSF_GRID_X x PSF_GRID_Y source pixels spread over the frame, at PSF_KNOTS
+// depth knots over the inverse distances of the scene, placed evenly in the relative change of the spread of the PSFs
+// (plus a pixel): a blend of two PSFs that differ much more in size is a double ring rather than the PSF in between.
+// The PSFs are sampled at up to PSF_MAX_SUBPIXELS per pixel, and keep as many as it takes to land the light within the
+// tolerance of the pixels the scatter renderer bins it into; they are centered on their centroids, and Render moves the
+// source pixels by the shifts instead. The PSFs of a knot, one per grid point and channel, are decomposed into the few
+// eigen PSFs that hold all but PSF_TOLERANCE of them, or all but their sampling noise, up to PSF_MAX_RANK (Flicker and
+// Fitzgerald 2005); their weights are interpolated bilinearly between the grid points and linearly between the knots. A
+// scatter renderer adds every source pixel times its own PSF, so the image is the sum over the knots and eigen PSFs of
+// the scene times the weights of the source pixels, convolved with the eigen PSF, which Render does with FFTs (see
+// FFT2D), summing the spectra of a knot so only the result is transformed back. The transforms of a knot cover just the
+// source pixels between its neighbours, plus its radius.
+//
+// Prepare takes PSF_SAMPLE_BUDGET samples for all PSFs, in two halves whose difference tells their noise apart from the
+// errors the tolerance bounds, once per lens state, focus and range of distances of the scene. The knots, the samples
+// and the eigen PSFs are fixed budgets, so Prepare and Render take about the same time for any scene and amount of
+// defocus. The image has no noise of its own; what is off is the noise of the sampled PSFs, which stays in every image
+// as a fixed pattern, the blend between the knots, and the variation of the PSFs between the grid points that their
+// weights don't follow. On the night time plate that is about 12% of the image, which the scatter renderer takes 1.5
+// times as long to match as the convolution takes with sampling its PSFs (see Benchmark::Convolution).
+//
+class PSFConvolution
+{
+  public:
+	void Prepare( DOF* dof, LensSystem* lensSystem, const float4* inputImage );
+	bool Fits( const DOF* dof, const LensSystem* lensSystem, const float4* inputImage ) const;
+
+	// the expected value of one frame of the scatter renderer, the color in rgb and the weight in a
+	void Render( const float4* inputImage, float4* output );
+
+	std::vector<PSFKnot> knots; // by increasing inverse distance
+	int budget = PSF_SAMPLE_BUDGET; // pupil samples of the PSFs of the next Prepare, besides finding their reach
+	float tolerance = PSF_TOLERANCE;
+
+	float prepareTime = 0.0f; // of the last Prepare and Render, in s
+	float renderTime = 0.0f;
+	int transforms = 0; // FFTs the last Render took
+	int samplesTaken = 0; // pupil samples the last Prepare took
+
+  private:
+	// the PSFs of a knot at the grid points, sampled in two independent halves: their sum, and their difference, which
+	// has no signal but as much noise
+	struct Windows
+	{
+		std::vector<float4> sums, differences;
+	};
+	void Sample( DOF* dof, LensSystem* lensSystem, PSFKnot& knot, int samples, Windows* windows );
+	void Subpixels( PSFKnot& knot, Windows* windows ) const;
+	static void Center( PSFKnot& knot, Windows* windows );
+	void Decompose( PSFKnot& knot, const Windows& windows ) const;
+	uint64 Key( const DOF* dof, const LensSystem* lensSystem, const float4* inputImage ) const;
+	static void DistanceRange( const float4* inputImage, float* nearest, float* farthest );
+
+	uint64 key = 0;
+};
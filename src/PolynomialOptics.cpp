@@ -0,0 +1,238 @@
+#include "precomp.h"
+
+//
+// Traces the ray of one sample, in[] as for Evaluate, and writes the outputs. Returns false when it is vignetted. The
+// ray starts from the light source towards the entrance pupil position, like ApplySSRT, moved forward along itself to
+// just before the lens so far light sources stay precise.
+//
+bool PolynomialOptics::TraceSample( LensSystem* lensSystem, float maxField, float zPlane, const float* in, float* out )
+{
+	float wavelength = in[POLY_WAVELENGTH] * 0.235f + 0.595f;
+	float z = LENS_TABLE_NEAR / std::max( in[POLY_INVERSE_DISTANCE], 1E-4f );
+	LensData lensData = lensSystem->GetLensData( wavelength, z );
+
+	float3 Pprime0 = float3( in[POLY_PUPIL_X], in[POLY_PUPIL_Y], 0.0f ) * lensData.entrancePupilRadius;
+	Pprime0.z = lensData.entrancePupil;
+	float3 D = float3( Pprime0.x, Pprime0.y - in[POLY_FIELD] * maxField * z, lensData.entrancePupil + z ).normalized();
+	float3 O = Pprime0 - D * ( ( lensData.entrancePupil + 0.05f ) / D.z );
+
+	if ( !lensSystem->TraceRay3D( &O, &D, wavelength, 0, lensSystem->num_elements - 1, true, false ) ) return false;
+
+	float t = ( zPlane - O.z ) / D.z;
+	out[POLY_X] = O.x + t * D.x;
+	out[POLY_Y] = O.y + t * D.y;
+	out[POLY_U] = D.x / D.z;
+	out[POLY_V] = D.y / D.z;
+	return true;
+}
+
+//
+// The field of the corner of the sensor with a bit to spare, the sensor is never closer than the focal length
+//
+float PolynomialOptics::MaxField( const LensSystem* lensSystem )
+{
+	float corner = std::min( 0.6f * SENSOR_SIZE / lensSystem->meanFocalLength, 0.95f );
+	return 1.1f * corner / sqrtf( 1.0f - corner * corner );
+}
+
+//
+// Random inputs, spread evenly over the field, the pupil disk and the wavelengths. The inverse distances are denser
+// towards infinity, where most of a scene is.
+//
+static void SampleInputs( uint index, float* in )
+{
+	RandomStream random( index, 0x9017, 0 );
+	float theta = random.rnd() * 2.0f * PI, rho = sqrtf( random.rnd() );
+	in[POLY_FIELD] = random.rnd();
+	in[POLY_PUPIL_X] = rho * sinf( theta );
+	in[POLY_PUPIL_Y] = rho * cosf( theta );
+	in[POLY_WAVELENGTH] = random.rnd() * 2.0f - 1.0f;
+	float distance = random.rnd();
+	in[POLY_INVERSE_DISTANCE] = distance * distance;
+}
+
+//
+// Fits the polynomials to POLYNOMIAL_RAYS rays traced through the lens in its current state (aperture, zoom), and
+// measures them on a quarter as many others, see error. Every output picks its terms by orthogonal matching pursuit:
+// out of all monomials up to POLYNOMIAL_DEGREE of its parity, the one that best matches what is left of the output is
+// added, until that is below POLYNOMIAL_TOLERANCE pixels on the sensor or it has POLYNOMIAL_TERMS terms.
+//
+void PolynomialOptics::Fit( LensSystem* lensSystem )
+{
+	Timer timer;
+
+	maxField = MaxField( lensSystem );
+	zPlane = lensSystem->sensorPosition;
+
+	const int count = POLYNOMIAL_RAYS, testCount = POLYNOMIAL_RAYS / 4;
+	std::vector<float> inputs( ( count + testCount ) * POLY_INPUTS ), outputs( ( count + testCount ) * POLY_OUTPUTS, 0.0f );
+	std::vector<char> valid( count + testCount );
+#pragma omp parallel for schedule( dynamic, 256 )
+	for ( int i = 0; i < count + testCount; i++ )
+	{
+		float* in = &inputs[i * POLY_INPUTS];
+		SampleInputs( i, in );
+		valid[i] = TraceSample( lensSystem, maxField, zPlane, in, &outputs[i * POLY_OUTPUTS] );
+		outputs[i * POLY_OUTPUTS + POLY_TRANSMITTANCE] = valid[i] ? 1.0f : 0.0f;
+	}
+
+	// how far off an output may be, the slopes only move the ray over the distance a focus pull moves the sensor
+	float position = POLYNOMIAL_TOLERANCE * SENSOR_SIZE / SCRWIDTH;
+	float focusRange = 0.1f * lensSystem->meanFocalLength;
+	const float tolerances[POLY_OUTPUTS] = { position, position, position / focusRange, position / focusRange, 0.02f };
+
+	terms[0].clear();
+	terms[1].clear();
+	for ( int o = 0; o < POLY_OUTPUTS; o++ )
+	{
+		// the monomials of the parity of this output in the pupil x
+		int parity = o == POLY_X || o == POLY_U ? 1 : 0;
+		std::vector<std::array<unsigned char, POLY_INPUTS>> monomials;
+		for ( int e = 0; e < (int)pow( POLYNOMIAL_DEGREE + 1, POLY_INPUTS ); e++ )
+		{
+			std::array<unsigned char, POLY_INPUTS> exponents;
+			int degree = 0;
+			for ( int i = 0, rest = e; i < POLY_INPUTS; i++, rest /= POLYNOMIAL_DEGREE + 1 )
+				exponents[i] = rest % ( POLYNOMIAL_DEGREE + 1 ), degree += exponents[i];
+			if ( degree <= POLYNOMIAL_DEGREE && exponents[POLY_PUPIL_X] % 2 == parity ) monomials.push_back( exponents );
+		}
+		int candidates = (int)monomials.size();
+
+		// the rays it is fitted on: the transmittance on all of them, the ray only where it passes
+		std::vector<int> rays;
+		for ( int i = 0; i < count; i++ )
+			if ( o == POLY_TRANSMITTANCE || valid[i] ) rays.push_back( i );
+		int n = (int)rays.size();
+		if ( n == 0 ) continue;
+
+		// every monomial over the rays, one column each
+		std::vector<double> columns( (size_t)candidates * n ), norms( candidates );
+#pragma omp parallel for schedule( dynamic, 1 )
+		for ( int c = 0; c < candidates; c++ )
+		{
+			double sum = 0.0;
+			for ( int r = 0; r < n; r++ )
+			{
+				const float* in = &inputs[rays[r] * POLY_INPUTS];
+				double m = 1.0;
+				for ( int i = 0; i < POLY_INPUTS; i++ )
+					for ( int k = 0; k < monomials[c][i]; k++ ) m *= in[i];
+				columns[(size_t)c * n + r] = m;
+				sum += m * m;
+			}
+			norms[c] = sqrt( sum );
+		}
+
+		std::vector<double> residual( n );
+		for ( int r = 0; r < n; r++ )
+			residual[r] = outputs[rays[r] * POLY_OUTPUTS + o];
+
+		// orthogonal matching pursuit, the chosen columns orthonormalized into basis, with columns = basis * R
+		std::vector<int> chosen;
+		std::vector<std::vector<double>> basis;
+		std::vector<double> R( POLYNOMIAL_TERMS * POLYNOMIAL_TERMS, 0.0 ), projections;
+		std::vector<char> unusable( candidates, 0 );
+		while ( (int)chosen.size() < POLYNOMIAL_TERMS )
+		{
+			double squares = 0.0;
+			for ( double v : residual ) squares += v * v;
+			if ( sqrt( squares / n ) < tolerances[o] ) break;
+
+			std::vector<double> scores( candidates, 0.0 );
+#pragma omp parallel for schedule( dynamic, 8 )
+			for ( int c = 0; c < candidates; c++ )
+			{
+				if ( unusable[c] || norms[c] == 0.0 ) continue;
+				const double* column = &columns[(size_t)c * n];
+				double dot = 0.0;
+				for ( int r = 0; r < n; r++ ) dot += column[r] * residual[r];
+				scores[c] = fabs( dot ) / norms[c];
+			}
+			int best = (int)( std::max_element( scores.begin(), scores.end() ) - scores.begin() );
+			if ( scores[best] == 0.0 ) break;
+
+			int k = (int)chosen.size();
+			std::vector<double> q( columns.begin() + (size_t)best * n, columns.begin() + (size_t)( best + 1 ) * n );
+			for ( int j = 0; j < k; j++ )
+			{
+				double dot = 0.0;
+				for ( int r = 0; r < n; r++ ) dot += basis[j][r] * q[r];
+				for ( int r = 0; r < n; r++ ) q[r] -= dot * basis[j][r];
+				R[j * POLYNOMIAL_TERMS + k] = dot;
+			}
+			double length = 0.0;
+			for ( double v : q ) length += v * v;
+			length = sqrt( length );
+			unusable[best] = 1;
+			if ( length < 1E-9 * norms[best] ) continue; // in the span of the chosen ones already
+
+			double projection = 0.0;
+			for ( int r = 0; r < n; r++ ) q[r] /= length, projection += q[r] * residual[r];
+			for ( int r = 0; r < n; r++ ) residual[r] -= projection * q[r];
+			R[k * POLYNOMIAL_TERMS + k] = length;
+			projections.push_back( projection );
+			basis.push_back( std::move( q ) );
+			chosen.push_back( best );
+		}
+
+		// the coefficients of the chosen monomials, R * coefficients = projections
+		int k = (int)chosen.size();
+		std::vector<double> coefficients( k );
+		for ( int j = k - 1; j >= 0; j-- )
+		{
+			double sum = projections[j];
+			for ( int l = j + 1; l < k; l++ ) sum -= R[j * POLYNOMIAL_TERMS + l] * coefficients[l];
+			coefficients[j] = sum / R[j * POLYNOMIAL_TERMS + j];
+		}
+		std::vector<PolynomialTerm>& shared = terms[parity];
+		for ( int j = 0; j < k; j++ )
+		{
+			const unsigned char* exponents = monomials[chosen[j]].data();
+			auto term = std::find_if( shared.begin(), shared.end(), [&]( const PolynomialTerm& t ) { return memcmp( t.exponents, exponents, POLY_INPUTS ) == 0; } );
+			if ( term == shared.end() )
+			{
+				term = shared.insert( shared.end(), PolynomialTerm() );
+				memcpy( term->exponents, exponents, POLY_INPUTS );
+				std::fill( term->coefficients, term->coefficients + POLY_OUTPUTS, 0.0f );
+			}
+			term->coefficients[o] = (float)coefficients[j];
+		}
+	}
+
+	// the error on the test rays, at the current sensor position
+	error = PolynomialFitError();
+	int compared = 0, misclassified = 0;
+	double squares = 0.0;
+	for ( int i = count; i < count + testCount; i++ )
+	{
+		float out[POLY_OUTPUTS];
+		Evaluate( &inputs[i * POLY_INPUTS], out );
+		bool passes = out[POLY_TRANSMITTANCE] > 0.5f;
+		if ( passes != (bool)valid[i] ) misclassified++;
+		if ( !passes || !valid[i] ) continue;
+
+		const float* exact = &outputs[i * POLY_OUTPUTS];
+		float dx = out[POLY_X] - exact[POLY_X], dy = out[POLY_Y] - exact[POLY_Y];
+		float pixels = sqrtf( dx * dx + dy * dy ) / SENSOR_SIZE * SCRWIDTH;
+		squares += pixels * pixels;
+		error.max = std::max( error.max, pixels );
+		compared++;
+	}
+	error.rms = compared > 0 ? (float)sqrt( squares / compared ) : 0.0f;
+	error.vignetting = (float)misclassified / testCount;
+	error.time = timer.elapsed();
+
+	key = lensSystem->StateKey();
+	fitted = true;
+
+	std::cout << "Polynomial optics: " << Terms() << " terms, fitted in " << ( error.time * 1E3f ) << "ms, sensor error " << error.rms << " px rms, " << error.max
+			  << " px max, vignetting wrong for " << ( error.vignetting * 100.0f ) << "% of the rays" << std::endl;
+}
+
+//
+// Monomials of all outputs together
+//
+int PolynomialOptics::Terms() const
+{
+	return (int)( terms[0].size() + terms[1].size() );
+}
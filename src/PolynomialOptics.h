@@ -0,0 +1,92 @@
+#pragma once
+
+//
+// Sparse polynomials that map a sample to the ray leaving the lens, fitted to rays traced with
+// LensSystem::TraceRay3D, so a sample costs a few dozen multiply-adds instead of a trace through every surface.
+//
+// The lens is rotationally symmetric, so the sample is rotated until its light source lies on the positive y axis.
+// That leaves five inputs: the field (the distance of the light source from the axis over its distance z, relative to
+// maxField), the entrance pupil position in the unit disk (px, py, relative to the entrance pupil radius as
+// ApplySSRT samples it), the wavelength (-1 to 1 over the visible range) and the inverse distance (relative to
+// 1 / LENS_TABLE_NEAR). The outputs are the rotated ray at the sensor plane of the fit, its position x, y and slopes
+// u = dx/dz, v = dy/dz, which carry it to the sensor when the focus changes, and the transmittance (1 when the ray
+// passes, 0 when it is vignetted). x and u are odd in px, the others even, so every output only takes the monomials of
+// its parity, and the outputs of one parity share the monomials.
+//
+enum PolynomialInput { POLY_FIELD, POLY_PUPIL_X, POLY_PUPIL_Y, POLY_WAVELENGTH, POLY_INVERSE_DISTANCE, POLY_INPUTS };
+enum PolynomialOutput { POLY_X, POLY_Y, POLY_U, POLY_V, POLY_TRANSMITTANCE, POLY_OUTPUTS };
+
+//
+// A monomial and what it adds to every output of its parity
+//
+struct PolynomialTerm
+{
+	unsigned char exponents[POLY_INPUTS];
+	float coefficients[POLY_OUTPUTS];
+};
+
+//
+// How well the polynomials match TraceRay3D on rays they were not fitted to, at the sensor position of the fit
+//
+struct PolynomialFitError
+{
+	float rms = 0.0f, max = 0.0f; // sensor position, in pixels
+	float vignetting = 0.0f;	  // fraction of the rays whose transmittance is on the wrong side of 0.5
+	float time = 0.0f;			  // of the fit, in s
+};
+
+class PolynomialOptics
+{
+  public:
+	void Fit( LensSystem* lensSystem );
+	bool Fits( const LensSystem* lensSystem ) const { return fitted && key == lensSystem->StateKey(); }
+	int Terms() const; // monomials of all outputs together
+
+	// the outputs of one (T = float) or SIMD_WIDTH (T = floatv) samples, in[] and out[] indexed by PolynomialInput and
+	// PolynomialOutput
+	template <typename T>
+	void Evaluate( const T* in, T* out ) const
+	{
+		T powers[POLY_INPUTS][POLYNOMIAL_DEGREE + 1];
+		for ( int i = 0; i < POLY_INPUTS; i++ )
+		{
+			powers[i][0] = T( 1.0f );
+			for ( int d = 1; d <= POLYNOMIAL_DEGREE; d++ )
+				powers[i][d] = powers[i][d - 1] * in[i];
+		}
+
+		T y = 0.0f, v = 0.0f, transmittance = 0.0f;
+		for ( const PolynomialTerm& term : terms[0] )
+		{
+			const unsigned char* e = term.exponents;
+			T monomial = powers[0][e[0]] * powers[1][e[1]] * powers[2][e[2]] * powers[3][e[3]] * powers[4][e[4]];
+			y += monomial * term.coefficients[POLY_Y];
+			v += monomial * term.coefficients[POLY_V];
+			transmittance += monomial * term.coefficients[POLY_TRANSMITTANCE];
+		}
+
+		T x = 0.0f, u = 0.0f;
+		for ( const PolynomialTerm& term : terms[1] )
+		{
+			const unsigned char* e = term.exponents;
+			T monomial = powers[0][e[0]] * powers[1][e[1]] * powers[2][e[2]] * powers[3][e[3]] * powers[4][e[4]];
+			x += monomial * term.coefficients[POLY_X];
+			u += monomial * term.coefficients[POLY_U];
+		}
+
+		out[POLY_X] = x, out[POLY_Y] = y, out[POLY_U] = u, out[POLY_V] = v, out[POLY_TRANSMITTANCE] = transmittance;
+	}
+
+	// the exact outputs of one sample, traced with TraceRay3D, returns false when the ray is vignetted
+	static bool TraceSample( LensSystem* lensSystem, float maxField, float zPlane, const float* in, float* out );
+	static float MaxField( const LensSystem* lensSystem ); // for the sensor, at the mean focal length
+
+	float maxField = 1.0f; // the largest field, the distance from the axis over z, the fit covers
+	float zPlane = 0.0f;   // of the outputs, the sensor position of the fit
+	PolynomialFitError error;
+
+  private:
+	bool fitted = false;
+	uint64 key = 0; // of the lens the polynomials were fitted to
+	std::vector<PolynomialTerm> terms[2]; // by their parity in px
+};
@@ -0,0 +1,148 @@
+#include "precomp.h"
+
+static_assert( PUPIL_REGION_BANDS % 2 == 0, "the bands mirror in pairs" );
+
+static const int SCAN = 32;		   // steps along a ray from the pupil center before the boundaries are refined
+static const int REFINE = 8;	   // bisections per boundary
+static const float MARGIN = 0.02f; // added around the regions, relative to the pupil radius
+static const float WAVELENGTHS[] = { 0.360f, 0.595f, 0.830f }; // the regions cover the unvignetted pupil of all of these
+static const int SCANNED = sizeof( WAVELENGTHS ) / sizeof( float );
+
+//
+// Whether the kernel of the render mode keeps a sample, in the rotated frame of PolynomialOptics: the light source lies
+// on the positive y axis at field (relative to maxField). The Seidel kernel only checks the first lens element, with
+// the lens data of lensData.
+//
+static bool Passes( LensSystem* lensSystem, const LensSetup& lensSetup, bool traced, float maxField, float wavelength, const LensData& lensData, float field, float inverseDistance, float2 pupil )
+{
+	if ( traced )
+	{
+		float in[POLY_INPUTS] = { field, pupil.x, pupil.y, ( wavelength - 0.595f ) / 0.235f, inverseDistance }, out[POLY_OUTPUTS];
+		return PolynomialOptics::TraceSample( lensSystem, maxField, lensSystem->sensorPosition, in, out );
+	}
+
+	float z = LENS_TABLE_NEAR / std::max( inverseDistance, 1E-4f );
+	float2 Ps = float2( 0.0f, field * maxField * z );
+	float2 Pprime0 = pupil * lensData.entrancePupilRadius;
+	float2 dir = ( Pprime0 - Ps ) / ( z + lensData.entrancePupil );
+	float2 Popening = Ps + dir * ( z + lensSetup.element0 );
+	return Popening.sqrLength() <= lensSetup.aperture0Sqr;
+}
+
+//
+// Builds the regions of all bins from the extent of the unvignetted pupil along rays from its center, at the corners of
+// the bins, at every half band over half a turn (the other half mirrors it) and at every scanned wavelength.
+//
+void PupilRegions::Build( LensSystem* lensSystem, const LensSetup& lensSetup, bool traced )
+{
+	Timer timer;
+	maxField = PolynomialOptics::MaxField( lensSystem );
+
+	const int fields = PUPIL_REGION_FIELDS + 1, depths = PUPIL_REGION_DEPTHS + 1, angles = PUPIL_REGION_BANDS + 1;
+	std::vector<LensData> lensData( depths * SCANNED );
+	for ( int d = 0; d < depths; d++ )
+		for ( int w = 0; w < SCANNED; w++ )
+		{
+			float depth = d / (float)PUPIL_REGION_DEPTHS;
+			lensData[d * SCANNED + w] = lensSystem->GetLensData( WAVELENGTHS[w], LENS_TABLE_NEAR / std::max( depth * depth, 1E-4f ) );
+		}
+
+	// the first and last radius that passes along every ray at any of the wavelengths, inner > outer when none does
+	std::vector<float> inner( fields * depths * angles, 1.0f ), outer( fields * depths * angles, 0.0f );
+	int tested = 0;
+#pragma omp parallel for schedule( dynamic, 4 ) reduction( + : tested )
+	for ( int i = 0; i < fields * depths * angles; i++ )
+	{
+		int f = i / ( depths * angles ), d = i / angles % depths, a = i % angles;
+		float field = f / (float)PUPIL_REGION_FIELDS, depth = d / (float)PUPIL_REGION_DEPTHS;
+		float angle = a * ( PI / PUPIL_REGION_BANDS );
+		float2 direction = float2( sinf( angle ), cosf( angle ) );
+		for ( int w = 0; w < SCANNED; w++ )
+		{
+			auto passes = [&]( float radius ) {
+				tested++;
+				return Passes( lensSystem, lensSetup, traced, maxField, WAVELENGTHS[w], lensData[d * SCANNED + w], field, depth * depth, direction * radius );
+			};
+
+			int first = -1, last = -1;
+			for ( int step = 0; step <= SCAN; step++ )
+				if ( passes( step / (float)SCAN ) )
+				{
+					if ( first < 0 ) first = step;
+					last = step;
+				}
+			if ( first < 0 ) continue;
+
+			// narrow the boundaries down, keeping to the side that doesn't pass
+			float low = ( first - 1 ) / (float)SCAN, high = first / (float)SCAN;
+			for ( int refine = 0; first > 0 && refine < REFINE; refine++ )
+			{
+				float middle = ( low + high ) * 0.5f;
+				( passes( middle ) ? high : low ) = middle;
+			}
+			inner[i] = std::min( inner[i], first > 0 ? low : 0.0f );
+
+			low = last / (float)SCAN, high = ( last + 1 ) / (float)SCAN;
+			for ( int refine = 0; last < SCAN && refine < REFINE; refine++ )
+			{
+				float middle = ( low + high ) * 0.5f;
+				( passes( middle ) ? low : high ) = middle;
+			}
+			outer[i] = std::max( outer[i], last < SCAN ? high : 1.0f );
+		}
+	}
+
+	regions.resize( PUPIL_REGION_FIELDS * PUPIL_REGION_DEPTHS );
+	whole.resize( regions.size() );
+	for ( int f = 0; f < PUPIL_REGION_FIELDS; f++ )
+		for ( int d = 0; d < PUPIL_REGION_DEPTHS; d++ )
+		{
+			PupilRegion& region = regions[f * PUPIL_REGION_DEPTHS + d];
+			bool isWhole = true;
+			region.cdf[0] = 0.0f;
+			for ( int band = 0; band < PUPIL_REGION_BANDS; band++ )
+			{
+				// a band in the second half turn is the mirror image of one in the first
+				int mirrored = band < PUPIL_REGION_BANDS / 2 ? band : PUPIL_REGION_BANDS - 1 - band;
+				float low = 1.0f, high = 0.0f;
+				for ( int corner = 0; corner < 4; corner++ )
+					for ( int a = 2 * mirrored; a <= 2 * mirrored + 2; a++ )
+					{
+						int i = ( ( f + ( corner & 1 ) ) * depths + d + ( corner >> 1 ) ) * angles + a;
+						if ( inner[i] > outer[i] ) continue;
+						low = std::min( low, inner[i] );
+						high = std::max( high, outer[i] );
+					}
+				if ( low > high ) low = high = 0.0f;
+				else low = std::max( low - MARGIN, 0.0f ), high = std::min( high + MARGIN, 1.0f );
+
+				region.inner2[band] = low * low;
+				region.outer2[band] = high * high;
+				region.cdf[band + 1] = region.cdf[band] + region.outer2[band] - region.inner2[band];
+				isWhole &= low == 0.0f && high == 1.0f;
+			}
+
+			float total = region.cdf[PUPIL_REGION_BANDS];
+			region.fraction = total / PUPIL_REGION_BANDS;
+			for ( int band = 1; band <= PUPIL_REGION_BANDS; band++ )
+				region.cdf[band] = total > 0.0f ? region.cdf[band] / total : band / (float)PUPIL_REGION_BANDS;
+			whole[f * PUPIL_REGION_DEPTHS + d] = isWhole || region.fraction > PUPIL_REGION_MAX_FRACTION;
+		}
+
+	this->traced = traced;
+	key = lensSystem->StateKey();
+	tests = tested;
+	time = timer.elapsed();
+}
+
+//
+// The bin of a light source at field (the distance from the axis over z) and distance z. Light sources beyond the
+// field of the last bin take that one, which only vignettes more further out.
+//
+const PupilRegion* PupilRegions::Find( float field, float z ) const
+{
+	int f = std::min( (int)( field / maxField * PUPIL_REGION_FIELDS ), PUPIL_REGION_FIELDS - 1 );
+	int d = std::min( (int)( sqrtf( std::min( LENS_TABLE_NEAR / z, 1.0f ) ) * PUPIL_REGION_DEPTHS ), PUPIL_REGION_DEPTHS - 1 );
+	int index = f * PUPIL_REGION_DEPTHS + d;
+	return whole[index] ? nullptr : &regions[index];
+}
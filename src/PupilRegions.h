@@ -0,0 +1,83 @@
+#pragma once
+
+//
+// The part of the entrance pupil a light source sees through the lens, in PUPIL_REGION_BANDS angular bands around the
+// pupil center. The angles are relative to the direction of the light source (as the rotated samples of
+// PolynomialOptics), in turns, and the radii relative to the entrance pupil radius, so the whole pupil is the unit disk.
+// Every band holds the annulus between its inner and outer radius, which covers the unvignetted pupil along all angles
+// of the band.
+//
+struct PupilRegion
+{
+	float inner2[PUPIL_REGION_BANDS], outer2[PUPIL_REGION_BANDS]; // squared radii
+	float cdf[PUPIL_REGION_BANDS + 1]; // area of the bands before, relative to the whole region
+	float fraction;					   // of the unit disk the region covers
+
+	// a point drawn from the region, or from the whole pupil for a share PUPIL_REGION_UNIFORM of the samples, from a
+	// sample in [0, 1)^2 that would be uniform in the unit disk as ( theta, rho^2 ), and the angle of the light source
+	// in turns; returns it as the _theta and _rho of DOF::Apply, and the weight of the sample relative to one drawn
+	// uniformly from the pupil (0 when it takes no light). Unvignetted pupil the region misses is still drawn from the
+	// whole pupil, so the weighted samples are unbiased however well the region fits.
+	float Sample( float2 u, float angle, float* theta, float* rho ) const
+	{
+		const float uniform = PUPIL_REGION_UNIFORM;
+		float inside = fraction > 0.0f ? 1.0f / ( uniform + ( 1.0f - uniform ) / fraction ) : 0.0f;
+		if ( u.x < uniform )
+		{
+			*theta = u.x / uniform;
+			*rho = sqrtf( u.y );
+			return Contains( *theta, u.y, angle ) ? inside : 1.0f / uniform;
+		}
+
+		u.x = ( u.x - uniform ) / ( 1.0f - uniform );
+		int band = (int)( std::upper_bound( cdf + 1, cdf + PUPIL_REGION_BANDS, u.x ) - ( cdf + 1 ) );
+		float t = ( u.x - cdf[band] ) / ( cdf[band + 1] - cdf[band] );
+		*theta = ( band + t ) * ( 1.0f / PUPIL_REGION_BANDS ) + angle;
+		*theta -= floorf( *theta );
+		*rho = sqrtf( inner2[band] + u.y * ( outer2[band] - inner2[band] ) );
+		return inside;
+	}
+
+	// whether the region holds the pupil point at theta (in turns) and squared radius rho2, for a light source at angle
+	bool Contains( float theta, float rho2, float angle ) const
+	{
+		float turns = theta - angle;
+		int band = std::min( (int)( ( turns - floorf( turns ) ) * PUPIL_REGION_BANDS ), PUPIL_REGION_BANDS - 1 );
+		return rho2 >= inner2[band] && rho2 <= outer2[band];
+	}
+};
+
+struct LensSetup;
+
+//
+// The pupil regions of light sources over the field (relative to PolynomialOptics::MaxField) and the square root of the
+// inverse distance, PUPIL_REGION_FIELDS x PUPIL_REGION_DEPTHS bins, so most samples of a pixel can be drawn from the
+// unvignetted pupil instead of being thrown away by the kernel. A bin covers the regions found at its corners at the
+// ends and the middle of the visible range, plus a margin for the light sources of a pixel, which spread over the pixel
+// and the depth bin. That is not a bound, so PupilRegion::Sample draws a share of the samples from the whole pupil and
+// weights every sample by the density it was drawn with: what a region misses is sampled less well, but not lost.
+// What the region holds of the vignetted pupil is still thrown away by the kernel.
+//
+// Build finds the regions by testing the samples the kernel of the render mode would throw away: the ray through the
+// first lens element for the Seidel kernel, a full TraceRay3D for the others.
+//
+class PupilRegions
+{
+  public:
+	void Build( LensSystem* lensSystem, const LensSetup& lensSetup, bool traced );
+	bool Fits( const LensSystem* lensSystem, bool traced ) const { return Built() && this->traced == traced && key == lensSystem->StateKey(); }
+	bool Built() const { return !regions.empty(); }
+
+	// the region of a light source, nullptr when it sees the whole pupil or nearly (PUPIL_REGION_MAX_FRACTION)
+	const PupilRegion* Find( float field, float z ) const;
+
+	float maxField = 1.0f;
+	float time = 0.0f; // of the last Build, in s
+	int tests = 0;	   // samples it tested
+
+  private:
+	std::vector<PupilRegion> regions; // fields x depths
+	std::vector<char> whole;		  // per region, whether it is (nearly) the whole pupil
+	bool traced = false;
+	uint64 key = 0;
+};
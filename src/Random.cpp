@@ -2,13 +2,24 @@
 
 int Random::seed = 1341;
 
-int Random::rndInt()
+//
+// Philox4x32 with 10 rounds, encrypts the counter in place
+//
+void Random::Philox( uint counter[4], uint key0, uint key1 )
 {
-	seed ^= seed << 13, seed ^= seed >> 17, seed ^= seed << 5;
-	return seed;
-}
+	for ( int round = 0; round < 10; round++ )
+	{
+		uint64 product0 = (uint64)0xD2511F53 * counter[0];
+		uint64 product1 = (uint64)0xCD9E8D57 * counter[2];
 
-float Random::rnd()
-{
-	return rndInt() * 2.3283064365387e-10f + 0.5f;
+		uint c0 = (uint)( product1 >> 32 ) ^ counter[1] ^ key0;
+		uint c1 = (uint)product1;
+		uint c2 = (uint)( product0 >> 32 ) ^ counter[3] ^ key1;
+		uint c3 = (uint)product0;
+
+		counter[0] = c0, counter[1] = c1, counter[2] = c2, counter[3] = c3;
+
+		key0 += 0x9E3779B9;
+		key1 += 0xBB67AE85;
+	}
 }
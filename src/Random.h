@@ -5,6 +5,44 @@ class Random
   public:
 	static int seed;
 
-	static int rndInt();
-	static float rnd();
+	static void Philox( uint counter[4], uint key0, uint key1 );
+};
+
+//
+// Counter-based random numbers (Philox4x32-10, Salmon et al. 2011). A stream is fully determined by the source pixel,
+// the frame and the sample index, so samples can be generated independently on any thread without shared state.
+//
+class RandomStream
+{
+  public:
+	RandomStream( uint pixel, uint frame, uint sample )
+	{
+		counter[0] = pixel;
+		counter[1] = frame;
+		counter[2] = sample;
+		block = 0;
+		used = 4;
+	}
+
+	float rnd()
+	{
+		if ( used == 4 ) Generate();
+		return ( output[used++] >> 8 ) * ( 1.0f / 16777216.0f ); // 24 bits, so the result is always < 1
+	}
+
+  private:
+	void Generate()
+	{
+		output[0] = counter[0];
+		output[1] = counter[1];
+		output[2] = counter[2];
+		output[3] = block++;
+		Random::Philox( output, (uint)Random::seed, 0x5EED1DE5 );
+		used = 0;
+	}
+
+	uint counter[3];
+	uint block;
+	uint output[4];
+	int used;
 };
@@ -0,0 +1,284 @@
+#include "precomp.h"
+
+static const int PUPIL_X = RAY_TABLE_PUPIL + 1, PUPIL_Y = 2 * RAY_TABLE_PUPIL + 1;
+
+// the axes in the order of the layout, the last one varies fastest
+enum { AXIS_FIELD, AXIS_PUPIL_Y, AXIS_PUPIL_X, AXIS_WAVELENGTH, AXIS_DEPTH, AXES };
+static const int counts[AXES] = { RAY_TABLE_FIELDS, PUPIL_Y, PUPIL_X, RAY_TABLE_WAVELENGTHS, RAY_TABLE_DEPTHS };
+static const int strides[AXES] = { PUPIL_Y * PUPIL_X * RAY_TABLE_WAVELENGTHS * RAY_TABLE_DEPTHS, PUPIL_X * RAY_TABLE_WAVELENGTHS * RAY_TABLE_DEPTHS,
+	RAY_TABLE_WAVELENGTHS * RAY_TABLE_DEPTHS, RAY_TABLE_DEPTHS, 1 };
+
+static_assert( RAY_TABLE_FIELDS >= 2 && RAY_TABLE_PUPIL >= 1 && RAY_TABLE_WAVELENGTHS >= 2 && RAY_TABLE_DEPTHS >= 2, "every axis interpolates" );
+static_assert( sizeof( RayCell ) == 4 * sizeof( unsigned short ), "the SIMD lookup gathers the cells as two pairs of halves" );
+static const unsigned short VIGNETTED = 0x7E00; // a half NaN
+static_assert( RayTable::Cells() <= 1 << 24, "the SIMD lookup counts the cells in floats" );
+
+//
+// Deletes the least recently used tables in the directory of the cache beyond RAY_TABLE_CACHE_FILES, Load touches the
+// ones it maps
+//
+static void EvictTables( const std::filesystem::path& directory )
+{
+	std::error_code error;
+	std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> tables;
+	for ( const auto& entry : std::filesystem::directory_iterator( directory, error ) )
+		if ( entry.path().extension() == ".raytable" ) tables.push_back( { entry.last_write_time( error ), entry.path() } );
+	if ( (int)tables.size() <= RAY_TABLE_CACHE_FILES ) return;
+
+	std::sort( tables.begin(), tables.end(), []( const auto& a, const auto& b ) { return a.first > b.first; } );
+	for ( size_t i = RAY_TABLE_CACHE_FILES; i < tables.size(); i++ )
+		std::filesystem::remove( tables[i].second, error );
+}
+
+//
+// Loads the table for the lens in its current state. While scrubbing, that is the table of the nearest precalculated
+// state, which stays loaded as long as the scrub doesn't get nearer to another one.
+//
+void RayTable::Load( LensSystem* lensSystem )
+{
+	key = lensSystem->StateKey();
+	if ( !lensSystem->Scrubbing() )
+	{
+		Map( lensSystem );
+		return;
+	}
+
+	LensSystem snapped = *lensSystem;
+	snapped.SnapToPrecalculated();
+	if ( cells == nullptr || bakedKey != snapped.StateKey() ) Map( &snapped );
+}
+
+//
+// Maps the table of the lens in its current state from the cache, or bakes it and writes the cache when there is none
+// (or an outdated one), in the same place as the lens data cache. The cache keeps RAY_TABLE_CACHE_FILES tables at most.
+//
+void RayTable::Map( LensSystem* lensSystem )
+{
+	Timer timer;
+	file.Close();
+	memory.clear();
+	cells = nullptr;
+	fromCache = false;
+	bakedKey = lensSystem->StateKey();
+
+	char name[32];
+	snprintf( name, sizeof( name ), "%016llx.raytable", (unsigned long long)bakedKey );
+	cachePath = ( std::filesystem::temp_directory_path() / "seidel_lenscache" / name ).string();
+	size_t size = sizeof( RayTableHeader ) + Cells() * sizeof( RayCell );
+
+	if ( file.Open( cachePath ) && file.size == size )
+	{
+		const RayTableHeader* header = (const RayTableHeader*)file.data;
+		if ( memcmp( header->magic, "RAYTABLE", 8 ) == 0 && header->version == RAY_TABLE_VERSION && header->fields == RAY_TABLE_FIELDS &&
+			 header->pupil == RAY_TABLE_PUPIL && header->wavelengths == RAY_TABLE_WAVELENGTHS && header->depths == RAY_TABLE_DEPTHS &&
+			 header->cellSize == sizeof( RayCell ) && header->key == bakedKey )
+		{
+			cells = (const RayCell*)( file.data + sizeof( RayTableHeader ) );
+			maxField = header->maxField;
+			zPlane = header->zPlane;
+			fromCache = true;
+
+			std::error_code error; // recently used, for EvictTables
+			std::filesystem::last_write_time( cachePath, std::filesystem::file_time_type::clock::now(), error );
+		}
+	}
+
+	if ( !fromCache )
+	{
+		file.Close();
+		RayTableHeader header = {};
+		memcpy( header.magic, "RAYTABLE", 8 );
+		header.version = RAY_TABLE_VERSION;
+		header.fields = RAY_TABLE_FIELDS;
+		header.pupil = RAY_TABLE_PUPIL;
+		header.wavelengths = RAY_TABLE_WAVELENGTHS;
+		header.depths = RAY_TABLE_DEPTHS;
+		header.cellSize = sizeof( RayCell );
+		header.key = bakedKey;
+		header.maxField = maxField = PolynomialOptics::MaxField( lensSystem );
+		header.zPlane = zPlane = lensSystem->sensorPosition;
+
+		memory.resize( size );
+		memcpy( memory.data(), &header, sizeof( RayTableHeader ) );
+		Bake( lensSystem, (RayCell*)( memory.data() + sizeof( RayTableHeader ) ) );
+
+		// switch to the mapped cache when it could be written, so this process shares the pages with later ones as well
+		std::error_code error;
+		std::filesystem::path directory = std::filesystem::path( cachePath ).parent_path();
+		std::filesystem::create_directories( directory, error );
+		cells = (const RayCell*)( memory.data() + sizeof( RayTableHeader ) );
+		if ( MappedFile::WriteAtomic( cachePath, memory.data(), memory.size() ) && file.Open( cachePath ) && file.size == memory.size() )
+		{
+			memory.clear();
+			cells = (const RayCell*)( file.data + sizeof( RayTableHeader ) );
+			EvictTables( directory );
+		}
+		else
+		{
+			file.Close();
+			std::cout << "WARNING: couldn't write ray table cache " << cachePath << std::endl;
+			cachePath.clear();
+		}
+	}
+
+	time = timer.elapsed();
+	std::cout << "Ray table: " << ( size >> 20 ) << "MB " << ( fromCache ? "mapped from " : cachePath.empty() ? "baked into memory" : "baked into " ) << cachePath
+			  << " in " << ( time * 1E3f ) << "ms" << std::endl;
+}
+
+//
+// Traces the ray of every cell. The cells just outside the pupil disk are only there for the samples near its edge to
+// interpolate to, so they are traced through a wider stop: the rays continue the ones inside smoothly, rather than
+// being vignetted by the stop and pulling the edge of the pupil in by half a cell. The other elements still vignette
+// them. Cells further out are never read and stay empty.
+//
+void RayTable::Bake( LensSystem* lensSystem, RayCell* out ) const
+{
+	const int total = (int)Cells();
+	const float stop = lensSystem->apertures[lensSystem->num_aperturestop];
+	for ( int outside = 0; outside < 2; outside++ )
+	{
+		lensSystem->program.SetAperture( lensSystem->num_aperturestop, outside ? stop * 1.25f : stop );
+
+#pragma omp parallel for schedule( dynamic, 256 )
+		for ( int i = 0; i < total; i++ )
+		{
+			int index[AXES];
+			for ( int a = 0; a < AXES; a++ )
+				index[a] = i / strides[a] % counts[a];
+
+			float in[POLY_INPUTS], ray[POLY_OUTPUTS];
+			in[POLY_FIELD] = index[AXIS_FIELD] / ( RAY_TABLE_FIELDS - 1.0f );
+			in[POLY_PUPIL_X] = index[AXIS_PUPIL_X] / (float)RAY_TABLE_PUPIL;
+			in[POLY_PUPIL_Y] = index[AXIS_PUPIL_Y] / (float)RAY_TABLE_PUPIL - 1.0f;
+			in[POLY_WAVELENGTH] = index[AXIS_WAVELENGTH] / ( RAY_TABLE_WAVELENGTHS - 1.0f ) * 2.0f - 1.0f;
+			float depth = index[AXIS_DEPTH] / ( RAY_TABLE_DEPTHS - 1.0f );
+			in[POLY_INVERSE_DISTANCE] = depth * depth;
+
+			float rho = sqrtf( in[POLY_PUPIL_X] * in[POLY_PUPIL_X] + in[POLY_PUPIL_Y] * in[POLY_PUPIL_Y] );
+			if ( ( rho > 1.0f ) != (bool)outside ) continue;
+
+			RayCell cell = { VIGNETTED, VIGNETTED, VIGNETTED, VIGNETTED };
+			if ( rho <= 1.0f + 1.5f / RAY_TABLE_PUPIL && PolynomialOptics::TraceSample( lensSystem, maxField, zPlane, in, ray ) )
+				cell = { FloatToHalf( ray[POLY_X] ), FloatToHalf( ray[POLY_Y] ), FloatToHalf( ray[POLY_U] ), FloatToHalf( ray[POLY_V] ) };
+			out[i] = cell;
+		}
+	}
+	lensSystem->program.SetAperture( lensSystem->num_aperturestop, stop );
+}
+
+//
+// Interpolates the cells around the sample over the simplex of the grid cell that holds it: from the cell below the
+// sample, one step along every axis, in the order of the sample's fractions along them from largest to smallest. That
+// takes 6 cells instead of the 32 of multilinear interpolation, and is as accurate for the smooth rays of a lens. The
+// transmittance is interpolated over all of them, the ray over the ones that pass, so the vignetted cells don't pull it
+// towards the axis.
+//
+void RayTable::Lookup( const float* in, float* out ) const
+{
+	float coordinates[AXES];
+	coordinates[AXIS_FIELD] = in[POLY_FIELD] * ( RAY_TABLE_FIELDS - 1 );
+	coordinates[AXIS_PUPIL_Y] = ( in[POLY_PUPIL_Y] + 1.0f ) * RAY_TABLE_PUPIL;
+	coordinates[AXIS_PUPIL_X] = fabsf( in[POLY_PUPIL_X] ) * RAY_TABLE_PUPIL;
+	coordinates[AXIS_WAVELENGTH] = ( in[POLY_WAVELENGTH] + 1.0f ) * ( 0.5f * ( RAY_TABLE_WAVELENGTHS - 1 ) );
+	coordinates[AXIS_DEPTH] = sqrtf( std::max( in[POLY_INVERSE_DISTANCE], 0.0f ) ) * ( RAY_TABLE_DEPTHS - 1 );
+
+	int index = 0, order[AXES];
+	float fractions[AXES];
+	for ( int a = 0; a < AXES; a++ )
+	{
+		float c = clamp( coordinates[a], 0.0f, counts[a] - 1.0f );
+		int knot = std::min( (int)c, counts[a] - 2 );
+		fractions[a] = c - knot;
+		index += knot * strides[a];
+		order[a] = a;
+	}
+	std::sort( order, order + AXES, [&]( int a, int b ) { return fractions[a] > fractions[b]; } );
+
+	float x = 0.0f, y = 0.0f, u = 0.0f, v = 0.0f, transmittance = 0.0f, previous = 1.0f;
+	for ( int k = 0; k <= AXES; k++ )
+	{
+		float next = k < AXES ? fractions[order[k]] : 0.0f;
+		const RayCell& cell = cells[index];
+		if ( cell.x != VIGNETTED )
+		{
+			float passing = previous - next;
+			x += passing * HalfToFloat( cell.x ), y += passing * HalfToFloat( cell.y ), u += passing * HalfToFloat( cell.u ), v += passing * HalfToFloat( cell.v );
+			transmittance += passing;
+		}
+		if ( k < AXES ) index += strides[order[k]];
+		previous = next;
+	}
+
+	// the half disk with px < 0 mirrors the other one
+	float scale = transmittance > 0.0f ? 1.0f / transmittance : 0.0f;
+	float mirror = in[POLY_PUPIL_X] < 0.0f ? -scale : scale;
+	out[POLY_X] = x * mirror, out[POLY_Y] = y * scale, out[POLY_U] = u * mirror, out[POLY_V] = v * scale;
+	out[POLY_TRANSMITTANCE] = transmittance;
+}
+
+//
+// Batched version of Lookup, gathers the cells of SIMD_WIDTH samples at once, two pairs of halves per cell. The axes are
+// put in order with a sorting network, their steps through the table along with them.
+//
+void RayTable::Lookup( const floatv* in, floatv* out ) const
+{
+	static_assert( AXES == 5, "the sorting network sorts five axes" );
+	static const int network[9][2] = { { 0, 1 }, { 3, 4 }, { 2, 4 }, { 2, 3 }, { 0, 3 }, { 0, 2 }, { 1, 4 }, { 1, 3 }, { 1, 2 } };
+
+	floatv coordinates[AXES];
+	coordinates[AXIS_FIELD] = in[POLY_FIELD] * (float)( RAY_TABLE_FIELDS - 1 );
+	coordinates[AXIS_PUPIL_Y] = ( in[POLY_PUPIL_Y] + 1.0f ) * (float)RAY_TABLE_PUPIL;
+	coordinates[AXIS_PUPIL_X] = floatv::max( in[POLY_PUPIL_X], -in[POLY_PUPIL_X] ) * (float)RAY_TABLE_PUPIL;
+	coordinates[AXIS_WAVELENGTH] = ( in[POLY_WAVELENGTH] + 1.0f ) * ( 0.5f * ( RAY_TABLE_WAVELENGTHS - 1 ) );
+	coordinates[AXIS_DEPTH] = floatv::sqrt( floatv::max( in[POLY_INVERSE_DISTANCE], 0.0f ) ) * (float)( RAY_TABLE_DEPTHS - 1 );
+
+	// the first cell, exact in a float, see the static_assert above
+	floatv first = 0.0f, fractions[AXES], steps[AXES];
+	for ( int a = 0; a < AXES; a++ )
+	{
+		floatv c = floatv::min( floatv::max( coordinates[a], 0.0f ), counts[a] - 1.0f );
+		floatv knot = floatv::min( floatv::floor( c ), counts[a] - 2.0f );
+		fractions[a] = c - knot;
+		steps[a] = (float)strides[a];
+		first += knot * steps[a];
+	}
+	for ( const int* pair : network )
+	{
+		maskv swap = fractions[pair[0]] < fractions[pair[1]];
+		floatv fraction = fractions[pair[0]], step = steps[pair[0]];
+		fractions[pair[0]] = floatv::select( swap, fractions[pair[1]], fraction );
+		fractions[pair[1]] = floatv::select( swap, fraction, fractions[pair[1]] );
+		steps[pair[0]] = floatv::select( swap, steps[pair[1]], step );
+		steps[pair[1]] = floatv::select( swap, step, steps[pair[1]] );
+	}
+
+	floatv x = 0.0f, y = 0.0f, u = 0.0f, v = 0.0f, transmittance = 0.0f, previous = 1.0f;
+	for ( int k = 0; k <= AXES; k++ )
+	{
+		floatv next = k < AXES ? fractions[k] : 0.0f;
+		alignas( 64 ) int index[SIMD_WIDTH];
+		first.store( index );
+		alignas( 64 ) int slopes[SIMD_WIDTH];
+		for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+			index[lane] *= 4, slopes[lane] = index[lane] + 2;
+
+		floatv cx, cy, cu, cv;
+		floatv::gatherHalfPair( &cells->x, index, &cx, &cy );
+		floatv::gatherHalfPair( &cells->x, slopes, &cu, &cv );
+		maskv passes = !( cx != cx );
+		floatv passing = floatv::select( passes, previous - next, 0.0f );
+		x += passing * floatv::select( passes, cx, 0.0f );
+		y += passing * floatv::select( passes, cy, 0.0f );
+		u += passing * floatv::select( passes, cu, 0.0f );
+		v += passing * floatv::select( passes, cv, 0.0f );
+		transmittance += passing;
+		if ( k < AXES ) first += steps[k];
+		previous = next;
+	}
+
+	floatv scale = floatv::select( transmittance > 0.0f, 1.0f / transmittance, 0.0f );
+	floatv mirror = floatv::select( in[POLY_PUPIL_X] < 0.0f, -scale, scale );
+	out[POLY_X] = x * mirror, out[POLY_Y] = y * scale, out[POLY_U] = u * mirror, out[POLY_V] = v * scale;
+	out[POLY_TRANSMITTANCE] = transmittance;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#define RAY_TABLE_VERSION 2 // increase whenever Bake changes what it stores
+
+//
+// Layout of a ray table cache file: this header, followed by the cells
+//
+struct RayTableHeader
+{
+	char magic[8]; // "RAYTABLE"
+	uint version;
+	uint fields, pupil, wavelengths, depths; // RAY_TABLE_FIELDS, ... of the table
+	uint cellSize;
+	uint64 key; // see LensSystem::StateKey
+	float maxField, zPlane;
+};
+
+//
+// The outputs of PolynomialOptics for one knot of the table, in half precision (see FloatToHalf): within 2 micrometers
+// at the edge of the sensor, a sixth of a pixel. A vignetted ray stores NaNs, so the transmittance takes no space.
+//
+struct RayCell
+{
+	unsigned short x, y, u, v;
+};
+
+//
+// The rays of the Screen Space Ray Tracing baked into a table over the five inputs of PolynomialOptics, so a sample
+// interpolates between the rays around it instead of tracing its own. The field (relative to maxField), the wavelength
+// and the square root of the inverse distance are spread evenly over their range. The pupil is a grid over the half disk
+// with px >= 0, which the other half mirrors, with RAY_TABLE_PUPIL intervals over its radius. Every sample interpolates
+// the 6 cells of the simplex around it, see Lookup; the transmittance decides whether it passes, and the rays of the cells
+// that pass are averaged with their weights.
+//
+// The table only depends on the lens and its state (aperture, zoom), see LensSystem::StateKey. It is cached on disk
+// next to the lens data and memory mapped, so only the first process that uses a lens bakes it; the least recently used
+// tables beyond RAY_TABLE_CACHE_FILES are deleted. During an aperture or zoom scrub (LensSystem::Scrubbing) the table of
+// the nearest precalculated state is used (LensSystem::SnapToPrecalculated), so a scrub bakes one table per aperture
+// step or zoom position it reaches at most, and reuses them from then on.
+//
+class RayTable
+{
+  public:
+	RayTable() = default;
+	RayTable( const RayTable& ) = delete;
+	RayTable& operator=( const RayTable& ) = delete;
+
+	// maps the table of the lens in its current state (or the nearest precalculated one while scrubbing) from the
+	// cache, bakes and caches it when there is none
+	void Load( LensSystem* lensSystem );
+	bool Fits( const LensSystem* lensSystem ) const { return cells != nullptr && key == lensSystem->StateKey(); }
+
+	// the outputs of one or SIMD_WIDTH samples, in[] and out[] as for PolynomialOptics::Evaluate
+	void Lookup( const float* in, float* out ) const;
+	void Lookup( const floatv* in, floatv* out ) const;
+
+	static constexpr size_t Cells() { return (size_t)RAY_TABLE_FIELDS * ( RAY_TABLE_PUPIL + 1 ) * ( 2 * RAY_TABLE_PUPIL + 1 ) * RAY_TABLE_WAVELENGTHS * RAY_TABLE_DEPTHS; }
+
+	float maxField = 1.0f; // as for PolynomialOptics
+	float zPlane = 0.0f;   // of the outputs, the sensor position the table was baked at
+	std::string cachePath;	// where the table is cached, set by Load, empty when it isn't
+	bool fromCache = false; // whether the last Load could use the cache
+	float time = 0.0f;		// of the last Load, in s
+
+  private:
+	void Map( LensSystem* lensSystem );
+	void Bake( LensSystem* lensSystem, RayCell* out ) const;
+
+	MappedFile file;
+	std::vector<byte> memory; // the table, only used when it is not in the cache
+	const RayCell* cells = nullptr;
+	uint64 key = 0;		  // of the lens state the table was loaded for
+	uint64 bakedKey = 0; // of the lens state the table was baked for, the nearest precalculated one while scrubbing
+};
@@ -0,0 +1,240 @@
+#pragma once
+
+//
+// Portable SIMD types for the batched kernels. The width follows the instruction set the compiler targets:
+// 16 lanes with AVX-512, 8 lanes with AVX2 + FMA and a plain array of 8 floats otherwise, which the
+// compiler is still free to auto-vectorize. Build with SEIDEL_NATIVE (the default) to get the widest path.
+//
+#if defined __AVX512F__
+#define SIMD_AVX512
+#define SIMD_WIDTH 16
+#elif defined __AVX2__ && defined __FMA__
+#define SIMD_AVX2
+#define SIMD_WIDTH 8
+#else
+#define SIMD_SCALAR
+#define SIMD_WIDTH 8
+#endif
+
+#ifdef SIMD_SCALAR
+#define SIMD_LOOP( expr )                       \
+	for ( int lane = 0; lane < SIMD_WIDTH; lane++ ) \
+	{                                           \
+		expr;                                   \
+	}
+#endif
+
+//
+// IEEE half precision conversion in software, for the paths without F16C and for building tables. FloatToHalf rounds to
+// nearest and doesn't bother with infinities or NaNs, the tables only store normalized values.
+//
+inline float HalfToFloat( unsigned short h )
+{
+	uint sign = ( h & 0x8000u ) << 16, exponent = ( h >> 10 ) & 0x1F, mantissa = h & 0x3FF;
+	if ( exponent == 0 )
+	{
+		float f = mantissa * ( 1.0f / 16777216.0f ); // subnormal, mantissa * 2^-24
+		return sign ? -f : f;
+	}
+	uint bits = sign | ( ( exponent + 112 ) << 23 ) | ( mantissa << 13 );
+	float f;
+	memcpy( &f, &bits, 4 );
+	return f;
+}
+
+inline unsigned short FloatToHalf( float f )
+{
+	uint bits;
+	memcpy( &bits, &f, 4 );
+	uint sign = ( bits >> 16 ) & 0x8000;
+	int exponent = (int)( ( bits >> 23 ) & 0xFF ) - 112;
+	uint mantissa = bits & 0x7FFFFF;
+	if ( exponent <= 0 )
+	{
+		if ( exponent < -10 ) return (unsigned short)sign;
+		mantissa |= 0x800000;
+		int shift = 14 - exponent;
+		return (unsigned short)( sign | ( ( mantissa + ( 1u << ( shift - 1 ) ) ) >> shift ) );
+	}
+	if ( exponent >= 31 ) return (unsigned short)( sign | 0x7BFF ); // clamp to the largest half
+	return (unsigned short)( ( sign | ( exponent << 10 ) | ( mantissa >> 13 ) ) + ( ( mantissa >> 12 ) & 1 ) );
+}
+
+struct maskv
+{
+#if defined SIMD_AVX512
+	__mmask16 m;
+	bool operator[]( int lane ) const { return ( m >> lane ) & 1; }
+	bool any() const { return m != 0; }
+	maskv operator&( const maskv& a ) const { return { (__mmask16)( m & a.m ) }; }
+	maskv operator|( const maskv& a ) const { return { (__mmask16)( m | a.m ) }; }
+	maskv operator!() const { return { (__mmask16)~m }; }
+	static maskv First( int count ) { return { (__mmask16)( ( 1u << count ) - 1 ) }; }
+#elif defined SIMD_AVX2
+	__m256 m;
+	bool operator[]( int lane ) const { return ( _mm256_movemask_ps( m ) >> lane ) & 1; }
+	bool any() const { return _mm256_movemask_ps( m ) != 0; }
+	maskv operator&( const maskv& a ) const { return { _mm256_and_ps( m, a.m ) }; }
+	maskv operator|( const maskv& a ) const { return { _mm256_or_ps( m, a.m ) }; }
+	maskv operator!() const { return { _mm256_xor_ps( m, _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) ) ) }; }
+	static maskv First( int count ) { return { _mm256_castsi256_ps( _mm256_cmpgt_epi32( _mm256_set1_epi32( count ), _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) ) ) }; }
+#else
+	bool m[SIMD_WIDTH];
+	bool operator[]( int lane ) const { return m[lane]; }
+	bool any() const
+	{
+		bool result = false;
+		SIMD_LOOP( result |= m[lane] );
+		return result;
+	}
+	maskv operator&( const maskv& a ) const { maskv r; SIMD_LOOP( r.m[lane] = m[lane] && a.m[lane] ); return r; }
+	maskv operator|( const maskv& a ) const { maskv r; SIMD_LOOP( r.m[lane] = m[lane] || a.m[lane] ); return r; }
+	maskv operator!() const { maskv r; SIMD_LOOP( r.m[lane] = !m[lane] ); return r; }
+	static maskv First( int count ) { maskv r; SIMD_LOOP( r.m[lane] = lane < count ); return r; }
+#endif
+};
+
+struct floatv
+{
+#if defined SIMD_AVX512
+	union { __m512 v; float data[16]; };
+	floatv() = default;
+	floatv( __m512 a ) : v( a ) {}
+	floatv( float f ) : v( _mm512_set1_ps( f ) ) {}
+	floatv operator+( const floatv& a ) const { return _mm512_add_ps( v, a.v ); }
+	floatv operator-( const floatv& a ) const { return _mm512_sub_ps( v, a.v ); }
+	floatv operator*( const floatv& a ) const { return _mm512_mul_ps( v, a.v ); }
+	floatv operator/( const floatv& a ) const { return _mm512_div_ps( v, a.v ); }
+	floatv operator-() const { return _mm512_sub_ps( _mm512_setzero_ps(), v ); }
+	maskv operator<( const floatv& a ) const { return { _mm512_cmp_ps_mask( v, a.v, _CMP_LT_OQ ) }; }
+	maskv operator<=( const floatv& a ) const { return { _mm512_cmp_ps_mask( v, a.v, _CMP_LE_OQ ) }; }
+	maskv operator>( const floatv& a ) const { return { _mm512_cmp_ps_mask( v, a.v, _CMP_GT_OQ ) }; }
+	maskv operator!=( const floatv& a ) const { return { _mm512_cmp_ps_mask( v, a.v, _CMP_NEQ_UQ ) }; }
+	static floatv sqrt( const floatv& a ) { return _mm512_sqrt_ps( a.v ); }
+	static floatv round( const floatv& a ) { return _mm512_roundscale_ps( a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ); }
+	static floatv floor( const floatv& a ) { return _mm512_roundscale_ps( a.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC ); }
+	static floatv min( const floatv& a, const floatv& b ) { return _mm512_min_ps( a.v, b.v ); }
+	static floatv max( const floatv& a, const floatv& b ) { return _mm512_max_ps( a.v, b.v ); }
+	static floatv fmadd( const floatv& a, const floatv& b, const floatv& c ) { return _mm512_fmadd_ps( a.v, b.v, c.v ); }
+	static floatv select( const maskv& m, const floatv& a, const floatv& b ) { return _mm512_mask_blend_ps( m.m, b.v, a.v ); }
+	static floatv truncate( const floatv& a ) { return _mm512_roundscale_ps( a.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC ); }
+	static floatv gather( const float* base, const int* index ) { return _mm512_i32gather_ps( _mm512_loadu_si512( index ), base, 4 ); }
+	static void gatherHalfPair( const unsigned short* base, const int* index, floatv* first, floatv* second )
+	{
+		__m512i pairs = _mm512_i32gather_epi32( _mm512_loadu_si512( index ), base, 2 );
+		*first = _mm512_cvtph_ps( _mm512_cvtepi32_epi16( pairs ) );
+		*second = _mm512_cvtph_ps( _mm512_cvtepi32_epi16( _mm512_srli_epi32( pairs, 16 ) ) );
+	}
+	void store( int* out ) const { _mm512_storeu_si512( out, _mm512_cvttps_epi32( v ) ); }
+#elif defined SIMD_AVX2
+	union { __m256 v; float data[8]; };
+	floatv() = default;
+	floatv( __m256 a ) : v( a ) {}
+	floatv( float f ) : v( _mm256_set1_ps( f ) ) {}
+	floatv operator+( const floatv& a ) const { return _mm256_add_ps( v, a.v ); }
+	floatv operator-( const floatv& a ) const { return _mm256_sub_ps( v, a.v ); }
+	floatv operator*( const floatv& a ) const { return _mm256_mul_ps( v, a.v ); }
+	floatv operator/( const floatv& a ) const { return _mm256_div_ps( v, a.v ); }
+	floatv operator-() const { return _mm256_sub_ps( _mm256_setzero_ps(), v ); }
+	maskv operator<( const floatv& a ) const { return { _mm256_cmp_ps( v, a.v, _CMP_LT_OQ ) }; }
+	maskv operator<=( const floatv& a ) const { return { _mm256_cmp_ps( v, a.v, _CMP_LE_OQ ) }; }
+	maskv operator>( const floatv& a ) const { return { _mm256_cmp_ps( v, a.v, _CMP_GT_OQ ) }; }
+	maskv operator!=( const floatv& a ) const { return { _mm256_cmp_ps( v, a.v, _CMP_NEQ_UQ ) }; }
+	static floatv sqrt( const floatv& a ) { return _mm256_sqrt_ps( a.v ); }
+	static floatv round( const floatv& a ) { return _mm256_round_ps( a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ); }
+	static floatv floor( const floatv& a ) { return _mm256_round_ps( a.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC ); }
+	static floatv min( const floatv& a, const floatv& b ) { return _mm256_min_ps( a.v, b.v ); }
+	static floatv max( const floatv& a, const floatv& b ) { return _mm256_max_ps( a.v, b.v ); }
+	static floatv fmadd( const floatv& a, const floatv& b, const floatv& c ) { return _mm256_fmadd_ps( a.v, b.v, c.v ); }
+	static floatv select( const maskv& m, const floatv& a, const floatv& b ) { return _mm256_blendv_ps( b.v, a.v, m.m ); }
+	static floatv truncate( const floatv& a ) { return _mm256_round_ps( a.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC ); }
+	static floatv gather( const float* base, const int* index ) { return _mm256_i32gather_ps( base, _mm256_loadu_si256( (const __m256i*)index ), 4 ); }
+#ifdef __F16C__
+	static void gatherHalfPair( const unsigned short* base, const int* index, floatv* first, floatv* second )
+	{
+		__m256i pairs = _mm256_i32gather_epi32( (const int*)base, _mm256_loadu_si256( (const __m256i*)index ), 2 );
+		// pack the low and high halves, the pack works per 128 bit lane, so put the quarters back in order afterwards
+		__m256i packed = _mm256_packus_epi32( _mm256_and_si256( pairs, _mm256_set1_epi32( 0xFFFF ) ), _mm256_srli_epi32( pairs, 16 ) );
+		packed = _mm256_permute4x64_epi64( packed, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+		*first = _mm256_cvtph_ps( _mm256_castsi256_si128( packed ) );
+		*second = _mm256_cvtph_ps( _mm256_extracti128_si256( packed, 1 ) );
+	}
+#else
+	static void gatherHalfPair( const unsigned short* base, const int* index, floatv* first, floatv* second )
+	{
+		for ( int lane = 0; lane < SIMD_WIDTH; lane++ ) first->data[lane] = HalfToFloat( base[index[lane]] ), second->data[lane] = HalfToFloat( base[index[lane] + 1] );
+	}
+#endif
+	void store( int* out ) const { _mm256_storeu_si256( (__m256i*)out, _mm256_cvttps_epi32( v ) ); }
+#else
+	float data[SIMD_WIDTH];
+	floatv() = default;
+	floatv( float f ) { SIMD_LOOP( data[lane] = f ); }
+	floatv operator+( const floatv& a ) const { floatv r; SIMD_LOOP( r.data[lane] = data[lane] + a.data[lane] ); return r; }
+	floatv operator-( const floatv& a ) const { floatv r; SIMD_LOOP( r.data[lane] = data[lane] - a.data[lane] ); return r; }
+	floatv operator*( const floatv& a ) const { floatv r; SIMD_LOOP( r.data[lane] = data[lane] * a.data[lane] ); return r; }
+	floatv operator/( const floatv& a ) const { floatv r; SIMD_LOOP( r.data[lane] = data[lane] / a.data[lane] ); return r; }
+	floatv operator-() const { floatv r; SIMD_LOOP( r.data[lane] = -data[lane] ); return r; }
+	maskv operator<( const floatv& a ) const { maskv r; SIMD_LOOP( r.m[lane] = data[lane] < a.data[lane] ); return r; }
+	maskv operator<=( const floatv& a ) const { maskv r; SIMD_LOOP( r.m[lane] = data[lane] <= a.data[lane] ); return r; }
+	maskv operator>( const floatv& a ) const { maskv r; SIMD_LOOP( r.m[lane] = data[lane] > a.data[lane] ); return r; }
+	maskv operator!=( const floatv& a ) const { maskv r; SIMD_LOOP( r.m[lane] = data[lane] != a.data[lane] ); return r; }
+	static floatv sqrt( const floatv& a ) { floatv r; SIMD_LOOP( r.data[lane] = sqrtf( a.data[lane] ) ); return r; }
+	static floatv round( const floatv& a ) { floatv r; SIMD_LOOP( r.data[lane] = nearbyintf( a.data[lane] ) ); return r; }
+	static floatv floor( const floatv& a ) { floatv r; SIMD_LOOP( r.data[lane] = floorf( a.data[lane] ) ); return r; }
+	static floatv min( const floatv& a, const floatv& b ) { floatv r; SIMD_LOOP( r.data[lane] = std::min( a.data[lane], b.data[lane] ) ); return r; }
+	static floatv max( const floatv& a, const floatv& b ) { floatv r; SIMD_LOOP( r.data[lane] = std::max( a.data[lane], b.data[lane] ) ); return r; }
+	static floatv fmadd( const floatv& a, const floatv& b, const floatv& c ) { return a * b + c; }
+	static floatv select( const maskv& m, const floatv& a, const floatv& b ) { floatv r; SIMD_LOOP( r.data[lane] = m.m[lane] ? a.data[lane] : b.data[lane] ); return r; }
+	static floatv truncate( const floatv& a ) { floatv r; SIMD_LOOP( r.data[lane] = truncf( a.data[lane] ) ); return r; }
+	static floatv gather( const float* base, const int* index ) { floatv r; SIMD_LOOP( r.data[lane] = base[index[lane]] ); return r; }
+	static void gatherHalfPair( const unsigned short* base, const int* index, floatv* first, floatv* second )
+	{
+		SIMD_LOOP( first->data[lane] = HalfToFloat( base[index[lane]] ); second->data[lane] = HalfToFloat( base[index[lane] + 1] ) );
+	}
+	void store( int* out ) const { SIMD_LOOP( out[lane] = (int)data[lane] ); }
+#endif
+	floatv operator+( float f ) const { return *this + floatv( f ); }
+	floatv operator-( float f ) const { return *this - floatv( f ); }
+	floatv operator*( float f ) const { return *this * floatv( f ); }
+	floatv operator/( float f ) const { return *this / floatv( f ); }
+	void operator+=( const floatv& a ) { *this = *this + a; }
+	void operator-=( const floatv& a ) { *this = *this - a; }
+	void operator*=( const floatv& a ) { *this = *this * a; }
+	float& operator[]( int lane ) { return data[lane]; }
+	float operator[]( int lane ) const { return data[lane]; }
+
+	//
+	// Sine and cosine of the same angle, Cody-Waite reduction to [-pi/4, pi/4] followed by the Cephes minimax
+	// polynomials. Absolute error below 2E-7 for |x| < 1E4, so well within single precision for our [0, 2 pi) angles.
+	//
+	static void sincos( const floatv& x, floatv* s, floatv* c )
+	{
+		floatv j = round( x * 0.63661977236f ); // 2 / pi
+		floatv r = x - j * 1.5703125f;			// pi / 2 split into three parts, such that j * part is exact
+		r = r - j * 4.837512969970703125E-4f;
+		r = r - j * 7.54978995489188216E-8f;
+
+		floatv quadrant = j - floor( j * 0.25f ) * 4.0f; // j mod 4, as a float in { 0, 1, 2, 3 }
+
+		floatv r2 = r * r;
+		floatv sinr = fmadd( fmadd( fmadd( r2, -1.9515295891E-4f, 8.3321608736E-3f ), r2, -1.6666654611E-1f ) * r2, r, r );
+		floatv cosr = fmadd( fmadd( fmadd( r2, 2.443315711809948E-5f, -1.388731625493765E-3f ), r2, 4.166664568298827E-2f ) * r2, r2, r2 * -0.5f ) + 1.0f;
+
+		maskv swap = ( quadrant == 1.0f ) | ( quadrant == 3.0f );
+		maskv negateSin = quadrant > 1.5f;
+		maskv negateCos = ( quadrant == 1.0f ) | ( quadrant == 2.0f );
+
+		floatv sinx = select( swap, cosr, sinr );
+		floatv cosx = select( swap, sinr, cosr );
+		*s = select( negateSin, -sinx, sinx );
+		*c = select( negateCos, -cosx, cosx );
+	}
+
+	maskv operator==( float f ) const { return !( *this != floatv( f ) ); }
+};
+
+inline floatv operator*( float f, const floatv& a ) { return floatv( f ) * a; }
+inline floatv operator+( float f, const floatv& a ) { return floatv( f ) + a; }
+inline floatv operator-( float f, const floatv& a ) { return floatv( f ) - a; }
+inline floatv operator/( float f, const floatv& a ) { return floatv( f ) / a; }
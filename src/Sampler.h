@@ -0,0 +1,160 @@
+#pragma once
+
+enum SamplerType
+{
+	SAMPLER_RANDOM, // independent Philox random numbers for every dimension
+	SAMPLER_SOBOL	// Owen scrambled Sobol points, padded per call
+};
+
+// the bits of the Morton code of a pixel of the screen
+constexpr int ScreenMortonBits()
+{
+	int bits = 0;
+	while ( ( 1 << bits ) < std::max( SCRWIDTH, SCRHEIGHT ) ) bits++;
+	return 2 * bits;
+}
+
+//
+// The sample points of DOF::Apply and DOF::ApplyBatch. Like RandomStream a sampler is fully determined by the source
+// pixel, the frame and the sample index (and the number of samples the pixel takes). Every Get1D or Get2D call is a new
+// dimension.
+//
+// SAMPLER_SOBOL takes the points of Owen scrambled Sobol sequences (Burley 2020, "Practical Hash-based Owen
+// Scrambling"), indexed in Z order: the pixel's Morton code, followed by the sample index in as many bits as the pixel
+// takes samples, rounded up to a power of two (Ahmed and Wonka 2020, "Screen-Space Blue-Noise Diffusion of Monte Carlo
+// Sampling Error via Hierarchical Ordering of Pixels"). Pixels that take the same number of bits share one sequence
+// per frame and dimension, so the samples of a pixel are a consecutive, aligned block of it, and so are those of a
+// square of neighbouring pixels that take as many samples, so both are stratified over the pupil, the pixel area and
+// the wavelengths. Most pixels take one sample or none, so the stratification between neighbours is what evens out the
+// bokeh. Pixels with another number of bits use a differently scrambled sequence, as do the samples beyond SAMPLE_BITS
+// of a pixel, so no two samples of a frame share a point. Every point is still uniformly distributed and the frames are
+// independent, so each frame stays an unbiased estimate (which Application::TileError relies on).
+//
+class Sampler
+{
+  public:
+	Sampler( SamplerType type, uint pixel, uint frame, uint sample, uint samples ) : random( pixel, frame, sample ), type( type )
+	{
+		if ( type == SAMPLER_RANDOM ) return;
+		int bits = 0;
+		while ( bits < SAMPLE_BITS && ( 1u << bits ) < samples ) bits++;
+		index = ( Morton( pixel % SCRWIDTH, pixel / SCRWIDTH ) << bits ) | ( sample & ( ( 1u << bits ) - 1 ) );
+		uint sequence = ( ( sample >> bits ) << 5 ) | bits; // the bits, and which run of 1 << SAMPLE_BITS samples
+		seed = Hash( frame ^ Hash( (uint)Random::seed ^ Hash( sequence ) ) );
+	}
+
+	float Get1D()
+	{
+		if ( type == SAMPLER_RANDOM ) return random.rnd();
+		uint dimensionSeed = Hash( seed ^ dimension++ );
+		uint shuffled = NestedUniformScramble( index, dimensionSeed );
+		return ToFloat( ReverseBits( LaineKarras( shuffled, Hash( dimensionSeed ^ 0x68BC21EB ) ) ) );
+	}
+
+	float2 Get2D()
+	{
+		float2 result;
+		if ( type == SAMPLER_RANDOM )
+		{
+			result.x = random.rnd(); // separate statements, argument evaluation order is unspecified
+			result.y = random.rnd();
+			return result;
+		}
+		// a different shuffle of the index per dimension decorrelates the dimensions, it keeps aligned blocks together
+		uint dimensionSeed = Hash( seed ^ dimension++ );
+		uint shuffled = NestedUniformScramble( index, dimensionSeed );
+		result.x = ToFloat( ReverseBits( LaineKarras( shuffled, Hash( dimensionSeed ^ 0x68BC21EB ) ) ) );
+		result.y = ToFloat( ReverseBits( LaineKarras( ReversedSobol1( shuffled ), Hash( dimensionSeed ^ 0x02E5BE93 ) ) ) );
+		return result;
+	}
+
+  private:
+	// what the Morton codes of the screen leave of the 32 bit index for the sample
+	static constexpr int SAMPLE_BITS = 32 - ScreenMortonBits();
+	static_assert( SAMPLE_BITS > 0, "the screen is too large for the Morton codes of Sampler" );
+
+	//
+	// The points are kept bit reversed as long as possible, the first Sobol dimension is the reversed index itself, and
+	// the second is linear in the bits of the index, so it is the xor of four lookups per byte (sobolTable)
+	//
+	static constexpr uint ReverseBits( uint x )
+	{
+		x = ( x << 16 ) | ( x >> 16 );
+		x = ( ( x & 0x00FF00FF ) << 8 ) | ( ( x & 0xFF00FF00 ) >> 8 );
+		x = ( ( x & 0x0F0F0F0F ) << 4 ) | ( ( x & 0xF0F0F0F0 ) >> 4 );
+		x = ( ( x & 0x33333333 ) << 2 ) | ( ( x & 0xCCCCCCCC ) >> 2 );
+		x = ( ( x & 0x55555555 ) << 1 ) | ( ( x & 0xAAAAAAAA ) >> 1 );
+		return x;
+	}
+
+	static uint ReversedSobol1( uint index )
+	{
+		return sobolTable.entries[0][index & 255] ^ sobolTable.entries[1][( index >> 8 ) & 255] ^
+			   sobolTable.entries[2][( index >> 16 ) & 255] ^ sobolTable.entries[3][index >> 24];
+	}
+
+	// hash that only lets bits affect higher bits, on reversed bits it is an Owen scramble
+	static uint LaineKarras( uint x, uint seed )
+	{
+		x += seed;
+		x ^= x * 0x6C50B47C;
+		x ^= x * 0xB82F1E52;
+		x ^= x * 0xC7AFE638;
+		x ^= x * 0x8D22F6E6;
+		return x;
+	}
+
+	static uint NestedUniformScramble( uint x, uint seed ) { return ReverseBits( LaineKarras( ReverseBits( x ), seed ) ); }
+
+	static uint Hash( uint x )
+	{
+		x ^= x >> 16, x *= 0x7FEB352D;
+		x ^= x >> 15, x *= 0x846CA68B;
+		return x ^ ( x >> 16 );
+	}
+
+	static float ToFloat( uint x ) { return ( x >> 8 ) * ( 1.0f / 16777216.0f ); }
+
+	static uint Morton( uint x, uint y )
+	{
+		auto spread = []( uint v ) {
+			v &= 0xFFFF;
+			v = ( v | ( v << 8 ) ) & 0x00FF00FF;
+			v = ( v | ( v << 4 ) ) & 0x0F0F0F0F;
+			v = ( v | ( v << 2 ) ) & 0x33333333;
+			return ( v | ( v << 1 ) ) & 0x55555555;
+		};
+		return spread( x ) | ( spread( y ) << 1 );
+	}
+
+	//
+	// The second Sobol dimension, bit reversed, for every byte of the index. Its direction numbers are
+	// v[0] = 1 << 31, v[k] = v[k - 1] ^ ( v[k - 1] >> 1 ).
+	//
+	struct SobolTable
+	{
+		uint entries[4][256];
+
+		constexpr SobolTable() : entries()
+		{
+			uint direction[32] = {};
+			direction[0] = 0x80000000;
+			for ( int k = 1; k < 32; k++ ) direction[k] = direction[k - 1] ^ ( direction[k - 1] >> 1 );
+			for ( int k = 0; k < 32; k++ ) direction[k] = ReverseBits( direction[k] );
+
+			for ( int byte = 0; byte < 4; byte++ )
+				for ( int value = 0; value < 256; value++ )
+					for ( int bit = 0; bit < 8; bit++ )
+						if ( value & ( 1 << bit ) ) entries[byte][value] ^= direction[byte * 8 + bit];
+		}
+	};
+	static const SobolTable sobolTable;
+
+	RandomStream random;
+	SamplerType type;
+	uint index = 0;
+	uint seed = 0;
+	uint dimension = 0;
+};
+
+inline constexpr Sampler::SobolTable Sampler::sobolTable;
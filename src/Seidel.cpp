@@ -1,84 +1,98 @@
 #include "precomp.h"
 
-void Seidel::GenerateCoefficients( float wavelength, int num_elements, std::vector<float> dispconstants, std::vector<float> radii, std::vector<float> centers, std::vector<float> thicknesses, LensData *lensData, float dist )
+//
+// Sums the coefficients of all surfaces, tracing the paraxial object ray (s, h) and pupil ray (t) through the system
+// one surface at a time. Only the values of the previous surface are needed, so nothing is stored. The pupil ray does
+// not depend on the object distance, with T = floatv the same chain runs for SIMD_WIDTH distances at once.
+//
+template <typename T>
+SeidelTerms<T> Seidel::Generate( float wavelength, int num_elements, const float* dispconstants, const float* radii, const float* centers, const float* thicknesses, float entrancePupil, T dist, T* s_prime_last )
 {
-	std::vector<float> r;
-	std::vector<float> s;
-	std::vector<float> s_prime;
-	std::vector<float> t;
-	std::vector<float> t_prime;
-	std::vector<float> n;
-	std::vector<float> k;
-	std::vector<float> h;
+	SeidelTerms<T> sum = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
 
-	//
-	// calculate constants
-	//
+	float n = HelperFunctions::CalculateRefractiveIndex( wavelength, (float*)&dispconstants[0] );
+	float t_prime = 0.0f;
+	T s_prime = 0.0f, h = 0.0f, k = 0.0f;
 
-	n.push_back( HelperFunctions::CalculateRefractiveIndex( wavelength, &dispconstants[0] ) );
 	for ( int i = 0; i < num_elements; i++ )
 	{
-		// n
-		n.push_back( HelperFunctions::CalculateRefractiveIndex( wavelength, &dispconstants[( i + 1 ) * 6] ) );
+		float n_next = HelperFunctions::CalculateRefractiveIndex( wavelength, (float*)&dispconstants[( i + 1 ) * 6] );
+		float r = -radii[i];
 
-		// r
-		r.push_back( -radii[i] );
-
-		// t, negative as in image 5.9
-		if ( i == 0 )
-			t.push_back( -( centers[0] + radii[0] - lensData->entrancePupil ) );
-		else
-			t.push_back( t_prime[i - 1] - thicknesses[i - 1] );
-
-		// s, negative as in image 5.9
+		// t and s, negative as in image 5.9
+		float t;
+		T s;
 		if ( i == 0 )
-			s.push_back( -( centers[0] + radii[0] + dist ) ); // distance from object plane to first lens element, negative
+		{
+			t = -( centers[0] + radii[0] - entrancePupil );
+			s = -( centers[0] + radii[0] + dist ); // distance from object plane to first lens element, negative
+		}
 		else
-			s.push_back( s_prime[i - 1] - thicknesses[i - 1] );
-
-		// s'
-		s_prime.push_back( ( r[i] * s[i] * n[i + 1] ) / ( r[i] * n[i] + s[i] * ( n[i + 1] - n[i] ) ) );
-
-		// t'
-		t_prime.push_back( ( r[i] * t[i] * n[i + 1] ) / ( r[i] * n[i] + t[i] * ( n[i + 1] - n[i] ) ) );
+		{
+			t = t_prime - thicknesses[i - 1];
+			s = s_prime - thicknesses[i - 1];
+		}
 
-		// h
-		if ( i == 0 )
-			h.push_back( s[0] / ( t[0] - s[0] ) );
-		else
-			h.push_back( ( s[i] / s_prime[i - 1] ) * h[i - 1] );
+		T s_prime_next = ( r * s * n_next ) / ( r * n + s * ( n_next - n ) );
+		t_prime = ( r * t * n_next ) / ( r * n + t * ( n_next - n ) );
 
-		// k
+		T h_next, k_next;
 		if ( i == 0 )
-			k.push_back( ( t[0] * ( t[0] - s[0] ) ) / ( n[0] * s[0] ) );
+		{
+			h_next = s / ( t - s );
+			k_next = ( t * ( t - s ) ) / ( n * s );
+		}
 		else
 		{
-			float d = thicknesses[i - 1];
-			float delta = d / ( n[i] * h[i - 1] * h[i] );
-
-			k.push_back( k[i - 1] + delta );
+			h_next = ( s / s_prime ) * h;
+			k_next = k + thicknesses[i - 1] / ( n * h * h_next );
 		}
+
+		// "Each primary aberration coefficient of a centred system is the sum of the corresponding
+		// aberration coefficients associated with the individual surfaces of the system"
+		SeidelTerms<T> c = CalculateCoefficients( r, n_next, n, s, s_prime_next, t, k_next, h_next );
+		sum.B = sum.B + c.B;
+		sum.C = sum.C + c.C;
+		sum.D = sum.D + c.D;
+		sum.E = sum.E + c.E;
+		sum.F = sum.F + c.F;
+
+		n = n_next;
+		s_prime = s_prime_next;
+		h = h_next;
+		k = k_next;
 	}
-	
-	lensData->s_prime = s_prime[num_elements - 1];
 
-	lensData->B = 0;
-	lensData->C = 0;
-	lensData->D = 0;
-	lensData->E = 0;
-	lensData->F = 0;
+	*s_prime_last = s_prime;
+	return sum;
+}
 
-	for ( int i = 0; i < num_elements; i++ )
+//
+// Seidel coefficients for the count object distances dists[j], SIMD_WIDTH at a time, into lensData[j]. All entries
+// share the wavelength, and so the entrance pupil of lensData[0].
+//
+void Seidel::GenerateCoefficientsRow( float wavelength, int num_elements, const float* dispconstants, const float* radii, const float* centers, const float* thicknesses, LensData* lensData, int count, const float* dists )
+{
+	float entrancePupil = lensData[0].entrancePupil;
+
+	for ( int first = 0; first < count; first += SIMD_WIDTH )
 	{
-		// "Each primary aberration coefficient of a centred system is the sum of the corresponding
-		// aberration coefficients associated with the individual surfaces of the system"
+		floatv dist;
+		for ( int lane = 0; lane < SIMD_WIDTH; lane++ )
+			dist[lane] = dists[std::min( first + lane, count - 1 )];
 
-		std::vector<float> c = Seidel::CalculateCoefficients( r[i], n[i + 1], n[i], s[i], s_prime[i], t[i], k[i], h[i] );
+		floatv s_prime;
+		SeidelTerms<floatv> c = Generate( wavelength, num_elements, dispconstants, radii, centers, thicknesses, entrancePupil, dist, &s_prime );
 
-		lensData->B += c[0];
-		lensData->C += c[1];
-		lensData->D += c[2];
-		lensData->E += c[3];
-		lensData->F += c[4];
+		for ( int lane = 0; lane < SIMD_WIDTH && first + lane < count; lane++ )
+		{
+			LensData& ld = lensData[first + lane];
+			ld.B = c.B[lane];
+			ld.C = c.C[lane];
+			ld.D = c.D[lane];
+			ld.E = c.E[lane];
+			ld.F = c.F[lane];
+			ld.s_prime = s_prime[lane];
+		}
 	}
-}
\ No newline at end of file
+}
@@ -1,33 +1,43 @@
 #pragma once
 
+//
+// The five primary aberration coefficients, for one (T = float) or SIMD_WIDTH (T = floatv) object distances at once
+//
+template <typename T>
+struct SeidelTerms
+{
+	T B, C, D, E, F;
+};
+
 class Seidel
 {
   private:
-	static float pow2( float f ) { return f * f; }
+	template <typename T>
+	static T pow2( T f ) { return f * f; }
 
   public:
-	static std::vector<float> CalculateCoefficients( float r, float n, float n_prev, float s, float s_prime, float t, float k, float h )
+	template <typename T>
+	static SeidelTerms<T> CalculateCoefficients( float r, float n, float n_prev, T s, T s_prime, float t, T k, T h )
 	{
 		// Equation 24 from page 225 from Principles of Optics.
 		// We set b_i = 0, as we assume all surfaces to be spherical.
 
-		float K = n_prev * ( 1.0f / r - 1.0f / s );
-		//float K = n * ( 1.0f / r - 1.0f / s_prime ); // alternative
+		T K = n_prev * ( 1.0f / r - 1.0f / s );
+		//T K = n * ( 1.0f / r - 1.0f / s_prime ); // alternative
 
-		float Ai = ( 1.0f / ( n * s_prime ) - 1.0f / ( n_prev * s ) );
-		float Bi = ( 1.0f / pow2( n ) - 1.0f / pow2( n_prev ) ); 
-		float h2 = h * h;
-		float h4 = h2 * h2;
+		T Ai = ( 1.0f / ( n * s_prime ) - 1.0f / ( n_prev * s ) );
+		float Bi = ( 1.0f / pow2( n ) - 1.0f / pow2( n_prev ) );
+		T h2 = h * h;
+		T h4 = h2 * h2;
 
-		float Ci = h2 * k * K;
+		T Ci = h2 * k * K;
 
-		std::vector<float> output;
-		output.reserve( 5 );
-		output.push_back( 0.5f * ( h4 * pow2( K ) * Ai ) );													 // B
-		output.push_back( 0.5f * ( pow2( 1.0f + Ci ) * Ai ) );												 // C
-		output.push_back( 0.5f * ( Ci * ( 2.0f + Ci ) * Ai - K * Bi ) );									 // D
-		output.push_back( 0.5f * ( k * ( 1.0f + Ci ) * ( 2.0f + Ci ) * Ai - ( ( 1.0f + Ci ) / h2 ) * Bi ) ); // E
-		output.push_back( 0.5f * ( h2 * K * ( 1.0f + Ci ) * Ai ) );											 // F
+		SeidelTerms<T> output;
+		output.B = 0.5f * ( h4 * pow2( K ) * Ai );													// B
+		output.C = 0.5f * ( pow2( 1.0f + Ci ) * Ai );												// C
+		output.D = 0.5f * ( Ci * ( 2.0f + Ci ) * Ai - K * Bi );										// D
+		output.E = 0.5f * ( k * ( 1.0f + Ci ) * ( 2.0f + Ci ) * Ai - ( ( 1.0f + Ci ) / h2 ) * Bi ); // E
+		output.F = 0.5f * ( h2 * K * ( 1.0f + Ci ) * Ai );											// F
 
 		return output;
 	}
@@ -36,5 +46,9 @@ class Seidel
 	{
 	}
 
-	static void GenerateCoefficients( float wavelength, int num_elements, std::vector<float> dispconstants, std::vector<float> radii, std::vector<float> centers, std::vector<float> thicknesses, LensData *lensData, float dist );
-};
\ No newline at end of file
+	static void GenerateCoefficientsRow( float wavelength, int num_elements, const float* dispconstants, const float* radii, const float* centers, const float* thicknesses, LensData* lensData, int count, const float* dists );
+
+  private:
+	template <typename T>
+	static SeidelTerms<T> Generate( float wavelength, int num_elements, const float* dispconstants, const float* radii, const float* centers, const float* thicknesses, float entrancePupil, T dist, T* s_prime_last );
+};
@@ -0,0 +1,70 @@
+#include "precomp.h"
+
+void SplatBins::Resize( int sources )
+{
+	binned.assign( sources, std::vector<SplatRecord>() );
+	start.assign( sources, std::vector<uint>( SPLAT_TILES + 1, 0 ) );
+}
+
+//
+// Counting sort on the destination tile, which keeps the records of a tile in the order they were splatted
+//
+void SplatBins::Bin( int source, std::vector<SplatRecord>& records )
+{
+	std::vector<uint>& offsets = start[source];
+	offsets.assign( SPLAT_TILES + 1, 0 );
+	for ( const SplatRecord& record : records )
+		offsets[record.tile + 1]++;
+	for ( int tile = 0; tile < SPLAT_TILES; tile++ )
+		offsets[tile + 1] += offsets[tile];
+
+	std::vector<SplatRecord>& sorted = binned[source];
+	sorted.resize( records.size() );
+
+	// offsets[tile] is used as the insertion point and ends up at the start of the next tile, shift it back afterwards
+	for ( const SplatRecord& record : records )
+		sorted[offsets[record.tile]++] = record;
+	for ( int tile = SPLAT_TILES; tile > 0; tile-- )
+		offsets[tile] = offsets[tile - 1];
+	offsets[0] = 0;
+
+	records.clear();
+}
+
+void SplatBins::Resolve( int tile, float4* accumulator, float* squares ) const
+{
+	float4 buffer[SPLAT_TILE * SPLAT_TILE];
+	memset( buffer, 0, sizeof( buffer ) );
+
+	for ( size_t source = 0; source < binned.size(); source++ )
+	{
+		const SplatRecord* records = binned[source].data();
+		for ( uint i = start[source][tile]; i < start[source][tile + 1]; i++ )
+		{
+			buffer[records[i].local].rgb += records[i].rgb;
+			buffer[records[i].local].a += records[i].weight;
+		}
+	}
+
+	int x0 = ( tile % SPLAT_TILES_X ) * SPLAT_TILE;
+	int y0 = ( tile / SPLAT_TILES_X ) * SPLAT_TILE;
+	int width = std::min( SPLAT_TILE, SCRWIDTH - x0 );
+	int height = std::min( SPLAT_TILE, SCRHEIGHT - y0 );
+	for ( int y = 0; y < height; y++ )
+		for ( int x = 0; x < width; x++ )
+		{
+			float4 added = buffer[y * SPLAT_TILE + x];
+			accumulator[( y0 + y ) * SCRWIDTH + x0 + x] += added;
+			if ( !squares ) continue;
+			float luminance = HelperFunctions::Luminance( added.rgb );
+			squares[( y0 + y ) * SCRWIDTH + x0 + x] += luminance * luminance;
+		}
+}
+
+size_t SplatBins::RecordCount() const
+{
+	size_t count = 0;
+	for ( size_t source = 0; source < binned.size(); source++ )
+		count += binned[source].size();
+	return count;
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#define SPLAT_TILE 32 // destination tiles of 32x32 pixels, 16KB of float4, resolve in L1
+#define SPLAT_TILES_X ( ( SCRWIDTH + SPLAT_TILE - 1 ) / SPLAT_TILE )
+#define SPLAT_TILES_Y ( ( SCRHEIGHT + SPLAT_TILE - 1 ) / SPLAT_TILE )
+#define SPLAT_TILES ( SPLAT_TILES_X * SPLAT_TILES_Y )
+#define SPLAT_UNITS 1024 // about the number of source work units per frame, see Application::PrepareSampling
+
+//
+// One splat, binned by destination tile: the color and weight to add, and where
+//
+struct SplatRecord
+{
+	float3 rgb;
+	float weight;
+	unsigned short tile;  // destination tile
+	unsigned short local; // pixel within the tile
+};
+
+//
+// A pixel of a fixed point accumulator, in units of 1 / SPLAT_FIXED_SCALE. Integer sums don't depend on the order of
+// the additions, so threads can splat into their own fixed point accumulators in any order and the merged result is
+// the same for any number of threads, see Application::RenderDirect.
+//
+#define SPLAT_FIXED_SCALE 4294967296.0f // 2^32, keeps a 2^31 range per pixel, well above what a render adds to one
+struct FixedPixel
+{
+	int64 r, g, b, a;
+};
+
+//
+// Where DOF::Apply and DOF::ApplyBatch put their samples: straight into an accumulator (float or fixed point), or appended to a list of
+// records that SplatBins sorts by destination tile, both dropping what lands off the screen; or into a window around a
+// pixel, which may reach off the screen, for the PSFs of PSFConvolution
+//
+class SplatTarget
+{
+  public:
+	SplatTarget( float4* accumulator ) : accumulator( accumulator ) {}
+	SplatTarget( FixedPixel* fixedAccumulator ) : fixedAccumulator( fixedAccumulator ) {}
+	SplatTarget( std::vector<SplatRecord>* records ) : records( records ) {}
+	SplatTarget( float4* window, int centerX, int centerY, int radius, int subpixels = 1 )
+		: window( window ), centerX( centerX ), centerY( centerY ), radius( radius ), subpixels( subpixels ) {}
+
+	// at a position on the screen in pixels, in the pixel it lies in, or for a window of subpixels, in the subpixel
+	void Add( float x, float y, const float3& rgb, float weight )
+	{
+		int pixelX = (int)( x + 1.0f ) - 1, pixelY = (int)( y + 1.0f ) - 1;
+		if ( subpixels == 1 )
+		{
+			Add( pixelX, pixelY, rgb, weight );
+			return;
+		}
+		if ( !Measure( pixelX, pixelY, weight ) ) return;
+		int side = ( 2 * radius + 1 ) * subpixels;
+		int subX = clamp( (int)floorf( ( x - ( centerX - radius ) ) * subpixels ), 0, side - 1 );
+		int subY = clamp( (int)floorf( ( y - ( centerY - radius ) ) * subpixels ), 0, side - 1 );
+		float4& pixel = window[subY * side + subX];
+		pixel.rgb += rgb;
+		pixel.a += weight;
+	}
+
+	void Add( int x, int y, const float3& rgb, float weight )
+	{
+		if ( window )
+		{
+			if ( !Measure( x, y, weight ) ) return;
+			float4& pixel = window[( y - centerY + radius ) * ( 2 * radius + 1 ) + x - centerX + radius];
+			pixel.rgb += rgb;
+			pixel.a += weight;
+			return;
+		}
+		if ( x < 0 || y < 0 || x >= SCRWIDTH || y >= SCRHEIGHT ) return;
+		if ( accumulator )
+		{
+			accumulator[y * SCRWIDTH + x].rgb += rgb;
+			accumulator[y * SCRWIDTH + x].a += weight;
+		}
+		else if ( fixedAccumulator )
+		{
+			// a float times a power of two is exact, so the rounding only drops what lies below 1 / SPLAT_FIXED_SCALE
+			FixedPixel& pixel = fixedAccumulator[y * SCRWIDTH + x];
+			pixel.r += llrintf( rgb.x * SPLAT_FIXED_SCALE );
+			pixel.g += llrintf( rgb.y * SPLAT_FIXED_SCALE );
+			pixel.b += llrintf( rgb.z * SPLAT_FIXED_SCALE );
+			pixel.a += llrintf( weight * SPLAT_FIXED_SCALE );
+		}
+		else
+		{
+			SplatRecord record;
+			record.rgb = rgb;
+			record.weight = weight;
+			record.tile = (unsigned short)( ( y / SPLAT_TILE ) * SPLAT_TILES_X + x / SPLAT_TILE );
+			record.local = (unsigned short)( ( y % SPLAT_TILE ) * SPLAT_TILE + x % SPLAT_TILE );
+			records->push_back( record );
+		}
+	}
+
+	// window: the farthest a sample landed from the center in x or y, the moments of where the weight landed (the sums
+	// of the weight, times x and y from the center and times their squared distance), both also outside of it, and
+	// the weight outside of it
+	int reach = 0;
+	float4 moments = float4( 0.0f );
+	float lost = 0.0f;
+
+  private:
+	// the reach and the moments of a sample of a window, and whether it lands inside
+	bool Measure( int x, int y, float weight )
+	{
+		int dx = x - centerX, dy = y - centerY, distance = std::max( abs( dx ), abs( dy ) );
+		reach = std::max( reach, distance );
+		moments += float4( weight, weight * dx, weight * dy, weight * (float)( dx * dx + dy * dy ) );
+		if ( distance <= radius ) return true;
+		lost += weight;
+		return false;
+	}
+
+	float4* accumulator = nullptr;
+	FixedPixel* fixedAccumulator = nullptr;
+	std::vector<SplatRecord>* records = nullptr;
+	float4* window = nullptr; // ( ( 2 radius + 1 ) subpixels )^2 subpixels, row by row
+	int centerX = 0, centerY = 0, radius = 0, subpixels = 1;
+};
+
+//
+// Two phase splatting. The samples of every source (a work unit of pixels, see Application::PrepareSampling) are
+// collected by one thread and sorted by destination tile with Bin. Resolve then sums everything that landed in one
+// destination tile into a small tile buffer, walking the sources in order. Every pixel is summed in the same order
+// however the sources were distributed over threads, so the result doesn't depend on the number of threads.
+//
+class SplatBins
+{
+  public:
+	// sets the number of sources, which are all empty afterwards
+	void Resize( int sources );
+
+	// sorts the records of a source by destination tile, the records vector is left empty for reuse
+	void Bin( int source, std::vector<SplatRecord>& records );
+
+	// adds everything that landed in a destination tile to the accumulator, and the squared luminance of that to
+	// squares when given (for the variance of adaptive sampling)
+	void Resolve( int tile, float4* accumulator, float* squares = nullptr ) const;
+
+	// whether a source has splatted anything into a destination tile
+	bool Reaches( int source, int tile ) const { return start[source][tile + 1] > start[source][tile]; }
+
+	size_t RecordCount() const;
+
+  private:
+	std::vector<std::vector<SplatRecord>> binned; // per source, sorted by destination tile
+	std::vector<std::vector<uint>> start;		  // per source, where the records of every destination tile start
+};
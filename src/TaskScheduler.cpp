@@ -0,0 +1,82 @@
+#include "precomp.h"
+
+//
+// Splits the tasks in numThreads contiguous ranges of about equal cost. Not thread safe, call from one thread.
+//
+void TaskScheduler::Init( const std::vector<float>& costs, int threads )
+{
+	if ( threads != numThreads )
+	{
+		ranges.reset( new Range[threads] );
+		numThreads = threads;
+	}
+	stats.assign( threads, ThreadStats() );
+	split.resize( threads );
+
+	double totalCost = 0;
+	for ( float cost : costs ) totalCost += cost;
+
+	int count = (int)costs.size();
+	int begin = 0;
+	double cost = 0;
+	for ( int thread = 0; thread < threads; thread++ )
+	{
+		// the range ends where the running cost passes the share of this and all previous threads
+		double target = totalCost * ( thread + 1 ) / threads;
+		int end = begin;
+		while ( end < count && ( cost + costs[end] * 0.5 < target || thread == threads - 1 ) )
+			cost += costs[end++];
+		split[thread] = Pack( begin, end );
+		begin = end;
+	}
+	Restart();
+}
+
+void TaskScheduler::Restart()
+{
+	for ( int thread = 0; thread < numThreads; thread++ )
+		ranges[thread].range.store( split[thread] );
+}
+
+bool TaskScheduler::Next( int thread, int* task )
+{
+	// own range, from the front
+	std::atomic<uint64>& own = ranges[thread].range;
+	uint64 current = own.load();
+	while ( true )
+	{
+		uint begin = (uint)current, end = (uint)( current >> 32 );
+		if ( begin >= end ) break;
+		if ( own.compare_exchange_weak( current, Pack( begin + 1, end ) ) )
+		{
+			*task = begin;
+			stats[thread].tasks++;
+			return true;
+		}
+	}
+
+	// steal from the back of the fullest range, retry as long as any range has tasks left
+	while ( true )
+	{
+		int victim = -1;
+		uint most = 0;
+		for ( int other = 0; other < numThreads; other++ )
+		{
+			uint64 r = ranges[other].range.load();
+			uint left = (uint)( r >> 32 ) - std::min( (uint)r, (uint)( r >> 32 ) );
+			if ( left > most ) most = left, victim = other;
+		}
+		if ( victim < 0 ) return false;
+
+		std::atomic<uint64>& theirs = ranges[victim].range;
+		uint64 r = theirs.load();
+		uint begin = (uint)r, end = (uint)( r >> 32 );
+		if ( begin < end && theirs.compare_exchange_strong( r, Pack( begin, end - 1 ) ) )
+		{
+			*task = end - 1;
+			stats[thread].tasks++;
+			stats[thread].steals++;
+			return true;
+		}
+	}
+}
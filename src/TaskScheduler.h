@@ -0,0 +1,40 @@
+#pragma once
+
+//
+// What a thread did since the last TaskScheduler::Init
+//
+struct ThreadStats
+{
+	alignas( 64 ) float busy = 0.0f; // seconds spent in tasks
+	int tasks = 0;
+	int steals = 0;
+};
+
+//
+// Work stealing over a fixed list of tasks with estimated costs. Init hands every thread a contiguous range of tasks of
+// about equal total cost, so neighbouring tasks (and their memory) stay on one thread. A thread takes tasks from the
+// front of its own range, and when that is empty steals single tasks from the back of the range with the most tasks
+// left. Both ends of a range live in one 64 bit atomic, so taking and stealing are a single compare and swap.
+// Restart hands out the same tasks again (the next frame), the statistics keep adding up until the next Init.
+//
+class TaskScheduler
+{
+  public:
+	void Init( const std::vector<float>& costs, int threads );
+	void Restart();
+	bool Next( int thread, int* task );
+
+	std::vector<ThreadStats> stats; // per thread, the caller adds the busy time
+
+  private:
+	struct alignas( 64 ) Range
+	{
+		std::atomic<uint64> range; // begin in the low 32 bits, end in the high 32 bits
+	};
+
+	static uint64 Pack( uint begin, uint end ) { return (uint64)begin | ( (uint64)end << 32 ); }
+
+	std::vector<uint64> split; // the initial range of every thread
+	std::unique_ptr<Range[]> ranges;
+	int numThreads = 0;
+};
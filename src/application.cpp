@@ -2,12 +2,25 @@
 
 
 
-inline int fastrand() { 
-  static unsigned int g_seed = (214013*g_seed+2531011); 
-  return (g_seed>>16)&0x7FFF; 
-} 
+inline int fastrand() {
+  static unsigned int g_seed = (214013*g_seed+2531011);
+  return (g_seed>>16)&0x7FFF;
+}
 
 
+// -----------------------------------------------------------
+// Free the buffers and the renderers allocated on first use
+// -----------------------------------------------------------
+Application::~Application()
+{
+	delete[] accumulator;
+	delete[] luminanceSquares;
+	delete[] cocMap;
+	delete[] inputImage;
+	delete bins;
+	delete convolution;
+}
+
 // -----------------------------------------------------------
 // Initialize the application
 // -----------------------------------------------------------
@@ -25,49 +38,132 @@ void Application::Init()
 	Random::seed = fastrand();
 	std::cout << "Random seed set to " << Random::seed << std::endl;
 
-	accumulator = new float4[SCRWIDTH * SCRHEIGHT];
-	for ( int x = 0; x < SCRWIDTH * SCRHEIGHT; x++ )
-		accumulator[x] = float4( 0, 0, 0, 0 );
-
-	cocMap = new float[SCRWIDTH * SCRHEIGHT];
-
 	//
 	// Import lens system and calculate Seidel coefficients
 	//
+	LoadLens( lensFileName );
+
+	//
+	// Read image from file
+	//
+	LoadImage( ImageIO::read_exr_beauty( imageFileName ) );
+
+	PrepareSampling();
+
+	int totalframes = 100;
+	float renderTime = Render( totalframes );
+	std::cout << "rendered " << totalSamplesTaken << " samples in " << renderTime << "s" << std::endl;
+
+	std::cout << "starting copying to buffer" << std::endl;
+
+	__m128 gamma = _mm_set1_ps( 0.454545f );
+	float multiplier = 1.0f/GetFrameCount();
+	std::vector<float> img(SCRHEIGHT*SCRWIDTH*4);
+
+	for ( int y = 0; y < SCRHEIGHT; y++ )
+	{
+		for ( int x = 0; x < SCRWIDTH; x++ )
+		{
+			float4 pixel = accumulator[y * SCRWIDTH + x] * exposure * multiplier;
+			img[((y * SCRWIDTH + x)*4)] = pixel.r;
+			img[((y * SCRWIDTH + x)*4)+1] = pixel.g;
+			img[((y * SCRWIDTH + x)*4)+2] = pixel.b;
+			img[((y * SCRWIDTH + x)*4)+3] = pixel.a;
+		}
+	}
+
+	ImageIO::save_to_exr(img, outputFileName, SCRWIDTH, SCRHEIGHT);
+	std::cout << "img saved" << std::endl;
+}
 
+// -----------------------------------------------------------
+// Import the lens system and calculate the Seidel coefficients
+// -----------------------------------------------------------
+void Application::LoadLens( const char* fileName )
+{
 	ls = LensSystem();
 	ls.FOCUS = focus;
-	ls.ImportFile( lensFileName );
+	ls.ImportFile( fileName );
 
 #ifdef USE_APERTURE_SPRITE
 
 	//
-	// Read aperture sprite from file
-	//
-	HelperFunctions::readImage( ls.apertureSprite, "assets/bokeh_sprite_polar_256.png", 256, 256 );
-
+	// Read aperture sprite from file, a polar sprite, or six blades without one
 	//
-	// normalize aperture sprite
-	//
-	float totalSprite = 0.0f;
-	for ( int i = 0; i < 65536; i++ )
-		totalSprite += ls.apertureSprite[i] / 256.0f;
-	ls.spriteMultiplier = 65536.0f / totalSprite;
+	if ( !ls.apertureShape.LoadSprite( "assets/bokeh_sprite_polar_256.exr" ) )
+	{
+		std::cout << "WARNING: no aperture sprite, using six blades" << std::endl;
+		ls.apertureShape.SetBlades( 6 );
+	}
 
 #endif
-	 
+
+	dof.meanLensData = ls.GetLensData( 0.550f, focus );
+
 	//
-	// Read image from file
+	// Set some values
 	//
-	const float* input_exr = ImageIO::read_exr_beauty(imageFileName);
-	inputImage = new float4[SCRWIDTH * SCRHEIGHT];
-	
+	aperture = APERTURE;
+	exposure = EXPOSURE;
+}
+
+// -----------------------------------------------------------
+// Change focus, aperture or zoom of the loaded lens, these only
+// recalculate the parts of the lens data that depend on them
+// -----------------------------------------------------------
+void Application::SetFocus( float focus )
+{
+	this->focus = focus;
+	ls.SetFocus( focus );
+	dof.meanLensData = ls.GetLensData( 0.550f, focus );
+}
+
+void Application::SetAperture( float aperture )
+{
+	this->aperture = clamp( aperture, 0.0f, 1.0f );
+	ls.SetAperture( this->aperture );
+	dof.meanLensData = ls.GetLensData( 0.550f, focus );
+}
+
+void Application::PrecalculateRange( float minAperture, float maxAperture, float nearFocus, float farFocus )
+{
+	ls.PrecalculateRange( clamp( minAperture, 0.0f, 1.0f ), clamp( maxAperture, 0.0f, 1.0f ), LENS_RANGE_APERTURES, nearFocus, farFocus, LENS_RANGE_FOCUS );
+	dof.meanLensData = ls.GetLensData( 0.550f, focus );
+}
+
+void Application::SetZoom( float zoom )
+{
+	ls.SetZoom( zoom );
+	dof.meanLensData = ls.GetLensData( 0.550f, focus );
+}
+
+void Application::PrecalculateZoom()
+{
+	ls.PrecalculateZoom( LENS_ZOOM_POSITIONS );
+	dof.meanLensData = ls.GetLensData( 0.550f, focus );
+}
+
+// -----------------------------------------------------------
+// Convert an RGBA + depth (in the alpha channel) image to the input buffer
+// -----------------------------------------------------------
+void Application::LoadImage( const float* rgbaImage )
+{
+	// allocated by the first image, later ones reuse the buffers
+	if ( !accumulator ) accumulator = new float4[SCRWIDTH * SCRHEIGHT];
+	if ( !luminanceSquares ) luminanceSquares = new float[SCRWIDTH * SCRHEIGHT];
+	ClearAccumulator();
+
+	if ( !cocMap ) cocMap = new float[SCRWIDTH * SCRHEIGHT];
+	memset( cocMap, 0, SCRWIDTH * SCRHEIGHT * sizeof( float ) );
+
+	if ( !inputImage ) inputImage = new float4[SCRWIDTH * SCRHEIGHT];
+
 	// ZENO: need to convert to float4 format
 	for (int i=0; i<SCRWIDTH*SCRHEIGHT; i++) {
-		inputImage[i].r = input_exr[(i*4)];
-		inputImage[i].g = input_exr[(i*4)+1];
-		inputImage[i].b = input_exr[(i*4)+2];
-		inputImage[i].a = input_exr[(i*4)+3];
+		inputImage[i].r = rgbaImage[(i*4)];
+		inputImage[i].g = rgbaImage[(i*4)+1];
+		inputImage[i].b = rgbaImage[(i*4)+2];
+		inputImage[i].a = rgbaImage[(i*4)+3];
 	}
 
 	// clamp values between 0 and 1000000 in order to prevent float overflow
@@ -80,24 +176,25 @@ void Application::Init()
 			inputImage[y * SCRWIDTH + x].b = clamp( inputImage[y * SCRWIDTH + x].b, 0.0f, 1000000.0f );
 		}
 	}
+}
 
-	dof.meanLensData = ls.GetLensData( 0.550f, focus );
-
-	//
-	// Set some values
-	//
-	aperture = APERTURE;
-	exposure = EXPOSURE;
-
+// -----------------------------------------------------------
+// Calculate the number of samples every pixel receives
+// -----------------------------------------------------------
+void Application::PrepareSampling()
+{
 	//
 	// Fill cocMap
 	//
 #ifdef SMART_SAMPLING
+	PrepareDOF(); // Apply needs the lens setup of the current lens state
 	for ( int x = 0; x < SCRWIDTH; x++ )
 	{
 		for ( int y = 0; y < SCRHEIGHT; y++ )
 		{
-			dof.Apply( inputImage, accumulator, cocMap, x, y, &ls, 1.0f, true );
+			Sampler sampler( dof.sampler, y * SCRWIDTH + x, 0, 0, 1 );
+			SplatTarget target( accumulator );
+			dof.Apply( dof.SetupPixel( inputImage, x, y, &ls ), &target, cocMap, x, y, &ls, 1.0f, true, &sampler );
 		}
 	}
 #endif
@@ -108,6 +205,7 @@ void Application::Init()
 
 	float maxContribution = 0.0f;
 	float totalContribution = 0.0f;
+	double totalLuminance = 0.0;
 	for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
 	{
 		float4 pixel = inputImage[n];
@@ -116,64 +214,437 @@ void Application::Init()
 		contributions[n] = std::max( 400.0f, cocMap[n] ) * luminance;
 		maxContribution = std::max( maxContribution, contributions[n] );
 		totalContribution += contributions[n];
+		totalLuminance += luminance;
 	}
-	contributionPerSample = totalContribution / samplesPerFrame;
+	// samplesPerFrame counts wavelengths, with hero wavelengths a pupil sample takes several of them
+	int wavelengths = WavelengthsPerSample();
+	contributionPerSample = totalContribution * wavelengths / samplesPerFrame;
+	luminanceFloor = 0.05f * (float)( totalLuminance / ( SCRWIDTH * SCRHEIGHT ) );
 
+	//
+	// Split the pixels, tile by tile, in work units of about equal cost: the expected number of wavelength samples plus
+	// one for the setup of the pixel. The units don't depend on the number of threads, and neither does the result.
+	//
+	pixelOrder.clear();
+	for ( int tile = 0; tile < SPLAT_TILES; tile++ )
+	{
+		int x0 = ( tile % SPLAT_TILES_X ) * SPLAT_TILE;
+		int y0 = ( tile / SPLAT_TILES_X ) * SPLAT_TILE;
+		for ( int y = y0; y < std::min( y0 + SPLAT_TILE, SCRHEIGHT ); y++ )
+			for ( int x = x0; x < std::min( x0 + SPLAT_TILE, SCRWIDTH ); x++ )
+				pixelOrder.push_back( y * SCRWIDTH + x );
+	}
 
+	double totalCost = 0;
+	for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
+		totalCost += contributions[n] / contributionPerSample * wavelengths + 1.0f;
+	double unitTarget = totalCost / SPLAT_UNITS;
 
+	unitStart.assign( 1, 0 );
+	unitCost.clear();
+	double cost = 0;
+	for ( int i = 0; i < (int)pixelOrder.size(); i++ )
+	{
+		cost += contributions[pixelOrder[i]] / contributionPerSample * wavelengths + 1.0f;
+		if ( cost >= unitTarget || i == (int)pixelOrder.size() - 1 )
+		{
+			unitStart.push_back( i + 1 );
+			unitCost.push_back( (float)cost );
+			cost = 0;
+		}
+	}
+	unitReach.clear(); // the units changed
+}
 
-int totalframes = 100;
-#pragma omp parallel for
-for (int framecount=0; framecount<totalframes; framecount++) {
-	
-	bool clearAccumulator = false;
-	bool recalculateLens = false;
+// -----------------------------------------------------------
+// heroWavelengths, rounded down to a divisor of SIMD_WIDTH (a
+// power of two), so a batch of DOF::ApplyBatch holds whole pupil
+// samples; at least 1
+// -----------------------------------------------------------
+int Application::WavelengthsPerSample() const
+{
+#ifdef ENABLE_CHROMATICS
+	int wavelengths = 1;
+	while ( wavelengths * 2 <= std::min( heroWavelengths, SIMD_WIDTH ) ) wavelengths *= 2;
+	return wavelengths;
+#else
+	return 1;
+#endif
+}
 
+void Application::ClearAccumulator()
+{
+	for ( int x = 0; x < SCRWIDTH * SCRHEIGHT; x++ )
+		accumulator[x] = float4( 0, 0, 0, 0 );
+	memset( luminanceSquares, 0, SCRWIDTH * SCRHEIGHT * sizeof( float ) );
+	tileFrames.assign( SPLAT_TILES, 0 );
+	tileConverged.assign( SPLAT_TILES, 0 );
+	tileError.assign( SPLAT_TILES, 1E30f );
+	unitReach.clear();
+	totalSamplesTaken = 0;
+	framecount = 0;
+}
+
+int Application::ConvergedTiles() const
+{
+	return (int)std::count( tileConverged.begin(), tileConverged.end(), 1 );
+}
+
+// -----------------------------------------------------------
+// Render a number of frames into the accumulator and return the time it took in seconds.
+// Random numbers come from counter-based streams keyed by pixel, frame and sample, so the
+// samples are the same no matter which thread takes which frame. In adaptive mode this
+// stops early when every tile has converged, GetFrameCount tells how many frames the
+// accumulator holds.
+// -----------------------------------------------------------
+float Application::Render( int totalframes )
+{
+	Timer timer;
+
+	PrepareDOF();
+
+	int framesRendered = totalframes;
+	int samplesTaken = psfConvolution ? RenderConvolved( totalframes )
+					   : binnedSplat || adaptive ? RenderBinned( totalframes, &framesRendered )
+												 : RenderDirect( totalframes );
+
+	totalSamplesTaken += samplesTaken;
+	framecount += framesRendered;
+
+	return timer.elapsed();
+}
+
+// -----------------------------------------------------------
+// Hand the sampling settings to the DOF and let it prepare for
+// the current lens state, before anything calls Apply
+// -----------------------------------------------------------
+void Application::PrepareDOF()
+{
 	aperture = clamp( aperture, 0.0f, 1.0f );
-	
-	for ( int y = 0; y < SCRHEIGHT; y++ )
+	dof.sampler = sampler;
+	dof.heroWavelengths = WavelengthsPerSample();
+	dof.unvignettedSampling = unvignettedSampling;
+	dof.Prepare( &ls );
+}
+
+// -----------------------------------------------------------
+// Take all samples of one pixel, returns the number of samples.
+// The rate scales the number of samples PrepareSampling decided.
+// -----------------------------------------------------------
+int Application::RenderPixel( int x, int y, int framecount, SplatTarget* target, float rate )
+{
+	int pixel = y * SCRWIDTH + x;
+
+	// the stochastic rounding uses a stream index no sample can have
+	RandomStream rounding( pixel, framecount, 0xFFFFFFFF );
+
+	float _samples = contributions[pixel] / contributionPerSample * rate;
+	int samples = (int)_samples; // base number of samples, floor
+	if ( _samples - samples > rounding.rnd() ) samples++;
+	if ( samples == 0 ) return 0;
+	float multiplier = 1.0f / samples * ( 1.0f / ( std::min( 1.0f, _samples ) ) );
+
+	// what the samples share is done once per pixel
+	PixelSetup setup = dof.SetupPixel( inputImage, x, y, &ls );
+
+#if ( defined UseSeidel || defined UseSSRT || defined UsePolynomial || defined UseRayTable ) && defined ENABLE_SIMD
+	dof.ApplyBatch( setup, target, x, y, &ls, multiplier, framecount, samples );
+#else
+	for ( int sample = 0; sample < samples; sample++ )
 	{
-		for ( int x = 0; x < SCRWIDTH; x++ )
+		Sampler sampler( dof.sampler, pixel, framecount, sample, samples );
+		dof.Apply( setup, target, cocMap, x, y, &ls, multiplier, false, &sampler );
+	}
+#endif
+	return samples;
+}
+
+// -----------------------------------------------------------
+// Direct scatter: every thread splats into its own private fixed
+// point accumulator, so the sample loop shares no writable memory
+// between threads, and the rows of all frames are handed out one
+// at a time, so every thread has work even for a single frame.
+// Integer sums don't depend on the order of the additions, so
+// the private accumulators, merged with a parallel loop over the
+// pixels afterwards, give the same result for any thread count
+// and any schedule.
+// -----------------------------------------------------------
+int Application::RenderDirect( int totalframes )
+{
+	std::vector<FixedPixel*> threadAccumulators;
+	int samplesTaken = 0;
+
+#pragma omp parallel reduction( + : samplesTaken )
+	{
+#pragma omp single
+		threadAccumulators.resize( omp_get_num_threads() );
+
+		// allocated and cleared by the thread that uses it, so the pages end up on its own NUMA node
+		FixedPixel* threadAccumulator = (FixedPixel*)MALLOC64( SCRWIDTH * SCRHEIGHT * sizeof( FixedPixel ) );
+		memset( threadAccumulator, 0, SCRWIDTH * SCRHEIGHT * sizeof( FixedPixel ) );
+		threadAccumulators[omp_get_thread_num()] = threadAccumulator;
+		SplatTarget target( threadAccumulator );
+
+#pragma omp for schedule( dynamic, 1 )
+		for ( int row = 0; row < totalframes * SCRHEIGHT; row++ )
 		{
+			int framecount = this->framecount + row / SCRHEIGHT;
+			int y = row % SCRHEIGHT;
+			for ( int x = 0; x < SCRWIDTH; x++ )
+				samplesTaken += RenderPixel( x, y, framecount, &target );
+		}
 
-				float _samples = contributions[y * SCRWIDTH + x] / contributionPerSample;
-				int samples = (int)_samples; // base number of samples, floor
-				if ( _samples - samples > Random::rnd() ) samples++;
-				float multiplier = 1.0f / samples * ( 1.0f / ( std::min( 1.0f, _samples ) ) );
+		//
+		// Merge the private accumulators, the implicit barrier of the loop above guarantees all of them are complete
+		//
+		int numThreads = (int)threadAccumulators.size();
 
-				for ( int sample = 0; sample < samples; sample++ )
-					dof.Apply( inputImage, accumulator, cocMap, x, y, &ls, multiplier, false );
-				totalSamplesTaken += samples;
+#pragma omp for schedule( static )
+		for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
+		{
+			FixedPixel sum = {};
+			for ( int thread = 0; thread < numThreads; thread++ )
+			{
+				const FixedPixel& pixel = threadAccumulators[thread][n];
+				sum.r += pixel.r, sum.g += pixel.g, sum.b += pixel.b, sum.a += pixel.a;
 			}
+			accumulator[n] += float4( (float)sum.r, (float)sum.g, (float)sum.b, (float)sum.a ) * ( 1.0f / SPLAT_FIXED_SCALE );
 		}
 
+		FREE64( threadAccumulator );
+	}
+
+	return samplesTaken;
 }
-	
 
-	std::cout << "starting copying to buffer" << std::endl;
+// -----------------------------------------------------------
+// Convolution: the expected image of a frame, without samples,
+// which every frame of the scatter renderers is an estimate of.
+// The PSFs are sampled again when the lens, the focus or the
+// range of distances of the scene change, and the samples that
+// takes are the ones returned; a render that reuses them takes
+// none. Both take about fixed times; the image is about 12%
+// off the scattered one, which a scatter render takes half as
+// long again to match, see PSFConvolution. Adaptive sampling
+// does not apply: the image has no noise, and all frames are
+// rendered at once.
+// -----------------------------------------------------------
+int Application::RenderConvolved( int totalframes )
+{
+	if ( !convolution ) convolution = new PSFConvolution();
+	int samplesTaken = 0;
+	if ( !convolution->Fits( &dof, &ls, inputImage ) )
+	{
+		convolution->Prepare( &dof, &ls, inputImage );
+		samplesTaken = convolution->samplesTaken;
+	}
 
-	__m128 gamma = _mm_set1_ps( 0.454545f );
-	float multiplier = 1.0f/totalframes;
-	std::vector<float> img(SCRHEIGHT*SCRWIDTH*4);
+	std::vector<float4> image( SCRWIDTH * SCRHEIGHT );
+	convolution->Render( inputImage, image.data() );
+	for ( int n = 0; n < SCRWIDTH * SCRHEIGHT; n++ )
+		accumulator[n] += image[n] * (float)totalframes;
+	return samplesTaken;
+}
 
-	for ( int y = 0; y < SCRHEIGHT; y++ )
+// -----------------------------------------------------------
+// Binned splatting, frame by frame: the samples of every work
+// unit are collected and sorted by destination tile (SplatBins),
+// then every destination tile is summed in a small buffer that
+// stays in L1, instead of scattering over the whole accumulator.
+// The samples per pixel are very uneven, so the units are cut by
+// estimated cost (PrepareSampling) and handed out by the work
+// stealing TaskScheduler. The result is the same for any number
+// of threads, the time every thread spent in the units is kept
+// in the scheduler statistics.
+//
+// Resolve also sums the squared luminance of every frame, which
+// gives the variance of every pixel. A tile whose relative error
+// drops below noiseThreshold is converged. In adaptive mode
+// nothing is added to it anymore, the units that seem to reach
+// only converged tiles drop to minAdaptiveRate, and the units
+// that reach noisy tiles take more samples (UpdateActiveUnits).
+// A frame is an unbiased estimate for any rate above 0, so the
+// open tiles still get all the light. Deciding when a tile
+// stops from its own samples is not unbiased however: a tile
+// that happens to come out bright converges a little sooner.
+// -----------------------------------------------------------
+int Application::RenderBinned( int totalframes, int* framesRendered )
+{
+	if ( !bins ) bins = new SplatBins();
+	int units = (int)unitCost.size();
+	bins->Resize( units );
+	scheduler.Init( unitCost, omp_get_max_threads() );
+	if ( unitReach.size() != (size_t)units * SPLAT_TILES ) unitReach.assign( (size_t)units * SPLAT_TILES, 0 );
+	unitRate.assign( units, 1.0f );
+	if ( adaptive ) UpdateActiveUnits();
+	int samplesTaken = 0;
+
+	int frame = 0;
+	for ( ; frame < totalframes; frame++ )
 	{
-		for ( int x = 0; x < SCRWIDTH; x++ )
+		if ( adaptive && ConvergedTiles() == SPLAT_TILES ) break;
+
+		int framecount = this->framecount + frame;
+		scheduler.Restart();
+
+#pragma omp parallel reduction( + : samplesTaken )
 		{
-			float4 pixel = accumulator[y * SCRWIDTH + x] * exposure * multiplier;
-			img[((y * SCRWIDTH + x)*4)] = pixel.r;
-			img[((y * SCRWIDTH + x)*4)+1] = pixel.g;
-			img[((y * SCRWIDTH + x)*4)+2] = pixel.b;
-			img[((y * SCRWIDTH + x)*4)+3] = pixel.a;			
+			int thread = omp_get_thread_num();
+			std::vector<SplatRecord> records;
+			SplatTarget target( &records );
+
+			auto renderUnit = [&]( int unit ) {
+				Timer timer;
+				for ( int i = unitStart[unit]; i < unitStart[unit + 1]; i++ )
+					samplesTaken += RenderPixel( pixelOrder[i] % SCRWIDTH, pixelOrder[i] / SCRWIDTH, framecount, &target, unitRate[unit] );
+				bins->Bin( unit, records );
+				scheduler.stats[thread].busy += timer.elapsed();
+			};
+
+			if ( workStealing )
+			{
+				int unit;
+				while ( scheduler.Next( thread, &unit ) )
+					renderUnit( unit );
+			}
+			else
+			{
+#pragma omp for schedule( dynamic, 1 ) nowait
+				for ( int unit = 0; unit < units; unit++ )
+				{
+					renderUnit( unit );
+					scheduler.stats[thread].tasks++;
+				}
+			}
+
+			// all units have to be binned before resolving
+#pragma omp barrier
+#pragma omp for schedule( dynamic, 1 )
+			for ( int tile = 0; tile < SPLAT_TILES; tile++ )
+			{
+				if ( adaptive && tileConverged[tile] ) continue;
+				bins->Resolve( tile, accumulator, luminanceSquares );
+				tileFrames[tile]++;
+				tileError[tile] = TileError( tile );
+				if ( tileFrames[tile] >= minAdaptiveFrames && tileError[tile] < noiseThreshold ) tileConverged[tile] = 1;
+			}
 		}
+
+		if ( adaptive ) UpdateActiveUnits();
 	}
 
-	ImageIO::save_to_exr(img, outputFileName, SCRWIDTH, SCRHEIGHT);
-	std::cout << "img saved" << std::endl;
+	*framesRendered = frame;
+	if ( adaptive ) NormalizeConvergedTiles( this->framecount + frame );
+	return samplesTaken;
 }
 
+// -----------------------------------------------------------
+// Relative standard error of the mean luminance of a tile: the
+// RMS over its pixels of the standard error of their mean,
+// divided by the mean (plus a small floor for black tiles)
+// -----------------------------------------------------------
+float Application::TileError( int tile ) const
+{
+	int n = tileFrames[tile];
+	if ( n < 2 ) return 1E30f;
+
+	int x0 = ( tile % SPLAT_TILES_X ) * SPLAT_TILE;
+	int y0 = ( tile / SPLAT_TILES_X ) * SPLAT_TILE;
+	float variance = 0.0f, mean = 0.0f;
+	int pixels = 0;
+	for ( int y = y0; y < std::min( y0 + SPLAT_TILE, SCRHEIGHT ); y++ )
+		for ( int x = x0; x < std::min( x0 + SPLAT_TILE, SCRWIDTH ); x++ )
+		{
+			float pixelMean = HelperFunctions::Luminance( accumulator[y * SCRWIDTH + x].rgb ) / n;
+			variance += std::max( 0.0f, luminanceSquares[y * SCRWIDTH + x] / n - pixelMean * pixelMean ) / ( n - 1 );
+			mean += pixelMean;
+			pixels++;
+		}
+	return sqrtf( variance / pixels ) / ( mean / pixels + luminanceFloor );
+}
+
+// -----------------------------------------------------------
+// Adds the destination tiles the units rendered last frame
+// reached to unitReach, and sets the sampling rate of every unit
+// from the noisiest open tile it reaches: the error over the
+// threshold, between 1 and maxAdaptiveRate (1 for the first
+// minAdaptiveFrames frames). The open tiles are
+// grown by one tile to cover splats a unit hasn't made yet, so
+// the units next to an open tile keep sampling at rate 1, as do
+// units that never splatted anything. The rest drops to
+// minAdaptiveRate rather than stopping: the reach is only what
+// was seen so far, and a rare wide splat into an open tile is
+// weighted up by the lower rate instead of lost.
+// -----------------------------------------------------------
+void Application::UpdateActiveUnits()
+{
+	std::vector<char> open( SPLAT_TILES, 0 );
+	for ( int tile = 0; tile < SPLAT_TILES; tile++ )
+	{
+		if ( tileConverged[tile] ) continue;
+		int tx = tile % SPLAT_TILES_X, ty = tile / SPLAT_TILES_X;
+		for ( int y = std::max( 0, ty - 1 ); y <= std::min( SPLAT_TILES_Y - 1, ty + 1 ); y++ )
+			for ( int x = std::max( 0, tx - 1 ); x <= std::min( SPLAT_TILES_X - 1, tx + 1 ); x++ )
+				open[y * SPLAT_TILES_X + x] = 1;
+	}
+
+	int units = (int)unitRate.size();
+#pragma omp parallel for schedule( static )
+	for ( int unit = 0; unit < units; unit++ )
+	{
+		char* reach = &unitReach[(size_t)unit * SPLAT_TILES];
+		for ( int tile = 0; tile < SPLAT_TILES; tile++ )
+			reach[tile] |= bins->Reaches( unit, tile );
+
+		bool reachesAny = false, reachesOpen = false;
+		float error = 0.0f;
+		for ( int tile = 0; tile < SPLAT_TILES; tile++ )
+		{
+			if ( !reach[tile] ) continue;
+			reachesAny = true;
+			reachesOpen |= open[tile] != 0;
+			if ( !tileConverged[tile] && tileFrames[tile] >= minAdaptiveFrames ) error = std::max( error, tileError[tile] );
+		}
+
+		if ( !reachesAny )
+			unitRate[unit] = 1.0f;
+		else if ( reachesOpen )
+			unitRate[unit] = clamp( error / noiseThreshold, 1.0f, maxAdaptiveRate );
+		else
+			unitRate[unit] = minAdaptiveRate;
+	}
+}
+
+// -----------------------------------------------------------
+// Scales the converged tiles up as if they had taken as many
+// frames as the others, so the whole accumulator can be divided
+// by GetFrameCount
+// -----------------------------------------------------------
+void Application::NormalizeConvergedTiles( int frames )
+{
+	for ( int tile = 0; tile < SPLAT_TILES; tile++ )
+	{
+		if ( tileFrames[tile] == frames || tileFrames[tile] == 0 ) continue;
+		float scale = (float)frames / tileFrames[tile];
+		int x0 = ( tile % SPLAT_TILES_X ) * SPLAT_TILE;
+		int y0 = ( tile / SPLAT_TILES_X ) * SPLAT_TILE;
+		for ( int y = y0; y < std::min( y0 + SPLAT_TILE, SCRHEIGHT ); y++ )
+			for ( int x = x0; x < std::min( x0 + SPLAT_TILE, SCRWIDTH ); x++ )
+			{
+				accumulator[y * SCRWIDTH + x] *= scale;
+				luminanceSquares[y * SCRWIDTH + x] *= scale;
+			}
+		tileFrames[tile] = frames;
+	}
+}
+
+int main( int argc, char** argv )
+{
+	if ( argc > 1 && strcmp( argv[1], "--benchmark" ) == 0 )
+	{
+		return Benchmark::Run( argc > 2 ? argv[2] : "all" ) > 0 ? 1 : 0;
+	}
 
-int main () {
 	Application app;
 	app.Init();
-}
\ No newline at end of file
+}
@@ -5,31 +5,88 @@ namespace PrimeFocusCPU
 	class Application
 	{
 	public:
+		Application() = default;
+		Application( const Application& ) = delete; // owns its buffers, freed by the destructor
+		Application& operator=( const Application& ) = delete;
+		~Application();
 		void Init();
 
+		void LoadLens( const char* fileName );
+		void LoadImage( const float* rgbaImage );
+		void SetFocus( float focus );
+		void SetAperture( float aperture );
+		void PrecalculateRange( float minAperture, float maxAperture, float nearFocus, float farFocus ); // makes SetFocus and SetAperture within these a lookup
+		void SetZoom( float zoom ); // from the first (0) to the last (1) configuration of a zoom lens file
+		void PrecalculateZoom();	// makes SetZoom a lookup for the current aperture
+		void PrepareSampling();
+		void ClearAccumulator();
+		float Render( int totalframes );
+		const float4* GetAccumulator() const { return accumulator; }
+		const std::vector<ThreadStats>& GetThreadStats() const { return scheduler.stats; } // of the last binned Render
+		int GetFrameCount() const { return framecount; } // frames in the accumulator
+		const PSFConvolution* GetConvolution() const { return convolution; } // of the last convolved Render
+		int ConvergedTiles() const;						 // tiles below noiseThreshold, kept by the binned renderer
+
+		int samplesPerFrame = 1;
+		SamplerType sampler = SAMPLER_SOBOL; // pupil, pixel area and wavelength sampling, see Sampler
+		int heroWavelengths = HERO_WAVELENGTHS; // wavelengths per pupil sample, rounded down to a divisor of SIMD_WIDTH, call PrepareSampling after changing it
+		bool binnedSplat = true;  // two phase splatting through SplatBins, see RenderBinned
+		bool workStealing = true; // RenderBinned hands out the work units through TaskScheduler, or else omp dynamic
+		bool adaptive = false;	  // stop sampling converged tiles, and stop rendering when all are, see RenderBinned
+		bool unvignettedSampling = false; // opt in on lenses that vignette strongly, see DOF::pupilRegions
+		bool psfConvolution = false; // render the expected image by convolving with low rank PSFs instead, see PSFConvolution; ignores adaptive
+
+		float noiseThreshold = 0.25f; // a tile is converged below this relative standard error, see TileError
+		int minAdaptiveFrames = 4;	  // frames every tile takes before it can be converged
+		float maxAdaptiveRate = 2.0f; // adaptive: the most samples a unit takes relative to PrepareSampling
+		float minAdaptiveRate = 0.1f; // adaptive: the rate of a unit that only reached converged tiles so far, above 0 so what it still sends to open tiles is kept
+		int totalSamplesTaken = 0;
+		float focus = 1.0f;
+
 	private:
-		float4* inputImage;
-		float4* accumulator;
+		void PrepareDOF();
+		int RenderPixel( int x, int y, int framecount, SplatTarget* target, float rate = 1.0f );
+		int RenderDirect( int totalframes );
+		int RenderBinned( int totalframes, int* framesRendered );
+		int RenderConvolved( int totalframes );
+		int WavelengthsPerSample() const;
+		float TileError( int tile ) const;
+		void UpdateActiveUnits();
+		void NormalizeConvergedTiles( int frames );
 
-		std::vector<int> randomizedPixelOrder;
-		float* cocMap;
+		float4* inputImage = nullptr;
+		float4* accumulator = nullptr;
+
+		std::vector<int> pixelOrder; // all pixels, tile by tile
+		std::vector<int> unitStart;	 // where every work unit starts in pixelOrder, one extra at the end
+		std::vector<float> unitCost; // estimated cost of every work unit
+		float* cocMap = nullptr;
 		float contributionPerSample;
 
+		// adaptive sampling
+		float* luminanceSquares = nullptr; // per pixel, the sum over frames of the squared luminance every frame added
+		std::vector<int> tileFrames;	// frames added to every destination tile, converged tiles stop counting
+		std::vector<char> tileConverged;
+		std::vector<float> tileError;	// TileError after the last frame
+		std::vector<char> unitReach;	// units x SPLAT_TILES, the destination tiles a unit has splatted into so far
+		std::vector<float> unitRate;	// samples relative to PrepareSampling, minAdaptiveRate for units that only reach converged tiles
+		float luminanceFloor = 0.0f;	// added to the tile mean in TileError, so black tiles converge
+
 		LensSystem ls;
 		DOF dof;
+		SplatBins* bins = nullptr; // allocated on first use
+		PSFConvolution* convolution = nullptr; // allocated on first use
+		TaskScheduler scheduler;
 
-		int samplesPerFrame = 1;
 		int frameCountSave = 1;
 		char* outputFileName = "image";
 		char* lensFileName = "";
-		int totalSamplesTaken = 0;
 
 		float exposure = 1.0f;
 		float aperture = 1.0f;
-		float focus = 1.0f;
 
 		int framecount = 0;
 		float contributions[SCRWIDTH * SCRHEIGHT];
 	};
 
-};
\ No newline at end of file
+};
@@ -1,15 +1,52 @@
 #define UseSeidel    // Seidel abberations
 // #define UseSSRT      // Screen Space Ray Tracing
+// #define UsePolynomial // Polynomials fitted to the Screen Space Ray Tracing, see PolynomialOptics
+// #define UseRayTable   // Screen Space Ray Tracing interpolated from a baked table of rays, see RayTable
 
 #define ENABLE_ABERRATIONS // Comment to set all Seidel coefficients to 0
 #define ENABLE_OPTICAL_VIGNETTING
 #define ENABLE_CHROMATICS
-//#define USE_APERTURE_SPRITE
+#define HERO_WAVELENGTHS 4 // Wavelengths per pupil sample with ENABLE_CHROMATICS, a divisor of SIMD_WIDTH, see DOF::HeroWavelength
+//#define USE_APERTURE_SPRITE // Draw the pupil samples from LensSystem::apertureShape, see ApertureShape
+#define ENABLE_LENS_CACHE // Keep precalculated lens data on disk, see LensSystem::LoadCache
+#define ENABLE_SIMD // Evaluate samples in SIMD batches (Seidel kernel or ray packets), see SIMD.h
+// #define LENS_TABLE_HALF // Store the lens data table of the SIMD batches in half precision, see LensDataTable
 
-#define LOOKUP_SIZE 64
+#define LOOKUP_SIZE 64 // wavelengths of the lensData table
+#define LENS_TABLE_NEAR 0.2f // nearest distance of the lensData table in m, it reaches to infinity in inverse distance
+#define LENS_TABLE_TOLERANCE 1E-2f // default interpolation error of the Seidel coefficients in the lensData table, see LensSystem::PrecalculateSeidel
+#define LENS_RANGE_APERTURES 16 // apertures and focus distances of Application::PrecalculateRange, see LensSystem::PrecalculateRange
+#define LENS_RANGE_FOCUS 32
+#define LENS_RANGE_TOLERANCE 0.25f // pixels of defocus blur that interpolating the focus in LensSystem::PrecalculateRange may add, cells beyond recalculate it
+#define LENS_ZOOM_POSITIONS 16 // zoom positions of Application::PrecalculateZoom, see LensSystem::PrecalculateZoom
+#define POLYNOMIAL_DEGREE 5 // highest total degree of the monomials of PolynomialOptics
+#define POLYNOMIAL_TERMS 40 // most terms per output of PolynomialOptics
+#define POLYNOMIAL_RAYS 16384 // rays PolynomialOptics is fitted to
+#define POLYNOMIAL_TOLERANCE 0.05f // the error in pixels on the sensor below which PolynomialOptics takes no more terms
+#define RAY_TABLE_FIELDS 32 // knots of RayTable over the field
+#define RAY_TABLE_PUPIL 12 // intervals of RayTable over the pupil radius, in px and py
+#define RAY_TABLE_WAVELENGTHS 6 // knots of RayTable over the wavelength and the square root of the inverse distance
+#define RAY_TABLE_DEPTHS 24
+#define RAY_TABLE_CACHE_FILES 24 // ray tables kept in the cache (11MB each), the least recently used ones are deleted beyond that; a scrub over the LENS_RANGE_APERTURES takes one per aperture
+#define PUPIL_REGION_BANDS 32 // angular bands of a PupilRegion, even
+#define PUPIL_REGION_FIELDS 32 // field and depth bins of PupilRegions
+#define PUPIL_REGION_DEPTHS 4
+#define PUPIL_REGION_MAX_FRACTION 0.9f // PupilRegions only samples from a region that covers less of the pupil, the rest costs more to sample than it saves
+#define PUPIL_REGION_UNIFORM 0.1f // share of the pupil samples PupilRegion::Sample draws from the whole pupil, which keeps them unbiased
+#define PSF_GRID_X 6 // source pixels PSFConvolution samples PSFs at, over the width and the height of the frame
+#define PSF_GRID_Y 4
+#define PSF_KNOTS 48 // depth knots of PSFConvolution, placed evenly in the spread of the PSFs
+#define PSF_MAX_RANK 8 // eigen PSFs per knot of PSFConvolution
+#define PSF_SAMPLE_BUDGET ( 1 << 23 ) // pupil samples PSFConvolution takes for the PSFs of all knots, half evenly, half by the squares they cover
+#define PSF_MAX_SUBPIXELS 2 // per pixel in x and y, PSFConvolution samples the PSFs at that and keeps as few as the tolerance allows
+#define PSF_MAX_RADIUS 256 // pixels from the source pixel, PSFConvolution loses the light that lands beyond
+#define PSF_TOLERANCE 0.02f // relative error of the PSFs of PSFConvolution in their subpixels and in their eigen PSFs
+#define PSF_MAX_TRANSFORM ( 1 << 22 ) // complex values of the FFTs of PSFConvolution, which splits what takes more
+#define APERTURE_SPRITE_SIZE 256 // pixels of an ApertureShape sprite in radius and angle
 #define SENSOR_SIZE 0.015f
 #define APERTURE 0.5f
 #define EXPOSURE 1.0f
+#define GLASS_CATALOG_DIR "assets/glasscat" // Zemax AGF catalogs named on the GCAT line of lens files, see GlassCatalog.h
 
 
 // Prevent expansion clashes (when using std::min and std::max):
@@ -21,6 +58,8 @@
 
 // C++ headers
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <fstream>
 #include <iostream>
@@ -29,8 +68,15 @@
 #include <string>
 #include <iterator>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <cstring>
+#include <filesystem>
+
+// OpenMP, used to parallelize rendering and precalculation
+#include <omp.h>
 
 
 // Header for AVX, and every technology before it.
@@ -44,12 +90,27 @@
 
 using namespace PrimeFocusCPU;
 
+#include "SIMD.h"
 #include "Random.h"
+#include "Sampler.h"
 #include "Glass.h"
+#include "MappedFile.h"
+#include "GlassCatalog.h"
 #include "CIE1931.h"
 #include "HelperFunctions.h"
+#include "ApertureShape.h"
+#include "LensProgram.h"
+#include "LensDataTable.h"
 #include "LensSystem.h"
+#include "PolynomialOptics.h"
+#include "RayTable.h"
+#include "PupilRegions.h"
+#include "SplatBins.h"
+#include "TaskScheduler.h"
 #include "DOF.h"
+#include "FFT.h"
+#include "PSFConvolution.h"
 #include "Seidel.h"
 #include "application.h"
+#include "Benchmark.h"
 #include "ImageIO.h"
\ No newline at end of file
@@ -47,6 +47,20 @@ inline float Rand( float range ) { return RandomFloat() * range; }
 
 namespace PrimeFocusCPU {
 
+// timer
+struct Timer
+{
+	Timer() { reset(); }
+	float elapsed() const
+	{
+		std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double> time_span = std::chrono::duration_cast<std::chrono::duration<double>>( t2 - start );
+		return (float)time_span.count();
+	}
+	void reset() { start = std::chrono::high_resolution_clock::now(); }
+	std::chrono::high_resolution_clock::time_point start;
+};
+
 
 // vectors
 class float2 // adapted from https://github.com/dcow/RayTracer